@@ -11,6 +11,19 @@
 #include <Athena/Tests/Inits/MathInits/Rotor.hpp>
 #include <Athena/Tests/Inits/MathInits/Random.hpp>
 #include <Athena/Tests/Inits/MathInits/Miscellaneous.hpp>
+#include <Athena/Tests/Inits/MathInits/SIMD.hpp>
+#include <Athena/Tests/Inits/MathInits/Wide.hpp>
+#include <Athena/Tests/Inits/MathInits/Transform.hpp>
+#include <Athena/Tests/Inits/MathInits/Affine.hpp>
+#include <Athena/Tests/Inits/MathInits/Approx.hpp>
+#include <Athena/Tests/Inits/MathInits/Blend.hpp>
+#include <Athena/Tests/Inits/MathInits/DualQuaternion.hpp>
+#include <Athena/Tests/Inits/MathInits/Geometry.hpp>
+#include <Athena/Tests/Inits/MathInits/Pack.hpp>
+#include <Athena/Tests/Inits/MathInits/Distribution.hpp>
+#include <Athena/Tests/Inits/MathInits/PoissonDisk.hpp>
+#include <Athena/Tests/Inits/MathInits/Noise.hpp>
+#include <Athena/Tests/Inits/MathInits/Curve.hpp>
 
 namespace MathTests {
 	void InitTests(std::vector<TestBlock>& _vBlockList) {
@@ -39,5 +52,44 @@ namespace MathTests {
 
 		//Math
 		//InitTests_Miscellaneous(_vBlockList);
+
+		//SIMD
+		InitTests_SIMD(_vBlockList);
+
+		//Wide
+		InitTests_Wide(_vBlockList);
+
+		//Transform
+		InitTests_Transform(_vBlockList);
+
+		//Affine
+		InitTests_Affine(_vBlockList);
+
+		//Approx
+		InitTests_Approx(_vBlockList);
+
+		//Blend
+		InitTests_Blend(_vBlockList);
+
+		//DualQuaternion
+		InitTests_DualQuaternion(_vBlockList);
+
+		//Geometry
+		InitTests_Geometry(_vBlockList);
+
+		//Pack
+		InitTests_Pack(_vBlockList);
+
+		//Distribution
+		InitTests_Distribution(_vBlockList);
+
+		//PoissonDisk
+		InitTests_PoissonDisk(_vBlockList);
+
+		//Noise
+		InitTests_Noise(_vBlockList);
+
+		//Curve
+		InitTests_Curve(_vBlockList);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <Athena/Tests/Inits/MathInits/Math_Common.hpp>
+
+namespace MathTests {
+	//Number of matrices timed per test. A single inverse is too short to compare the paths against each other.
+	constexpr int AFFINE_TEST_ITERATIONS = 4096;
+
+	//Relative tolerance between the specialised paths and the general ones they replace
+	constexpr float AFFINE_TOLERANCE = 1.0e-4f;
+
+	inline MatrixF AffineResultF(const MatrixF& _mMat) { return _mMat; }
+	inline MatrixF AffineResultF(const Affine3x4F& _aMat) { return ExtractMatrix(_aMat); }
+
+	//Scale stays in [0.5, 2] to keep every matrix well conditioned
+	inline Vec3F RandomAffineScaleF(Random& _rRand) { return Vec3F(0.5f) + Abs(RandomTestVec3F(_rRand)) * 1.5f; }
+
+	struct AffineTRS {
+		Vec3F m_vTranslation;
+		QuaternionF m_qRotation;
+		Vec3F m_vScale;
+	};
+
+	//The same transforms in both storage types, so conversion stays out of the timings
+	struct AffinePair {
+		MatrixF m_mLeft;
+		MatrixF m_mRight;
+		Affine3x4F m_aLeft;
+		Affine3x4F m_aRight;
+	};
+
+	inline std::vector<AffineTRS> GenerateAffineTRS(uint64_t _uSeed) {
+		return GenerateTestValues<AffineTRS>(AFFINE_TEST_ITERATIONS, _uSeed, [](Random& _rRand) { return AffineTRS{ RandomTestVec3F(_rRand) * 10.0f, RandomTestQuaternionF(_rRand), RandomAffineScaleF(_rRand) }; });
+	}
+
+	//Runs _fnFast and _fnGeneral over every input, prints the speedup of the specialised path over the general one and checks each
+	//result pair against AFFINE_TOLERANCE. _fDelta receives the specialised timing.
+	template<typename Input, typename FastFunc, typename GeneralFunc>
+	bool RunAffineComparison(const std::string& _strName, const std::vector<Input>& _vInputs, FastFunc _fnFast, GeneralFunc _fnGeneral, float& _fDelta) {
+		return RunBatchComparison(_strName, "general path", _vInputs, _fnFast, _fnGeneral, [](const auto& _tFast, const MatrixF& _mGeneral) { return TestCompareRelative(AffineResultF(_tFast), _mGeneral, AFFINE_TOLERANCE); }, _fDelta);
+	}
+
+	void InitTests_Affine(std::vector<TestBlock>& _vBlockList) {
+		TestBlock tbBlock = TestBlock("Math Library - Affine");
+
+		tbBlock.AddTest("InverseRigid", [](float& _fDelta) -> const bool {
+			Random rand(1);
+			std::vector<MatrixF> vInputs(AFFINE_TEST_ITERATIONS);
+
+			for (MatrixF& mMat : vInputs) {
+				mMat = RotationTranslationDegF(RandomTestVec3F(rand) * 180.0f, RandomTestVec3F(rand) * 10.0f);
+			}
+
+			return RunAffineComparison("InverseRigid", vInputs, [](const MatrixF& _mMat) { return InverseRigid(_mMat); }, [](const MatrixF& _mMat) { return Inverse(_mMat); }, _fDelta);
+		});
+
+		tbBlock.AddTest("InverseRigid LookAtLH", [](float& _fDelta) -> const bool {
+			MatrixF mView = LookAtLH(Vec3F(1.0f, 1.0f, 1.0f), Vec3F(0.0f, 0.0f, 0.0f), Vec3F(0.0f, 0.0f, 1.0f));
+			MatrixF mRes;
+
+			HC_TIME_EXECUTION(mRes = InverseRigid(mView), _fDelta);
+
+			return TestCompareRelative(mRes, Inverse(mView), AFFINE_TOLERANCE) && TestCompareRelative(mRes * mView, IdentityF(), AFFINE_TOLERANCE);
+		});
+
+		tbBlock.AddTest("InverseTRS", [](float& _fDelta) -> const bool {
+			std::vector<AffineTRS> vSource = GenerateAffineTRS(2);
+			std::vector<MatrixF> vInputs(vSource.size());
+
+			for (size_t sNdx = 0; sNdx < vSource.size(); ++sNdx) {
+				vInputs[sNdx] = ComposeTRS(vSource[sNdx].m_vTranslation, vSource[sNdx].m_qRotation, vSource[sNdx].m_vScale);
+			}
+
+			return RunAffineComparison("InverseTRS", vInputs, [](const MatrixF& _mMat) { return InverseTRS(_mMat); }, [](const MatrixF& _mMat) { return Inverse(_mMat); }, _fDelta);
+		});
+
+		tbBlock.AddTest("InverseTRS Zero Scale", [](float& _fDelta) -> const bool {
+			MatrixF mMat = ComposeTRS(Vec3F(1.0f, 2.0f, 3.0f), QuaternionF(), Vec3F(1.0f, 0.0f, 1.0f));
+			MatrixF mRes;
+
+			HC_TIME_EXECUTION(mRes = InverseTRS(mMat), _fDelta);
+
+			return TestCompareRelative(mRes, MatrixF(), AFFINE_TOLERANCE);
+		});
+
+		tbBlock.AddTest("InverseAffine", [](float& _fDelta) -> const bool {
+			Random rand(3);
+			std::vector<MatrixF> vInputs(AFFINE_TEST_ITERATIONS);
+
+			//Non uniform scale applied after the rotation leaves the rows skewed, which only the general affine path handles
+			for (MatrixF& mMat : vInputs) {
+				mMat = RotationTranslationScaleDegF(RandomTestVec3F(rand) * 180.0f, RandomTestVec3F(rand) * 10.0f, RandomAffineScaleF(rand));
+			}
+
+			return RunAffineComparison("InverseAffine", vInputs, [](const MatrixF& _mMat) { return InverseAffine(_mMat); }, [](const MatrixF& _mMat) { return Inverse(_mMat); }, _fDelta);
+		});
+
+		tbBlock.AddTest("ComposeTRS Quaternion", [](float& _fDelta) -> const bool {
+			return RunAffineComparison("ComposeTRS Quaternion", GenerateAffineTRS(4),
+				[](const AffineTRS& _trsVal) { return ComposeTRS(_trsVal.m_vTranslation, _trsVal.m_qRotation, _trsVal.m_vScale); },
+				[](const AffineTRS& _trsVal) { return ScaleXYZF(_trsVal.m_vScale) * ExtractMatrix(_trsVal.m_qRotation) * TranslationF(_trsVal.m_vTranslation); }, _fDelta);
+		});
+
+		tbBlock.AddTest("ComposeTRS Rotor", [](float& _fDelta) -> const bool {
+			std::vector<AffineTRS> vSource = GenerateAffineTRS(5);
+
+			return RunAffineComparison("ComposeTRS Rotor", vSource,
+				[](const AffineTRS& _trsVal) { return ComposeTRS(_trsVal.m_vTranslation, RotorF(_trsVal.m_qRotation.m_vQuat), _trsVal.m_vScale); },
+				[](const AffineTRS& _trsVal) { return ScaleXYZF(_trsVal.m_vScale) * ExtractMatrix(RotorF(_trsVal.m_qRotation.m_vQuat)) * TranslationF(_trsVal.m_vTranslation); }, _fDelta);
+		});
+
+		tbBlock.AddTest("RotationTranslationScaleDegF", [](float& _fDelta) -> const bool {
+			Vec3F vRotation(30.0f, -45.0f, 60.0f), vTranslation(1.5f, -2.0f, 3.25f), vScale(2.0f, 0.5f, 1.0f);
+			MatrixF mRes;
+
+			HC_TIME_EXECUTION(mRes = RotationTranslationScaleDegF(vRotation, vTranslation, vScale), _fDelta);
+
+			//Must keep matching the original product now that the scale is applied row by row
+			return TestCompareRelative(mRes, RotationTranslationDegF(vRotation, vTranslation) * ScaleXYZF(vScale), AFFINE_TOLERANCE);
+		});
+
+		tbBlock.AddTest("Affine3x4F Round Trip", [](float& _fDelta) -> const bool {
+			MatrixF mMat = RotationTranslationScaleDegF(Vec3F(30.0f, -45.0f, 60.0f), Vec3F(1.5f, -2.0f, 3.25f), Vec3F(2.0f, 0.5f, 1.0f));
+			Affine3x4F aMat;
+
+			HC_TIME_EXECUTION(aMat = Affine3x4F(mMat), _fDelta);
+
+			//Stored as the columns of the matrix, with the translation in W
+			return sizeof(Affine3x4F) == 48 && aMat[0] == Vec4F(mMat[0].x, mMat[1].x, mMat[2].x, mMat[3].x) &&
+				   TestCompareRelative(ExtractMatrix(aMat), mMat, AFFINE_TOLERANCE) && TestCompareRelative(ExtractMatrix(IdentityAffineF()), IdentityF(), AFFINE_TOLERANCE);
+		});
+
+		tbBlock.AddTest("Affine3x4F Multiply", [](float& _fDelta) -> const bool {
+			std::vector<AffineTRS> vLeft = GenerateAffineTRS(6);
+			std::vector<AffineTRS> vRight = GenerateAffineTRS(7);
+			std::vector<AffinePair> vInputs(vLeft.size());
+
+			for (size_t sNdx = 0; sNdx < vLeft.size(); ++sNdx) {
+				MatrixF mLeft = ComposeTRS(vLeft[sNdx].m_vTranslation, vLeft[sNdx].m_qRotation, vLeft[sNdx].m_vScale);
+				MatrixF mRight = ComposeTRS(vRight[sNdx].m_vTranslation, vRight[sNdx].m_qRotation, vRight[sNdx].m_vScale);
+				vInputs[sNdx] = { mLeft, mRight, Affine3x4F(mLeft), Affine3x4F(mRight) };
+			}
+
+			return RunAffineComparison("Affine3x4F Multiply", vInputs,
+				[](const AffinePair& _pIn) { return _pIn.m_aLeft * _pIn.m_aRight; },
+				[](const AffinePair& _pIn) { return _pIn.m_mLeft * _pIn.m_mRight; }, _fDelta);
+		});
+
+		tbBlock.AddTest("Affine3x4F Transform", [](float& _fDelta) -> const bool {
+			MatrixF mMat = RotationTranslationScaleDegF(Vec3F(30.0f, -45.0f, 60.0f), Vec3F(1.5f, -2.0f, 3.25f), Vec3F(2.0f, 0.5f, 1.0f));
+			Affine3x4F aMat = Affine3x4F(mMat);
+			Vec3F vPoint(-3.0f, 0.25f, 7.5f), vPointRes, vDirectionRes;
+
+			HC_TIME_EXECUTION(vPointRes = TransformPoint(aMat, vPoint); vDirectionRes = TransformDirection(aMat, vPoint), _fDelta);
+
+			return TestCompareRelative(vPointRes, TransformPoint(mMat, vPoint), AFFINE_TOLERANCE) &&
+				   TestCompareRelative(vDirectionRes, TransformDirection(mMat, vPoint), AFFINE_TOLERANCE);
+		});
+
+		tbBlock.AddTest("Affine3x4F Inverse", [](float& _fDelta) -> const bool {
+			Random rand(8);
+			std::vector<AffinePair> vInputs(AFFINE_TEST_ITERATIONS);
+
+			for (AffinePair& pPair : vInputs) {
+				pPair.m_mLeft = RotationTranslationScaleDegF(RandomTestVec3F(rand) * 180.0f, RandomTestVec3F(rand) * 10.0f, RandomAffineScaleF(rand));
+				pPair.m_aLeft = Affine3x4F(pPair.m_mLeft);
+			}
+
+			return RunAffineComparison("Affine3x4F Inverse", vInputs, [](const AffinePair& _pIn) { return Inverse(_pIn.m_aLeft); }, [](const AffinePair& _pIn) { return Inverse(_pIn.m_mLeft); }, _fDelta);
+		});
+
+		tbBlock.AddTest("Affine3x4F InverseRigid", [](float& _fDelta) -> const bool {
+			MatrixF mMat = RotationTranslationDegF(Vec3F(10.0f, 20.0f, -70.0f), Vec3F(4.0f, -1.0f, 0.5f));
+			Affine3x4F aRes;
+
+			HC_TIME_EXECUTION(aRes = InverseRigid(Affine3x4F(mMat)), _fDelta);
+
+			return TestCompareRelative(ExtractMatrix(aRes), Inverse(mMat), AFFINE_TOLERANCE);
+		});
+
+		_vBlockList.push_back(tbBlock);
+	}
+}
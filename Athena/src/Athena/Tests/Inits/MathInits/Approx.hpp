@@ -0,0 +1,161 @@
+#pragma once
+
+#include <Athena/Tests/Inits/MathInits/Math_Common.hpp>
+
+#include <bit>
+
+namespace MathTests {
+	//Number of samples per sweep, a multiple of four so every Vec4F is full
+	constexpr int APPROX_TEST_SAMPLES = 1 << 16;
+
+	//Evenly spaced samples over [_fMin, _fMax], visited in a scrambled order so neighbouring lanes are not correlated
+	inline std::vector<Vec4F> GenerateApproxSweepF(float _fMin, float _fMax, uint32_t _uStride = 1) {
+		std::vector<Vec4F> vRes(APPROX_TEST_SAMPLES / 4);
+
+		for (uint32_t uNdx = 0; uNdx < APPROX_TEST_SAMPLES; ++uNdx) {
+			const uint32_t uSample = (uNdx * _uStride) % APPROX_TEST_SAMPLES;
+			vRes[uNdx / 4][uNdx % 4] = _fMin + (_fMax - _fMin) * (static_cast<float>(uSample) / static_cast<float>(APPROX_TEST_SAMPLES - 1));
+		}
+
+		return vRes;
+	}
+
+	//Distance between two floats in units in the last place
+	inline uint32_t ApproxULPDistance(float _fLeft, float _fRight) {
+		int64_t iLeft = std::bit_cast<int32_t>(_fLeft);
+		int64_t iRight = std::bit_cast<int32_t>(_fRight);
+
+		//Map negative floats below positive ones so the integers order the same way as the floats
+		iLeft = iLeft < 0 ? INT32_MIN - iLeft : iLeft;
+		iRight = iRight < 0 ? INT32_MIN - iRight : iRight;
+
+		return static_cast<uint32_t>(std::min<int64_t>(std::abs(iLeft - iRight), UINT32_MAX));
+	}
+
+	/// <summary>
+	/// Times _fnFast against _fnFull over every input, prints the throughput ratio along with the largest absolute and ULP error
+	/// of the fast results, and checks the largest error against _fTolerance. _bRelative scales each error by the libm result.
+	/// _fDelta receives the fast timing.
+	/// </summary>
+	template<typename Input, typename FastFunc, typename FullFunc>
+	bool RunApproxComparison(const std::string& _strName, const std::vector<Input>& _vInputs, FastFunc _fnFast, FullFunc _fnFull, float _fTolerance, bool _bRelative, float& _fDelta) {
+		float fMaxError = 0.0f;
+		float fMaxAbsError = 0.0f;
+		uint32_t uMaxULP = 0;
+
+		//Every pair is measured rather than stopping at the first miss, so the report covers the whole sweep
+		RunBatchComparison(_strName, "libm", _vInputs, _fnFast, _fnFull, [&](const Vec4F& _vFast, const Vec4F& _vFull) {
+			for (int iLane = 0; iLane < 4; ++iLane) {
+				const float fAbsError = fabsf(_vFast[iLane] - _vFull[iLane]);
+
+				fMaxAbsError = fmaxf(fMaxAbsError, fAbsError);
+				fMaxError = fmaxf(fMaxError, _bRelative ? fAbsError / fmaxf(fabsf(_vFull[iLane]), FLT_MIN) : fAbsError);
+				uMaxULP = std::max(uMaxULP, ApproxULPDistance(_vFast[iLane], _vFull[iLane]));
+			}
+
+			return true;
+		}, _fDelta);
+
+		Console::Print("\t" + _strName + ": max abs error " + std::to_string(fMaxAbsError) + ", max ULP " + std::to_string(uMaxULP) + "\n", Console::YELLOW);
+
+		return fMaxError <= _fTolerance;
+	}
+
+	void InitTests_Approx(std::vector<TestBlock>& _vBlockList) {
+		TestBlock tbBlock = TestBlock("Math Library - Approx");
+
+		tbBlock.AddTest("Sin Vec4F", [](float& _fDelta) -> const bool {
+			return RunApproxComparison("Sin", GenerateApproxSweepF(-8.0f * HC_PI, 8.0f * HC_PI, 7919),
+				[](const Vec4F& _vVal) { return Math::Sin(_vVal, PRECISION_FAST); },
+				[](const Vec4F& _vVal) { return Math::Sin(_vVal, PRECISION_FULL); }, 1.0e-4f, false, _fDelta);
+		});
+
+		tbBlock.AddTest("Cos Vec4F", [](float& _fDelta) -> const bool {
+			return RunApproxComparison("Cos", GenerateApproxSweepF(-8.0f * HC_PI, 8.0f * HC_PI, 7919),
+				[](const Vec4F& _vVal) { return Math::Cos(_vVal, PRECISION_FAST); },
+				[](const Vec4F& _vVal) { return Math::Cos(_vVal, PRECISION_FULL); }, 1.0e-4f, false, _fDelta);
+		});
+
+		tbBlock.AddTest("Tan Vec4F", [](float& _fDelta) -> const bool {
+			return RunApproxComparison("Tan", GenerateApproxSweepF(-1.4f, 1.4f, 7919),
+				[](const Vec4F& _vVal) { return Math::Tan(_vVal, PRECISION_FAST); },
+				[](const Vec4F& _vVal) { return Math::Tan(_vVal, PRECISION_FULL); }, 1.0e-4f, true, _fDelta);
+		});
+
+		tbBlock.AddTest("Exp Vec4F", [](float& _fDelta) -> const bool {
+			return RunApproxComparison("Exp", GenerateApproxSweepF(-20.0f, 20.0f, 7919),
+				[](const Vec4F& _vVal) { return Math::Exp(_vVal, PRECISION_FAST); },
+				[](const Vec4F& _vVal) { return Math::Exp(_vVal, PRECISION_FULL); }, 1.0e-4f, true, _fDelta);
+		});
+
+		tbBlock.AddTest("Log2 Vec4F", [](float& _fDelta) -> const bool {
+			return RunApproxComparison("Log2", GenerateApproxSweepF(1.0e-3f, 1.0e3f, 7919),
+				[](const Vec4F& _vVal) { return Math::Log2(_vVal, PRECISION_FAST); },
+				[](const Vec4F& _vVal) { return Math::Log2(_vVal, PRECISION_FULL); }, 1.0e-4f, false, _fDelta);
+		});
+
+		tbBlock.AddTest("Pow Vec4F", [](float& _fDelta) -> const bool {
+			return RunApproxComparison("Pow", GenerateApproxSweepF(1.0e-2f, 1.0e2f, 7919),
+				[](const Vec4F& _vVal) { return Math::Pow(_vVal, 2.2f, PRECISION_FAST); },
+				[](const Vec4F& _vVal) { return Math::Pow(_vVal, 2.2f, PRECISION_FULL); }, 1.0e-4f, true, _fDelta);
+		});
+
+		tbBlock.AddTest("ArcTan2 Vec4F", [](float& _fDelta) -> const bool {
+			std::vector<Vec4F> vLeft = GenerateApproxSweepF(-10.0f, 10.0f, 7919);
+			std::vector<Vec4F> vRight = GenerateApproxSweepF(-10.0f, 10.0f, 104729);
+			std::vector<std::pair<Vec4F, Vec4F>> vInputs(vLeft.size());
+
+			for (size_t sNdx = 0; sNdx < vInputs.size(); ++sNdx) {
+				vInputs[sNdx] = { vLeft[sNdx], vRight[sNdx] };
+			}
+
+			return RunApproxComparison("ArcTan2", vInputs,
+				[](const std::pair<Vec4F, Vec4F>& _pVal) { return Math::ArcTan2(_pVal.first, _pVal.second, PRECISION_FAST); },
+				[](const std::pair<Vec4F, Vec4F>& _pVal) { return Math::ArcTan2(_pVal.first, _pVal.second, PRECISION_FULL); }, 1.0e-4f, false, _fDelta);
+		});
+
+		tbBlock.AddTest("RSqrt Vec4F", [](float& _fDelta) -> const bool {
+			return RunApproxComparison("RSqrt", GenerateApproxSweepF(1.0e-3f, 1.0e3f, 7919),
+				[](const Vec4F& _vVal) { return Math::RSqrt(_vVal, PRECISION_FAST); },
+				[](const Vec4F& _vVal) { return Math::RSqrt(_vVal, PRECISION_FULL); }, 1.0e-4f, true, _fDelta);
+		});
+
+		tbBlock.AddTest("Scalar Matches Vec4F", [](float& _fDelta) -> const bool {
+			const Vec4F vVal(-3.7f, 0.25f, 1.9f, 12.5f);
+			Vec4F vSin, vCos;
+
+			HC_TIME_EXECUTION(Math::SinCos(vVal, vSin, vCos, PRECISION_FAST), _fDelta);
+
+			for (int iLane = 0; iLane < 4; ++iLane) {
+				float fSin, fCos;
+				Math::SinCos(vVal[iLane], fSin, fCos, PRECISION_FAST);
+
+				if (fabsf(fSin - vSin[iLane]) > 1.0e-6f || fabsf(fCos - vCos[iLane]) > 1.0e-6f ||
+					fabsf(Math::Exp(vVal[iLane], PRECISION_FAST) - Math::Exp(vVal, PRECISION_FAST)[iLane]) > 1.0e-6f * expf(vVal[iLane])) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("Cos Vec3F", [](float& _fDelta) -> const bool {
+			Vec3F vRes;
+
+			HC_TIME_EXECUTION(vRes = Math::Cos(Vec3F(0.0f, HC_PI, HC_PI_HALF), PRECISION_FAST), _fDelta);
+
+			return fabsf(vRes.x - 1.0f) <= 1.0e-6f && fabsf(vRes.y + 1.0f) <= 1.0e-6f && fabsf(vRes.z) <= 1.0e-6f;
+		});
+
+		tbBlock.AddTest("Full Precision Is libm", [](float& _fDelta) -> const bool {
+			float fRes = 0.0f;
+
+			HC_TIME_EXECUTION(fRes = Math::Sin(0.7f, PRECISION_FULL), _fDelta);
+
+			return fRes == sinf(0.7f) && Math::Cos(0.7f, PRECISION_FULL) == cosf(0.7f) && Math::Exp(0.7f, PRECISION_FULL) == expf(0.7f) &&
+				Math::Pow(0.7f, 1.3f, PRECISION_FULL) == powf(0.7f, 1.3f) && Math::ArcTan2(0.7f, -0.2f, PRECISION_FULL) == atan2f(0.7f, -0.2f);
+		});
+
+		_vBlockList.push_back(tbBlock);
+	}
+}
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <Athena/Tests/Inits/MathInits/Math_Common.hpp>
+
+#include <HellfireControl/Math/Wide.hpp>
+
+namespace MathTests {
+	//Enough bones for a handful of characters, and not a multiple of four so the partial group is exercised
+	constexpr size_t BLEND_TEST_COUNT = 4099;
+	constexpr float BLEND_FULL_TOLERANCE = 2.0e-6f; //Radians from the double precision SLerp. The lane-wise acos and sin stay well inside it
+
+	//Double precision SLerp along the shorter arc, the reference every blend is measured against
+	inline QuaternionF ReferenceSLerpQuaternionF(const QuaternionF& _qStart, const QuaternionF& _qEnd, float _fRatio) {
+		double dDot = 0.0;
+		for (int iNdx = 0; iNdx < 4; ++iNdx) { dDot += static_cast<double>(_qStart[iNdx]) * static_cast<double>(_qEnd[iNdx]); }
+
+		const double dSign = dDot < 0.0 ? -1.0 : 1.0;
+		const double dTheta = acos(std::min(fabs(dDot), 1.0));
+		const double dSinTheta = sin(dTheta);
+		const double dFrom = dSinTheta > 1.0e-9 ? sin((1.0 - _fRatio) * dTheta) / dSinTheta : 1.0 - _fRatio;
+		const double dTo = (dSinTheta > 1.0e-9 ? sin(_fRatio * dTheta) / dSinTheta : _fRatio) * dSign;
+
+		QuaternionF qRes;
+		for (int iNdx = 0; iNdx < 4; ++iNdx) { qRes[iNdx] = static_cast<float>(dFrom * _qStart[iNdx] + dTo * _qEnd[iNdx]); }
+
+		return qRes;
+	}
+
+	//Angle between two unit quaternions, in radians of rotation. Measured from the chord, since acos of a dot product close to
+	//one cannot resolve anything below about 1e-3.
+	inline float BlendAngleError(const QuaternionF& _qLeft, const QuaternionF& _qRight) {
+		const float fChord = std::min(Length(_qLeft.m_vQuat - _qRight.m_vQuat), Length(_qLeft.m_vQuat + _qRight.m_vQuat));
+		return 4.0f * asinf(std::min(fChord * 0.5f, 1.0f));
+	}
+
+	//Largest angle between each blended rotation and the reference SLerp
+	inline float MaxBlendError(const std::vector<QuaternionF>& _vStart, const std::vector<QuaternionF>& _vEnd, const std::vector<QuaternionF>& _vRes, float _fRatio) {
+		float fMaxError = 0.0f;
+
+		for (size_t sNdx = 0; sNdx < _vStart.size(); ++sNdx) {
+			fMaxError = fmaxf(fMaxError, BlendAngleError(_vRes[sNdx], ReferenceSLerpQuaternionF(_vStart[sNdx], _vEnd[sNdx], _fRatio)));
+		}
+
+		return fMaxError;
+	}
+
+	//The one pair at a time SLerp the batch kernels replace: normalize, branch on the sign and on the nearly parallel case
+	inline QuaternionF ScalarSLerpQuaternionF(const QuaternionF& _qStart, const QuaternionF& _qEnd, float _fRatio) {
+		QuaternionF qEnd = _qEnd;
+		float fDot = Dot(_qStart.m_vQuat, _qEnd.m_vQuat);
+
+		if (fDot < 0.0f) {
+			fDot = -fDot;
+			qEnd = -qEnd;
+		}
+
+		if (fDot > HC_NEAR_ONE) { return Normalize((qEnd - _qStart) * _fRatio + _qStart); }
+
+		float fTheta = acosf(fDot);
+		float fFrom = sinf((1.0f - _fRatio) * fTheta) / sinf(fTheta);
+		float fTo = sinf(_fRatio * fTheta) / sinf(fTheta);
+
+		return (fFrom * _qStart) + (fTo * qEnd);
+	}
+
+	void InitTests_Blend(std::vector<TestBlock>& _vBlockList) {
+		TestBlock tbBlock = TestBlock("Math Library - Blend");
+
+		tbBlock.AddTest("NLerp QuaternionF Span", [](float& _fDelta) -> const bool {
+			std::vector<QuaternionF> vStart = GenerateTestQuaternionF(BLEND_TEST_COUNT, 1);
+			std::vector<QuaternionF> vEnd = GenerateTestQuaternionF(BLEND_TEST_COUNT, 2);
+			std::vector<QuaternionF> vRes(BLEND_TEST_COUNT);
+
+			HC_TIME_EXECUTION(Math::NLerp(vStart, vEnd, 0.35f, vRes), _fDelta);
+
+			for (size_t sNdx = 0; sNdx < BLEND_TEST_COUNT; ++sNdx) {
+				QuaternionF qEnd = Dot(vStart[sNdx].m_vQuat, vEnd[sNdx].m_vQuat) < 0.0f ? -vEnd[sNdx] : vEnd[sNdx];
+				QuaternionF qExpected = Normalize((qEnd - vStart[sNdx]) * 0.35f + vStart[sNdx]);
+
+				if (Length(vRes[sNdx].m_vQuat - qExpected.m_vQuat) > 1.0e-5f) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("SLerp QuaternionF Span", [](float& _fDelta) -> const bool {
+			std::vector<QuaternionF> vStart = GenerateTestQuaternionF(BLEND_TEST_COUNT, 3);
+			std::vector<QuaternionF> vEnd = GenerateTestQuaternionF(BLEND_TEST_COUNT, 4);
+			std::vector<QuaternionF> vRes(BLEND_TEST_COUNT);
+			std::vector<QuaternionF> vScalar(BLEND_TEST_COUNT);
+
+			RunBatchThenReference("SLerp", "scalar", [&]() { Math::SLerp(vStart, vEnd, 0.7f, vRes, PRECISION_FULL); },
+				[&]() { for (size_t sNdx = 0; sNdx < BLEND_TEST_COUNT; ++sNdx) vScalar[sNdx] = ScalarSLerpQuaternionF(vStart[sNdx], vEnd[sNdx], 0.7f); }, _fDelta);
+
+			const float fError = MaxBlendError(vStart, vEnd, vRes, 0.7f);
+
+			Console::Print("\tSLerp: max error " + std::to_string(fError) + " rad, scalar " + std::to_string(MaxBlendError(vStart, vEnd, vScalar, 0.7f)) + " rad\n", Console::YELLOW);
+
+			return fError <= BLEND_FULL_TOLERANCE;
+		});
+
+		tbBlock.AddTest("Approximate SLerp QuaternionF Span", [](float& _fDelta) -> const bool {
+			std::vector<QuaternionF> vStart = GenerateTestQuaternionF(BLEND_TEST_COUNT, 5);
+			std::vector<QuaternionF> vEnd = GenerateTestQuaternionF(BLEND_TEST_COUNT, 6);
+			std::vector<QuaternionF> vRes(BLEND_TEST_COUNT);
+			std::vector<QuaternionF> vScalar(BLEND_TEST_COUNT);
+			float fMaxError = 0.0f;
+
+			RunBatchThenReference("Approximate SLerp", "scalar", [&]() { Math::SLerp(vStart, vEnd, 0.3f, vRes, PRECISION_FAST); },
+				[&]() { for (size_t sNdx = 0; sNdx < BLEND_TEST_COUNT; ++sNdx) vScalar[sNdx] = ScalarSLerpQuaternionF(vStart[sNdx], vEnd[sNdx], 0.3f); }, _fDelta);
+
+			//Sweep the ratio too, the correction is weakest a quarter of the way along
+			for (float fRatio = 0.0f; fRatio <= 1.0f; fRatio += 0.125f) {
+				Math::SLerp(vStart, vEnd, fRatio, vRes, PRECISION_FAST);
+				fMaxError = fmaxf(fMaxError, MaxBlendError(vStart, vEnd, vRes, fRatio));
+			}
+
+			Console::Print("\tApproximate SLerp: max error " + std::to_string(fMaxError) + " rad\n", Console::YELLOW);
+
+			return fMaxError <= 1.0e-3f;
+		});
+
+		tbBlock.AddTest("SLerp Nearly Parallel And Opposite", [](float& _fDelta) -> const bool {
+			std::vector<QuaternionF> vStart = GenerateTestQuaternionF(8, 7);
+			std::vector<QuaternionF> vEnd = vStart;
+			std::vector<QuaternionF> vRes(8);
+
+			//Identical, sign flipped and nearly identical endpoints all land on the start rotation
+			for (size_t sNdx = 0; sNdx < 8; sNdx += 2) { vEnd[sNdx] = -vEnd[sNdx]; }
+			vEnd[3] = Normalize(vEnd[3] + QuaternionF(1.0e-4f, 0.0f, 0.0f, 0.0f));
+
+			HC_TIME_EXECUTION(Math::SLerp(vStart, vEnd, 0.5f, vRes, PRECISION_FULL), _fDelta);
+
+			for (size_t sNdx = 0; sNdx < 8; ++sNdx) {
+				if (BlendAngleError(vRes[sNdx], vStart[sNdx]) > 1.0e-3f || fabsf(Length(vRes[sNdx]) - 1.0f) > 1.0e-5f) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("SLerp In Place", [](float& _fDelta) -> const bool {
+			std::vector<QuaternionF> vStart = GenerateTestQuaternionF(BLEND_TEST_COUNT, 8);
+			std::vector<QuaternionF> vEnd = GenerateTestQuaternionF(BLEND_TEST_COUNT, 9);
+			std::vector<QuaternionF> vExpected(BLEND_TEST_COUNT);
+			std::vector<QuaternionF> vRes = vStart;
+
+			Math::SLerp(vStart, vEnd, 0.5f, vExpected, PRECISION_FULL);
+
+			HC_TIME_EXECUTION(Math::SLerp(vRes, vEnd, 0.5f, vRes, PRECISION_FULL), _fDelta);
+
+			for (size_t sNdx = 0; sNdx < BLEND_TEST_COUNT; ++sNdx) {
+				if (vRes[sNdx] != vExpected[sNdx]) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("SLerp QuaternionFx4", [](float& _fDelta) -> const bool {
+			std::vector<QuaternionF> vStart = GenerateTestQuaternionF(4, 10);
+			std::vector<QuaternionF> vEnd = GenerateTestQuaternionF(4, 11);
+			std::vector<QuaternionF> vExpected(4);
+			QuaternionFx4 qRes;
+
+			Math::SLerp(vStart, vEnd, 0.6f, vExpected, PRECISION_FULL);
+
+			HC_TIME_EXECUTION(qRes = Math::SLerp(LoadQuaternionFx4(vStart.data()), LoadQuaternionFx4(vEnd.data()), 0.6f, PRECISION_FULL), _fDelta);
+
+			for (int iLane = 0; iLane < Floatx4::LANES; ++iLane) {
+				if (qRes.GetLane(iLane) != vExpected[iLane]) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("SLerp RotorF Span", [](float& _fDelta) -> const bool {
+			std::vector<QuaternionF> vStart = GenerateTestQuaternionF(BLEND_TEST_COUNT, 12);
+			std::vector<QuaternionF> vEnd = GenerateTestQuaternionF(BLEND_TEST_COUNT, 13);
+			std::vector<RotorF> vRotStart(BLEND_TEST_COUNT), vRotEnd(BLEND_TEST_COUNT), vRotRes(BLEND_TEST_COUNT);
+			std::vector<QuaternionF> vRes(BLEND_TEST_COUNT);
+
+			for (size_t sNdx = 0; sNdx < BLEND_TEST_COUNT; ++sNdx) {
+				vRotStart[sNdx] = RotorF(vStart[sNdx].m_vQuat);
+				vRotEnd[sNdx] = RotorF(vEnd[sNdx].m_vQuat);
+			}
+
+			HC_TIME_EXECUTION(Math::SLerp(vRotStart, vRotEnd, 0.45f, vRotRes, PRECISION_FULL), _fDelta);
+
+			for (size_t sNdx = 0; sNdx < BLEND_TEST_COUNT; ++sNdx) {
+				vRes[sNdx] = QuaternionF(vRotRes[sNdx].m_vRot);
+			}
+
+			return MaxBlendError(vStart, vEnd, vRes, 0.45f) <= BLEND_FULL_TOLERANCE;
+		});
+
+		tbBlock.AddTest("ExtractMatrices QuaternionF", [](float& _fDelta) -> const bool {
+			std::vector<QuaternionF> vQuats = GenerateTestQuaternionF(BLEND_TEST_COUNT, 14);
+			std::vector<MatrixF> vRes(BLEND_TEST_COUNT);
+			std::vector<MatrixF> vScalar(BLEND_TEST_COUNT);
+
+			RunBatchThenReference("ExtractMatrices", "scalar", [&]() { ExtractMatrices(vQuats, vRes); },
+				[&]() { for (size_t sNdx = 0; sNdx < BLEND_TEST_COUNT; ++sNdx) vScalar[sNdx] = ExtractMatrix(vQuats[sNdx]); }, _fDelta);
+
+			for (size_t sNdx = 0; sNdx < BLEND_TEST_COUNT; ++sNdx) {
+				for (int iRow = 0; iRow < 4; ++iRow) {
+					if (Length(vRes[sNdx][iRow] - vScalar[sNdx][iRow]) > 1.0e-5f) {
+						return false;
+					}
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("ExtractMatrices RotorF", [](float& _fDelta) -> const bool {
+			std::vector<QuaternionF> vQuats = GenerateTestQuaternionF(BLEND_TEST_COUNT, 15);
+			std::vector<RotorF> vRots(BLEND_TEST_COUNT);
+			std::vector<MatrixF> vRes(BLEND_TEST_COUNT);
+
+			for (size_t sNdx = 0; sNdx < BLEND_TEST_COUNT; ++sNdx) {
+				vRots[sNdx] = RotorF(vQuats[sNdx].m_vQuat);
+			}
+
+			HC_TIME_EXECUTION(ExtractMatrices(vRots, vRes), _fDelta);
+
+			for (size_t sNdx = 0; sNdx < BLEND_TEST_COUNT; ++sNdx) {
+				MatrixF mExpected = ExtractMatrix(vRots[sNdx]);
+
+				for (int iRow = 0; iRow < 4; ++iRow) {
+					if (Length(vRes[sNdx][iRow] - mExpected[iRow]) > 1.0e-5f) {
+						return false;
+					}
+				}
+			}
+
+			return true;
+		});
+
+		_vBlockList.push_back(tbBlock);
+	}
+}
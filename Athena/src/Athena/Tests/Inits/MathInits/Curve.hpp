@@ -0,0 +1,154 @@
+#pragma once
+
+#include <Athena/Tests/Inits/MathInits/Math_Common.hpp>
+
+#include <HellfireControl/Math/Curve.hpp>
+
+namespace MathTests {
+	//Absolute tolerance on evaluated points and derivatives
+	constexpr float CURVE_TOLERANCE = 1.0e-5f;
+
+	void InitTests_Curve(std::vector<TestBlock>& _vBlockList) {
+		TestBlock tbBlock = TestBlock("Math Library - Curve");
+
+		tbBlock.AddTest("Curve Control Points", [](float& _fDelta) -> const bool {
+			const Vec3F vPoints[] = { Vec3F(0.0f, 0.0f, 0.0f), Vec3F(1.0f, 2.0f, 0.0f), Vec3F(3.0f, 2.0f, 1.0f), Vec3F(4.0f, 0.0f, 1.0f), Vec3F(6.0f, -1.0f, 2.0f), Vec3F(7.0f, 1.0f, 2.0f), Vec3F(8.0f, 0.0f, 0.0f) };
+			bool bRes = true;
+
+			//Catmull-Rom passes through every point, one segment between each pair
+			const Curve<Vec3F> cCatmull(CURVE_CATMULL_ROM, std::span<const Vec3F>(vPoints));
+			Vec3F vVal;
+			HC_TIME_EXECUTION(vVal = cCatmull.Evaluate(0.5f), _fDelta);
+
+			bRes &= cCatmull.GetSegmentCount() == 6 && TestCompare(vVal, vPoints[3], CURVE_TOLERANCE);
+			for (int iNdx = 0; iNdx < 7; ++iNdx) { bRes &= TestCompare(cCatmull.Evaluate(iNdx / 6.0f), vPoints[iNdx], CURVE_TOLERANCE); }
+
+			//Bezier segments meet at every third point and the midpoint weighs the four points 1 3 3 1
+			const Curve<Vec3F> cBezier(CURVE_BEZIER, std::span<const Vec3F>(vPoints));
+			bRes &= cBezier.GetSegmentCount() == 2 && TestCompare(cBezier.Evaluate(0.0f), vPoints[0], CURVE_TOLERANCE) && TestCompare(cBezier.Evaluate(0.5f), vPoints[3], CURVE_TOLERANCE) && TestCompare(cBezier.Evaluate(1.0f), vPoints[6], CURVE_TOLERANCE);
+			bRes &= TestCompare(cBezier.Evaluate(0.25f), (vPoints[0] + vPoints[1] * 3.0f + vPoints[2] * 3.0f + vPoints[3]) / 8.0f, CURVE_TOLERANCE);
+
+			//Hermite tangents are per segment, so the derivative over the whole curve is scaled by the segment count
+			const Curve<Vec3F> cHermite(CURVE_HERMITE, std::span<const Vec3F>(vPoints, 6));
+			bRes &= cHermite.GetSegmentCount() == 2 && TestCompare(cHermite.Evaluate(0.5f), vPoints[2], CURVE_TOLERANCE) && TestCompare(cHermite.Evaluate(1.0f), vPoints[4], CURVE_TOLERANCE);
+			bRes &= TestCompare(cHermite.Derivative(0.0f), vPoints[1] * 2.0f, CURVE_TOLERANCE) && TestCompare(cHermite.Derivative(0.5f), vPoints[3] * 2.0f, 1.0e-4f);
+
+			//B-splines start at the weighted average of their first three points
+			const Curve<Vec3F> cBSpline(CURVE_BSPLINE, std::span<const Vec3F>(vPoints));
+			bRes &= cBSpline.GetSegmentCount() == 4 && TestCompare(cBSpline.Evaluate(0.0f), (vPoints[0] + vPoints[1] * 4.0f + vPoints[2]) / 6.0f, CURVE_TOLERANCE);
+
+			//Parameters outside [0, 1] clamp to the ends
+			return bRes && cCatmull.Evaluate(-1.0f) == cCatmull.Evaluate(0.0f) && cCatmull.Evaluate(2.0f) == cCatmull.Evaluate(1.0f);
+			});
+
+		tbBlock.AddTest("Curve Continuity", [](float& _fDelta) -> const bool {
+			Random rand(41);
+			std::vector<Vec2F> vPoints(9);
+			bool bRes = true;
+
+			for (Vec2F& vPoint : vPoints) { vPoint = Vec2F(rand.GenerateFloat(-10.0f, 10.0f), rand.GenerateFloat(-10.0f, 10.0f)); }
+
+			for (const CurveType ctType : { CURVE_CATMULL_ROM, CURVE_BSPLINE }) {
+				for (const bool bClosed : { false, true }) {
+					const Curve<Vec2F> cCurve(ctType, std::span<const Vec2F>(vPoints), bClosed);
+					const float fSegments = static_cast<float>(cCurve.GetSegmentCount());
+
+					//Position and tangent agree on both sides of every join
+					for (int iJoin = 1; iJoin < cCurve.GetSegmentCount(); ++iJoin) {
+						const float fJoin = iJoin / fSegments;
+
+						bRes &= Length(cCurve.Evaluate(fJoin - 1.0e-5f) - cCurve.Evaluate(fJoin + 1.0e-5f)) < 1.0e-2f;
+						bRes &= Length(cCurve.Derivative(fJoin - 1.0e-5f) - cCurve.Derivative(fJoin + 1.0e-5f)) < 0.2f;
+					}
+
+					if (bClosed) {
+						bRes &= Length(cCurve.Evaluate(0.0f) - cCurve.Evaluate(1.0f)) < 1.0e-4f && Length(cCurve.Derivative(0.0f) - cCurve.Derivative(1.0f)) < 1.0e-3f;
+					}
+				}
+			}
+
+			const Curve<Vec2F> cLoop(CURVE_CATMULL_ROM, std::span<const Vec2F>(vPoints), true);
+			Vec2F vVal;
+			HC_TIME_EXECUTION(vVal = cLoop.Evaluate(8.0f / 9.0f), _fDelta);
+
+			return bRes && cLoop.GetSegmentCount() == 9 && Length(vVal - vPoints[8]) < 1.0e-4f;
+			});
+
+		tbBlock.AddTest("Curve Batch Matches Single", [](float& _fDelta) -> const bool {
+			Random rand(12);
+			std::vector<Vec3F> vPoints(32);
+			std::vector<float> vParams(100000);
+			std::vector<Vec3F> vOut(vParams.size());
+			bool bRes = true;
+
+			for (Vec3F& vPoint : vPoints) { vPoint = RandomTestVec3F(rand) * 50.0f; }
+			rand.FillFloats(std::span<float>(vParams));
+
+			const Curve<Vec3F> cCurve(CURVE_CATMULL_ROM, std::span<const Vec3F>(vPoints));
+
+			HC_TIME_EXECUTION(cCurve.Evaluate(std::span<const float>(vParams), std::span<Vec3F>(vOut)), _fDelta);
+
+			Console::Print("\tCurve Evaluate: " + std::to_string(_fDelta / static_cast<float>(vParams.size())) + " ns per point\n", Console::YELLOW);
+
+			for (size_t sNdx = 0; sNdx < vParams.size(); sNdx += 7) { bRes &= vOut[sNdx] == cCurve.Evaluate(vParams[sNdx]); }
+
+			return bRes;
+			});
+
+		tbBlock.AddTest("Curve Arc Length", [](float& _fDelta) -> const bool {
+			//A straight Bezier with its handles bunched at the start races through the far end when stepped by parameter
+			const Vec3F vLine[] = { Vec3F(0.0f, 0.0f, 0.0f), Vec3F(0.2f, 0.0f, 0.0f), Vec3F(0.5f, 0.0f, 0.0f), Vec3F(10.0f, 0.0f, 0.0f) };
+			Curve<Vec3F> cLine(CURVE_BEZIER, std::span<const Vec3F>(vLine));
+			bool bRes = true;
+
+			cLine.BuildArcLengthTable(64);
+			bRes &= fabsf(cLine.GetLength() - 10.0f) < 1.0e-3f;
+
+			for (float fDistance = 0.0f; fDistance <= 10.0f; fDistance += 0.25f) { bRes &= fabsf(cLine.EvaluateAtDistance(fDistance).x - fDistance) < 0.02f; }
+
+			//A loop through eight points on a circle: evenly resampled points are evenly spaced around it
+			std::vector<Vec3F> vCircle(8);
+			for (int iNdx = 0; iNdx < 8; ++iNdx) { vCircle[iNdx] = Vec3F(cosf(iNdx * HC_2PI / 8.0f), sinf(iNdx * HC_2PI / 8.0f), 0.0f) * 5.0f; }
+
+			Curve<Vec3F> cCircle(CURVE_CATMULL_ROM, std::span<const Vec3F>(vCircle), true);
+			std::vector<Vec3F> vSamples(200);
+
+			HC_TIME_EXECUTION(cCircle.BuildArcLengthTable(), _fDelta);
+
+			cCircle.Resample(std::span<Vec3F>(vSamples));
+			bRes &= fabsf(cCircle.GetLength() - 5.0f * HC_2PI) < 0.5f;
+
+			const float fSpacing = cCircle.GetLength() / 199.0f;
+			for (size_t sNdx = 1; sNdx < vSamples.size(); ++sNdx) { bRes &= fabsf(Length(vSamples[sNdx] - vSamples[sNdx - 1]) - fSpacing) < fSpacing * 0.02f; }
+
+			return bRes && TestCompare(cCircle.EvaluateAtDistance(0.0f), vCircle[0], CURVE_TOLERANCE) && cCircle.ParameterAtDistance(cCircle.GetLength()) == 1.0f;
+			});
+
+		tbBlock.AddTest("Curve Quaternion", [](float& _fDelta) -> const bool {
+			//The third key is negated. It is the same rotation and the curve must not swing the long way round to reach it.
+			const QuaternionF qKeys[] = { QuaternionF(Vec3F(0.0f, 1.0f, 0.0f), 0.0f), QuaternionF(Vec3F(0.0f, 1.0f, 0.0f), 0.8f), -QuaternionF(Vec3F(1.0f, 0.0f, 0.0f), 0.6f), QuaternionF(Vec3F(0.0f, 0.0f, 1.0f), 1.2f) };
+			Curve<QuaternionF> cCurve(CURVE_CATMULL_ROM, std::span<const QuaternionF>(qKeys));
+			std::vector<QuaternionF> vSamples(301);
+			bool bRes = true;
+
+			HC_TIME_EXECUTION(cCurve.BuildArcLengthTable(64), _fDelta);
+			cCurve.Resample(std::span<QuaternionF>(vSamples));
+
+			for (int iNdx = 0; iNdx < 4; ++iNdx) { bRes &= fabsf(fabsf(Dot(cCurve.Evaluate(iNdx / 3.0f).m_vQuat, qKeys[iNdx].m_vQuat)) - 1.0f) < 1.0e-5f; }
+
+			for (size_t sNdx = 0; sNdx < vSamples.size(); ++sNdx) {
+				bRes &= fabsf(Length(vSamples[sNdx].m_vQuat) - 1.0f) < 1.0e-5f;
+
+				//Evenly spaced in angle, and well short of the half turn a wrong hemisphere would cost
+				if (sNdx > 0) {
+					const float fAngle = 2.0f * acosf(fminf(fabsf(Dot(vSamples[sNdx].m_vQuat, vSamples[sNdx - 1].m_vQuat)), 1.0f));
+					bRes &= fabsf(fAngle - cCurve.GetLength() / 300.0f) < cCurve.GetLength() / 3000.0f;
+				}
+			}
+
+			return bRes && cCurve.GetLength() < 4.0f;
+			});
+
+		_vBlockList.push_back(tbBlock);
+	}
+}
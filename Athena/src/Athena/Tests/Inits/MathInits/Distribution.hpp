@@ -0,0 +1,191 @@
+#pragma once
+
+#include <Athena/Tests/Inits/MathInits/Math_Common.hpp>
+#include <Athena/Tests/Inits/MathInits/Random.hpp>
+
+#include <HellfireControl/Math/Distribution.hpp>
+
+namespace MathTests {
+	//Enough draws that the moment checks below sit many standard errors inside their tolerances
+	constexpr size_t DISTRIBUTION_TEST_COUNT = 1 << 18;
+
+	inline void DistributionMoments(std::span<const float> _fVals, double& _dMean, double& _dVariance) {
+		double dSum = 0.0, dSquares = 0.0;
+
+		for (const float fVal : _fVals) {
+			dSum += fVal;
+			dSquares += static_cast<double>(fVal) * fVal;
+		}
+
+		_dMean = dSum / _fVals.size();
+		_dVariance = dSquares / _fVals.size() - _dMean * _dMean;
+	}
+
+	void InitTests_Distribution(std::vector<TestBlock>& _vBlockList) {
+		TestBlock tbBlock = TestBlock("Math Library - Distribution");
+
+		tbBlock.AddTest("Distribution Normal", [](float& _fDelta) -> const bool {
+			Random rand(1234);
+			std::vector<float> vVals(DISTRIBUTION_TEST_COUNT);
+			float fBoxMullerDelta = 0.0f;
+
+			{
+				HC_TIME_EXECUTION(Math::SampleNormal(rand, std::span<float>(vVals), 2.0f, 3.0f), _fDelta);
+			}
+
+			double dMean, dVariance;
+			DistributionMoments(vVals, dMean, dVariance);
+
+			//Box-Muller on the same generator is the usual way to get these
+			std::vector<float> vBoxMuller(DISTRIBUTION_TEST_COUNT);
+			{
+				HC_TIME_EXECUTION(
+					for (size_t sNdx = 0; sNdx < vBoxMuller.size(); sNdx += 2) {
+						const float fRadius = sqrtf(-2.0f * logf(1.0f - rand.GenerateFloat()));
+						const float fAngle = HC_2PI * rand.GenerateFloat();
+						vBoxMuller[sNdx] = 2.0f + 3.0f * fRadius * cosf(fAngle);
+						vBoxMuller[sNdx + 1] = 2.0f + 3.0f * fRadius * sinf(fAngle);
+					}, fBoxMullerDelta);
+			}
+
+			PrintSpeedup("SampleNormal", _fDelta, fBoxMullerDelta, "Box-Muller");
+
+			//Beyond three standard deviations the tail path is doing its job: 0.27% of a normal lies out there
+			size_t sTail = 0;
+			for (const float fVal : vVals) { sTail += fabsf(fVal - 2.0f) > 9.0f ? 1 : 0; }
+
+			const double dTail = static_cast<double>(sTail) / vVals.size();
+
+			return fabs(dMean - 2.0) < 0.03 && fabs(dVariance - 9.0) < 0.15 && dTail > 0.0022 && dTail < 0.0032;
+			});
+
+		tbBlock.AddTest("Distribution Exponential", [](float& _fDelta) -> const bool {
+			Random rand(99);
+			std::vector<float> vVals(DISTRIBUTION_TEST_COUNT + 3);
+			bool bRes = true;
+
+			HC_TIME_EXECUTION(Math::SampleExponential(rand, std::span<float>(vVals), 4.0f), _fDelta);
+
+			for (const MathPrecision mpPrecision : { PRECISION_FULL, PRECISION_FAST }) {
+				Math::SampleExponential(rand, std::span<float>(vVals), 4.0f, mpPrecision);
+
+				double dMean, dVariance;
+				DistributionMoments(vVals, dMean, dVariance);
+
+				bRes &= fabs(dMean - 0.25) < 0.005 && fabs(dVariance - 0.0625) < 0.003;
+
+				for (const float fVal : vVals) { bRes &= fVal >= 0.0f && std::isfinite(fVal); }
+			}
+
+			return bRes;
+			});
+
+		tbBlock.AddTest("Distribution Poisson", [](float& _fDelta) -> const bool {
+			RandomStream rsStream(7, 0);
+			std::vector<uint32_t> vVals(DISTRIBUTION_TEST_COUNT);
+			bool bRes = true;
+
+			HC_TIME_EXECUTION(Math::SamplePoisson(rsStream, std::span<uint32_t>(vVals), 4.0f), _fDelta);
+
+			//One mean on each side of the switch from inversion to PTRS. Mean and variance are both lambda.
+			for (const float fMean : { 0.5f, 4.0f, 40.0f, 400.0f }) {
+				Math::SamplePoisson(rsStream, std::span<uint32_t>(vVals), fMean);
+
+				double dSum = 0.0, dSquares = 0.0;
+				for (const uint32_t uVal : vVals) {
+					dSum += uVal;
+					dSquares += static_cast<double>(uVal) * uVal;
+				}
+
+				const double dMean = dSum / vVals.size(), dVariance = dSquares / vVals.size() - dMean * dMean;
+
+				bRes &= fabs(dMean - fMean) < 0.01 * fMean + 0.01 && fabs(dVariance - fMean) < 0.03 * fMean + 0.01;
+			}
+
+			return bRes;
+			});
+
+		tbBlock.AddTest("Distribution Sphere And Hemisphere", [](float& _fDelta) -> const bool {
+			Random rand(5);
+			std::vector<Vec3F> vDirs(DISTRIBUTION_TEST_COUNT + 1);
+			const Vec3F vNormal = Vec3F(0.0f, 2.0f, 0.0f);
+			bool bRes = true;
+
+			HC_TIME_EXECUTION(Math::SampleOnSphere(rand, std::span<Vec3F>(vDirs)), _fDelta);
+
+			//Every direction is unit length, and each octant gets an eighth of them
+			std::vector<uint32_t> vOctants(8, 0U);
+			for (const Vec3F& vDir : vDirs) {
+				bRes &= fabsf(Length(vDir) - 1.0f) < 1.0e-4f;
+				++vOctants[(vDir.x < 0.0f ? 1 : 0) | (vDir.y < 0.0f ? 2 : 0) | (vDir.z < 0.0f ? 4 : 0)];
+			}
+
+			bRes &= RandomChiSquare(vOctants, vDirs.size() / 8.0) < 24.32;
+
+			Math::SampleOnHemisphere(rand, std::span<Vec3F>(vDirs), vNormal, PRECISION_FAST);
+
+			//Uniform on the hemisphere means the height above it is uniform in [0, 1], so its mean is a half
+			double dHeight = 0.0;
+			for (const Vec3F& vDir : vDirs) {
+				bRes &= Dot(vDir, vNormal) >= 0.0f && fabsf(Length(vDir) - 1.0f) < 1.0e-3f;
+				dHeight += vDir.y;
+			}
+
+			return bRes && fabs(dHeight / vDirs.size() - 0.5) < 0.005;
+			});
+
+		tbBlock.AddTest("Distribution Disk", [](float& _fDelta) -> const bool {
+			RandomStream rsStream(11, 3);
+			std::vector<Vec2F> vPoints(DISTRIBUTION_TEST_COUNT + 2);
+			bool bRes = true;
+
+			HC_TIME_EXECUTION(Math::SampleInDisk(rsStream, std::span<Vec2F>(vPoints), 3.0f), _fDelta);
+
+			//A quarter of a disk's area lies within half its radius
+			size_t sInner = 0;
+			for (const Vec2F& vPoint : vPoints) {
+				bRes &= Length(vPoint) <= 3.0f + 1.0e-5f;
+				sInner += Length(vPoint) < 1.5f ? 1 : 0;
+			}
+
+			return bRes && fabs(static_cast<double>(sInner) / vPoints.size() - 0.25) < 0.005;
+			});
+
+		tbBlock.AddTest("Distribution Alias Table", [](float& _fDelta) -> const bool {
+			const float fWeights[] = { 1.0f, 0.0f, 5.0f, 2.5f, 0.5f, 7.0f, 3.0f };
+			const AliasTable atTable = AliasTable(std::span<const float>(fWeights));
+			Random rand(2024);
+			std::vector<uint32_t> vVals(DISTRIBUTION_TEST_COUNT);
+
+			HC_TIME_EXECUTION(atTable.Sample(rand, std::span<uint32_t>(vVals)), _fDelta);
+
+			std::vector<uint32_t> vCounts(std::size(fWeights), 0U);
+			for (const uint32_t uVal : vVals) { ++vCounts[uVal]; }
+
+			//The zero weight column is never drawn. The rest match their weights, checked by chi-square with 5 degrees of freedom.
+			double dChiSquare = 0.0;
+			for (size_t sNdx = 0; sNdx < std::size(fWeights); ++sNdx) {
+				if (fWeights[sNdx] == 0.0f) { continue; }
+
+				const double dExpected = vVals.size() * fWeights[sNdx] / 19.0;
+				const double dDiff = vCounts[sNdx] - dExpected;
+				dChiSquare += dDiff * dDiff / dExpected;
+			}
+
+			return vCounts[1] == 0U && dChiSquare < 20.52 && atTable.Sample(rand) < atTable.GetSize();
+			});
+
+		tbBlock.AddTest("Distribution Stream Reproducible", [](float& _fDelta) -> const bool {
+			RandomStream rsFirst(42, 9), rsSecond(42, 9);
+			std::vector<float> vFirst(1000), vSecond(1000);
+
+			HC_TIME_EXECUTION(Math::SampleNormal(rsFirst, std::span<float>(vFirst)), _fDelta);
+
+			Math::SampleNormal(rsSecond, std::span<float>(vSecond));
+
+			return vFirst == vSecond;
+			});
+
+		_vBlockList.push_back(tbBlock);
+	}
+}
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <Athena/Tests/Inits/MathInits/Math_Common.hpp>
+
+namespace MathTests {
+	//Roughly one skeleton's worth of bones per test
+	constexpr size_t DUAL_QUATERNION_TEST_COUNT = 256;
+
+	//Relative tolerance for every comparison against the matrix and quaternion paths
+	constexpr float DUAL_QUATERNION_TOLERANCE = 1.0e-4f;
+
+	//Two dual quaternions describe the same transform when they are equal up to sign
+	inline bool DualQuaternionCompare(const DualQuaternionF& _dqLeft, const DualQuaternionF& _dqRight) {
+		const DualQuaternionF dqRight = Dot(_dqLeft.m_qReal.m_vQuat, _dqRight.m_qReal.m_vQuat) < 0.0f ? -_dqRight : _dqRight;
+		return TestCompareRelative(_dqLeft.m_qReal.m_vQuat, dqRight.m_qReal.m_vQuat, DUAL_QUATERNION_TOLERANCE) &&
+			   TestCompareRelative(_dqLeft.m_qDual.m_vQuat, dqRight.m_qDual.m_vQuat, DUAL_QUATERNION_TOLERANCE);
+	}
+
+	inline std::vector<DualQuaternionF> GenerateDualQuaternionF(size_t _sCount, uint64_t _uSeed) {
+		return GenerateTestValues<DualQuaternionF>(_sCount, _uSeed, [](Random& _rRand) {
+			const QuaternionF qRotation = RandomTestQuaternionF(_rRand);
+			return DualQuaternionF(RandomTestVec3F(_rRand) * 10.0f, qRotation);
+		});
+	}
+
+	void InitTests_DualQuaternion(std::vector<TestBlock>& _vBlockList) {
+		TestBlock tbBlock = TestBlock("Math Library - DualQuaternion");
+
+		tbBlock.AddTest("Default Constructor", [](float& _fDelta) -> const bool {
+			DualQuaternionF dqVal;
+
+			HC_TIME_EXECUTION(dqVal = DualQuaternionF(), _fDelta);
+
+			return TestCompareRelative(ExtractMatrix(dqVal), IdentityF(), DUAL_QUATERNION_TOLERANCE);
+		});
+
+		tbBlock.AddTest("Translation Rotation Constructor", [](float& _fDelta) -> const bool {
+			const QuaternionF qRotation = Normalize(QuaternionF(0.2f, -0.4f, 0.1f, 0.9f));
+			const Vec3F vTranslation(1.0f, -2.0f, 3.0f);
+			const Vec3F vPoint(0.5f, 4.0f, -1.5f);
+			DualQuaternionF dqVal;
+
+			HC_TIME_EXECUTION(dqVal = DualQuaternionF(vTranslation, qRotation), _fDelta);
+
+			return TestCompareRelative(ExtractTranslation(dqVal), vTranslation, DUAL_QUATERNION_TOLERANCE) && TestCompareRelative(TransformPoint(dqVal, vPoint), RotateByQuaternion(vPoint, qRotation) + vTranslation, DUAL_QUATERNION_TOLERANCE);
+		});
+
+		tbBlock.AddTest("MatrixF Round Trip", [](float& _fDelta) -> const bool {
+			std::vector<DualQuaternionF> vSource = GenerateDualQuaternionF(DUAL_QUATERNION_TEST_COUNT, 1);
+			std::vector<DualQuaternionF> vRes(DUAL_QUATERNION_TEST_COUNT);
+
+			//Half turns about each axis reach every branch of the matrix to quaternion conversion
+			vSource[0] = DualQuaternionF(Vec3F(1.0f, 0.0f, 0.0f), QuaternionF(1.0f, 0.0f, 0.0f, 0.0f));
+			vSource[1] = DualQuaternionF(Vec3F(0.0f, 1.0f, 0.0f), QuaternionF(0.0f, 1.0f, 0.0f, 0.0f));
+			vSource[2] = DualQuaternionF(Vec3F(0.0f, 0.0f, 1.0f), QuaternionF(0.0f, 0.0f, 1.0f, 0.0f));
+			vSource[3] = DualQuaternionF(Vec3F(1.0f, 1.0f, 1.0f), Normalize(QuaternionF(0.9f, 0.1f, 0.0f, 0.2f)));
+
+			HC_TIME_EXECUTION(for (size_t sNdx = 0; sNdx < DUAL_QUATERNION_TEST_COUNT; ++sNdx) vRes[sNdx] = DualQuaternionF(ExtractMatrix(vSource[sNdx])), _fDelta);
+
+			for (size_t sNdx = 0; sNdx < DUAL_QUATERNION_TEST_COUNT; ++sNdx) {
+				if (!DualQuaternionCompare(vRes[sNdx], vSource[sNdx])) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("MatrixF Constructor Drops Scale", [](float& _fDelta) -> const bool {
+			const QuaternionF qRotation = Normalize(QuaternionF(-0.3f, 0.5f, 0.2f, 0.7f));
+			const Vec3F vTranslation(4.0f, 5.0f, -6.0f);
+			DualQuaternionF dqVal;
+
+			HC_TIME_EXECUTION(dqVal = DualQuaternionF(ComposeTRS(vTranslation, qRotation, Vec3F(2.0f, 0.5f, 3.0f))), _fDelta);
+
+			return TestCompareRelative(ExtractMatrix(dqVal), ComposeTRS(vTranslation, qRotation, Vec3F(1.0f)), DUAL_QUATERNION_TOLERANCE);
+		});
+
+		tbBlock.AddTest("TransformPoint", [](float& _fDelta) -> const bool {
+			std::vector<DualQuaternionF> vSource = GenerateDualQuaternionF(DUAL_QUATERNION_TEST_COUNT, 2);
+			std::vector<Vec3F> vRes(DUAL_QUATERNION_TEST_COUNT);
+			const Vec3F vPoint(1.5f, -2.5f, 0.75f);
+
+			HC_TIME_EXECUTION(for (size_t sNdx = 0; sNdx < DUAL_QUATERNION_TEST_COUNT; ++sNdx) vRes[sNdx] = TransformPoint(vSource[sNdx], vPoint), _fDelta);
+
+			for (size_t sNdx = 0; sNdx < DUAL_QUATERNION_TEST_COUNT; ++sNdx) {
+				if (!TestCompareRelative(vRes[sNdx], TransformPoint(ExtractMatrix(vSource[sNdx]), vPoint), DUAL_QUATERNION_TOLERANCE) ||
+					!TestCompareRelative(TransformDirection(vSource[sNdx], vPoint), TransformDirection(ExtractMatrix(vSource[sNdx]), vPoint), DUAL_QUATERNION_TOLERANCE)) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("Multiplication Matches MatrixF", [](float& _fDelta) -> const bool {
+			std::vector<DualQuaternionF> vLeft = GenerateDualQuaternionF(DUAL_QUATERNION_TEST_COUNT, 3);
+			std::vector<DualQuaternionF> vRight = GenerateDualQuaternionF(DUAL_QUATERNION_TEST_COUNT, 4);
+			std::vector<DualQuaternionF> vRes(DUAL_QUATERNION_TEST_COUNT);
+
+			HC_TIME_EXECUTION(for (size_t sNdx = 0; sNdx < DUAL_QUATERNION_TEST_COUNT; ++sNdx) vRes[sNdx] = vLeft[sNdx] * vRight[sNdx], _fDelta);
+
+			for (size_t sNdx = 0; sNdx < DUAL_QUATERNION_TEST_COUNT; ++sNdx) {
+				if (!TestCompareRelative(ExtractMatrix(vRes[sNdx]), ExtractMatrix(vLeft[sNdx]) * ExtractMatrix(vRight[sNdx]), DUAL_QUATERNION_TOLERANCE)) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("Inverse", [](float& _fDelta) -> const bool {
+			std::vector<DualQuaternionF> vSource = GenerateDualQuaternionF(DUAL_QUATERNION_TEST_COUNT, 5);
+			std::vector<DualQuaternionF> vRes(DUAL_QUATERNION_TEST_COUNT);
+
+			HC_TIME_EXECUTION(for (size_t sNdx = 0; sNdx < DUAL_QUATERNION_TEST_COUNT; ++sNdx) vRes[sNdx] = Inverse(vSource[sNdx]), _fDelta);
+
+			for (size_t sNdx = 0; sNdx < DUAL_QUATERNION_TEST_COUNT; ++sNdx) {
+				if (!DualQuaternionCompare(vSource[sNdx] * vRes[sNdx], DualQuaternionF())) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("Normalize", [](float& _fDelta) -> const bool {
+			const DualQuaternionF dqSource(Vec3F(3.0f, -1.0f, 2.0f), Normalize(QuaternionF(0.1f, 0.7f, -0.2f, 0.6f)));
+			//Scaled, with some dual part drift along the real part
+			const DualQuaternionF dqDrifted(dqSource.m_qReal * 2.5f, (dqSource.m_qDual + dqSource.m_qReal * 0.01f) * 2.5f);
+			DualQuaternionF dqRes;
+
+			HC_TIME_EXECUTION(dqRes = Normalize(dqDrifted), _fDelta);
+
+			return fabsf(Length(dqRes.m_qReal.m_vQuat) - 1.0f) <= 1.0e-5f && fabsf(Dot(dqRes.m_qReal.m_vQuat, dqRes.m_qDual.m_vQuat)) <= 1.0e-5f &&
+				   DualQuaternionCompare(dqRes, dqSource);
+		});
+
+		tbBlock.AddTest("Blend", [](float& _fDelta) -> const bool {
+			const QuaternionF qRotation = Normalize(QuaternionF(0.0f, 0.0f, 0.3f, 0.95f));
+			const DualQuaternionF dqStart(Vec3F(2.0f, 0.0f, 0.0f), qRotation);
+			const DualQuaternionF dqEnd(Vec3F(4.0f, 0.0f, 0.0f), qRotation);
+			//The sign flipped copy is the same transform and has to add to the blend rather than cancel it
+			const DualQuaternionF dqTransforms[] = { dqStart, dqEnd, -dqEnd };
+			const float fWeights[] = { 0.5f, 0.25f, 0.25f };
+			DualQuaternionF dqRes;
+
+			HC_TIME_EXECUTION(dqRes = Math::Blend(dqTransforms, fWeights), _fDelta);
+
+			return DualQuaternionCompare(dqRes, DualQuaternionF(Vec3F(3.0f, 0.0f, 0.0f), qRotation));
+		});
+
+		tbBlock.AddTest("Blend Stays Rigid", [](float& _fDelta) -> const bool {
+			std::vector<DualQuaternionF> vSource = GenerateDualQuaternionF(4, 6);
+			const float fWeights[] = { 0.1f, 0.2f, 0.3f, 0.4f };
+			DualQuaternionF dqRes;
+
+			HC_TIME_EXECUTION(dqRes = Math::Blend(vSource, fWeights), _fDelta);
+
+			//A rigid transform keeps distances, which a blend of matrices does not
+			const Vec3F vFirst = TransformPoint(dqRes, Vec3F(1.0f, 0.0f, 0.0f));
+			const Vec3F vSecond = TransformPoint(dqRes, Vec3F(0.0f, 2.0f, 0.0f));
+
+			return fabsf(Length(vFirst - vSecond) - Length(Vec3F(1.0f, -2.0f, 0.0f))) <= 1.0e-4f;
+		});
+
+		tbBlock.AddTest("BuildSkinPalette", [](float& _fDelta) -> const bool {
+			std::vector<DualQuaternionF> vBones = GenerateDualQuaternionF(DUAL_QUATERNION_TEST_COUNT, 7);
+			std::vector<DualQuaternionF> vBinds = GenerateDualQuaternionF(DUAL_QUATERNION_TEST_COUNT, 8);
+			std::vector<MatrixF> vBoneMatrices(DUAL_QUATERNION_TEST_COUNT);
+			std::vector<MatrixF> vInverseBindMatrices(DUAL_QUATERNION_TEST_COUNT);
+			std::vector<DualQuaternionF> vInverseBinds(DUAL_QUATERNION_TEST_COUNT);
+			std::vector<DualQuaternionF> vPalette(DUAL_QUATERNION_TEST_COUNT);
+			std::vector<DualQuaternionF> vFromDual(DUAL_QUATERNION_TEST_COUNT);
+
+			for (size_t sNdx = 0; sNdx < DUAL_QUATERNION_TEST_COUNT; ++sNdx) {
+				vBoneMatrices[sNdx] = ExtractMatrix(vBones[sNdx]);
+				vInverseBindMatrices[sNdx] = ExtractMatrix(Inverse(vBinds[sNdx]));
+				vInverseBinds[sNdx] = Inverse(vBinds[sNdx]);
+			}
+
+			HC_TIME_EXECUTION(BuildSkinPalette(vBoneMatrices, vInverseBindMatrices, vPalette), _fDelta);
+
+			BuildSkinPalette(vBones, vInverseBinds, vFromDual);
+
+			for (size_t sNdx = 0; sNdx < DUAL_QUATERNION_TEST_COUNT; ++sNdx) {
+				const MatrixF mExpected = vInverseBindMatrices[sNdx] * vBoneMatrices[sNdx];
+
+				if (!TestCompareRelative(ExtractMatrix(vPalette[sNdx]), mExpected, DUAL_QUATERNION_TOLERANCE) || !DualQuaternionCompare(vFromDual[sNdx], vPalette[sNdx])) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		_vBlockList.push_back(tbBlock);
+	}
+}
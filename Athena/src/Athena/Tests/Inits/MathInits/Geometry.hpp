@@ -0,0 +1,196 @@
+#pragma once
+
+#include <Athena/Tests/Inits/MathInits/Math_Common.hpp>
+
+#include <HellfireControl/Math/Geometry.hpp>
+
+namespace MathTests {
+	//A scene's worth of objects, and not a multiple of 32 so the last mask word is partial
+	constexpr size_t GEOMETRY_TEST_COUNT = 4099;
+
+	//Camera at (0, 0, -10) looking down +Z
+	inline MatrixF GeometryTestViewProjection() {
+		const MatrixF mView = InverseTRS(LookAtLH(Vec3F(0.0f, 0.0f, -10.0f), Vec3F(0.0f, 0.0f, 0.0f), Vec3F(0.0f, 1.0f, 0.0f)));
+		return mView * ProjectionF(16.0f / 9.0f, HC_DEG2RAD(35.0f), 0.1f, 100.0f);
+	}
+
+	inline std::vector<SphereF> GenerateGeometrySpheres(size_t _sCount, uint64_t _uSeed) {
+		return GenerateTestValues<SphereF>(_sCount, _uSeed, [](Random& _rRand) { return SphereF(RandomTestVec3F(_rRand) * 40.0f, fabsf(_rRand.GenerateFloat(0.1f, 3.0f))); });
+	}
+
+	inline std::vector<AABBF> GenerateGeometryAABBs(size_t _sCount, uint64_t _uSeed) {
+		return GenerateTestValues<AABBF>(_sCount, _uSeed, [](Random& _rRand) {
+			const Vec3F vCenter = RandomTestVec3F(_rRand) * 40.0f;
+			const Vec3F vExtents = Abs(RandomTestVec3F(_rRand)) * 3.0f + Vec3F(0.05f);
+			return AABBF(vCenter - vExtents, vCenter + vExtents);
+		});
+	}
+
+	//Runs the batched test and the scalar loop it replaces, prints the speedup and compares every bit
+	template<typename Volume, typename BatchFunc, typename ScalarFunc>
+	bool RunGeometryComparison(const std::string& _strName, const std::vector<Volume>& _vVolumes, BatchFunc _fnBatch, ScalarFunc _fnScalar, float& _fDelta) {
+		std::vector<uint32_t> vMask(GetMaskWordCount(_vVolumes.size()));
+		std::vector<uint8_t> vScalar(_vVolumes.size());
+		size_t sHits = 0;
+
+		RunBatchThenReference(_strName, "scalar", [&]() { _fnBatch(_vVolumes, vMask); }, [&]() { for (size_t sNdx = 0; sNdx < _vVolumes.size(); ++sNdx) vScalar[sNdx] = _fnScalar(_vVolumes[sNdx]); }, _fDelta);
+
+		for (size_t sNdx = 0; sNdx < _vVolumes.size(); ++sNdx) {
+			if (GetMaskBit(vMask, sNdx) != (vScalar[sNdx] != 0)) {
+				return false;
+			}
+
+			sHits += vScalar[sNdx];
+		}
+
+		//Bits past the end of the input stay clear, and the data has to exercise both outcomes
+		return (vMask.back() >> (_vVolumes.size() % 32)) == 0U && sHits > 0 && sHits < _vVolumes.size();
+	}
+
+	void InitTests_Geometry(std::vector<TestBlock>& _vBlockList) {
+		TestBlock tbBlock = TestBlock("Math Library - Geometry");
+
+		tbBlock.AddTest("Frustum Plane Extraction", [](float& _fDelta) -> const bool {
+			const MatrixF mViewProjection = GeometryTestViewProjection();
+			Random rand(1);
+			FrustumF fFrustum;
+
+			HC_TIME_EXECUTION(fFrustum = FrustumF(mViewProjection), _fDelta);
+
+			//Every plane agrees with the clip space bounds -w <= x, y <= w and 0 <= z <= w
+			for (int iNdx = 0; iNdx < 1024; ++iNdx) {
+				const Vec3F vPoint = RandomTestVec3F(rand) * 20.0f;
+				const Vec4F vClip = mViewProjection[0] * vPoint.x + mViewProjection[1] * vPoint.y + mViewProjection[2] * vPoint.z + mViewProjection[3];
+				const bool bClipInside = fabsf(vClip.x) <= vClip.w && fabsf(vClip.y) <= vClip.w && vClip.z >= 0.0f && vClip.z <= vClip.w;
+
+				bool bPlaneInside = true;
+				for (const PlaneF& pPlane : fFrustum.m_pPlanes) { bPlaneInside &= SignedDistance(pPlane, vPoint) >= 0.0f; }
+
+				if (bClipInside != bPlaneInside) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("Frustum Sphere", [](float& _fDelta) -> const bool {
+			const FrustumF fFrustum = FrustumF(GeometryTestViewProjection());
+			bool bAhead = false, bBehind = true, bBeside = true, bStraddling = false;
+
+			HC_TIME_EXECUTION(bAhead = Intersects(fFrustum, SphereF(Vec3F(0.0f, 0.0f, 5.0f), 1.0f)), _fDelta);
+
+			bBehind = Intersects(fFrustum, SphereF(Vec3F(0.0f, 0.0f, -15.0f), 1.0f));
+			bBeside = Intersects(fFrustum, SphereF(Vec3F(30.0f, 0.0f, 0.0f), 1.0f));
+			bStraddling = Intersects(fFrustum, SphereF(Vec3F(0.0f, 0.0f, -10.0f), 1.0f));
+
+			return bAhead && !bBehind && !bBeside && bStraddling;
+		});
+
+		tbBlock.AddTest("Frustum AABB And OBB", [](float& _fDelta) -> const bool {
+			const FrustumF fFrustum = FrustumF(GeometryTestViewProjection());
+			const AABBF bBeside = AABBF(Vec3F(29.0f, -1.0f, -1.0f), Vec3F(31.0f, 1.0f, 1.0f));
+			//Long and thin, and only reaches into view once it is turned towards the centre
+			const OBBF bTurned = OBBF(Vec3F(20.0f, 0.0f, 0.0f), Vec3F(0.5f, 0.5f, 20.0f), QuaternionF(Vec3F(0.0f, 1.0f, 0.0f), HC_DEG2RAD(90.0f)));
+			const OBBF bStraight = OBBF(Vec3F(20.0f, 0.0f, 0.0f), Vec3F(0.5f, 0.5f, 20.0f), QuaternionF());
+			bool bAhead = false;
+
+			HC_TIME_EXECUTION(bAhead = Intersects(fFrustum, AABBF(Vec3F(-1.0f), Vec3F(1.0f))), _fDelta);
+
+			return bAhead && !Intersects(fFrustum, bBeside) && Intersects(fFrustum, bTurned) && !Intersects(fFrustum, bStraight);
+		});
+
+		tbBlock.AddTest("Overlap Tests", [](float& _fDelta) -> const bool {
+			const AABBF bBox = AABBF(Vec3F(-1.0f), Vec3F(1.0f));
+			bool bTouching = false;
+
+			HC_TIME_EXECUTION(bTouching = Intersects(bBox, AABBF(Vec3F(1.0f, 0.0f, 0.0f), Vec3F(2.0f))), _fDelta);
+
+			return bTouching && !Intersects(bBox, AABBF(Vec3F(1.5f), Vec3F(2.0f))) &&
+				   Intersects(bBox, SphereF(Vec3F(1.5f, 1.5f, 0.0f), 0.75f)) && !Intersects(bBox, SphereF(Vec3F(1.5f, 1.5f, 1.5f), 0.75f)) &&
+				   Intersects(SphereF(Vec3F(), 1.0f), SphereF(Vec3F(1.5f, 0.0f, 0.0f), 0.5f)) && !Intersects(SphereF(Vec3F(), 1.0f), SphereF(Vec3F(1.5f, 0.5f, 0.0f), 0.5f)) &&
+				   Contains(bBox, Vec3F(0.5f)) && !Contains(bBox, Vec3F(0.5f, 1.5f, 0.0f));
+		});
+
+		tbBlock.AddTest("TransformAABB", [](float& _fDelta) -> const bool {
+			const AABBF bBox = AABBF(Vec3F(-1.0f, -2.0f, -3.0f), Vec3F(2.0f, 1.0f, 0.5f));
+			const MatrixF mMat = ComposeTRS(Vec3F(5.0f, -3.0f, 2.0f), Normalize(QuaternionF(0.3f, -0.2f, 0.5f, 0.8f)), Vec3F(1.0f, 2.0f, 0.5f));
+			AABBF bRes;
+
+			HC_TIME_EXECUTION(bRes = TransformAABB(bBox, mMat), _fDelta);
+
+			//Must equal the bounds of the eight transformed corners
+			AABBF bExpected = AABBF(Vec3F(FLT_MAX), Vec3F(-FLT_MAX));
+			for (int iCorner = 0; iCorner < 8; ++iCorner) {
+				const Vec3F vCorner = Vec3F((iCorner & 1) ? bBox.m_vMax.x : bBox.m_vMin.x, (iCorner & 2) ? bBox.m_vMax.y : bBox.m_vMin.y, (iCorner & 4) ? bBox.m_vMax.z : bBox.m_vMin.z);
+				bExpected = Merge(bExpected, TransformPoint(mMat, vCorner));
+			}
+
+			return Length(bRes.m_vMin - bExpected.m_vMin) <= 1.0e-4f && Length(bRes.m_vMax - bExpected.m_vMax) <= 1.0e-4f;
+		});
+
+		tbBlock.AddTest("Ray Tests", [](float& _fDelta) -> const bool {
+			const RayF rRay = RayF(Vec3F(0.0f, 0.0f, -10.0f), Vec3F(0.0f, 0.0f, 1.0f));
+			float fBox = -1.0f, fSphere = -1.0f, fPlane = -1.0f, fInside = -1.0f, fUnused = 0.0f;
+			bool bBox = false;
+
+			HC_TIME_EXECUTION(bBox = Intersects(rRay, AABBF(Vec3F(-1.0f), Vec3F(1.0f)), fBox), _fDelta);
+
+			const bool bSphere = Intersects(rRay, SphereF(Vec3F(0.0f, 0.5f, 0.0f), 1.0f), fSphere);
+			const bool bPlane = Intersects(rRay, PlaneF(Vec3F(0.0f, 0.0f, -1.0f), Vec3F(0.0f, 0.0f, 4.0f)), fPlane);
+			const bool bInside = Intersects(RayF(Vec3F(), Vec3F(1.0f, 0.0f, 0.0f)), AABBF(Vec3F(-1.0f), Vec3F(1.0f)), fInside);
+			const bool bBehind = Intersects(RayF(Vec3F(0.0f, 0.0f, 5.0f), Vec3F(0.0f, 0.0f, 1.0f)), SphereF(Vec3F(), 1.0f), fUnused);
+			const bool bMissed = Intersects(rRay, AABBF(Vec3F(2.0f, 2.0f, -1.0f), Vec3F(3.0f, 3.0f, 1.0f)), fUnused);
+
+			return bBox && fabsf(fBox - 9.0f) <= 1.0e-5f && bSphere && fabsf(fSphere - (10.0f - sqrtf(0.75f))) <= 1.0e-5f &&
+				   bPlane && fabsf(fPlane - 14.0f) <= 1.0e-5f && bInside && fInside == 0.0f && !bBehind && !bMissed;
+		});
+
+		tbBlock.AddTest("Batched Frustum Spheres", [](float& _fDelta) -> const bool {
+			const FrustumF fFrustum = FrustumF(GeometryTestViewProjection());
+
+			return RunGeometryComparison("Frustum vs spheres", GenerateGeometrySpheres(GEOMETRY_TEST_COUNT, 2),
+				[&](const std::vector<SphereF>& _vSpheres, std::vector<uint32_t>& _vMask) { Math::Intersects(fFrustum, _vSpheres, _vMask); },
+				[&](const SphereF& _sSphere) -> uint8_t { return Intersects(fFrustum, _sSphere); }, _fDelta);
+		});
+
+		tbBlock.AddTest("Batched Frustum AABBs", [](float& _fDelta) -> const bool {
+			const FrustumF fFrustum = FrustumF(GeometryTestViewProjection());
+
+			return RunGeometryComparison("Frustum vs AABBs", GenerateGeometryAABBs(GEOMETRY_TEST_COUNT, 3),
+				[&](const std::vector<AABBF>& _vBoxes, std::vector<uint32_t>& _vMask) { Math::Intersects(fFrustum, _vBoxes, _vMask); },
+				[&](const AABBF& _bBox) -> uint8_t { return Intersects(fFrustum, _bBox); }, _fDelta);
+		});
+
+		tbBlock.AddTest("Batched Ray AABBs", [](float& _fDelta) -> const bool {
+			const RayF rRay = RayF(Vec3F(-30.0f, -5.0f, -40.0f), Normalize(Vec3F(0.8f, 0.1f, 1.0f)));
+
+			return RunGeometryComparison("Ray vs AABBs", GenerateGeometryAABBs(GEOMETRY_TEST_COUNT, 4),
+				[&](const std::vector<AABBF>& _vBoxes, std::vector<uint32_t>& _vMask) { Math::Intersects(rRay, _vBoxes, _vMask); },
+				[&](const AABBF& _bBox) -> uint8_t { float fDistance; return Intersects(rRay, _bBox, fDistance); }, _fDelta);
+		});
+
+		tbBlock.AddTest("Pick Closest AABB", [](float& _fDelta) -> const bool {
+			const std::vector<AABBF> vBoxes = GenerateGeometryAABBs(GEOMETRY_TEST_COUNT, 5);
+			const RayF rRay = RayF(Vec3F(-30.0f, 2.0f, -40.0f), Normalize(Vec3F(0.7f, -0.05f, 1.0f)));
+			float fDistance = -1.0f;
+			int64_t iPicked = -1;
+
+			HC_TIME_EXECUTION(iPicked = Math::Pick(rRay, vBoxes, fDistance), _fDelta);
+
+			int64_t iExpected = -1;
+			float fExpected = FLT_MAX;
+			for (size_t sNdx = 0; sNdx < vBoxes.size(); ++sNdx) {
+				float fHit;
+				if (Intersects(rRay, vBoxes[sNdx], fHit) && fHit < fExpected) {
+					fExpected = fHit;
+					iExpected = static_cast<int64_t>(sNdx);
+				}
+			}
+
+			return iExpected >= 0 && iPicked == iExpected && fabsf(fDistance - fExpected) <= 1.0e-4f;
+		});
+
+		_vBlockList.push_back(tbBlock);
+	}
+}
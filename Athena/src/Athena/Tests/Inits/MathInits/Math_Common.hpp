@@ -4,4 +4,122 @@
 #include <Athena/Core/Util.hpp>
 
 #include <HellfireControl/Math/Math.hpp>
-#include <HellfireControl/Math/Random.hpp>
\ No newline at end of file
+#include <HellfireControl/Math/Random.hpp>
+
+#include <string>
+#include <vector>
+
+namespace MathTests {
+	//Every component in [-1, 1]. Scale the result for a wider range.
+	inline Vec2F RandomTestVec2F(Random& _rRand) { return Vec2F(_rRand.GenerateFloat(-1.0f, 1.0f), _rRand.GenerateFloat(-1.0f, 1.0f)); }
+	inline Vec3F RandomTestVec3F(Random& _rRand) { return Vec3F(_rRand.GenerateFloat(-1.0f, 1.0f), _rRand.GenerateFloat(-1.0f, 1.0f), _rRand.GenerateFloat(-1.0f, 1.0f)); }
+	inline Vec4F RandomTestVec4F(Random& _rRand) { return Vec4F(_rRand.GenerateFloat(-1.0f, 1.0f), _rRand.GenerateFloat(-1.0f, 1.0f), _rRand.GenerateFloat(-1.0f, 1.0f), _rRand.GenerateFloat(-1.0f, 1.0f)); }
+	inline MatrixF RandomTestMatrixF(Random& _rRand) { return MatrixF(RandomTestVec4F(_rRand), RandomTestVec4F(_rRand), RandomTestVec4F(_rRand), RandomTestVec4F(_rRand)); }
+	inline Vec4D RandomTestVec4D(Random& _rRand) { return Vec4D(_rRand.GenerateDouble(-1.0, 1.0), _rRand.GenerateDouble(-1.0, 1.0), _rRand.GenerateDouble(-1.0, 1.0), _rRand.GenerateDouble(-1.0, 1.0)); }
+	inline MatrixD RandomTestMatrixD(Random& _rRand) { return MatrixD(RandomTestVec4D(_rRand), RandomTestVec4D(_rRand), RandomTestVec4D(_rRand), RandomTestVec4D(_rRand)); }
+	inline QuaternionF RandomTestQuaternionF(Random& _rRand) { return Normalize(QuaternionF(RandomTestVec4F(_rRand))); }
+
+	//_sCount values from _fnGenerate on a generator seeded with _uSeed, so every run sees the same data
+	template<typename Type, typename Generator>
+	std::vector<Type> GenerateTestValues(size_t _sCount, uint64_t _uSeed, Generator _fnGenerate) {
+		Random rand(_uSeed);
+		std::vector<Type> vRes(_sCount);
+
+		for (Type& tVal : vRes) { tVal = _fnGenerate(rand); }
+
+		return vRes;
+	}
+
+	inline std::vector<float> GenerateTestFloats(size_t _sCount, uint64_t _uSeed, float _fMin, float _fMax) {
+		return GenerateTestValues<float>(_sCount, _uSeed, [=](Random& _rRand) { return _rRand.GenerateFloat(_fMin, _fMax); });
+	}
+
+	//Every component in [-_fExtent, _fExtent]
+	inline std::vector<Vec3F> GenerateTestVec3F(size_t _sCount, uint64_t _uSeed, float _fExtent = 1.0f) {
+		return GenerateTestValues<Vec3F>(_sCount, _uSeed, [=](Random& _rRand) { return RandomTestVec3F(_rRand) * _fExtent; });
+	}
+
+	inline std::vector<QuaternionF> GenerateTestQuaternionF(size_t _sCount, uint64_t _uSeed) { return GenerateTestValues<QuaternionF>(_sCount, _uSeed, RandomTestQuaternionF); }
+
+	//Distance from the reference within a fixed _fTolerance
+	inline bool TestCompare(const Vec3F& _vValue, const Vec3F& _vReference, float _fTolerance) { return Length(_vValue - _vReference) <= _fTolerance; }
+	inline bool TestCompare(const Vec4F& _vValue, const Vec4F& _vReference, float _fTolerance) { return Length(_vValue - _vReference) <= _fTolerance; }
+
+	//Distance from the reference within _fTolerance of its length, or of one for anything shorter. Paths that round in a
+	//different order are held to the same number of significant digits whatever the magnitude.
+	inline bool TestCompareRelative(float _fValue, float _fReference, float _fTolerance = 1.0e-5f) { return fabsf(_fValue - _fReference) <= _fTolerance * fmaxf(1.0f, fabsf(_fReference)); }
+	inline bool TestCompareRelative(const Vec2F& _vValue, const Vec2F& _vReference, float _fTolerance = 1.0e-5f) { return Length(_vValue - _vReference) <= _fTolerance * fmaxf(1.0f, Length(_vReference)); }
+	inline bool TestCompareRelative(const Vec3F& _vValue, const Vec3F& _vReference, float _fTolerance = 1.0e-5f) { return Length(_vValue - _vReference) <= _fTolerance * fmaxf(1.0f, Length(_vReference)); }
+	inline bool TestCompareRelative(const Vec4F& _vValue, const Vec4F& _vReference, float _fTolerance = 1.0e-5f) { return Length(_vValue - _vReference) <= _fTolerance * fmaxf(1.0f, Length(_vReference)); }
+	inline bool TestCompareRelative(const MatrixF& _mValue, const MatrixF& _mReference, float _fTolerance = 1.0e-5f) {
+		return TestCompareRelative(_mValue[0], _mReference[0], _fTolerance) && TestCompareRelative(_mValue[1], _mReference[1], _fTolerance) &&
+			   TestCompareRelative(_mValue[2], _mReference[2], _fTolerance) && TestCompareRelative(_mValue[3], _mReference[3], _fTolerance);
+	}
+
+	inline bool TestCompareRelative(double _dValue, double _dReference, double _dTolerance = 1.0e-12) { return fabs(_dValue - _dReference) <= _dTolerance * fmax(1.0, fabs(_dReference)); }
+	inline bool TestCompareRelative(const Vec4D& _vValue, const Vec4D& _vReference, double _dTolerance = 1.0e-12) { return Length(_vValue - _vReference) <= _dTolerance * fmax(1.0, Length(_vReference)); }
+	inline bool TestCompareRelative(const MatrixD& _mValue, const MatrixD& _mReference, double _dTolerance = 1.0e-12) {
+		return TestCompareRelative(_mValue[0], _mReference[0], _dTolerance) && TestCompareRelative(_mValue[1], _mReference[1], _dTolerance) &&
+			   TestCompareRelative(_mValue[2], _mReference[2], _dTolerance) && TestCompareRelative(_mValue[3], _mReference[3], _dTolerance);
+	}
+
+	//Prints how many times longer _fReferenceDelta took than _fDelta, naming the reference it was measured against
+	inline void PrintSpeedup(const std::string& _strName, float _fDelta, float _fReferenceDelta, const std::string& _strReference) {
+		Console::Print("\t" + _strName + ": " + std::to_string(_fReferenceDelta / (_fDelta > 0.0f ? _fDelta : 1.0f)) + "x vs " + _strReference + "\n", Console::YELLOW);
+	}
+
+	/// <summary>
+	/// Runs _fnBatch and _fnReference over every input, timing each into its own delta, prints the speedup of the batch over the
+	/// reference and then checks each result pair with _fnCompare. _fDelta receives the batch timing. Only the compare decides the result.
+	/// </summary>
+	template<typename Input, typename BatchFunc, typename ReferenceFunc, typename CompareFunc>
+	bool RunBatchComparison(const std::string& _strName, const std::string& _strReference, const std::vector<Input>& _vInputs, BatchFunc _fnBatch, ReferenceFunc _fnReference, CompareFunc _fnCompare, float& _fDelta) {
+		std::vector<decltype(_fnBatch(_vInputs[0]))> vBatch(_vInputs.size());
+		std::vector<decltype(_fnReference(_vInputs[0]))> vReference(_vInputs.size());
+		float fReferenceDelta = 0.0f;
+
+		//Untimed pass first so neither path pays for cold caches
+		for (size_t sNdx = 0; sNdx < _vInputs.size(); ++sNdx) {
+			vBatch[sNdx] = _fnBatch(_vInputs[sNdx]);
+			vReference[sNdx] = _fnReference(_vInputs[sNdx]);
+		}
+
+		{
+			HC_TIME_EXECUTION(for (size_t sNdx = 0; sNdx < _vInputs.size(); ++sNdx) vBatch[sNdx] = _fnBatch(_vInputs[sNdx]), _fDelta);
+		}
+
+		{
+			HC_TIME_EXECUTION(for (size_t sNdx = 0; sNdx < _vInputs.size(); ++sNdx) vReference[sNdx] = _fnReference(_vInputs[sNdx]), fReferenceDelta);
+		}
+
+		PrintSpeedup(_strName, _fDelta, fReferenceDelta, _strReference);
+
+		for (size_t sNdx = 0; sNdx < _vInputs.size(); ++sNdx) {
+			if (!_fnCompare(vBatch[sNdx], vReference[sNdx])) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	//Times a call that processes a whole array and the scalar loop it replaces, each after an untimed warm up pass, and prints
+	//the speedup. _fDelta receives the batch timing and both results are left for the test to compare.
+	template<typename BatchFunc, typename ReferenceFunc>
+	void RunBatchThenReference(const std::string& _strName, const std::string& _strReference, BatchFunc _fnBatch, ReferenceFunc _fnReference, float& _fDelta) {
+		float fReferenceDelta = 0.0f;
+
+		_fnBatch();
+		_fnReference();
+
+		{
+			HC_TIME_EXECUTION(_fnBatch(), _fDelta);
+		}
+
+		{
+			HC_TIME_EXECUTION(_fnReference(), fReferenceDelta);
+		}
+
+		PrintSpeedup(_strName, _fDelta, fReferenceDelta, _strReference);
+	}
+}
@@ -19,6 +19,35 @@ namespace MathTests {
 					   matRes.m_vRow3 == Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
 			});
 
+			tbBlock.AddTest("MatrixF Constexpr Builders", [](float& _fDelta) -> const bool {
+				constexpr MatrixF matIdentity = IdentityF();
+				constexpr MatrixF matTranslation = TranslationF(Vec3F(1.0f, 2.0f, 3.0f));
+				constexpr MatrixF matScale = ScaleXYZF(Vec3F(2.0f, 3.0f, 4.0f));
+				constexpr MatrixF matRotation = RotationZDegF(30.0f);
+
+				static_assert(matIdentity.m_vRow0[0] == 1.0f && matIdentity.m_vRow3[3] == 1.0f && matIdentity.m_vRow1[0] == 0.0f);
+				static_assert(matTranslation.m_vRow3[0] == 1.0f && matTranslation.m_vRow3[1] == 2.0f && matTranslation.m_vRow3[2] == 3.0f);
+				static_assert(matScale.m_vRow0[0] == 2.0f && matScale.m_vRow1[1] == 3.0f && matScale.m_vRow2[2] == 4.0f);
+#if !HC_USE_SIMD
+				static_assert(Dot(Vec3F(1.0f, 2.0f, 3.0f), Vec3F(4.0f, 5.0f, 6.0f)) == 32.0f);
+				static_assert(Cross(Vec3F(1.0f, 0.0f, 0.0f), Vec3F(0.0f, 1.0f, 0.0f))[2] == 1.0f);
+#endif
+
+				//Compile time rotations come from the polynomial kernel, so they only have to agree with libm closely
+				MatrixF matRes;
+				volatile float fDeg = 30.0f;
+
+				HC_TIME_EXECUTION(matRes = RotationZDegF(fDeg), _fDelta);
+
+				for (int iNdx = 0; iNdx < 4; ++iNdx) {
+					if (Length(matRes[iNdx] - matRotation[iNdx]) > 1.0e-6f) {
+						return false;
+					}
+				}
+
+				return true;
+			});
+
 			tbBlock.AddTest("MatrixF Transpose", [](float& _fDelta) -> const bool {
 				MatrixF mat;
 				MatrixF matRes;
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <Athena/Tests/Inits/MathInits/Math_Common.hpp>
+
+#include <HellfireControl/Math/Noise.hpp>
+
+namespace MathTests {
+	constexpr NoiseType NOISE_TEST_TYPES[] = { NOISE_VALUE, NOISE_PERLIN, NOISE_SIMPLEX };
+
+	void InitTests_Noise(std::vector<TestBlock>& _vBlockList) {
+		TestBlock tbBlock = TestBlock("Math Library - Noise");
+
+		tbBlock.AddTest("Noise Range And Seeding", [](float& _fDelta) -> const bool {
+			Random rand(17);
+			bool bRes = true;
+
+			{
+				Noise nNoise(rand);
+				float fVal = 0.0f;
+				HC_TIME_EXECUTION(fVal = nNoise.Sample(Vec3F(0.3f, 1.7f, -2.2f)), _fDelta);
+				bRes &= fVal >= -1.0f && fVal <= 1.0f;
+			}
+
+			for (const NoiseType ntType : NOISE_TEST_TYPES) {
+				const Noise nNoise(1234U, ntType), nSame(1234U, ntType), nOther(4321U, ntType);
+				int iDiffers = 0;
+
+				for (int iNdx = 0; iNdx < 2000; ++iNdx) {
+					const Vec4F vPos = RandomTestVec4F(rand) * 100.0f;
+					const float fVals[] = { nNoise.Sample(Vec2F(vPos.x, vPos.y)), nNoise.Sample(vPos.XYZ()), nNoise.Sample(vPos) };
+
+					for (const float fVal : fVals) { bRes &= fVal >= -1.0f && fVal <= 1.0f; }
+
+					bRes &= nSame.Sample(vPos.XYZ()) == fVals[1];
+					iDiffers += nOther.Sample(vPos.XYZ()) != fVals[1] ? 1 : 0;
+				}
+
+				bRes &= iDiffers > 1900;
+			}
+
+			return bRes;
+			});
+
+		tbBlock.AddTest("Noise Batch Matches Single", [](float& _fDelta) -> const bool {
+			Random rand(3);
+			std::vector<Vec3F> vPos(1027);
+			std::vector<float> fBatch(vPos.size());
+			bool bRes = true;
+
+			for (Vec3F& vVal : vPos) { vVal = RandomTestVec3F(rand) * 40.0f; }
+
+			for (const NoiseType ntType : NOISE_TEST_TYPES) {
+				Noise nNoise(rand, ntType);
+				nNoise.SetFractal(FRACTAL_FBM, 4);
+
+				HC_TIME_EXECUTION(nNoise.Sample(std::span<const Vec3F>(vPos), std::span<float>(fBatch)), _fDelta);
+
+				for (size_t sNdx = 0; sNdx < vPos.size(); ++sNdx) { bRes &= fBatch[sNdx] == nNoise.Sample(vPos[sNdx]); }
+			}
+
+			return bRes;
+			});
+
+		tbBlock.AddTest("Noise Continuity", [](float& _fDelta) -> const bool {
+			Random rand(29);
+			bool bRes = true;
+
+			//A seam in the lattice or a wrong simplex would show up as a jump between two points a hair apart
+			for (const NoiseType ntType : NOISE_TEST_TYPES) {
+				const Noise nNoise(99U, ntType);
+				float fWorst = 0.0f;
+
+				for (int iNdx = 0; iNdx < 20000; ++iNdx) {
+					const Vec4F vPos = RandomTestVec4F(rand) * 20.0f;
+					const Vec4F vStep = RandomTestVec4F(rand) * 1.0e-3f;
+
+					fWorst = fmaxf(fWorst, fabsf(nNoise.Sample(Vec2F(vPos.x, vPos.y)) - nNoise.Sample(Vec2F(vPos.x + vStep.x, vPos.y + vStep.y))));
+					fWorst = fmaxf(fWorst, fabsf(nNoise.Sample(vPos.XYZ()) - nNoise.Sample((vPos + vStep).XYZ())));
+					fWorst = fmaxf(fWorst, fabsf(nNoise.Sample(vPos) - nNoise.Sample(vPos + vStep)));
+				}
+
+				bRes &= fWorst < 0.03f;
+			}
+
+			//Gradient noise passes through zero at every lattice point
+			const Noise nPerlin(5U, NOISE_PERLIN);
+			HC_TIME_EXECUTION(bRes &= nPerlin.Sample(Vec3F(3.0f, -7.0f, 12.0f)) == 0.0f, _fDelta);
+
+			return bRes;
+			});
+
+		tbBlock.AddTest("Noise Fractals", [](float& _fDelta) -> const bool {
+			Random rand(8);
+			Noise nFbm(rand), nRidged(rand);
+			bool bRes = true;
+			double dFbm = 0.0, dRidged = 0.0;
+
+			nFbm.SetFractal(FRACTAL_FBM, 6);
+			nRidged.SetFractal(FRACTAL_RIDGED, 6);
+			nFbm.SetFrequency(0.05f);
+
+			HC_TIME_EXECUTION(dFbm += nFbm.Sample(Vec2F(1.5f, 2.5f)), _fDelta);
+
+			for (int iNdx = 0; iNdx < 20000; ++iNdx) {
+				const Vec2F vPos = Vec2F(rand.GenerateFloat(-500.0f, 500.0f), rand.GenerateFloat(-500.0f, 500.0f));
+				const float fFbm = nFbm.Sample(vPos), fRidged = nRidged.Sample(vPos);
+
+				bRes &= fFbm >= -1.0f && fFbm <= 1.0f && fRidged >= -1.0f && fRidged <= 1.0f;
+				dFbm += fFbm;
+				dRidged += fRidged;
+			}
+
+			//fBm hovers around zero. Ridged noise folds the basis's many near-zero values up toward its crests, so it sits higher.
+			return bRes && fabs(dFbm / 20000.0) < 0.05 && dRidged / 20000.0 > 0.05;
+			});
+
+		tbBlock.AddTest("Noise Fill Grid", [](float& _fDelta) -> const bool {
+			constexpr uint32_t WIDTH = 512, HEIGHT = 512;
+			Noise nNoise(777U);
+			std::vector<float> vThreaded(WIDTH * HEIGHT), vSingle(WIDTH * HEIGHT);
+			bool bRes = true;
+
+			nNoise.SetFractal(FRACTAL_FBM, 5);
+			nNoise.SetFrequency(1.0f / 64.0f);
+
+			RunBatchThenReference("FillGrid 512x512, 5 octaves", "one thread", [&]() { nNoise.FillGrid(std::span<float>(vThreaded), WIDTH, HEIGHT, Vec2F(-10.0f, 20.0f), Vec2F(1.0f, 1.0f)); },
+				[&]() { nNoise.FillGrid(std::span<float>(vSingle), WIDTH, HEIGHT, Vec2F(-10.0f, 20.0f), Vec2F(1.0f, 1.0f), 1U); }, _fDelta);
+
+			bRes &= vThreaded == vSingle;
+
+			//Bands that do not divide the rows evenly still cover every row once
+			std::fill(vThreaded.begin(), vThreaded.end(), 2.0f);
+			nNoise.FillGrid(std::span<float>(vThreaded), WIDTH, HEIGHT, Vec2F(-10.0f, 20.0f), Vec2F(1.0f, 1.0f), 3U);
+			bRes &= vThreaded == vSingle;
+
+			for (uint32_t uNdx = 0; uNdx < WIDTH * HEIGHT; uNdx += 997) {
+				bRes &= vSingle[uNdx] == nNoise.Sample(Vec2F(-10.0f + static_cast<float>(uNdx % WIDTH), 20.0f + static_cast<float>(uNdx / WIDTH)));
+			}
+
+			//Volumes step slices along z
+			std::vector<float> vVolume(33 * 17 * 9);
+			nNoise.FillGrid(std::span<float>(vVolume), 33, 17, 9, Vec3F(0.0f, 0.0f, 0.0f), Vec3F(2.0f, 3.0f, 4.0f));
+
+			bRes &= vVolume[(8 * 17 + 16) * 33 + 32] == nNoise.Sample(Vec3F(64.0f, 48.0f, 32.0f));
+
+			return bRes;
+			});
+
+		_vBlockList.push_back(tbBlock);
+	}
+}
@@ -0,0 +1,244 @@
+#pragma once
+
+#include <Athena/Tests/Inits/MathInits/Math_Common.hpp>
+
+#include <HellfireControl/Math/Pack.hpp>
+
+#include <cstring>
+
+namespace MathTests {
+	//Roughly a mesh's worth of values, and not a multiple of four so every batch has a tail
+	constexpr size_t PACK_TEST_COUNT = 4099;
+
+	inline std::vector<Vec3F> GeneratePackNormals(size_t _sCount, uint64_t _uSeed) {
+		return GenerateTestValues<Vec3F>(_sCount, _uSeed, [](Random& _rRand) { return Normalize(RandomTestVec3F(_rRand) + Vec3F(0.0f, 0.0f, 1.0e-3f)); });
+	}
+
+	inline std::vector<QuaternionF> GeneratePackQuaternions(size_t _sCount, uint64_t _uSeed) {
+		return GenerateTestValues<QuaternionF>(_sCount, _uSeed, [](Random& _rRand) { return Normalize(QuaternionF(RandomTestVec4F(_rRand) + Vec4F(0.0f, 0.0f, 0.0f, 1.0e-3f))); });
+	}
+
+	//Angle between two rotations, treating q and -q as the same
+	inline float PackQuaternionAngle(const QuaternionF& _qLeft, const QuaternionF& _qRight) {
+		const float fDot = fabsf(_qLeft.x * _qRight.x + _qLeft.y * _qRight.y + _qLeft.z * _qRight.z + _qLeft.w * _qRight.w);
+		return 2.0f * acosf(fminf(fDot, 1.0f));
+	}
+
+	void InitTests_Pack(std::vector<TestBlock>& _vBlockList) {
+		TestBlock tbBlock = TestBlock("Math Library - Pack");
+
+		tbBlock.AddTest("Half Round Trip", [](float& _fDelta) -> const bool {
+			uint16_t uOne = 0U;
+
+			HC_TIME_EXECUTION(uOne = FloatToHalf(1.0f), _fDelta);
+
+			//Every half that is not NaN survives the trip through float unchanged
+			for (uint32_t uHalf = 0U; uHalf <= 0xFFFFU; ++uHalf) {
+				if ((uHalf & 0x7FFFU) > 0x7C00U) {
+					if (!std::isnan(HalfToFloat(static_cast<uint16_t>(uHalf))) || (FloatToHalf(HalfToFloat(static_cast<uint16_t>(uHalf))) & 0x7FFFU) <= 0x7C00U) {
+						return false;
+					}
+
+					continue;
+				}
+
+				if (FloatToHalf(HalfToFloat(static_cast<uint16_t>(uHalf))) != uHalf) {
+					return false;
+				}
+			}
+
+			//Ties round to even, overflow goes to infinity and the smallest denormal survives
+			return uOne == 0x3C00U && FloatToHalf(1.0f + ldexpf(1.0f, -11)) == 0x3C00U && FloatToHalf(1.0f + 3.0f * ldexpf(1.0f, -11)) == 0x3C02U &&
+				   FloatToHalf(65520.0f) == 0x7C00U && FloatToHalf(-1.0e10f) == 0xFC00U && FloatToHalf(ldexpf(1.0f, -24)) == 0x0001U &&
+				   FloatToHalf(ldexpf(1.0f, -26)) == 0x0000U && HalfToFloat(0x0001U) == ldexpf(1.0f, -24) && HalfToFloat(0xC000U) == -2.0f;
+		});
+
+		tbBlock.AddTest("Batched Half", [](float& _fDelta) -> const bool {
+			//Wide enough to cover denormals and overflow
+			std::vector<float> vFloats = GenerateTestFloats(PACK_TEST_COUNT, 1, -70000.0f, 70000.0f);
+			for (size_t sNdx = 0; sNdx < vFloats.size(); sNdx += 3) { vFloats[sNdx] *= 1.0e-9f; }
+
+			std::vector<uint16_t> vBatch(vFloats.size()), vScalar(vFloats.size());
+			std::vector<float> vBatchBack(vFloats.size()), vScalarBack(vFloats.size());
+
+			RunBatchThenReference("Float to half", "scalar", [&]() { Math::PackHalf(vFloats, vBatch); },
+				[&]() { for (size_t sNdx = 0; sNdx < vFloats.size(); ++sNdx) vScalar[sNdx] = FloatToHalf(vFloats[sNdx]); }, _fDelta);
+
+			float fUnused = 0.0f;
+			RunBatchThenReference("Half to float", "scalar", [&]() { Math::UnpackHalf(vBatch, vBatchBack); },
+				[&]() { for (size_t sNdx = 0; sNdx < vScalar.size(); ++sNdx) vScalarBack[sNdx] = HalfToFloat(vScalar[sNdx]); }, fUnused);
+
+			return vBatch == vScalar && memcmp(vBatchBack.data(), vScalarBack.data(), vBatchBack.size() * sizeof(float)) == 0;
+		});
+
+		tbBlock.AddTest("Snorm And Unorm", [](float& _fDelta) -> const bool {
+			int16_t iHalf = 0;
+
+			HC_TIME_EXECUTION(iHalf = PackSnorm16(0.5f), _fDelta);
+
+			//Endpoints are exact, the most negative code decodes to -1 and out of range values clamp
+			if (iHalf != 16384 || PackSnorm8(-1.0f) != -127 || PackSnorm8(2.0f) != 127 || PackUnorm8(1.0f) != 255 || PackUnorm8(-0.5f) != 0 ||
+				PackUnorm16(1.0f) != 65535U || UnpackSnorm8(-128) != -1.0f || UnpackSnorm16(-32768) != -1.0f || UnpackUnorm16(65535U) != 1.0f) {
+				return false;
+			}
+
+			for (int iCode = -128; iCode <= 127; ++iCode) {
+				if (iCode > -128 && PackSnorm8(UnpackSnorm8(static_cast<int8_t>(iCode))) != iCode) {
+					return false;
+				}
+			}
+
+			for (int iCode = 0; iCode <= 255; ++iCode) {
+				if (PackUnorm8(UnpackUnorm8(static_cast<uint8_t>(iCode))) != iCode) {
+					return false;
+				}
+			}
+
+			//Error is never more than half a step
+			for (const float fVal : GenerateTestFloats(PACK_TEST_COUNT, 2, -1.0f, 1.0f)) {
+				if (fabsf(UnpackSnorm16(PackSnorm16(fVal)) - fVal) > 0.5f / 32767.0f + 1.0e-7f || fabsf(UnpackUnorm16(PackUnorm16(fabsf(fVal))) - fabsf(fVal)) > 0.5f / 65535.0f + 1.0e-7f) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("Batched Snorm And Unorm", [](float& _fDelta) -> const bool {
+			const std::vector<float> vFloats = GenerateTestFloats(PACK_TEST_COUNT, 3, -1.25f, 1.25f);
+			std::vector<int8_t> vSnorm8(vFloats.size()), vSnorm8Scalar(vFloats.size());
+			std::vector<uint8_t> vUnorm8(vFloats.size()), vUnorm8Scalar(vFloats.size());
+			std::vector<int16_t> vSnorm16(vFloats.size()), vSnorm16Scalar(vFloats.size());
+			std::vector<uint16_t> vUnorm16(vFloats.size()), vUnorm16Scalar(vFloats.size());
+
+			RunBatchThenReference("Float to snorm16", "scalar", [&]() { Math::PackSnorm16(vFloats, vSnorm16); },
+				[&]() { for (size_t sNdx = 0; sNdx < vFloats.size(); ++sNdx) vSnorm16Scalar[sNdx] = PackSnorm16(vFloats[sNdx]); }, _fDelta);
+
+			Math::PackSnorm8(vFloats, vSnorm8);
+			Math::PackUnorm8(vFloats, vUnorm8);
+			Math::PackUnorm16(vFloats, vUnorm16);
+
+			for (size_t sNdx = 0; sNdx < vFloats.size(); ++sNdx) {
+				vSnorm8Scalar[sNdx] = PackSnorm8(vFloats[sNdx]);
+				vUnorm8Scalar[sNdx] = PackUnorm8(vFloats[sNdx]);
+				vUnorm16Scalar[sNdx] = PackUnorm16(vFloats[sNdx]);
+			}
+
+			if (vSnorm8 != vSnorm8Scalar || vUnorm8 != vUnorm8Scalar || vSnorm16 != vSnorm16Scalar || vUnorm16 != vUnorm16Scalar) {
+				return false;
+			}
+
+			std::vector<float> vSnorm8Back(vFloats.size()), vUnorm8Back(vFloats.size()), vSnorm16Back(vFloats.size()), vUnorm16Back(vFloats.size());
+			Math::UnpackSnorm8(vSnorm8, vSnorm8Back);
+			Math::UnpackUnorm8(vUnorm8, vUnorm8Back);
+			Math::UnpackSnorm16(vSnorm16, vSnorm16Back);
+			Math::UnpackUnorm16(vUnorm16, vUnorm16Back);
+
+			for (size_t sNdx = 0; sNdx < vFloats.size(); ++sNdx) {
+				if (vSnorm8Back[sNdx] != UnpackSnorm8(vSnorm8[sNdx]) || vUnorm8Back[sNdx] != UnpackUnorm8(vUnorm8[sNdx]) ||
+					vSnorm16Back[sNdx] != UnpackSnorm16(vSnorm16[sNdx]) || vUnorm16Back[sNdx] != UnpackUnorm16(vUnorm16[sNdx])) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("Octahedral Normals", [](float& _fDelta) -> const bool {
+			const std::vector<Vec3F> vNormals = GeneratePackNormals(PACK_TEST_COUNT, 4);
+			uint32_t uPacked = 0U;
+
+			HC_TIME_EXECUTION(uPacked = PackNormal(vNormals[0]), _fDelta);
+
+			//The axes, including the folded -Z pole, come back exactly
+			const Vec3F vAxes[] = { Vec3F(1.0f, 0.0f, 0.0f), Vec3F(0.0f, -1.0f, 0.0f), Vec3F(0.0f, 0.0f, 1.0f), Vec3F(0.0f, 0.0f, -1.0f) };
+			for (const Vec3F& vAxis : vAxes) {
+				if (Length(UnpackNormal(PackNormal(vAxis)) - vAxis) > 1.0e-6f) {
+					return false;
+				}
+			}
+
+			//16 bits per axis keeps the error well under a tenth of a degree
+			for (const Vec3F& vNormal : vNormals) {
+				if (Dot(UnpackNormal(PackNormal(vNormal)), vNormal) < cosf(HC_DEG2RAD(0.1f))) {
+					return false;
+				}
+			}
+
+			return uPacked == PackNormal(vNormals[0]);
+		});
+
+		tbBlock.AddTest("Batched Octahedral Normals", [](float& _fDelta) -> const bool {
+			const std::vector<Vec3F> vNormals = GeneratePackNormals(PACK_TEST_COUNT, 5);
+			std::vector<uint32_t> vBatch(vNormals.size()), vScalar(vNormals.size());
+			std::vector<Vec3F> vBatchBack(vNormals.size());
+
+			RunBatchThenReference("Normals to octahedral", "scalar", [&]() { Math::PackNormals(vNormals, vBatch); },
+				[&]() { for (size_t sNdx = 0; sNdx < vNormals.size(); ++sNdx) vScalar[sNdx] = PackNormal(vNormals[sNdx]); }, _fDelta);
+
+			Math::UnpackNormals(vBatch, vBatchBack);
+
+			//Division may round differently per lane, so allow one code of difference on each axis
+			for (size_t sNdx = 0; sNdx < vNormals.size(); ++sNdx) {
+				const int iX = static_cast<int16_t>(vBatch[sNdx] & 0xFFFFU) - static_cast<int16_t>(vScalar[sNdx] & 0xFFFFU);
+				const int iY = static_cast<int16_t>(vBatch[sNdx] >> 16) - static_cast<int16_t>(vScalar[sNdx] >> 16);
+
+				if (abs(iX) > 1 || abs(iY) > 1 || Length(vBatchBack[sNdx] - UnpackNormal(vBatch[sNdx])) > 1.0e-5f) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("Smallest Three Quaternions", [](float& _fDelta) -> const bool {
+			const std::vector<QuaternionF> vQuats = GeneratePackQuaternions(PACK_TEST_COUNT, 6);
+			const QuaternionF qFlipped = QuaternionF(-0.1f, 0.2f, -0.3f, -sqrtf(1.0f - 0.14f));
+			uint32_t uPacked = 0U;
+
+			HC_TIME_EXECUTION(uPacked = PackQuaternion(vQuats[0]), _fDelta);
+
+			//q and -q are the same rotation and pack the same way
+			if (PackQuaternion(qFlipped) != PackQuaternion(QuaternionF(0.1f, -0.2f, 0.3f, sqrtf(1.0f - 0.14f))) || PackQuaternionAngle(UnpackQuaternion(PackQuaternion(QuaternionF(0.0f, 0.0f, 0.0f, 1.0f))), QuaternionF(0.0f, 0.0f, 0.0f, 1.0f)) != 0.0f) {
+				return false;
+			}
+
+			for (const QuaternionF& qQuat : vQuats) {
+				if (PackQuaternionAngle(UnpackQuaternion(PackQuaternion(qQuat)), qQuat) > 0.005f) {
+					return false;
+				}
+			}
+
+			return uPacked == PackQuaternion(vQuats[0]);
+		});
+
+		tbBlock.AddTest("Batched Smallest Three Quaternions", [](float& _fDelta) -> const bool {
+			const std::vector<QuaternionF> vQuats = GeneratePackQuaternions(PACK_TEST_COUNT, 7);
+			std::vector<uint32_t> vBatch(vQuats.size()), vScalar(vQuats.size());
+			std::vector<QuaternionF> vBatchBack(vQuats.size());
+
+			RunBatchThenReference("Quaternions to smallest three", "scalar", [&]() { Math::PackQuaternions(vQuats, vBatch); },
+				[&]() { for (size_t sNdx = 0; sNdx < vQuats.size(); ++sNdx) vScalar[sNdx] = PackQuaternion(vQuats[sNdx]); }, _fDelta);
+
+			Math::UnpackQuaternions(vBatch, vBatchBack);
+
+			if (vBatch != vScalar) {
+				return false;
+			}
+
+			for (size_t sNdx = 0; sNdx < vQuats.size(); ++sNdx) {
+				const QuaternionF qScalar = UnpackQuaternion(vBatch[sNdx]);
+
+				for (int iNdx = 0; iNdx < 4; ++iNdx) {
+					if (fabsf(vBatchBack[sNdx][iNdx] - qScalar[iNdx]) > 1.0e-6f) {
+						return false;
+					}
+				}
+			}
+
+			return true;
+		});
+
+		_vBlockList.push_back(tbBlock);
+	}
+}
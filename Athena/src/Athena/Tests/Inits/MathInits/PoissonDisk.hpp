@@ -0,0 +1,107 @@
+#pragma once
+
+#include <Athena/Tests/Inits/MathInits/Math_Common.hpp>
+
+#include <HellfireControl/Math/PoissonDisk.hpp>
+
+namespace MathTests {
+	//Closest pair by brute force, the quadratic check the sampler exists to avoid. _fExtent wraps distances when above zero.
+	template<typename Vec, int Dims>
+	float PoissonDiskClosest(const std::vector<Vec>& _vPoints, float _fExtent = 0.0f) {
+		float fRes = FLT_MAX;
+
+		for (size_t sLeft = 0; sLeft < _vPoints.size(); ++sLeft) {
+			for (size_t sRight = sLeft + 1; sRight < _vPoints.size(); ++sRight) {
+				float fDistance = 0.0f;
+
+				for (int iAxis = 0; iAxis < Dims; ++iAxis) {
+					float fDelta = fabsf(_vPoints[sLeft][iAxis] - _vPoints[sRight][iAxis]);
+					if (_fExtent > 0.0f) { fDelta = fminf(fDelta, _fExtent - fDelta); }
+					fDistance += fDelta * fDelta;
+				}
+
+				fRes = fminf(fRes, fDistance);
+			}
+		}
+
+		return sqrtf(fRes);
+	}
+
+	void InitTests_PoissonDisk(std::vector<TestBlock>& _vBlockList) {
+		TestBlock tbBlock = TestBlock("Math Library - Poisson Disk");
+
+		tbBlock.AddTest("Poisson Disk 2D Spacing", [](float& _fDelta) -> const bool {
+			Random rand(31);
+			std::vector<Vec2F> vPoints;
+
+			HC_TIME_EXECUTION(vPoints = Math::PoissonDisk(rand, Vec2F(40.0f, 25.0f), 0.5f), _fDelta);
+
+			bool bRes = vPoints.size() > 2000 && PoissonDiskClosest<Vec2F, 2>(vPoints) >= 0.5f;
+
+			for (const Vec2F& vPoint : vPoints) { bRes &= vPoint.x >= 0.0f && vPoint.x < 40.0f && vPoint.y >= 0.0f && vPoint.y < 25.0f; }
+
+			//Maximal: nowhere in the domain is there room for one more point, so every probe is within 2r of a sample
+			for (int iProbe = 0; iProbe < 200; ++iProbe) {
+				const Vec2F vProbe = Vec2F(rand.GenerateFloat(0.0f, 40.0f), rand.GenerateFloat(0.0f, 25.0f));
+				float fNearest = FLT_MAX;
+
+				for (const Vec2F& vPoint : vPoints) { fNearest = fminf(fNearest, Length(vPoint - vProbe)); }
+
+				bRes &= fNearest < 1.0f;
+			}
+
+			return bRes;
+			});
+
+		tbBlock.AddTest("Poisson Disk 3D Spacing", [](float& _fDelta) -> const bool {
+			RandomStream rsStream(8, 1);
+			std::vector<Vec3F> vPoints;
+
+			HC_TIME_EXECUTION(vPoints = Math::PoissonDisk(rsStream, Vec3F(10.0f, 6.0f, 8.0f), 0.75f), _fDelta);
+
+			bool bRes = vPoints.size() > 500 && PoissonDiskClosest<Vec3F, 3>(vPoints) >= 0.75f;
+
+			for (const Vec3F& vPoint : vPoints) { bRes &= vPoint.x >= 0.0f && vPoint.x < 10.0f && vPoint.y >= 0.0f && vPoint.y < 6.0f && vPoint.z >= 0.0f && vPoint.z < 8.0f; }
+
+			return bRes;
+			});
+
+		tbBlock.AddTest("Poisson Disk Blue Noise Tile", [](float& _fDelta) -> const bool {
+			Random rand(77);
+			std::vector<Vec2F> vPoints;
+
+			HC_TIME_EXECUTION(vPoints = Math::BlueNoiseTile(rand, 0.02f), _fDelta);
+
+			bool bRes = vPoints.size() > 1000;
+
+			for (const Vec2F& vPoint : vPoints) { bRes &= vPoint.x >= 0.0f && vPoint.x < 1.0f && vPoint.y >= 0.0f && vPoint.y < 1.0f; }
+
+			//Spacing holds across the seams too
+			return bRes && PoissonDiskClosest<Vec2F, 2>(vPoints, 1.0f) >= 0.02f;
+			});
+
+		tbBlock.AddTest("Poisson Disk Linear Time", [](float& _fDelta) -> const bool {
+			Random rand(5);
+			std::vector<Vec2F> vSmall, vLarge;
+			float fSmallDelta = 0.0f;
+
+			{
+				HC_TIME_EXECUTION(vSmall = Math::PoissonDisk(rand, Vec2F(50.0f, 50.0f), 1.0f), fSmallDelta);
+			}
+
+			//Four times the area at the same radius is four times the points, and should cost about four times as much
+			{
+				HC_TIME_EXECUTION(vLarge = Math::PoissonDisk(rand, Vec2F(100.0f, 100.0f), 1.0f), _fDelta);
+			}
+
+			Console::Print("\tPoissonDisk: " + std::to_string(vLarge.size()) + " points, " + std::to_string(_fDelta / static_cast<float>(vLarge.size())) + " ns per point, "
+				+ std::to_string(fSmallDelta / static_cast<float>(vSmall.size())) + " at a quarter of the area\n", Console::YELLOW);
+
+			const float fRatio = vLarge.size() / static_cast<float>(vSmall.size());
+
+			return vLarge.size() > 5000 && fRatio > 3.6f && fRatio < 4.4f;
+			});
+
+		_vBlockList.push_back(tbBlock);
+	}
+}
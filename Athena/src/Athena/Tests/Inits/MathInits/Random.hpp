@@ -3,6 +3,28 @@
 #include <Athena/Tests/Inits/MathInits/Math_Common.hpp>
 
 namespace MathTests {
+	//Pearson's chi-square statistic of _vCounts against a uniform expectation
+	inline double RandomChiSquare(const std::vector<uint32_t>& _vCounts, double _dExpected) {
+		double dRes = 0.0;
+
+		for (const uint32_t uCount : _vCounts) {
+			const double dDiff = static_cast<double>(uCount) - _dExpected;
+			dRes += dDiff * dDiff / _dExpected;
+		}
+
+		return dRes;
+	}
+
+	//Times _iCount calls of _fnGenerate and prints the cost of each, keeping every result live so none of them are optimised away
+	template<typename Func>
+	void RunRandomThroughput(const std::string& _strName, int _iCount, Func _fnGenerate, float& _fDelta) {
+		volatile int64_t iSink = 0;
+
+		HC_TIME_EXECUTION(for (int iNdx = 0; iNdx < _iCount; ++iNdx) iSink = iSink + static_cast<int64_t>(_fnGenerate()), _fDelta);
+
+		Console::Print("\t" + _strName + ": " + std::to_string(_fDelta / static_cast<float>(_iCount)) + " ns per value\n", Console::YELLOW);
+	}
+
 	void InitTests_Random(std::vector<TestBlock>& _vBlockList) {
 		TestBlock tbBlock = TestBlock("Math Library - Random");
 
@@ -203,6 +225,263 @@ namespace MathTests {
 			return dRes >= -64.0 && dRes < 32.0;
 			});
 
+		tbBlock.AddTest("Random Fill Floats", [](float& _fDelta) -> const bool {
+			Random rand(7);
+			std::vector<float> vFloats(100003), vScalar(vFloats.size());
+
+			RunBatchThenReference("FillFloats", "GenerateFloat", [&]() { rand.FillFloats(vFloats, -2.0f, 6.0f); }, [&]() { for (float& fVal : vScalar) fVal = rand.GenerateFloat(-2.0f, 6.0f); }, _fDelta);
+
+			double dSum = 0.0;
+			for (const float fVal : vFloats) {
+				if (fVal < -2.0f || fVal > 6.0f) {
+					return false;
+				}
+
+				dSum += fVal;
+			}
+
+			//The mean of a uniform [-2, 6] is 2, and 100k samples land well within 0.05 of it
+			return fabs(dSum / static_cast<double>(vFloats.size()) - 2.0) < 0.05;
+			});
+
+		tbBlock.AddTest("Random Fill Ints", [](float& _fDelta) -> const bool {
+			Random rand(8);
+			std::vector<int> vInts(10007);
+			std::array<int, 13> aCounts = {};
+
+			HC_TIME_EXECUTION(rand.FillInts(vInts, -6, 6), _fDelta);
+
+			for (const int iVal : vInts) {
+				if (iVal < -6 || iVal > 6) {
+					return false;
+				}
+
+				++aCounts[iVal + 6];
+			}
+
+			//Both ends are inclusive, and every value turns up about 770 times
+			for (const int iCount : aCounts) {
+				if (iCount < 600 || iCount > 940) {
+					return false;
+				}
+			}
+
+			//The full range needs no reduction
+			rand.FillInts(vInts, INT_MIN, INT_MAX);
+
+			return std::any_of(vInts.begin(), vInts.end(), [](int _iVal) { return _iVal < 0; }) && std::any_of(vInts.begin(), vInts.end(), [](int _iVal) { return _iVal > 0; });
+			});
+
+		tbBlock.AddTest("Random Fill Vec3", [](float& _fDelta) -> const bool {
+			Random rand(9);
+			std::vector<Vec3F> vPoints(4099);
+			const Vec3F vMin = Vec3F(-1.0f, 10.0f, -100.0f), vMax = Vec3F(1.0f, 20.0f, -50.0f);
+
+			HC_TIME_EXECUTION(rand.FillVec3(vPoints, vMin, vMax), _fDelta);
+
+			for (const Vec3F& vPoint : vPoints) {
+				if (vPoint.x < vMin.x || vPoint.x > vMax.x || vPoint.y < vMin.y || vPoint.y > vMax.y || vPoint.z < vMin.z || vPoint.z > vMax.z) {
+					return false;
+				}
+			}
+
+			//Axes come from different draws, so they must not simply repeat each other
+			return (vPoints[0].y - vMin.y) / 10.0f != (vPoints[0].x - vMin.x) / 2.0f;
+			});
+
+		tbBlock.AddTest("Random Fill Seeding", [](float& _fDelta) -> const bool {
+			Random rLeft(1234), rRight(1234);
+			std::vector<float> vLeft(1001), vRight(1001);
+
+			HC_TIME_EXECUTION(rLeft.FillFloats(vLeft), _fDelta);
+
+			rRight.FillFloats(vRight);
+			if (vLeft != vRight) {
+				return false;
+			}
+
+			//Reseeding restarts the stream, and a neighbouring seed gives a different one
+			std::vector<float> vFirst = vLeft;
+			rLeft.FillFloats(vLeft);
+			rLeft.SetSeed(1234);
+			rLeft.FillFloats(vRight);
+			if (vRight != vFirst || vLeft == vFirst) {
+				return false;
+			}
+
+			rRight.SetSeed(1235);
+			rRight.FillFloats(vRight);
+
+			return vRight != vFirst && rLeft.GetSeed() == 1234 && rRight.GetSeed() == 1235;
+			});
+
+		tbBlock.AddTest("Random Stream Known Answers", [](float& _fDelta) -> const bool {
+			//Philox4x32-10 reference vectors from Random123
+			const uint32_t uZero[4] = { 0U, 0U, 0U, 0U }, uOnes[4] = { 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU };
+			const uint32_t uPi[4] = { 0x243F6A88U, 0x85A308D3U, 0x13198A2EU, 0x03707344U };
+			uint32_t uRes0[4], uRes1[4], uRes2[4];
+
+			HC_TIME_EXECUTION(PhiloxF(uZero, 0ULL, uRes0), _fDelta);
+
+			PhiloxF(uOnes, UINT64_MAX, uRes1);
+			PhiloxF(uPi, 0x299F31D0A4093822ULL, uRes2);
+
+			return uRes0[0] == 0x6627E8D5U && uRes0[1] == 0xE169C58DU && uRes0[2] == 0xBC57AC4CU && uRes0[3] == 0x9B00DBD8U &&
+				   uRes1[0] == 0x408F276DU && uRes1[1] == 0x41C83B0EU && uRes1[2] == 0xA20BC7C6U && uRes1[3] == 0x6D5451FDU &&
+				   uRes2[0] == 0xD16CFE09U && uRes2[1] == 0x94FDCCEBU && uRes2[2] == 0x5001E420U && uRes2[3] == 0x24126EA1U;
+			});
+
+		tbBlock.AddTest("Random Stream Fill And Seek", [](float& _fDelta) -> const bool {
+			RandomStream rBatch(99, 3), rSingle(99, 3);
+			std::vector<uint32_t> vBatch(100003);
+			float fScalarDelta = 0.0f;
+
+			//Start mid-block so the fill has to line up with the blocks first
+			(void)rBatch.GenerateUnsignedInt();
+			(void)rSingle.GenerateUnsignedInt();
+
+			{
+				HC_TIME_EXECUTION(rBatch.FillUnsignedInts(vBatch), _fDelta);
+			}
+
+			//Both generators have to run exactly once from the same position, so there is no warm up pass here
+			std::vector<uint32_t> vSingle(vBatch.size());
+			{
+				HC_TIME_EXECUTION(for (uint32_t& uVal : vSingle) uVal = rSingle.GenerateUnsignedInt(), fScalarDelta);
+			}
+
+			PrintSpeedup("RandomStream FillUnsignedInts", _fDelta, fScalarDelta, "GenerateUnsignedInt");
+
+			if (vBatch != vSingle) {
+				return false;
+			}
+
+			//Jumping straight to a position gives the same values as reading up to it, including across the 2^32 block boundary
+			RandomStream rSeek(99, 3);
+			rSeek.Seek(50001);
+			const bool bSeek = rSeek.GenerateUnsignedInt() == vBatch[50000];
+
+			RandomStream rFar(7), rFarBatch(7);
+			rFar.Seek(0xFFFFFFFFULL * 4 - 6);
+			rFarBatch.Seek(0xFFFFFFFFULL * 4 - 6);
+			std::vector<uint32_t> vFar(40);
+			rFarBatch.FillUnsignedInts(vFar);
+
+			for (const uint32_t uVal : vFar) {
+				if (uVal != rFar.GenerateUnsignedInt()) {
+					return false;
+				}
+			}
+
+			return bSeek && rBatch.GetPosition() == vBatch.size() + 1;
+			});
+
+		tbBlock.AddTest("Random Stream Substreams", [](float& _fDelta) -> const bool {
+			const RandomStream rRoot(2024);
+			constexpr int ENTITY_COUNT = 4096;
+
+			//One value per entity from its own substream, split over a varying number of workers
+			const auto Simulate = [&](int _iThreads) {
+				std::vector<float> vRes(ENTITY_COUNT);
+				std::vector<std::thread> vWorkers;
+
+				for (int iThread = 0; iThread < _iThreads; ++iThread) {
+					vWorkers.emplace_back([&, iThread]() {
+						for (int iEntity = iThread; iEntity < ENTITY_COUNT; iEntity += _iThreads) {
+							RandomStream rEntity = rRoot.Substream(static_cast<uint64_t>(iEntity));
+							vRes[iEntity] = rEntity.GenerateFloat(-1.0f, 1.0f) + rEntity.GenerateFloat(-1.0f, 1.0f);
+						}
+					});
+				}
+
+				for (std::thread& tWorker : vWorkers) { tWorker.join(); }
+
+				return vRes;
+			};
+
+			std::vector<float> vSerial;
+
+			HC_TIME_EXECUTION(vSerial = Simulate(1), _fDelta);
+
+			//Children differ from each other and from the parent, and the same id always gives the same child
+			RandomStream rParent = rRoot, rFirst = rRoot.Substream(0), rSecond = rRoot.Substream(1), rNested = rRoot.Substream(0).Substream(1);
+			const uint32_t uParent = rParent.GenerateUnsignedInt(), uFirst = rFirst.GenerateUnsignedInt(), uSecond = rSecond.GenerateUnsignedInt(), uNested = rNested.GenerateUnsignedInt();
+			const bool bDistinct = uParent != uFirst && uFirst != uSecond && uNested != uSecond && rRoot.Substream(1).GetStream() == rSecond.GetStream();
+
+			return bDistinct && Simulate(3) == vSerial && Simulate(8) == vSerial;
+			});
+
+		tbBlock.AddTest("Random Chi-Square Int", [](float& _fDelta) -> const bool {
+			Random rand(31);
+			constexpr int SAMPLE_COUNT = 160000;
+			std::vector<uint32_t> vCounts(16);
+
+			RunRandomThroughput("GenerateInt", SAMPLE_COUNT, [&]() { return rand.GenerateInt(0, 15); }, _fDelta);
+
+			for (int iNdx = 0; iNdx < SAMPLE_COUNT; ++iNdx) { ++vCounts[rand.GenerateInt(0, 15)]; }
+
+			//15 degrees of freedom, p = 0.001
+			return RandomChiSquare(vCounts, SAMPLE_COUNT / 16.0) < 37.70;
+			});
+
+		tbBlock.AddTest("Random Chi-Square Unbiased Range", [](float& _fDelta) -> const bool {
+			Random rand(32);
+			constexpr int SAMPLE_COUNT = 120000;
+			constexpr uint32_t RANGE = 0xC0000000U;
+			std::vector<uint32_t> vCounts(3);
+
+			//Reducing 32 bits with % makes the bottom third of this range twice as likely as the rest
+			RunRandomThroughput("GenerateUnsignedInt", SAMPLE_COUNT, [&]() { return rand.GenerateUnsignedInt(0U, RANGE); }, _fDelta);
+
+			for (int iNdx = 0; iNdx < SAMPLE_COUNT; ++iNdx) { ++vCounts[rand.GenerateUnsignedInt(0U, RANGE) / 0x40000000U]; }
+
+			//2 degrees of freedom, p = 0.001
+			return RandomChiSquare(vCounts, SAMPLE_COUNT / 3.0) < 13.82;
+			});
+
+		tbBlock.AddTest("Random Chi-Square Float", [](float& _fDelta) -> const bool {
+			Random rand(33);
+			constexpr int SAMPLE_COUNT = 640000;
+			std::vector<uint32_t> vCounts(64);
+
+			RunRandomThroughput("GenerateFloat", SAMPLE_COUNT, [&]() { return rand.GenerateFloat(0.0f, 64.0f); }, _fDelta);
+
+			for (int iNdx = 0; iNdx < SAMPLE_COUNT; ++iNdx) {
+				const float fVal = rand.GenerateFloat(-32.0f, 32.0f);
+				if (fVal < -32.0f || fVal >= 32.0f) {
+					return false;
+				}
+
+				++vCounts[static_cast<int>(fVal + 32.0f)];
+			}
+
+			//63 degrees of freedom, p = 0.001
+			return RandomChiSquare(vCounts, SAMPLE_COUNT / 64.0) < 103.44;
+			});
+
+		tbBlock.AddTest("Random Chi-Square Long And Double", [](float& _fDelta) -> const bool {
+			Random rand(34);
+			constexpr int SAMPLE_COUNT = 80000;
+			std::vector<uint32_t> vLongCounts(8), vDoubleCounts(8);
+
+			RunRandomThroughput("GenerateDouble", SAMPLE_COUNT, [&]() { return rand.GenerateDouble(0.0, 1.0e6); }, _fDelta);
+
+			//A range wider than 32 bits checks that both halves of the fused value are used
+			for (int iNdx = 0; iNdx < SAMPLE_COUNT; ++iNdx) {
+				const int64_t lVal = rand.GenerateLong(-(1LL << 40), (1LL << 40) - 1);
+				const double dVal = rand.GenerateDouble(-1.0, 1.0);
+				if (dVal < -1.0 || dVal >= 1.0) {
+					return false;
+				}
+
+				++vLongCounts[static_cast<size_t>((lVal + (1LL << 40)) >> 38)];
+				++vDoubleCounts[static_cast<size_t>((dVal + 1.0) * 4.0)];
+			}
+
+			//7 degrees of freedom, p = 0.001
+			return RandomChiSquare(vLongCounts, SAMPLE_COUNT / 8.0) < 24.32 && RandomChiSquare(vDoubleCounts, SAMPLE_COUNT / 8.0) < 24.32;
+			});
+
 		_vBlockList.push_back(tbBlock);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,267 @@
+#pragma once
+
+#include <Athena/Tests/Inits/MathInits/Math_Common.hpp>
+
+namespace MathTests {
+	//Number of operations timed per test. A single operation is too short to compare the backends against each other.
+	constexpr int SIMD_TEST_ITERATIONS = 4096;
+
+	template<typename Type>
+	struct SIMDPair {
+		Type m_tLeft;
+		Type m_tRight;
+	};
+
+	template<typename Type, typename Generator>
+	std::vector<SIMDPair<Type>> GenerateSIMDPairs(Generator _fnGenerator) {
+		return GenerateTestValues<SIMDPair<Type>>(SIMD_TEST_ITERATIONS, 0x5EED, [&](Random& _rRand) { return SIMDPair<Type>{ _fnGenerator(_rRand), _fnGenerator(_rRand) }; });
+	}
+
+	/// <summary>
+	/// Runs _fnLibrary and _fnReference over every input pair, prints the speedup of the library call over the plain scalar reference
+	/// and checks that each library result is within TestCompareRelative's default tolerance of the reference converted to Output.
+	/// _fDelta receives the library timing.
+	/// </summary>
+	template<typename Output, typename Input, typename LibraryFunc, typename ReferenceFunc>
+	bool RunSIMDComparison(const std::string& _strName, const std::vector<Input>& _vInputs, LibraryFunc _fnLibrary, ReferenceFunc _fnReference, float& _fDelta) {
+		//The backends sum in different orders, so results are compared relative to their magnitude
+		return RunBatchComparison(_strName, "scalar reference (HC_USE_SIMD = " + std::to_string(HC_USE_SIMD) + ")", _vInputs, _fnLibrary, [&](const Input& _tIn) { return static_cast<Output>(_fnReference(_tIn)); },
+			[](const Output& _tLibrary, const Output& _tReference) { return TestCompareRelative(_tLibrary, _tReference); }, _fDelta);
+	}
+
+	void InitTests_SIMD(std::vector<TestBlock>& _vBlockList) {
+		TestBlock tbBlock = TestBlock("Math Library - SIMD");
+
+		//Vec2F
+		{
+			tbBlock.AddTest("SIMD Vec2F Multiply Add", [](float& _fDelta) -> const bool {
+				return RunSIMDComparison<Vec2F>("Vec2F Multiply Add", GenerateSIMDPairs<Vec2F>(RandomTestVec2F),
+					[](const SIMDPair<Vec2F>& _pIn) { return _pIn.m_tLeft * _pIn.m_tRight + _pIn.m_tLeft; },
+					[](const SIMDPair<Vec2F>& _pIn) { return Vec2F(_pIn.m_tLeft.x * _pIn.m_tRight.x + _pIn.m_tLeft.x, _pIn.m_tLeft.y * _pIn.m_tRight.y + _pIn.m_tLeft.y); }, _fDelta);
+			});
+
+			tbBlock.AddTest("SIMD Vec2F Dot", [](float& _fDelta) -> const bool {
+				return RunSIMDComparison<float>("Vec2F Dot", GenerateSIMDPairs<Vec2F>(RandomTestVec2F),
+					[](const SIMDPair<Vec2F>& _pIn) { return Dot(_pIn.m_tLeft, _pIn.m_tRight); },
+					[](const SIMDPair<Vec2F>& _pIn) { return _pIn.m_tLeft.x * _pIn.m_tRight.x + _pIn.m_tLeft.y * _pIn.m_tRight.y; }, _fDelta);
+			});
+		}
+
+		//Vec3F
+		{
+			tbBlock.AddTest("SIMD Vec3F Divide", [](float& _fDelta) -> const bool {
+				return RunSIMDComparison<Vec3F>("Vec3F Divide", GenerateSIMDPairs<Vec3F>(RandomTestVec3F),
+					[](const SIMDPair<Vec3F>& _pIn) { return _pIn.m_tLeft / (_pIn.m_tRight + Vec3F(2.0f)); },
+					[](const SIMDPair<Vec3F>& _pIn) { return Vec3F(_pIn.m_tLeft.x / (_pIn.m_tRight.x + 2.0f), _pIn.m_tLeft.y / (_pIn.m_tRight.y + 2.0f), _pIn.m_tLeft.z / (_pIn.m_tRight.z + 2.0f)); }, _fDelta);
+			});
+
+			tbBlock.AddTest("SIMD Vec3F Cross", [](float& _fDelta) -> const bool {
+				return RunSIMDComparison<Vec3F>("Vec3F Cross", GenerateSIMDPairs<Vec3F>(RandomTestVec3F),
+					[](const SIMDPair<Vec3F>& _pIn) { return Cross(_pIn.m_tLeft, _pIn.m_tRight); },
+					[](const SIMDPair<Vec3F>& _pIn) {
+						return Vec3F(_pIn.m_tLeft.y * _pIn.m_tRight.z - _pIn.m_tLeft.z * _pIn.m_tRight.y,
+									 _pIn.m_tLeft.z * _pIn.m_tRight.x - _pIn.m_tLeft.x * _pIn.m_tRight.z,
+									 _pIn.m_tLeft.x * _pIn.m_tRight.y - _pIn.m_tLeft.y * _pIn.m_tRight.x);
+					}, _fDelta);
+			});
+
+			tbBlock.AddTest("SIMD Vec3F Dot", [](float& _fDelta) -> const bool {
+				return RunSIMDComparison<float>("Vec3F Dot", GenerateSIMDPairs<Vec3F>(RandomTestVec3F),
+					[](const SIMDPair<Vec3F>& _pIn) { return Dot(_pIn.m_tLeft, _pIn.m_tRight); },
+					[](const SIMDPair<Vec3F>& _pIn) { return _pIn.m_tLeft.x * _pIn.m_tRight.x + _pIn.m_tLeft.y * _pIn.m_tRight.y + _pIn.m_tLeft.z * _pIn.m_tRight.z; }, _fDelta);
+			});
+
+			tbBlock.AddTest("SIMD Vec3F Normalize", [](float& _fDelta) -> const bool {
+				return RunSIMDComparison<Vec3F>("Vec3F Normalize", GenerateSIMDPairs<Vec3F>(RandomTestVec3F),
+					[](const SIMDPair<Vec3F>& _pIn) { return Normalize(_pIn.m_tLeft); },
+					[](const SIMDPair<Vec3F>& _pIn) {
+						float fLen = sqrtf(_pIn.m_tLeft.x * _pIn.m_tLeft.x + _pIn.m_tLeft.y * _pIn.m_tLeft.y + _pIn.m_tLeft.z * _pIn.m_tLeft.z);
+						return Vec3F(_pIn.m_tLeft.x / fLen, _pIn.m_tLeft.y / fLen, _pIn.m_tLeft.z / fLen);
+					}, _fDelta);
+			});
+		}
+
+		//Vec4F
+		{
+			tbBlock.AddTest("SIMD Vec4F Multiply Subtract", [](float& _fDelta) -> const bool {
+				return RunSIMDComparison<Vec4F>("Vec4F Multiply Subtract", GenerateSIMDPairs<Vec4F>(RandomTestVec4F),
+					[](const SIMDPair<Vec4F>& _pIn) { return _pIn.m_tLeft * _pIn.m_tRight - _pIn.m_tRight; },
+					[](const SIMDPair<Vec4F>& _pIn) {
+						return Vec4F(_pIn.m_tLeft.x * _pIn.m_tRight.x - _pIn.m_tRight.x, _pIn.m_tLeft.y * _pIn.m_tRight.y - _pIn.m_tRight.y,
+									 _pIn.m_tLeft.z * _pIn.m_tRight.z - _pIn.m_tRight.z, _pIn.m_tLeft.w * _pIn.m_tRight.w - _pIn.m_tRight.w);
+					}, _fDelta);
+			});
+
+			tbBlock.AddTest("SIMD Vec4F Dot", [](float& _fDelta) -> const bool {
+				return RunSIMDComparison<float>("Vec4F Dot", GenerateSIMDPairs<Vec4F>(RandomTestVec4F),
+					[](const SIMDPair<Vec4F>& _pIn) { return Dot(_pIn.m_tLeft, _pIn.m_tRight); },
+					[](const SIMDPair<Vec4F>& _pIn) { return _pIn.m_tLeft.x * _pIn.m_tRight.x + _pIn.m_tLeft.y * _pIn.m_tRight.y + _pIn.m_tLeft.z * _pIn.m_tRight.z + _pIn.m_tLeft.w * _pIn.m_tRight.w; }, _fDelta);
+			});
+		}
+
+		//QuaternionF and RotorF
+		{
+			tbBlock.AddTest("SIMD QuaternionF Multiply", [](float& _fDelta) -> const bool {
+				return RunSIMDComparison<Vec4F>("QuaternionF Multiply", GenerateSIMDPairs<Vec4F>(RandomTestVec4F),
+					[](const SIMDPair<Vec4F>& _pIn) { return (QuaternionF(_pIn.m_tLeft) * QuaternionF(_pIn.m_tRight)).m_vQuat; },
+					[](const SIMDPair<Vec4F>& _pIn) {
+						const Vec4F& l = _pIn.m_tLeft;
+						const Vec4F& r = _pIn.m_tRight;
+						return Vec4F(l.w * r.x + l.x * r.w + l.y * r.z - l.z * r.y,
+									 l.w * r.y - l.x * r.z + l.y * r.w + l.z * r.x,
+									 l.w * r.z + l.x * r.y - l.y * r.x + l.z * r.w,
+									 l.w * r.w - l.x * r.x - l.y * r.y - l.z * r.z);
+					}, _fDelta);
+			});
+
+			tbBlock.AddTest("SIMD RotorF Multiply", [](float& _fDelta) -> const bool {
+				return RunSIMDComparison<Vec4F>("RotorF Multiply", GenerateSIMDPairs<Vec4F>(RandomTestVec4F),
+					[](const SIMDPair<Vec4F>& _pIn) { return (RotorF(_pIn.m_tLeft) * RotorF(_pIn.m_tRight)).m_vRot; },
+					[](const SIMDPair<Vec4F>& _pIn) {
+						const Vec4F& l = _pIn.m_tLeft;
+						const Vec4F& r = _pIn.m_tRight;
+						return Vec4F(l.x * r.w + l.w * r.x + l.z * r.y - l.y * r.z,
+									 l.y * r.w + l.w * r.y - l.z * r.x + l.x * r.z,
+									 l.z * r.w + l.w * r.z + l.y * r.x - l.x * r.y,
+									 l.w * r.w - l.x * r.x - l.y * r.y - l.z * r.z);
+					}, _fDelta);
+			});
+		}
+
+		//MatrixF
+		{
+			tbBlock.AddTest("SIMD MatrixF Multiply", [](float& _fDelta) -> const bool {
+				return RunSIMDComparison<MatrixF>("MatrixF Multiply", GenerateSIMDPairs<MatrixF>(RandomTestMatrixF),
+					[](const SIMDPair<MatrixF>& _pIn) { return _pIn.m_tLeft * _pIn.m_tRight; },
+					[](const SIMDPair<MatrixF>& _pIn) {
+						MatrixF mRes;
+						for (int iRow = 0; iRow < 4; ++iRow) {
+							for (int iCol = 0; iCol < 4; ++iCol) {
+								mRes[iRow][iCol] = _pIn.m_tLeft[iRow][0] * _pIn.m_tRight[0][iCol] + _pIn.m_tLeft[iRow][1] * _pIn.m_tRight[1][iCol] +
+												   _pIn.m_tLeft[iRow][2] * _pIn.m_tRight[2][iCol] + _pIn.m_tLeft[iRow][3] * _pIn.m_tRight[3][iCol];
+							}
+						}
+						return mRes;
+					}, _fDelta);
+			});
+
+			tbBlock.AddTest("SIMD MatrixF Vector Multiply", [](float& _fDelta) -> const bool {
+				return RunSIMDComparison<Vec4F>("MatrixF Vector Multiply", GenerateSIMDPairs<MatrixF>(RandomTestMatrixF),
+					[](const SIMDPair<MatrixF>& _pIn) { return _pIn.m_tLeft * _pIn.m_tRight[0]; },
+					[](const SIMDPair<MatrixF>& _pIn) {
+						Vec4F vRes;
+						for (int iRow = 0; iRow < 4; ++iRow) {
+							vRes[iRow] = _pIn.m_tLeft[iRow][0] * _pIn.m_tRight[0][0] + _pIn.m_tLeft[iRow][1] * _pIn.m_tRight[0][1] +
+										 _pIn.m_tLeft[iRow][2] * _pIn.m_tRight[0][2] + _pIn.m_tLeft[iRow][3] * _pIn.m_tRight[0][3];
+						}
+						return vRes;
+					}, _fDelta);
+			});
+
+			tbBlock.AddTest("SIMD MatrixF Transpose", [](float& _fDelta) -> const bool {
+				return RunSIMDComparison<MatrixF>("MatrixF Transpose", GenerateSIMDPairs<MatrixF>(RandomTestMatrixF),
+					[](const SIMDPair<MatrixF>& _pIn) { return Transpose(_pIn.m_tLeft); },
+					[](const SIMDPair<MatrixF>& _pIn) {
+						MatrixF mRes;
+						for (int iRow = 0; iRow < 4; ++iRow) {
+							for (int iCol = 0; iCol < 4; ++iCol) {
+								mRes[iRow][iCol] = _pIn.m_tLeft[iCol][iRow];
+							}
+						}
+						return mRes;
+					}, _fDelta);
+			});
+
+			tbBlock.AddTest("SIMD MatrixF Inverse", [](float& _fDelta) -> const bool {
+				//Rigid transforms keep the inverse well conditioned and have a closed form to check against.
+				return RunSIMDComparison<MatrixF>("MatrixF Inverse", GenerateSIMDPairs<MatrixF>([](Random& _rRand) {
+						return RotationTranslationDegF(RandomTestVec3F(_rRand) * 180.0f, RandomTestVec3F(_rRand));
+					}),
+					[](const SIMDPair<MatrixF>& _pIn) { return Inverse(_pIn.m_tLeft); },
+					[](const SIMDPair<MatrixF>& _pIn) {
+						const MatrixF& m = _pIn.m_tLeft;
+						MatrixF mRes;
+						for (int iRow = 0; iRow < 3; ++iRow) {
+							for (int iCol = 0; iCol < 3; ++iCol) {
+								mRes[iRow][iCol] = m[iCol][iRow];
+							}
+							mRes[3][iRow] = -(m[3][0] * m[iRow][0] + m[3][1] * m[iRow][1] + m[3][2] * m[iRow][2]);
+						}
+						mRes[3][3] = 1.0f;
+						return mRes;
+					}, _fDelta);
+			});
+		}
+
+		//Vec4D and MatrixD. These take the AVX2 path only when the CPU supports it, otherwise they check the scalar fallback.
+		{
+#if HC_USE_SIMD
+			Console::Print("\tAVX2/FMA double precision path: " + std::string(HC_AVX2_AVAILABLE() ? "enabled" : "unsupported, using scalar") + "\n", Console::YELLOW);
+#endif
+
+			tbBlock.AddTest("SIMD Vec4D Dot", [](float& _fDelta) -> const bool {
+				return RunSIMDComparison<double>("Vec4D Dot", GenerateSIMDPairs<Vec4D>(RandomTestVec4D),
+					[](const SIMDPair<Vec4D>& _pIn) { return Dot(_pIn.m_tLeft, _pIn.m_tRight); },
+					[](const SIMDPair<Vec4D>& _pIn) { return _pIn.m_tLeft.x * _pIn.m_tRight.x + _pIn.m_tLeft.y * _pIn.m_tRight.y + _pIn.m_tLeft.z * _pIn.m_tRight.z + _pIn.m_tLeft.w * _pIn.m_tRight.w; }, _fDelta);
+			});
+
+			tbBlock.AddTest("SIMD Vec4D Cross", [](float& _fDelta) -> const bool {
+				return RunSIMDComparison<Vec4D>("Vec4D Cross", GenerateSIMDPairs<Vec4D>(RandomTestVec4D),
+					[](const SIMDPair<Vec4D>& _pIn) { return Cross(_pIn.m_tLeft, _pIn.m_tRight); },
+					[](const SIMDPair<Vec4D>& _pIn) {
+						return Vec4D(_pIn.m_tLeft.y * _pIn.m_tRight.z - _pIn.m_tLeft.z * _pIn.m_tRight.y,
+									 _pIn.m_tLeft.z * _pIn.m_tRight.x - _pIn.m_tLeft.x * _pIn.m_tRight.z,
+									 _pIn.m_tLeft.x * _pIn.m_tRight.y - _pIn.m_tLeft.y * _pIn.m_tRight.x, _pIn.m_tLeft.w);
+					}, _fDelta);
+			});
+
+			tbBlock.AddTest("SIMD Vec4D Normalize", [](float& _fDelta) -> const bool {
+				return RunSIMDComparison<Vec4D>("Vec4D Normalize", GenerateSIMDPairs<Vec4D>(RandomTestVec4D),
+					[](const SIMDPair<Vec4D>& _pIn) { return Normalize(_pIn.m_tLeft); },
+					[](const SIMDPair<Vec4D>& _pIn) {
+						const Vec4D& v = _pIn.m_tLeft;
+						double dLen = sqrt(v.x * v.x + v.y * v.y + v.z * v.z + v.w * v.w);
+						return Vec4D(v.x / dLen, v.y / dLen, v.z / dLen, v.w / dLen);
+					}, _fDelta);
+			});
+
+			tbBlock.AddTest("SIMD MatrixD Multiply", [](float& _fDelta) -> const bool {
+				return RunSIMDComparison<MatrixD>("MatrixD Multiply", GenerateSIMDPairs<MatrixD>(RandomTestMatrixD),
+					[](const SIMDPair<MatrixD>& _pIn) { return _pIn.m_tLeft * _pIn.m_tRight; },
+					[](const SIMDPair<MatrixD>& _pIn) {
+						MatrixD mRes;
+						for (int iRow = 0; iRow < 4; ++iRow) {
+							for (int iCol = 0; iCol < 4; ++iCol) {
+								mRes[iRow][iCol] = _pIn.m_tLeft[iRow][0] * _pIn.m_tRight[0][iCol] + _pIn.m_tLeft[iRow][1] * _pIn.m_tRight[1][iCol] +
+												   _pIn.m_tLeft[iRow][2] * _pIn.m_tRight[2][iCol] + _pIn.m_tLeft[iRow][3] * _pIn.m_tRight[3][iCol];
+							}
+						}
+						return mRes;
+					}, _fDelta);
+			});
+
+			tbBlock.AddTest("SIMD MatrixD Transpose", [](float& _fDelta) -> const bool {
+				return RunSIMDComparison<MatrixD>("MatrixD Transpose", GenerateSIMDPairs<MatrixD>(RandomTestMatrixD),
+					[](const SIMDPair<MatrixD>& _pIn) { return Transpose(_pIn.m_tLeft); },
+					[](const SIMDPair<MatrixD>& _pIn) {
+						MatrixD mRes;
+						for (int iRow = 0; iRow < 4; ++iRow) {
+							for (int iCol = 0; iCol < 4; ++iCol) {
+								mRes[iRow][iCol] = _pIn.m_tLeft[iCol][iRow];
+							}
+						}
+						return mRes;
+					}, _fDelta);
+			});
+
+			tbBlock.AddTest("SIMD MatrixD Inverse", [](float& _fDelta) -> const bool {
+				//A random matrix times its inverse must come back to identity; doubles leave plenty of headroom for the tolerance.
+				return RunSIMDComparison<MatrixD>("MatrixD Inverse", GenerateSIMDPairs<MatrixD>([](Random& _rRand) { return RandomTestMatrixD(_rRand) + IdentityD() * 4.0; }),
+					[](const SIMDPair<MatrixD>& _pIn) { return Inverse(_pIn.m_tLeft) * _pIn.m_tLeft; },
+					[](const SIMDPair<MatrixD>&) { return IdentityD(); }, _fDelta);
+			});
+		}
+
+		_vBlockList.push_back(tbBlock);
+	}
+}
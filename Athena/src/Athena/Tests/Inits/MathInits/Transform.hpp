@@ -0,0 +1,121 @@
+#pragma once
+
+#include <Athena/Tests/Inits/MathInits/Math_Common.hpp>
+
+namespace MathTests {
+	inline MatrixF GenerateTransformTestMatrixF() {
+		return RotationTranslationScaleDegF(Vec3F(30.0f, -45.0f, 60.0f), Vec3F(1.5f, -2.0f, 3.25f), Vec3F(2.0f, 0.5f, 1.0f));
+	}
+
+	//Transformed points stay within a few tens of units of the origin, where float error is well under this
+	constexpr float TRANSFORM_TOLERANCE = 1.0e-4f;
+
+	void InitTests_Transform(std::vector<TestBlock>& _vBlockList) {
+		TestBlock tbBlock = TestBlock("Math Library - Transform");
+
+		tbBlock.AddTest("TransformPoint Translation", [](float& _fDelta) -> const bool {
+			MatrixF mMat = TranslationF(Vec3F(1.0f, 2.0f, 3.0f));
+			Vec3F vRes;
+
+			HC_TIME_EXECUTION(vRes = TransformPoint(mMat, Vec3F(4.0f, 5.0f, 6.0f)), _fDelta);
+
+			return vRes == Vec3F(5.0f, 7.0f, 9.0f) && TransformDirection(mMat, Vec3F(4.0f, 5.0f, 6.0f)) == Vec3F(4.0f, 5.0f, 6.0f);
+		});
+
+		tbBlock.AddTest("TransformPoints Vec3F", [](float& _fDelta) -> const bool {
+			MatrixF mMat = GenerateTransformTestMatrixF();
+			std::vector<Vec3F> vSource = GenerateTestVec3F(1027, 1, 10.0f);
+			std::vector<Vec3F> vRes(vSource.size());
+
+			HC_TIME_EXECUTION(TransformPoints(mMat, vSource, vRes), _fDelta);
+
+			for (size_t sNdx = 0; sNdx < vSource.size(); ++sNdx) {
+				if (!TestCompare(vRes[sNdx], TransformPoint(mMat, vSource[sNdx]), TRANSFORM_TOLERANCE)) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("TransformDirections Vec3F In Place", [](float& _fDelta) -> const bool {
+			MatrixF mMat = GenerateTransformTestMatrixF();
+			std::vector<Vec3F> vSource = GenerateTestVec3F(1026, 2, 10.0f);
+			std::vector<Vec3F> vRes = vSource;
+
+			HC_TIME_EXECUTION(TransformDirections(mMat, vRes), _fDelta);
+
+			for (size_t sNdx = 0; sNdx < vSource.size(); ++sNdx) {
+				if (!TestCompare(vRes[sNdx], TransformDirection(mMat, vSource[sNdx]), TRANSFORM_TOLERANCE)) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("TransformPoints Vec4F Projection", [](float& _fDelta) -> const bool {
+			MatrixF mMat = ProjectionF(16.0f / 9.0f, 60.0f, 0.1f, 100.0f);
+			std::vector<Vec3F> vPoints = GenerateTestVec3F(1025, 3, 10.0f);
+			std::vector<Vec4F> vSource(vPoints.size());
+			std::vector<Vec4F> vRes(vPoints.size());
+
+			for (size_t sNdx = 0; sNdx < vPoints.size(); ++sNdx) {
+				vSource[sNdx] = Vec4F(vPoints[sNdx], 1.0f);
+			}
+
+			HC_TIME_EXECUTION(TransformPoints(mMat, vSource, vRes), _fDelta);
+
+			for (size_t sNdx = 0; sNdx < vSource.size(); ++sNdx) {
+				//The W lane must carry the projective result rather than be forced to one
+				if (!TestCompare(vRes[sNdx], TransformPoint(mMat, vSource[sNdx]), TRANSFORM_TOLERANCE)) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("TransformPointsParallel Vec3F", [](float& _fDelta) -> const bool {
+			MatrixF mMat = GenerateTransformTestMatrixF();
+			std::vector<Vec3F> vSource = GenerateTestVec3F(HC_TRANSFORM_PARALLEL_MIN_COUNT * 8 + 3, 4, 10.0f);
+			std::vector<Vec3F> vSerial(vSource.size());
+			std::vector<Vec3F> vRes(vSource.size());
+
+			RunBatchThenReference("TransformPointsParallel", "TransformPoints", [&]() { TransformPointsParallel(mMat, vSource, vRes, 4); }, [&]() { TransformPoints(mMat, vSource, vSerial); }, _fDelta);
+
+			//Every chunk runs the same kernel, so the split must not change a single bit
+			for (size_t sNdx = 0; sNdx < vSource.size(); ++sNdx) {
+				if (vRes[sNdx] != vSerial[sNdx]) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("TransformDirectionsParallel Vec4F In Place", [](float& _fDelta) -> const bool {
+			MatrixF mMat = GenerateTransformTestMatrixF();
+			std::vector<Vec3F> vPoints = GenerateTestVec3F(HC_TRANSFORM_PARALLEL_MIN_COUNT * 2 + 1, 5, 10.0f);
+			std::vector<Vec4F> vSource(vPoints.size());
+
+			for (size_t sNdx = 0; sNdx < vPoints.size(); ++sNdx) {
+				vSource[sNdx] = Vec4F(vPoints[sNdx], 0.0f);
+			}
+
+			std::vector<Vec4F> vRes = vSource;
+
+			HC_TIME_EXECUTION(TransformDirectionsParallel(mMat, vRes), _fDelta);
+
+			for (size_t sNdx = 0; sNdx < vSource.size(); ++sNdx) {
+				if (!TestCompare(vRes[sNdx], TransformDirection(mMat, vSource[sNdx]), TRANSFORM_TOLERANCE)) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		_vBlockList.push_back(tbBlock);
+	}
+}
@@ -0,0 +1,217 @@
+#pragma once
+
+#include <Athena/Tests/Inits/MathInits/Math_Common.hpp>
+
+#include <HellfireControl/Math/Wide.hpp>
+
+namespace MathTests {
+	void InitTests_Wide(std::vector<TestBlock>& _vBlockList) {
+		TestBlock tbBlock = TestBlock("Math Library - Wide");
+
+		tbBlock.AddTest("Vec3Fx8 Pack Unpack", [](float& _fDelta) -> const bool {
+			std::vector<Vec3F> vSource = GenerateTestVec3F(1003, 1);
+			std::vector<Vec3Fx8> vWide;
+			std::vector<Vec3F> vRes;
+
+			HC_TIME_EXECUTION(Pack(vSource, vWide); Unpack(vWide, vRes, vSource.size()), _fDelta);
+
+			if (vWide.size() != 126 || vRes.size() != vSource.size()) {
+				return false;
+			}
+
+			for (size_t sNdx = 0; sNdx < vSource.size(); ++sNdx) {
+				if (vRes[sNdx] != vSource[sNdx]) {
+					return false;
+				}
+			}
+
+			//The padding lanes of the final group must stay zeroed
+			return vWide.back().GetLane(7) == Vec3F();
+		});
+
+		tbBlock.AddTest("Vec4Fx4 Pack Unpack", [](float& _fDelta) -> const bool {
+			std::vector<Vec4F> vSource(10);
+			for (size_t sNdx = 0; sNdx < vSource.size(); ++sNdx) {
+				vSource[sNdx] = Vec4F(static_cast<float>(sNdx), 1.0f, -2.0f, 0.5f * sNdx);
+			}
+
+			std::vector<Vec4Fx4> vWide;
+			std::vector<Vec4F> vRes;
+
+			HC_TIME_EXECUTION(Pack(vSource, vWide); Unpack(vWide, vRes, vSource.size()), _fDelta);
+
+			for (size_t sNdx = 0; sNdx < vSource.size(); ++sNdx) {
+				if (vRes[sNdx] != vSource[sNdx]) {
+					return false;
+				}
+			}
+
+			return vWide.size() == 3;
+		});
+
+		tbBlock.AddTest("Vec3Fx8 Arithmetic", [](float& _fDelta) -> const bool {
+			std::vector<Vec3F> vLeft = GenerateTestVec3F(8, 2);
+			std::vector<Vec3F> vRight = GenerateTestVec3F(8, 3);
+			Vec3Fx8 vWideLeft = LoadVec3Fx8(vLeft.data());
+			Vec3Fx8 vWideRight = LoadVec3Fx8(vRight.data());
+			Vec3Fx8 vRes;
+
+			HC_TIME_EXECUTION(vRes = (vWideLeft + vWideRight) * vWideLeft - vWideRight * 2.0f, _fDelta);
+
+			for (int iLane = 0; iLane < Floatx8::LANES; ++iLane) {
+				if (vRes.GetLane(iLane) != (vLeft[iLane] + vRight[iLane]) * vLeft[iLane] - vRight[iLane] * 2.0f) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("Vec3Fx8 Dot Cross", [](float& _fDelta) -> const bool {
+			std::vector<Vec3F> vLeft = GenerateTestVec3F(8, 4);
+			std::vector<Vec3F> vRight = GenerateTestVec3F(8, 5);
+			Vec3Fx8 vWideLeft = LoadVec3Fx8(vLeft.data());
+			Vec3Fx8 vWideRight = LoadVec3Fx8(vRight.data());
+			Floatx8 fDot;
+			Vec3Fx8 vCross;
+
+			HC_TIME_EXECUTION(fDot = Dot(vWideLeft, vWideRight); vCross = Cross(vWideLeft, vWideRight), _fDelta);
+
+			for (int iLane = 0; iLane < Floatx8::LANES; ++iLane) {
+				if (!(HC_FLOAT_COMPARE(fDot[iLane], Dot(vLeft[iLane], vRight[iLane]))) || vCross.GetLane(iLane) != Cross(vLeft[iLane], vRight[iLane])) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("Vec3Fx4 Normalize", [](float& _fDelta) -> const bool {
+			std::vector<Vec3F> vSource = GenerateTestVec3F(4, 6);
+			Vec3Fx4 vWide = LoadVec3Fx4(vSource.data());
+			Vec3Fx4 vRes;
+
+			HC_TIME_EXECUTION(vRes = Normalize(vWide), _fDelta);
+
+			for (int iLane = 0; iLane < Floatx4::LANES; ++iLane) {
+				Vec3F vExpected = Normalize(vSource[iLane]);
+				if (fabsf(Length(vRes.GetLane(iLane) - vExpected)) > 1.0e-6f) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("QuaternionFx8 Multiply", [](float& _fDelta) -> const bool {
+			std::vector<QuaternionF> vLeft = GenerateTestQuaternionF(8, 7);
+			std::vector<QuaternionF> vRight = GenerateTestQuaternionF(8, 8);
+			QuaternionFx8 qWideLeft = LoadQuaternionFx8(vLeft.data());
+			QuaternionFx8 qWideRight = LoadQuaternionFx8(vRight.data());
+			QuaternionFx8 qRes;
+
+			HC_TIME_EXECUTION(qRes = qWideLeft * qWideRight, _fDelta);
+
+			for (int iLane = 0; iLane < Floatx8::LANES; ++iLane) {
+				if (fabsf(Length(qRes.GetLane(iLane).m_vQuat - (vLeft[iLane] * vRight[iLane]).m_vQuat)) > 1.0e-6f) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("QuaternionFx8 Rotate", [](float& _fDelta) -> const bool {
+			std::vector<QuaternionF> vRotations = GenerateTestQuaternionF(8, 9);
+			std::vector<Vec3F> vPoints = GenerateTestVec3F(8, 10);
+			QuaternionFx8 qWide = LoadQuaternionFx8(vRotations.data());
+			Vec3Fx8 vWide = LoadVec3Fx8(vPoints.data());
+			Vec3Fx8 vRes;
+
+			HC_TIME_EXECUTION(vRes = RotateByQuaternion(vWide, qWide), _fDelta);
+
+			for (int iLane = 0; iLane < Floatx8::LANES; ++iLane) {
+				if (fabsf(Length(vRes.GetLane(iLane) - RotateByQuaternion(vPoints[iLane], vRotations[iLane]))) > 1.0e-5f) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("QuaternionFx8 SLerp", [](float& _fDelta) -> const bool {
+			std::vector<QuaternionF> vStart = GenerateTestQuaternionF(8, 11);
+			std::vector<QuaternionF> vEnd = GenerateTestQuaternionF(8, 12);
+			vEnd[5] = vStart[5]; //Exercise the nearly parallel fallback
+			QuaternionFx8 qWideStart = LoadQuaternionFx8(vStart.data());
+			QuaternionFx8 qWideEnd = LoadQuaternionFx8(vEnd.data());
+			QuaternionFx8 qRes;
+
+			HC_TIME_EXECUTION(qRes = Math::SLerp(qWideStart, qWideEnd, 0.25f), _fDelta);
+
+			QuaternionFx8 qFirst = Math::SLerp(qWideStart, qWideEnd, 0.0f);
+			Floatx8 fLength = Length(qRes);
+
+			for (int iLane = 0; iLane < Floatx8::LANES; ++iLane) {
+				//Unit length and the start point is reproduced exactly at a ratio of zero
+				if (fabsf(fLength[iLane] - 1.0f) > 1.0e-5f || fabsf(Length(qFirst.GetLane(iLane).m_vQuat - vStart[iLane].m_vQuat)) > 1.0e-5f) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("Floatx8 ArcCos SinCos", [](float& _fDelta) -> const bool {
+			std::vector<float> vCosines = GenerateTestFloats(1024, 13, -1.0f, 1.0f);
+			std::vector<float> vAngles = GenerateTestFloats(1024, 14, -4.0f * HC_PI, 4.0f * HC_PI);
+			vCosines[0] = 1.0f; vCosines[1] = -1.0f; vCosines[2] = 0.5f; vCosines[3] = 0.99999f;
+			vAngles[0] = 0.0f; vAngles[1] = HC_PI_HALF; vAngles[2] = -HC_PI; vAngles[3] = 0.25f * HC_PI;
+
+			std::vector<Floatx8> vWideCosines(vCosines.size() / Floatx8::LANES), vWideAngles(vWideCosines.size());
+			for (size_t sNdx = 0; sNdx < vCosines.size(); ++sNdx) {
+				vWideCosines[sNdx / Floatx8::LANES][static_cast<int>(sNdx % Floatx8::LANES)] = vCosines[sNdx];
+				vWideAngles[sNdx / Floatx8::LANES][static_cast<int>(sNdx % Floatx8::LANES)] = vAngles[sNdx];
+			}
+
+			std::vector<Floatx8> vACos(vWideCosines.size()), vSin(vWideCosines.size()), vCos(vWideCosines.size());
+
+			HC_TIME_EXECUTION(for (size_t sGroup = 0; sGroup < vACos.size(); ++sGroup) { vACos[sGroup] = ArcCos(vWideCosines[sGroup]); SinCos(vWideAngles[sGroup], vSin[sGroup], vCos[sGroup]); }, _fDelta);
+
+			for (size_t sNdx = 0; sNdx < vCosines.size(); ++sNdx) {
+				const size_t sGroup = sNdx / Floatx8::LANES;
+				const int iLane = static_cast<int>(sNdx % Floatx8::LANES);
+
+				if (fabsf(vACos[sGroup][iLane] - acosf(vCosines[sNdx])) > 1.0e-6f ||
+					fabsf(vSin[sGroup][iLane] - sinf(vAngles[sNdx])) > 1.0e-6f || fabsf(vCos[sGroup][iLane] - cosf(vAngles[sNdx])) > 1.0e-6f) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		tbBlock.AddTest("Uintx4 Integer Lanes", [](float& _fDelta) -> const bool {
+			const Floatx4 fVal = Floatx4(-2.5f, -1.0f, 0.75f, 3.0f);
+			const Uintx4 uLeft = Uintx4(0xDEADBEEFU) + ToUintx4(Floatx4(0.0f, 1.0f, 2.0f, 3.0f));
+			Uintx4 uProduct;
+
+			HC_TIME_EXECUTION(uProduct = uLeft * 0x9E3779B9U, _fDelta);
+
+			const Floatx4 fFloor = Floor(fVal);
+			const Floatx4 fPicked = Select(MaskGreater(fVal, Floatx4(0.0f)), Floatx4(1.0f), Floatx4(-1.0f));
+
+			for (int iLane = 0; iLane < Uintx4::LANES; ++iLane) {
+				//Products wrap like uint32_t, floor rounds down on both sides of zero and the integer round trip keeps the sign
+				if (uProduct[iLane] != (0xDEADBEEFU + static_cast<uint32_t>(iLane)) * 0x9E3779B9U || fFloor[iLane] != floorf(fVal[iLane]) ||
+					ToFloatx4(ToUintx4(fFloor))[iLane] != fFloor[iLane] || fPicked[iLane] != (fVal[iLane] > 0.0f ? 1.0f : -1.0f)) {
+					return false;
+				}
+			}
+
+			return true;
+		});
+
+		_vBlockList.push_back(tbBlock);
+	}
+}
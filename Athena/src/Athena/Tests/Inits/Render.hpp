@@ -0,0 +1,19 @@
+#pragma once
+
+#include <Athena/Core/TestBlock.hpp>
+#include <Athena/Core/Util.hpp>
+
+#include <Athena/Tests/Inits/RenderInits/Culling.hpp>
+#include <Athena/Tests/Inits/RenderInits/Memory.hpp>
+
+namespace RenderTests {
+	void InitTests(std::vector<TestBlock>& _vBlockList) {
+		Console::Print("Generating tests for Render\n");
+
+		//Culling
+		InitTests_Culling(_vBlockList);
+
+		//Memory
+		InitTests_Memory(_vBlockList);
+	}
+}
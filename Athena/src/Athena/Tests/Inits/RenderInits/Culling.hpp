@@ -0,0 +1,103 @@
+#pragma once
+
+#include <Athena/Core/TestBlock.hpp>
+#include <Athena/Core/Util.hpp>
+
+#include <HellfireControl/Math/Math.hpp>
+#include <HellfireControl/Math/Random.hpp>
+#include <HellfireControl/Render/Culling.hpp>
+
+#include <string>
+
+namespace RenderTests {
+	//Camera at z = -10 looking down +z, 45 degrees either side of centre, seeing 1 to 100 units ahead
+	inline MatrixF CullingTestViewProjection() {
+		return InverseRigid(LookAtLH(Vec3F(0.0f, 0.0f, -10.0f), Vec3F(0.0f, 0.0f, 0.0f), Vec3F(0.0f, 1.0f, 0.0f))) * ProjectionF(1.0f, HC_DEG2RAD(45.0f), 1.0f, 100.0f);
+	}
+
+	void InitTests_Culling(std::vector<TestBlock>& _vBlockList) {
+		TestBlock tbBlock = TestBlock("Render - Culling");
+
+		tbBlock.AddTest("Culling Visible Draws", [](float& _fDelta) -> const bool {
+			CullingSubsystem csCulling;
+			bool bRes = true;
+
+			csCulling.SetBounds(7, 0, AABBF(Vec3F(-1.0f), Vec3F(1.0f)));						//At the origin, in view
+			csCulling.SetBounds(7, 2, AABBF(Vec3F(-1.0f, -1.0f, -30.0f), Vec3F(1.0f, 1.0f, -20.0f)));	//Behind the camera
+			csCulling.SetBounds(7, 3, AABBF(Vec3F(500.0f, -1.0f, 0.0f), Vec3F(501.0f, 1.0f, 1.0f)));	//Far off to the side
+			csCulling.SetDrawCount(7, 5);
+			csCulling.SetDrawCount(9, 4); //Never given bounds, so not culled at all
+
+			HC_TIME_EXECUTION(csCulling.Cull(CullingTestViewProjection()), _fDelta);
+
+			//Draw 1 was skipped and draw 4 was added without bounds. Both are kept.
+			const std::span<const uint32_t> vVisible = csCulling.GetVisibleDraws(7);
+			bRes &= std::vector<uint32_t>(vVisible.begin(), vVisible.end()) == std::vector<uint32_t>({ 0, 1, 4 });
+			bRes &= csCulling.GetStats().m_u32Tested == 5 && csCulling.GetStats().m_u32Visible == 3;
+			bRes &= csCulling.IsContextCulled(7) && !csCulling.IsContextCulled(9) && csCulling.GetVisibleDraws(9).empty();
+
+			csCulling.ClearContext(7);
+			csCulling.Cull(CullingTestViewProjection());
+
+			return bRes && !csCulling.IsContextCulled(7) && csCulling.GetStats().m_u32Tested == 0;
+			});
+
+		tbBlock.AddTest("Culling Draw Count Shrinks", [](float& _fDelta) -> const bool {
+			CullingSubsystem csCulling;
+
+			for (uint32_t u32Draw = 0; u32Draw < 6; ++u32Draw) { csCulling.SetBounds(3, u32Draw, AABBF(Vec3F(-1.0f), Vec3F(1.0f))); }
+
+			//The context lost its last two draws, so their bounds must not come back as visible
+			csCulling.SetDrawCount(3, 4);
+
+			HC_TIME_EXECUTION(csCulling.Cull(CullingTestViewProjection()), _fDelta);
+
+			const std::span<const uint32_t> vVisible = csCulling.GetVisibleDraws(3);
+			bool bRes = std::vector<uint32_t>(vVisible.begin(), vVisible.end()) == std::vector<uint32_t>({ 0, 1, 2, 3 }) && csCulling.GetStats().m_u32Tested == 4;
+
+			//Growing again brings the stored bounds back into play
+			csCulling.SetDrawCount(3, 6);
+			csCulling.Cull(CullingTestViewProjection());
+
+			return bRes && csCulling.GetVisibleDraws(3).size() == 6;
+			});
+
+		tbBlock.AddTest("Culling Threaded Matches Single", [](float& _fDelta) -> const bool {
+			Random rand(23);
+			CullingSubsystem csSingle, csThreaded;
+			const FrustumF fFrustum(CullingTestViewProjection());
+			std::vector<uint32_t> vExpected;
+			float fSingleDelta = 0.0f;
+
+			for (uint32_t u32Draw = 0; u32Draw < 100003; ++u32Draw) {
+				const Vec3F vCenter = Vec3F(rand.GenerateFloat(-150.0f, 150.0f), rand.GenerateFloat(-150.0f, 150.0f), rand.GenerateFloat(-50.0f, 150.0f));
+				const AABBF bBounds = AABBF(vCenter - Vec3F(1.0f), vCenter + Vec3F(1.0f));
+
+				csSingle.SetBounds(0, u32Draw, bBounds);
+				csThreaded.SetBounds(0, u32Draw, bBounds);
+				if (Intersects(fFrustum, bBounds)) { vExpected.push_back(u32Draw); }
+			}
+
+			csSingle.SetThreadCount(1);
+			csThreaded.SetThreadCount(3);
+
+			{
+				HC_TIME_EXECUTION(csSingle.Cull(CullingTestViewProjection()), fSingleDelta);
+			}
+
+			{
+				HC_TIME_EXECUTION(csThreaded.Cull(CullingTestViewProjection()), _fDelta);
+			}
+
+			Console::Print("\tCull 100003 boxes: " + std::to_string(fSingleDelta / 1.0e6f) + " ms on one thread, " + std::to_string(_fDelta / 1.0e6f) + " ms on three, " +
+				std::to_string(csThreaded.GetStats().m_u32Visible) + " visible\n", Console::YELLOW);
+
+			const std::span<const uint32_t> vSingle = csSingle.GetVisibleDraws(0), vThreaded = csThreaded.GetVisibleDraws(0);
+
+			return std::equal(vSingle.begin(), vSingle.end(), vExpected.begin(), vExpected.end()) && std::equal(vThreaded.begin(), vThreaded.end(), vExpected.begin(), vExpected.end()) &&
+				csThreaded.GetStats().m_u32Tested == 100003 && !vExpected.empty();
+			});
+
+		_vBlockList.push_back(tbBlock);
+	}
+}
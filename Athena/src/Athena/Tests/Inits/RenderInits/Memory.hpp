@@ -0,0 +1,94 @@
+#pragma once
+
+#include <Athena/Core/TestBlock.hpp>
+#include <Athena/Core/Util.hpp>
+
+#include <HellfireControl/Math/Random.hpp>
+
+#include <Platform/Vulkan/VkTLSF.hpp>
+
+#include <string>
+
+namespace RenderTests {
+	void InitTests_Memory(std::vector<TestBlock>& _vBlockList) {
+		TestBlock tbBlock = TestBlock("Render - Memory");
+
+		tbBlock.AddTest("TLSF Alignment And Reuse", [](float& _fDelta) -> const bool {
+			TLSFAllocator taRanges(1024 * 1024);
+			uint64_t u64First = 0, u64Aligned = 0, u64Reused = 0;
+			uint32_t u32First = HC_TLSF_INVALID_NODE, u32Aligned = HC_TLSF_INVALID_NODE;
+			bool bRes = true;
+
+			HC_TIME_EXECUTION(u32First = taRanges.Allocate(100, 4, u64First), _fDelta);
+
+			//Sizes round up to the minimum alignment, and larger alignments are padded to
+			u32Aligned = taRanges.Allocate(5000, 4096, u64Aligned);
+			bRes &= u64First == 0 && u64Aligned == 4096 && taRanges.GetNodeSize(u32First) == 128 && taRanges.GetUsed() == 128 + 5056;
+
+			//The padding in front of the aligned range is handed out again
+			const uint32_t u32Reused = taRanges.Allocate(1000, 64, u64Reused);
+			bRes &= u64Reused == 128 && taRanges.GetAllocationCount() == 3;
+
+			//More than is free fails cleanly
+			uint64_t u64Unused = 0;
+			bRes &= taRanges.Allocate(1024 * 1024, 64, u64Unused) == HC_TLSF_INVALID_NODE;
+
+			taRanges.Free(u32Reused);
+			taRanges.Free(u32First);
+			taRanges.Free(u32Aligned);
+
+			return bRes && taRanges.IsEmpty() && taRanges.GetUsed() == 0 && taRanges.GetLargestFree() == 1024 * 1024;
+			});
+
+		tbBlock.AddTest("TLSF Random Allocate Free", [](float& _fDelta) -> const bool {
+			Random rand(31);
+			TLSFAllocator taRanges(64ULL * 1024 * 1024);
+			std::vector<std::pair<uint32_t, uint64_t>> vLive;
+			std::vector<uint32_t> vNodes;
+			bool bRes = true;
+
+			const auto fnChurn = [&]() {
+				for (int iNdx = 0; iNdx < 100000; ++iNdx) {
+					if (!vLive.empty() && rand.GenerateInt(0, 2) == 0) {
+						const size_t sVictim = rand.GenerateInt(0, static_cast<int>(vLive.size()) - 1);
+
+						taRanges.Free(vLive[sVictim].first);
+						vLive[sVictim] = vLive.back();
+						vLive.pop_back();
+					}
+					else {
+						const uint64_t u64Alignment = 1ULL << rand.GenerateInt(2, 12);
+						uint64_t u64Offset = 0;
+						const uint32_t u32Node = taRanges.Allocate(rand.GenerateInt(1, 65536), u64Alignment, u64Offset);
+
+						if (u32Node != HC_TLSF_INVALID_NODE) {
+							bRes &= u64Offset % u64Alignment == 0;
+							vLive.emplace_back(u32Node, u64Offset);
+						}
+					}
+				}
+			};
+
+			HC_TIME_EXECUTION(fnChurn(), _fDelta);
+
+			Console::Print("\tTLSF churn: " + std::to_string(_fDelta / 100000.0f) + " ns per allocate or free, " + std::to_string(vLive.size()) + " live\n", Console::YELLOW);
+
+			//Live ranges never overlap and stay in bounds
+			taRanges.GetAllocatedNodes(vNodes);
+			bRes &= vNodes.size() == vLive.size() && taRanges.GetAllocationCount() == vLive.size();
+
+			for (size_t sNdx = 1; sNdx < vNodes.size(); ++sNdx) {
+				bRes &= taRanges.GetOffset(vNodes[sNdx - 1]) + taRanges.GetNodeSize(vNodes[sNdx - 1]) <= taRanges.GetOffset(vNodes[sNdx]);
+			}
+
+			bRes &= vNodes.empty() || taRanges.GetOffset(vNodes.back()) + taRanges.GetNodeSize(vNodes.back()) <= taRanges.GetSize();
+
+			//Freeing everything merges the block back into a single range
+			for (const auto& aLive : vLive) { taRanges.Free(aLive.first); }
+
+			return bRes && taRanges.IsEmpty() && taRanges.GetLargestFree() == taRanges.GetSize();
+			});
+
+		_vBlockList.push_back(tbBlock);
+	}
+}
@@ -6,10 +6,13 @@
 #include <HellfireControl/Core/Common.hpp>
 
 #include <Athena/Tests/Inits/Math.hpp>
+#include <Athena/Tests/Inits/Render.hpp>
 
 
 namespace Tests {
 	void InitTests(std::vector<TestBlock>& _vBlockList) {
 		MathTests::InitTests(_vBlockList);
+
+		RenderTests::InitTests(_vBlockList);
 	}
 }
\ No newline at end of file
@@ -32,11 +32,21 @@
 
 //Defines for standardized declarations
 #define HC_INLINE inline
+#define HC_CONSTEXPR constexpr
+#if defined(_MSC_VER)
 #define HC_VECTORCALL __vectorcall
+#else
+#define HC_VECTORCALL
+#endif
 #define HC_ALIGNAS(_val) alignas((_val))
 
 //Defines for engine conditionals
+#ifndef HC_USE_SIMD //Set through the HC_ENABLE_SIMD CMake option
 #define HC_USE_SIMD 0
+#endif
+#ifndef HC_USE_FAST_MATH //Set through the HC_ENABLE_FAST_MATH CMake option
+#define HC_USE_FAST_MATH 0
+#endif
 #define HC_ENABLE_DOUBLE_PRECISION 1
 #define HC_USE_ROTOR 1
 
@@ -0,0 +1,5 @@
+#pragma once
+
+#include <HellfireControl/Core/Common.hpp>
+
+#include <HellfireControl/Math/Internal/Curve/Curve_F.hpp>
\ No newline at end of file
@@ -0,0 +1,5 @@
+#pragma once
+
+#include <HellfireControl/Core/Common.hpp>
+
+#include <HellfireControl/Math/Internal/Random/Distribution_F.hpp>
\ No newline at end of file
@@ -0,0 +1,6 @@
+#pragma once
+
+#include <HellfireControl/Core/Common.hpp>
+
+#include <HellfireControl/Math/Internal/Geometry/Geometry_F.hpp>
+#include <HellfireControl/Math/Internal/Geometry/Cull_Fx4.hpp>
\ No newline at end of file
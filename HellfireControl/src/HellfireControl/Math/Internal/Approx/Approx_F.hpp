@@ -0,0 +1,394 @@
+#pragma once
+
+#include <HellfireControl/Math/Internal/Vector/Vector2_F.hpp>
+#include <HellfireControl/Math/Internal/Vector/Vector3_F.hpp>
+#include <HellfireControl/Math/Internal/Vector/Vector4_F.hpp>
+
+#include <bit>
+#include <cfloat>
+#include <type_traits>
+
+/*
+* Polynomial approximations of the libm transcendentals for callers that can live with ~1e-4 error (animation, particles,
+* oscillators). Every kernel is branch free so the Vec4F and Vec3F versions run all lanes in one pass under the SSE backend.
+* Domains: Sin/Cos/Tan are reduced around multiples of pi/2 and hold their accuracy for |x| < 8192, Exp clamps its input
+* to [-87, 88], Log2 and Pow expect a positive, normal base.
+*/
+enum MathPrecision : uint8_t {
+	PRECISION_FULL = 0U,	//Forwards to libm
+	PRECISION_FAST = 1U		//Polynomial approximation
+};
+
+//Precision used by the single argument Math functions
+#if HC_USE_FAST_MATH
+#define HC_MATH_PRECISION PRECISION_FAST
+#else
+#define HC_MATH_PRECISION PRECISION_FULL
+#endif
+
+#define HC_APPROX_2_OVER_PI 0.636619772367581343076f
+#define HC_APPROX_PI_HALF_HI 1.57079637050628662109375f
+#define HC_APPROX_PI_HALF_LO -4.37113900018624283e-8f
+#define HC_APPROX_LOG2E 1.44269504088896341f
+#define HC_APPROX_LN2 0.693147180559945309f
+#define HC_APPROX_LN2_HI 0.693359375f
+#define HC_APPROX_LN2_LO -2.12194440e-4f
+#define HC_APPROX_SQRT2 1.41421356237309504880f
+#define HC_APPROX_EXP_MIN -87.0f
+#define HC_APPROX_EXP_MAX 88.0f
+
+#pragma region Scalar Kernels
+//Rounds half away from zero through a truncating conversion, which stays inline where floorf would be a library call.
+HC_CONSTEXPR int ApproxRoundF(float _fVal) { return static_cast<int>(_fVal + (_fVal < 0.0f ? -0.5f : 0.5f)); }
+
+//Reduces _fVal into [-pi/4, pi/4] and returns the quadrant it came from.
+HC_CONSTEXPR int ApproxReduceF(float _fVal, float& _fReduced) {
+	const int iQuadrant = ApproxRoundF(_fVal * HC_APPROX_2_OVER_PI);
+	const float fQuadrant = static_cast<float>(iQuadrant);
+	_fReduced = (_fVal - fQuadrant * HC_APPROX_PI_HALF_HI) - fQuadrant * HC_APPROX_PI_HALF_LO;
+	return iQuadrant;
+}
+
+HC_CONSTEXPR float ApproxSinPolyF(float _fVal, float _fSquared) {
+	return _fVal + _fVal * _fSquared * (-1.6666654611e-1f + _fSquared * (8.3321608736e-3f + _fSquared * -1.9515295891e-4f));
+}
+
+HC_CONSTEXPR float ApproxCosPolyF(float _fSquared) {
+	return 1.0f - 0.5f * _fSquared + _fSquared * _fSquared * (4.166664568298827e-2f + _fSquared * (-1.388731625493765e-3f + _fSquared * 2.443315711809948e-5f));
+}
+
+HC_CONSTEXPR void ApproxSinCosF(float _fVal, float& _fSin, float& _fCos) {
+	float fReduced;
+	const int iQuadrant = ApproxReduceF(_fVal, fReduced);
+	const float fSquared = fReduced * fReduced;
+	const float fSin = ApproxSinPolyF(fReduced, fSquared);
+	const float fCos = ApproxCosPolyF(fSquared);
+
+	//Odd quadrants swap the polynomials, quadrants 2 and 3 negate sine, quadrants 1 and 2 negate cosine
+	_fSin = (iQuadrant & 1) ? fCos : fSin;
+	_fCos = (iQuadrant & 1) ? fSin : fCos;
+	_fSin = (iQuadrant & 2) ? -_fSin : _fSin;
+	_fCos = ((iQuadrant + 1) & 2) ? -_fCos : _fCos;
+}
+
+//Sine and cosine for the constexpr builders. Constant evaluation has no libm, so it falls back on the polynomial kernel.
+HC_CONSTEXPR void ConstexprSinCosF(float _fVal, float& _fSin, float& _fCos) {
+	if (std::is_constant_evaluated()) {
+		ApproxSinCosF(_fVal, _fSin, _fCos);
+		return;
+	}
+
+	_fSin = sinf(_fVal);
+	_fCos = cosf(_fVal);
+}
+
+HC_INLINE float ApproxExpF(float _fVal) {
+	_fVal = _fVal < HC_APPROX_EXP_MIN ? HC_APPROX_EXP_MIN : (_fVal > HC_APPROX_EXP_MAX ? HC_APPROX_EXP_MAX : _fVal);
+
+	//e^x = 2^n * e^r with |r| <= ln(2) / 2
+	const int iExponent = ApproxRoundF(_fVal * HC_APPROX_LOG2E);
+	const float fExponent = static_cast<float>(iExponent);
+	const float fReduced = (_fVal - fExponent * HC_APPROX_LN2_HI) - fExponent * HC_APPROX_LN2_LO;
+	const float fPoly = ((((((1.9875691500e-4f * fReduced + 1.3981999507e-3f) * fReduced + 8.3334519073e-3f) * fReduced + 4.1665795894e-2f) * fReduced
+		+ 1.6666665459e-1f) * fReduced + 5.0000001201e-1f) * fReduced * fReduced) + fReduced + 1.0f;
+
+	return fPoly * std::bit_cast<float>((iExponent + 127) << 23);
+}
+
+HC_INLINE float ApproxLog2F(float _fVal) {
+	const int32_t iBits = std::bit_cast<int32_t>(_fVal);
+	float fExponent = static_cast<float>(((iBits >> 23) & 0xFF) - 127);
+	float fMantissa = std::bit_cast<float>((iBits & 0x007FFFFF) | 0x3F800000);
+
+	//Centre the mantissa on one so the series below converges fast
+	if (fMantissa > HC_APPROX_SQRT2) {
+		fMantissa *= 0.5f;
+		fExponent += 1.0f;
+	}
+
+	//log2(m) = 2 / ln(2) * atanh((m - 1) / (m + 1))
+	const float fRatio = (fMantissa - 1.0f) / (fMantissa + 1.0f);
+	const float fSquared = fRatio * fRatio;
+	const float fSeries = 1.0f + fSquared * (0.333333333f + fSquared * (0.2f + fSquared * (0.142857143f + fSquared * 0.111111111f)));
+
+	return fExponent + fRatio * fSeries * (2.0f * HC_APPROX_LOG2E);
+}
+
+//Minimax arctangent on [0, 1]
+HC_INLINE float ApproxArcTanPolyF(float _fVal) {
+	const float fSquared = _fVal * _fVal;
+	return _fVal * (0.99997726f + fSquared * (-0.33262347f + fSquared * (0.19354346f + fSquared * (-0.11643287f + fSquared * (0.05265332f + fSquared * -0.01172120f)))));
+}
+
+HC_INLINE float ApproxArcTan2F(float _fLeft, float _fRight) {
+	const float fAbsY = fabsf(_fLeft);
+	const float fAbsX = fabsf(_fRight);
+	const float fMax = fAbsX > fAbsY ? fAbsX : fAbsY;
+	const float fMin = fAbsX > fAbsY ? fAbsY : fAbsX;
+
+	float fRes = ApproxArcTanPolyF(fMax > 0.0f ? fMin / fMax : 0.0f);
+	fRes = fAbsY > fAbsX ? HC_PI_HALF - fRes : fRes;
+	fRes = _fRight < 0.0f ? HC_PI - fRes : fRes;
+
+	return _fLeft < 0.0f ? -fRes : fRes;
+}
+
+HC_INLINE float ApproxRSqrtF(float _fVal) {
+#if HC_USE_SIMD
+	const __m128 fVal = _mm_set_ss(_fVal);
+	const __m128 fEstimate = _mm_rsqrt_ss(fVal);
+	const __m128 fSquare = _mm_mul_ss(_mm_mul_ss(fVal, fEstimate), fEstimate);
+
+	//One Newton-Raphson step on the 12 bit hardware estimate
+	return _mm_cvtss_f32(_mm_mul_ss(_mm_mul_ss(_mm_set_ss(0.5f), fEstimate), _mm_sub_ss(_mm_set_ss(3.0f), fSquare)));
+#else
+	//Bit level first guess needs two Newton-Raphson steps to get below 1e-5
+	float fEstimate = std::bit_cast<float>(0x5F375A86 - (std::bit_cast<int32_t>(_fVal) >> 1));
+	fEstimate = fEstimate * (1.5f - 0.5f * _fVal * fEstimate * fEstimate);
+	return fEstimate * (1.5f - 0.5f * _fVal * fEstimate * fEstimate);
+#endif
+}
+#pragma endregion
+
+#pragma region Vector Kernels
+#if HC_USE_SIMD
+HC_INLINE __m128 HC_VECTORCALL ApproxSelectF(__m128 _fMask, __m128 _fTrue, __m128 _fFalse) { return _mm_or_ps(_mm_and_ps(_fMask, _fTrue), _mm_andnot_ps(_fMask, _fFalse)); }
+
+HC_INLINE void HC_VECTORCALL ApproxSinCos4F(__m128 _fVal, __m128& _fSin, __m128& _fCos) {
+	const __m128i iQuadrant = _mm_cvtps_epi32(_mm_mul_ps(_fVal, _mm_set1_ps(HC_APPROX_2_OVER_PI)));
+	const __m128 fQuadrant = _mm_cvtepi32_ps(iQuadrant);
+	__m128 fReduced = _mm_sub_ps(_fVal, _mm_mul_ps(fQuadrant, _mm_set1_ps(HC_APPROX_PI_HALF_HI)));
+	fReduced = _mm_sub_ps(fReduced, _mm_mul_ps(fQuadrant, _mm_set1_ps(HC_APPROX_PI_HALF_LO)));
+
+	const __m128 fSquared = _mm_mul_ps(fReduced, fReduced);
+
+	__m128 fSin = _mm_add_ps(_mm_set1_ps(8.3321608736e-3f), _mm_mul_ps(fSquared, _mm_set1_ps(-1.9515295891e-4f)));
+	fSin = _mm_add_ps(_mm_set1_ps(-1.6666654611e-1f), _mm_mul_ps(fSquared, fSin));
+	fSin = _mm_add_ps(fReduced, _mm_mul_ps(_mm_mul_ps(fReduced, fSquared), fSin));
+
+	__m128 fCos = _mm_add_ps(_mm_set1_ps(-1.388731625493765e-3f), _mm_mul_ps(fSquared, _mm_set1_ps(2.443315711809948e-5f)));
+	fCos = _mm_add_ps(_mm_set1_ps(4.166664568298827e-2f), _mm_mul_ps(fSquared, fCos));
+	fCos = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_set1_ps(0.5f), fSquared)), _mm_mul_ps(_mm_mul_ps(fSquared, fSquared), fCos));
+
+	//Same quadrant fix up as the scalar kernel, done with masks and sign bits
+	const __m128 fSwap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(iQuadrant, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+	const __m128 fSinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(iQuadrant, _mm_set1_epi32(2)), 30));
+	const __m128 fCosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(iQuadrant, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+
+	_fSin = _mm_xor_ps(ApproxSelectF(fSwap, fCos, fSin), fSinSign);
+	_fCos = _mm_xor_ps(ApproxSelectF(fSwap, fSin, fCos), fCosSign);
+}
+
+HC_INLINE __m128 HC_VECTORCALL ApproxExp4F(__m128 _fVal) {
+	_fVal = _mm_min_ps(_mm_max_ps(_fVal, _mm_set1_ps(HC_APPROX_EXP_MIN)), _mm_set1_ps(HC_APPROX_EXP_MAX));
+
+	const __m128i iExponent = _mm_cvtps_epi32(_mm_mul_ps(_fVal, _mm_set1_ps(HC_APPROX_LOG2E)));
+	const __m128 fExponent = _mm_cvtepi32_ps(iExponent);
+	__m128 fReduced = _mm_sub_ps(_fVal, _mm_mul_ps(fExponent, _mm_set1_ps(HC_APPROX_LN2_HI)));
+	fReduced = _mm_sub_ps(fReduced, _mm_mul_ps(fExponent, _mm_set1_ps(HC_APPROX_LN2_LO)));
+
+	__m128 fPoly = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(1.9875691500e-4f), fReduced), _mm_set1_ps(1.3981999507e-3f));
+	fPoly = _mm_add_ps(_mm_mul_ps(fPoly, fReduced), _mm_set1_ps(8.3334519073e-3f));
+	fPoly = _mm_add_ps(_mm_mul_ps(fPoly, fReduced), _mm_set1_ps(4.1665795894e-2f));
+	fPoly = _mm_add_ps(_mm_mul_ps(fPoly, fReduced), _mm_set1_ps(1.6666665459e-1f));
+	fPoly = _mm_add_ps(_mm_mul_ps(fPoly, fReduced), _mm_set1_ps(5.0000001201e-1f));
+	fPoly = _mm_add_ps(_mm_add_ps(_mm_mul_ps(fPoly, _mm_mul_ps(fReduced, fReduced)), fReduced), _mm_set1_ps(1.0f));
+
+	return _mm_mul_ps(fPoly, _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(iExponent, _mm_set1_epi32(127)), 23)));
+}
+
+HC_INLINE __m128 HC_VECTORCALL ApproxLog24F(__m128 _fVal) {
+	const __m128i iBits = _mm_castps_si128(_fVal);
+	__m128 fExponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_and_si128(_mm_srli_epi32(iBits, 23), _mm_set1_epi32(0xFF)), _mm_set1_epi32(127)));
+	__m128 fMantissa = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(iBits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000)));
+
+	const __m128 fHigh = _mm_cmpgt_ps(fMantissa, _mm_set1_ps(HC_APPROX_SQRT2));
+	fMantissa = ApproxSelectF(fHigh, _mm_mul_ps(fMantissa, _mm_set1_ps(0.5f)), fMantissa);
+	fExponent = _mm_add_ps(fExponent, _mm_and_ps(fHigh, _mm_set1_ps(1.0f)));
+
+	const __m128 fRatio = _mm_div_ps(_mm_sub_ps(fMantissa, _mm_set1_ps(1.0f)), _mm_add_ps(fMantissa, _mm_set1_ps(1.0f)));
+	const __m128 fSquared = _mm_mul_ps(fRatio, fRatio);
+
+	__m128 fSeries = _mm_add_ps(_mm_set1_ps(0.142857143f), _mm_mul_ps(fSquared, _mm_set1_ps(0.111111111f)));
+	fSeries = _mm_add_ps(_mm_set1_ps(0.2f), _mm_mul_ps(fSquared, fSeries));
+	fSeries = _mm_add_ps(_mm_set1_ps(0.333333333f), _mm_mul_ps(fSquared, fSeries));
+	fSeries = _mm_add_ps(_mm_set1_ps(1.0f), _mm_mul_ps(fSquared, fSeries));
+
+	return _mm_add_ps(fExponent, _mm_mul_ps(_mm_mul_ps(fRatio, fSeries), _mm_set1_ps(2.0f * HC_APPROX_LOG2E)));
+}
+
+HC_INLINE __m128 HC_VECTORCALL ApproxArcTan24F(__m128 _fLeft, __m128 _fRight) {
+	const __m128 fAbsY = AbsF(_fLeft);
+	const __m128 fAbsX = AbsF(_fRight);
+	const __m128 fMax = _mm_max_ps(fAbsX, fAbsY);
+	const __m128 fMin = _mm_min_ps(fAbsX, fAbsY);
+
+	//Zero over zero resolves to zero instead of a NaN
+	const __m128 fRatio = _mm_and_ps(_mm_cmpgt_ps(fMax, _mm_setzero_ps()), _mm_div_ps(fMin, _mm_max_ps(fMax, _mm_set1_ps(FLT_MIN))));
+	const __m128 fSquared = _mm_mul_ps(fRatio, fRatio);
+
+	__m128 fRes = _mm_add_ps(_mm_set1_ps(0.05265332f), _mm_mul_ps(fSquared, _mm_set1_ps(-0.01172120f)));
+	fRes = _mm_add_ps(_mm_set1_ps(-0.11643287f), _mm_mul_ps(fSquared, fRes));
+	fRes = _mm_add_ps(_mm_set1_ps(0.19354346f), _mm_mul_ps(fSquared, fRes));
+	fRes = _mm_add_ps(_mm_set1_ps(-0.33262347f), _mm_mul_ps(fSquared, fRes));
+	fRes = _mm_mul_ps(fRatio, _mm_add_ps(_mm_set1_ps(0.99997726f), _mm_mul_ps(fSquared, fRes)));
+
+	fRes = ApproxSelectF(_mm_cmpgt_ps(fAbsY, fAbsX), _mm_sub_ps(_mm_set1_ps(HC_PI_HALF), fRes), fRes);
+	fRes = ApproxSelectF(_mm_cmplt_ps(_fRight, _mm_setzero_ps()), _mm_sub_ps(_mm_set1_ps(HC_PI), fRes), fRes);
+
+	return ApproxSelectF(_mm_cmplt_ps(_fLeft, _mm_setzero_ps()), _mm_sub_ps(_mm_setzero_ps(), fRes), fRes);
+}
+
+HC_INLINE __m128 HC_VECTORCALL ApproxRSqrt4F(__m128 _fVal) {
+	const __m128 fEstimate = _mm_rsqrt_ps(_fVal);
+	const __m128 fSquare = _mm_mul_ps(_mm_mul_ps(_fVal, fEstimate), fEstimate);
+
+	return _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), fEstimate), _mm_sub_ps(_mm_set1_ps(3.0f), fSquare));
+}
+#endif
+#pragma endregion
+
+namespace Math {
+#pragma region Scalar
+	/// <summary>
+	/// Computes the sine and cosine of _fVal together, sharing the range reduction.
+	/// </summary>
+	/// <param name="_fVal: Angle in radians"></param>
+	/// <param name="_fSin: Receives the sine"></param>
+	/// <param name="_fCos: Receives the cosine"></param>
+	/// <param name="_mpPrecision: PRECISION_FULL for libm, PRECISION_FAST for the polynomial approximation"></param>
+	HC_INLINE void SinCos(float _fVal, float& _fSin, float& _fCos, MathPrecision _mpPrecision) {
+		if (_mpPrecision == PRECISION_FAST) {
+			ApproxSinCosF(_fVal, _fSin, _fCos);
+			return;
+		}
+
+		_fSin = sinf(_fVal);
+		_fCos = cosf(_fVal);
+	}
+
+	[[nodiscard]] HC_INLINE float Sin(float _fVal, MathPrecision _mpPrecision) {
+		if (_mpPrecision == PRECISION_FULL) { return sinf(_fVal); }
+
+		float fSin, fCos;
+		ApproxSinCosF(_fVal, fSin, fCos);
+		return fSin;
+	}
+
+	[[nodiscard]] HC_INLINE float Cos(float _fVal, MathPrecision _mpPrecision) {
+		if (_mpPrecision == PRECISION_FULL) { return cosf(_fVal); }
+
+		float fSin, fCos;
+		ApproxSinCosF(_fVal, fSin, fCos);
+		return fCos;
+	}
+
+	[[nodiscard]] HC_INLINE float Tan(float _fVal, MathPrecision _mpPrecision) {
+		if (_mpPrecision == PRECISION_FULL) { return tanf(_fVal); }
+
+		float fSin, fCos;
+		ApproxSinCosF(_fVal, fSin, fCos);
+		return fSin / fCos;
+	}
+
+	[[nodiscard]] HC_INLINE float Exp(float _fVal, MathPrecision _mpPrecision) { return _mpPrecision == PRECISION_FAST ? ApproxExpF(_fVal) : expf(_fVal); }
+
+	[[nodiscard]] HC_INLINE float Log2(float _fVal, MathPrecision _mpPrecision) { return _mpPrecision == PRECISION_FAST ? ApproxLog2F(_fVal) : log2f(_fVal); }
+
+	/// <summary>
+	/// Raises _fBase to the power of _fExp. The fast path computes exp(_fExp * ln(_fBase)) and requires a positive base.
+	/// </summary>
+	[[nodiscard]] HC_INLINE float Pow(float _fBase, float _fExp, MathPrecision _mpPrecision) {
+		return _mpPrecision == PRECISION_FAST ? ApproxExpF(_fExp * ApproxLog2F(_fBase) * HC_APPROX_LN2) : powf(_fBase, _fExp);
+	}
+
+	[[nodiscard]] HC_INLINE float ArcTan2(float _fLeft, float _fRight, MathPrecision _mpPrecision) {
+		return _mpPrecision == PRECISION_FAST ? ApproxArcTan2F(_fLeft, _fRight) : atan2f(_fLeft, _fRight);
+	}
+
+	/// <summary>
+	/// Computes 1 / sqrt(_fVal). The fast path refines the hardware estimate with a single Newton-Raphson step.
+	/// </summary>
+	[[nodiscard]] HC_INLINE float RSqrt(float _fVal, MathPrecision _mpPrecision) { return _mpPrecision == PRECISION_FAST ? ApproxRSqrtF(_fVal) : 1.0f / sqrtf(_fVal); }
+#pragma endregion
+
+#pragma region Vec2
+	[[nodiscard]] HC_INLINE Vec2F Sin(const Vec2F& _vVal, MathPrecision _mpPrecision) { return Vec2F(Sin(_vVal.x, _mpPrecision), Sin(_vVal.y, _mpPrecision)); }
+	[[nodiscard]] HC_INLINE Vec2F Cos(const Vec2F& _vVal, MathPrecision _mpPrecision) { return Vec2F(Cos(_vVal.x, _mpPrecision), Cos(_vVal.y, _mpPrecision)); }
+	[[nodiscard]] HC_INLINE Vec2F Exp(const Vec2F& _vVal, MathPrecision _mpPrecision) { return Vec2F(Exp(_vVal.x, _mpPrecision), Exp(_vVal.y, _mpPrecision)); }
+	[[nodiscard]] HC_INLINE Vec2F RSqrt(const Vec2F& _vVal, MathPrecision _mpPrecision) { return Vec2F(RSqrt(_vVal.x, _mpPrecision), RSqrt(_vVal.y, _mpPrecision)); }
+#pragma endregion
+
+#pragma region Vec4
+	HC_INLINE void SinCos(const Vec4F& _vVal, Vec4F& _vSin, Vec4F& _vCos, MathPrecision _mpPrecision) {
+#if HC_USE_SIMD
+		if (_mpPrecision == PRECISION_FAST) {
+			ApproxSinCos4F(_vVal.m_fVec, _vSin.m_fVec, _vCos.m_fVec);
+			return;
+		}
+#endif
+		for (int iNdx = 0; iNdx < 4; ++iNdx) {
+			SinCos(_vVal[iNdx], _vSin[iNdx], _vCos[iNdx], _mpPrecision);
+		}
+	}
+
+	[[nodiscard]] HC_INLINE Vec4F Sin(const Vec4F& _vVal, MathPrecision _mpPrecision) { Vec4F vSin, vCos; SinCos(_vVal, vSin, vCos, _mpPrecision); return vSin; }
+	[[nodiscard]] HC_INLINE Vec4F Cos(const Vec4F& _vVal, MathPrecision _mpPrecision) { Vec4F vSin, vCos; SinCos(_vVal, vSin, vCos, _mpPrecision); return vCos; }
+	[[nodiscard]] HC_INLINE Vec4F Tan(const Vec4F& _vVal, MathPrecision _mpPrecision) { Vec4F vSin, vCos; SinCos(_vVal, vSin, vCos, _mpPrecision); return vSin / vCos; }
+
+	[[nodiscard]] HC_INLINE Vec4F Exp(const Vec4F& _vVal, MathPrecision _mpPrecision) {
+#if HC_USE_SIMD
+		if (_mpPrecision == PRECISION_FAST) { return Vec4F(ApproxExp4F(_vVal.m_fVec)); }
+#endif
+		return Vec4F(Exp(_vVal.x, _mpPrecision), Exp(_vVal.y, _mpPrecision), Exp(_vVal.z, _mpPrecision), Exp(_vVal.w, _mpPrecision));
+	}
+
+	[[nodiscard]] HC_INLINE Vec4F Log2(const Vec4F& _vVal, MathPrecision _mpPrecision) {
+#if HC_USE_SIMD
+		if (_mpPrecision == PRECISION_FAST) { return Vec4F(ApproxLog24F(_vVal.m_fVec)); }
+#endif
+		return Vec4F(Log2(_vVal.x, _mpPrecision), Log2(_vVal.y, _mpPrecision), Log2(_vVal.z, _mpPrecision), Log2(_vVal.w, _mpPrecision));
+	}
+
+	[[nodiscard]] HC_INLINE Vec4F Pow(const Vec4F& _vBase, float _fExp, MathPrecision _mpPrecision) {
+#if HC_USE_SIMD
+		if (_mpPrecision == PRECISION_FAST) { return Vec4F(ApproxExp4F(_mm_mul_ps(ApproxLog24F(_vBase.m_fVec), _mm_set1_ps(_fExp * HC_APPROX_LN2)))); }
+#endif
+		return Vec4F(Pow(_vBase.x, _fExp, _mpPrecision), Pow(_vBase.y, _fExp, _mpPrecision), Pow(_vBase.z, _fExp, _mpPrecision), Pow(_vBase.w, _fExp, _mpPrecision));
+	}
+
+	[[nodiscard]] HC_INLINE Vec4F ArcTan2(const Vec4F& _vLeft, const Vec4F& _vRight, MathPrecision _mpPrecision) {
+#if HC_USE_SIMD
+		if (_mpPrecision == PRECISION_FAST) { return Vec4F(ApproxArcTan24F(_vLeft.m_fVec, _vRight.m_fVec)); }
+#endif
+		return Vec4F(ArcTan2(_vLeft.x, _vRight.x, _mpPrecision), ArcTan2(_vLeft.y, _vRight.y, _mpPrecision), ArcTan2(_vLeft.z, _vRight.z, _mpPrecision), ArcTan2(_vLeft.w, _vRight.w, _mpPrecision));
+	}
+
+	[[nodiscard]] HC_INLINE Vec4F RSqrt(const Vec4F& _vVal, MathPrecision _mpPrecision) {
+#if HC_USE_SIMD
+		if (_mpPrecision == PRECISION_FAST) { return Vec4F(ApproxRSqrt4F(_vVal.m_fVec)); }
+#endif
+		return Vec4F(RSqrt(_vVal.x, _mpPrecision), RSqrt(_vVal.y, _mpPrecision), RSqrt(_vVal.z, _mpPrecision), RSqrt(_vVal.w, _mpPrecision));
+	}
+#pragma endregion
+
+#pragma region Vec3
+	//The padding lane runs through the Vec4F kernels with a value inside every domain and is dropped by XYZ()
+
+	HC_INLINE void SinCos(const Vec3F& _vVal, Vec3F& _vSin, Vec3F& _vCos, MathPrecision _mpPrecision) {
+		Vec4F vSin, vCos;
+		SinCos(Vec4F(_vVal, 0.0f), vSin, vCos, _mpPrecision);
+		_vSin = vSin.XYZ();
+		_vCos = vCos.XYZ();
+	}
+
+	[[nodiscard]] HC_INLINE Vec3F Sin(const Vec3F& _vVal, MathPrecision _mpPrecision) { return Sin(Vec4F(_vVal, 0.0f), _mpPrecision).XYZ(); }
+	[[nodiscard]] HC_INLINE Vec3F Cos(const Vec3F& _vVal, MathPrecision _mpPrecision) { return Cos(Vec4F(_vVal, 0.0f), _mpPrecision).XYZ(); }
+	[[nodiscard]] HC_INLINE Vec3F Tan(const Vec3F& _vVal, MathPrecision _mpPrecision) { return Tan(Vec4F(_vVal, 0.0f), _mpPrecision).XYZ(); }
+	[[nodiscard]] HC_INLINE Vec3F Exp(const Vec3F& _vVal, MathPrecision _mpPrecision) { return Exp(Vec4F(_vVal, 0.0f), _mpPrecision).XYZ(); }
+	[[nodiscard]] HC_INLINE Vec3F Log2(const Vec3F& _vVal, MathPrecision _mpPrecision) { return Log2(Vec4F(_vVal, 1.0f), _mpPrecision).XYZ(); }
+	[[nodiscard]] HC_INLINE Vec3F Pow(const Vec3F& _vBase, float _fExp, MathPrecision _mpPrecision) { return Pow(Vec4F(_vBase, 1.0f), _fExp, _mpPrecision).XYZ(); }
+	[[nodiscard]] HC_INLINE Vec3F ArcTan2(const Vec3F& _vLeft, const Vec3F& _vRight, MathPrecision _mpPrecision) { return ArcTan2(Vec4F(_vLeft, 0.0f), Vec4F(_vRight, 0.0f), _mpPrecision).XYZ(); }
+	[[nodiscard]] HC_INLINE Vec3F RSqrt(const Vec3F& _vVal, MathPrecision _mpPrecision) { return RSqrt(Vec4F(_vVal, 1.0f), _mpPrecision).XYZ(); }
+#pragma endregion
+}
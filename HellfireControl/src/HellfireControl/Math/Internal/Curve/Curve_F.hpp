@@ -0,0 +1,333 @@
+#pragma once
+
+#include <HellfireControl/Math/Vector.hpp>
+#include <HellfireControl/Math/Quaternion.hpp>
+
+#include <algorithm>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+/*
+* Piecewise cubic curves over Vec2F, Vec3F and QuaternionF. Every curve type is converted once, at construction, into the
+* power basis a*u^3 + b*u^2 + c*u + d per segment, so evaluation is the same three multiply-adds on a Vec4F whatever the
+* type. Quaternion curves are built on the four components, kept on one hemisphere, and normalized on the way out.
+* The curve parameter runs from 0 to 1 across the whole curve with every segment taking an equal share. An arc length table
+* maps distance along the curve back to that parameter so points can be spaced evenly.
+*/
+
+enum CurveType : uint8_t {
+	CURVE_BEZIER = 0U,		//Cubic Bezier segments sharing end points: P0 C0 C1 P1 C2 C3 P2 ..., 3n + 1 points for n segments
+	CURVE_CATMULL_ROM = 1U,	//Passes through every point. Open ends are extended by reflecting the neighboring point
+	CURVE_HERMITE = 2U,		//Points alternate position and tangent: P0 T0 P1 T1 ..., 2n + 2 points for n segments
+	CURVE_BSPLINE = 3U		//Uniform cubic B-spline. Continuous in curvature but only approaches its points, n + 3 for n segments
+};
+
+#define HC_CURVE_ARC_SAMPLES 16		//Default chords per segment measured by the arc length table
+
+#pragma region Kernels
+//Rows give the weights of the four segment points for d, c, b and a in turn
+HC_CONSTEXPR float CURVE_BASIS[4][4][4] = {
+	{ { 1.0f, 0.0f, 0.0f, 0.0f }, { -3.0f, 3.0f, 0.0f, 0.0f }, { 3.0f, -6.0f, 3.0f, 0.0f }, { -1.0f, 3.0f, -3.0f, 1.0f } },
+	{ { 0.0f, 1.0f, 0.0f, 0.0f }, { -0.5f, 0.0f, 0.5f, 0.0f }, { 1.0f, -2.5f, 2.0f, -0.5f }, { -0.5f, 1.5f, -1.5f, 0.5f } },
+	{ { 1.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f, 0.0f }, { -3.0f, -2.0f, 3.0f, -1.0f }, { 2.0f, 1.0f, -2.0f, 1.0f } },
+	{ { 1.0f / 6.0f, 4.0f / 6.0f, 1.0f / 6.0f, 0.0f }, { -0.5f, 0.0f, 0.5f, 0.0f }, { 0.5f, -1.0f, 0.5f, 0.0f }, { -1.0f / 6.0f, 0.5f, -0.5f, 1.0f / 6.0f } }
+};
+
+//Points between the starts of neighboring segments
+HC_CONSTEXPR int CURVE_STRIDE[4] = { 3, 1, 2, 1 };
+
+template<typename T>
+[[nodiscard]] HC_INLINE Vec4F CurveStoreF(const T& _tVal) {
+	if constexpr (std::is_same_v<T, Vec2F>) {
+		return Vec4F(_tVal, 0.0f, 0.0f);
+	}
+	else if constexpr (std::is_same_v<T, Vec3F>) {
+		return Vec4F(_tVal, 0.0f);
+	}
+	else {
+		return _tVal.m_vQuat;
+	}
+}
+
+template<typename T>
+[[nodiscard]] HC_INLINE T CurveLoadF(const Vec4F& _vVal) {
+	if constexpr (std::is_same_v<T, Vec2F>) {
+		return _vVal.XY();
+	}
+	else if constexpr (std::is_same_v<T, Vec3F>) {
+		return _vVal.XYZ();
+	}
+	else {
+		return QuaternionF(Normalize(_vVal));
+	}
+}
+
+//Distance between two points on the curve. Quaternions measure the angle of the rotation between them.
+template<typename T>
+[[nodiscard]] HC_INLINE float CurveDistanceF(const Vec4F& _vLeft, const Vec4F& _vRight) {
+	if constexpr (std::is_same_v<T, QuaternionF>) {
+		//The 4D angle between the two from the half angle's tangent, which unlike acos stays precise for the short chords the
+		//arc length table measures. The rotation turns through twice that angle.
+		const Vec4F vLeft = Normalize(_vLeft);
+		const Vec4F vRight = Dot(_vLeft, _vRight) < 0.0f ? -Normalize(_vRight) : Normalize(_vRight);
+		return 4.0f * atan2f(Length(vLeft - vRight), Length(vLeft + vRight));
+	}
+	else {
+		return Length(_vRight - _vLeft);
+	}
+}
+
+//q and -q are the same rotation. Keeping neighbors on one hemisphere stops a quaternion curve taking the long way round.
+//_iStep groups a Hermite position with its tangent so both flip together.
+HC_INLINE void CurveHemisphereF(std::vector<Vec4F>& _vPoints, int _iStep) {
+	for (size_t sNdx = _iStep; sNdx < _vPoints.size(); sNdx += _iStep) {
+		if (Dot(_vPoints[sNdx - _iStep], _vPoints[sNdx]) < 0.0f) {
+			for (int iOffset = 0; iOffset < _iStep; ++iOffset) { _vPoints[sNdx + iOffset] = -_vPoints[sNdx + iOffset]; }
+		}
+	}
+}
+
+//Control points laid out so segment i reads four points from i * stride, with any phantom or wrapped points filled in
+template<typename T>
+[[nodiscard]] HC_INLINE std::vector<Vec4F> CurveControlPointsF(CurveType _ctType, std::span<const T> _tPoints, bool _bClosed) {
+	constexpr bool bRotation = std::is_same_v<T, QuaternionF>;
+	const int iStep = _ctType == CURVE_HERMITE ? 2 : 1;
+	std::vector<Vec4F> vSource, vRes;
+
+	vSource.reserve(_tPoints.size());
+	for (const T& tPoint : _tPoints) { vSource.push_back(CurveStoreF(tPoint)); }
+
+	if constexpr (bRotation) { CurveHemisphereF(vSource, iStep); }
+
+	const int iCount = static_cast<int>(vSource.size());
+	vRes.reserve(iCount + 3);
+
+	if (_ctType == CURVE_CATMULL_ROM) {
+		vRes.push_back(_bClosed ? vSource[iCount - 1] : vSource[0] * 2.0f - vSource[1]);
+		vRes.insert(vRes.end(), vSource.begin(), vSource.end());
+
+		if (_bClosed) {
+			vRes.push_back(vSource[0]);
+			vRes.push_back(vSource[1]);
+		}
+		else {
+			vRes.push_back(vSource[iCount - 1] * 2.0f - vSource[iCount - 2]);
+		}
+	}
+	else {
+		vRes.insert(vRes.end(), vSource.begin(), vSource.end());
+
+		if (_bClosed) {
+			for (int iNdx = 0; iNdx < 3; ++iNdx) { vRes.push_back(vSource[iNdx % iCount]); }
+		}
+	}
+
+	//Wrapped points were copied from the far end of the chain and may sit on the other hemisphere from their new neighbors
+	if constexpr (bRotation) {
+		if (_bClosed) { CurveHemisphereF(vRes, iStep); }
+	}
+
+	return vRes;
+}
+#pragma endregion
+
+template<typename T>
+class Curve {
+private:
+	/// <summary>
+	/// Power basis coefficients, four per segment in the order d, c, b, a
+	/// </summary>
+	std::vector<Vec4F> m_vCoefficients;
+
+	/// <summary>
+	/// Curve parameter at evenly spaced distances from the start to the end. Empty until BuildArcLengthTable is called
+	/// </summary>
+	std::vector<float> m_vArcParams;
+
+	/// <summary>
+	/// Number of cubic segments
+	/// </summary>
+	int m_iSegments = 0;
+
+	/// <summary>
+	/// Length measured by the arc length table
+	/// </summary>
+	float m_fLength = 0.0f;
+
+	[[nodiscard]] HC_INLINE const Vec4F* Locate(float _fParam, float& _fLocal) const {
+		const float fScaled = fminf(fmaxf(_fParam, 0.0f), 1.0f) * static_cast<float>(m_iSegments);
+		const int iSegment = std::min(static_cast<int>(fScaled), m_iSegments - 1);
+
+		_fLocal = fScaled - static_cast<float>(iSegment);
+		return m_vCoefficients.data() + iSegment * 4;
+	}
+
+	[[nodiscard]] HC_INLINE Vec4F EvaluateRaw(float _fParam) const {
+		float fLocal;
+		const Vec4F* pCoeff = Locate(_fParam, fLocal);
+
+		return ((pCoeff[3] * fLocal + pCoeff[2]) * fLocal + pCoeff[1]) * fLocal + pCoeff[0];
+	}
+
+public:
+	/// <summary>
+	/// Builds the curve from its control points. See CurveType for how each type reads them.
+	/// </summary>
+	/// <param name="_ctType: How the control points are interpreted"></param>
+	/// <param name="_tPoints: Control points"></param>
+	/// <param name="_bClosed: Joins the end back to the start. Catmull-Rom and B-splines only"></param>
+	HC_INLINE explicit Curve(CurveType _ctType, std::span<const T> _tPoints, bool _bClosed = false) {
+		const int iCount = static_cast<int>(_tPoints.size());
+
+		assert(!_bClosed || _ctType == CURVE_CATMULL_ROM || _ctType == CURVE_BSPLINE);
+
+		switch (_ctType) {
+		case CURVE_BEZIER:
+			assert(iCount >= 4 && (iCount - 1) % 3 == 0);
+			m_iSegments = (iCount - 1) / 3;
+			break;
+		case CURVE_CATMULL_ROM:
+			assert(iCount >= 2);
+			m_iSegments = _bClosed ? iCount : iCount - 1;
+			break;
+		case CURVE_HERMITE:
+			assert(iCount >= 4 && iCount % 2 == 0);
+			m_iSegments = iCount / 2 - 1;
+			break;
+		case CURVE_BSPLINE:
+			assert(_bClosed ? iCount >= 3 : iCount >= 4);
+			m_iSegments = _bClosed ? iCount : iCount - 3;
+			break;
+		}
+
+		const std::vector<Vec4F> vPoints = CurveControlPointsF(_ctType, _tPoints, _bClosed);
+		m_vCoefficients.resize(static_cast<size_t>(m_iSegments) * 4);
+
+		for (int iSegment = 0; iSegment < m_iSegments; ++iSegment) {
+			const Vec4F* pPoints = vPoints.data() + iSegment * CURVE_STRIDE[_ctType];
+
+			for (int iPower = 0; iPower < 4; ++iPower) {
+				const float* pWeights = CURVE_BASIS[_ctType][iPower];
+				m_vCoefficients[iSegment * 4 + iPower] = pPoints[0] * pWeights[0] + pPoints[1] * pWeights[1] + pPoints[2] * pWeights[2] + pPoints[3] * pWeights[3];
+			}
+		}
+	}
+
+	[[nodiscard]] HC_INLINE int GetSegmentCount() const { return m_iSegments; }
+
+	/// <summary>
+	/// Length of the curve. Zero until BuildArcLengthTable is called. Radians of rotation for quaternion curves.
+	/// </summary>
+	[[nodiscard]] HC_INLINE float GetLength() const { return m_fLength; }
+
+	/// <summary>
+	/// Evaluates the curve at _fParam, clamped to [0, 1].
+	/// </summary>
+	[[nodiscard]] HC_INLINE T Evaluate(float _fParam) const { return CurveLoadF<T>(EvaluateRaw(_fParam)); }
+
+	/// <summary>
+	/// Evaluates the curve at every parameter in _fParams.
+	/// </summary>
+	/// <param name="_fParams: Parameters to evaluate, each clamped to [0, 1]"></param>
+	/// <param name="_tOut: Receives one point per parameter"></param>
+	HC_INLINE void Evaluate(std::span<const float> _fParams, std::span<T> _tOut) const {
+		assert(_tOut.size() >= _fParams.size());
+
+		for (size_t sNdx = 0; sNdx < _fParams.size(); ++sNdx) { _tOut[sNdx] = CurveLoadF<T>(EvaluateRaw(_fParams[sNdx])); }
+	}
+
+	/// <summary>
+	/// Rate of change of the curve with respect to _fParam, which points along the curve. Not available on quaternion curves.
+	/// </summary>
+	[[nodiscard]] HC_INLINE T Derivative(float _fParam) const {
+		static_assert(!std::is_same_v<T, QuaternionF>, "The derivative of a normalized quaternion curve is not a rotation");
+
+		float fLocal;
+		const Vec4F* pCoeff = Locate(_fParam, fLocal);
+
+		return CurveLoadF<T>(((pCoeff[3] * (3.0f * fLocal) + pCoeff[2] * 2.0f) * fLocal + pCoeff[1]) * static_cast<float>(m_iSegments));
+	}
+
+	/// <summary>
+	/// Measures the curve with chords and builds the table that the distance based functions read.
+	/// </summary>
+	/// <param name="_iSamplesPerSegment: Chords per segment. More chords measure tight bends more accurately"></param>
+	HC_INLINE void BuildArcLengthTable(int _iSamplesPerSegment = HC_CURVE_ARC_SAMPLES) {
+		assert(_iSamplesPerSegment > 0);
+
+		const int iSamples = m_iSegments * _iSamplesPerSegment;
+		const float fInvSamples = 1.0f / static_cast<float>(iSamples);
+		std::vector<float> vDistances(iSamples + 1);
+		Vec4F vPrev = EvaluateRaw(0.0f);
+
+		vDistances[0] = 0.0f;
+
+		for (int iNdx = 1; iNdx <= iSamples; ++iNdx) {
+			const Vec4F vNext = EvaluateRaw(static_cast<float>(iNdx) * fInvSamples);
+			vDistances[iNdx] = vDistances[iNdx - 1] + CurveDistanceF<T>(vPrev, vNext);
+			vPrev = vNext;
+		}
+
+		m_fLength = vDistances[iSamples];
+		m_vArcParams.resize(iSamples + 1);
+
+		//Invert the table onto evenly spaced distances, walking both forward together
+		int iChord = 0;
+		for (int iNdx = 0; iNdx <= iSamples; ++iNdx) {
+			const float fDistance = m_fLength * static_cast<float>(iNdx) * fInvSamples;
+
+			while (iChord < iSamples - 1 && vDistances[iChord + 1] < fDistance) { ++iChord; }
+
+			const float fChord = vDistances[iChord + 1] - vDistances[iChord];
+			const float fRatio = fChord > 0.0f ? fminf(fmaxf((fDistance - vDistances[iChord]) / fChord, 0.0f), 1.0f) : 0.0f;
+
+			m_vArcParams[iNdx] = (static_cast<float>(iChord) + fRatio) * fInvSamples;
+		}
+	}
+
+	/// <summary>
+	/// Finds the curve parameter _fDistance along the curve from its start. Requires BuildArcLengthTable.
+	/// </summary>
+	/// <param name="_fDistance: Distance from the start, clamped to [0, GetLength()]"></param>
+	/// <returns>
+	/// float: Curve parameter in [0, 1]
+	/// </returns>
+	[[nodiscard]] HC_INLINE float ParameterAtDistance(float _fDistance) const {
+		assert(!m_vArcParams.empty());
+
+		const int iLast = static_cast<int>(m_vArcParams.size()) - 1;
+		const float fScaled = m_fLength > 0.0f ? fminf(fmaxf(_fDistance / m_fLength, 0.0f), 1.0f) * static_cast<float>(iLast) : 0.0f;
+		const int iNdx = std::min(static_cast<int>(fScaled), iLast - 1);
+		const float fRatio = fScaled - static_cast<float>(iNdx);
+
+		return m_vArcParams[iNdx] + (m_vArcParams[iNdx + 1] - m_vArcParams[iNdx]) * fRatio;
+	}
+
+	/// <summary>
+	/// Evaluates the curve _fDistance along it from its start. Requires BuildArcLengthTable.
+	/// </summary>
+	[[nodiscard]] HC_INLINE T EvaluateAtDistance(float _fDistance) const { return Evaluate(ParameterAtDistance(_fDistance)); }
+
+	/// <summary>
+	/// Evaluates the curve at every distance in _fDistances. Requires BuildArcLengthTable.
+	/// </summary>
+	/// <param name="_fDistances: Distances from the start, each clamped to [0, GetLength()]"></param>
+	/// <param name="_tOut: Receives one point per distance"></param>
+	HC_INLINE void EvaluateAtDistance(std::span<const float> _fDistances, std::span<T> _tOut) const {
+		assert(_tOut.size() >= _fDistances.size());
+
+		for (size_t sNdx = 0; sNdx < _fDistances.size(); ++sNdx) { _tOut[sNdx] = CurveLoadF<T>(EvaluateRaw(ParameterAtDistance(_fDistances[sNdx]))); }
+	}
+
+	/// <summary>
+	/// Fills _tOut with points evenly spaced by distance from the start of the curve to its end. Requires BuildArcLengthTable.
+	/// </summary>
+	HC_INLINE void Resample(std::span<T> _tOut) const {
+		if (_tOut.empty()) return;
+
+		const float fStep = _tOut.size() > 1 ? m_fLength / static_cast<float>(_tOut.size() - 1) : 0.0f;
+
+		for (size_t sNdx = 0; sNdx < _tOut.size(); ++sNdx) { _tOut[sNdx] = CurveLoadF<T>(EvaluateRaw(ParameterAtDistance(fStep * static_cast<float>(sNdx)))); }
+	}
+};
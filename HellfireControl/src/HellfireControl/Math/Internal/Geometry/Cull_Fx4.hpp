@@ -0,0 +1,198 @@
+#pragma once
+
+#include <HellfireControl/Math/Internal/Wide/Wide_Fx4.hpp>
+#include <HellfireControl/Math/Internal/Geometry/Geometry_F.hpp>
+
+#include <cfloat>
+#include <span>
+
+/*
+* Batched culling and picking. Each group of four volumes is transposed into lanes and tested against the same frustum or ray
+* without branches. Results come back as a bitmask: bit (i % 32) of word (i / 32) is set when volume i passes. Use
+* GetMaskWordCount to size the mask. Every test gives the same answer as its scalar Intersects in Geometry_F.hpp.
+*/
+
+static_assert(sizeof(SphereF) == sizeof(Vec4F), "Batched sphere tests walk SphereF spans as packed Vec4Fs");
+
+[[nodiscard]] HC_CONSTEXPR size_t GetMaskWordCount(size_t _sCount) { return (_sCount + 31) / 32; }
+
+[[nodiscard]] HC_INLINE bool GetMaskBit(std::span<const uint32_t> _uMask, size_t _sNdx) { return (_uMask[_sNdx / 32] >> (_sNdx % 32)) & 1U; }
+
+/// <summary>
+/// The planes of one FrustumF broadcast across every lane, built once per batch.
+/// </summary>
+struct FrustumFx4
+{
+	Vec4Fx4 m_vPlanes[FRUSTUM_PLANE_COUNT];
+	Vec3Fx4 m_vAbsNormals[FRUSTUM_PLANE_COUNT];
+
+	HC_INLINE explicit FrustumFx4(const FrustumF& _fFrustum) {
+		for (int iPlane = 0; iPlane < FRUSTUM_PLANE_COUNT; ++iPlane) {
+			m_vPlanes[iPlane] = Vec4Fx4(_fFrustum.m_pPlanes[iPlane].m_vPlane);
+			m_vAbsNormals[iPlane] = Vec3Fx4(Abs(_fFrustum.m_pPlanes[iPlane].GetNormal()));
+		}
+	}
+};
+
+/// <summary>
+/// A RayF broadcast across every lane, with the reciprocal direction the slab test needs.
+/// </summary>
+struct RayFx4
+{
+	Vec3Fx4 m_vOrigin;
+	Vec3Fx4 m_vInvDirection;
+
+	HC_INLINE explicit RayFx4(const RayF& _rRay) : m_vOrigin(_rRay.m_vOrigin), m_vInvDirection(Vec3F(1.0f) / _rRay.m_vDirection) {}
+};
+
+/// <summary>
+/// Gathers up to four AABBFs into corner lanes. Lanes past _iCount are left at zero.
+/// </summary>
+HC_INLINE void LoadAABBFx4(const AABBF* _pSource, Vec3Fx4& _vMin, Vec3Fx4& _vMax, int _iCount = Floatx4::LANES) {
+#if HC_USE_SIMD
+	if (_iCount == Floatx4::LANES) {
+		__m128 fMin0 = _pSource[0].m_vMin.m_fVec, fMin1 = _pSource[1].m_vMin.m_fVec, fMin2 = _pSource[2].m_vMin.m_fVec, fMin3 = _pSource[3].m_vMin.m_fVec;
+		__m128 fMax0 = _pSource[0].m_vMax.m_fVec, fMax1 = _pSource[1].m_vMax.m_fVec, fMax2 = _pSource[2].m_vMax.m_fVec, fMax3 = _pSource[3].m_vMax.m_fVec;
+		_MM_TRANSPOSE4_PS(fMin0, fMin1, fMin2, fMin3);
+		_MM_TRANSPOSE4_PS(fMax0, fMax1, fMax2, fMax3);
+		_vMin = Vec3Fx4(Floatx4(fMin0), Floatx4(fMin1), Floatx4(fMin2));
+		_vMax = Vec3Fx4(Floatx4(fMax0), Floatx4(fMax1), Floatx4(fMax2));
+		return;
+	}
+#endif
+	_vMin = Vec3Fx4();
+	_vMax = Vec3Fx4();
+	for (int iLane = 0; iLane < _iCount; ++iLane) {
+		_vMin.SetLane(iLane, _pSource[iLane].m_vMin);
+		_vMax.SetLane(iLane, _pSource[iLane].m_vMax);
+	}
+}
+
+[[nodiscard]] HC_INLINE int CullSpheresF(const FrustumFx4& _fFrustum, const Vec4Fx4& _vSpheres) {
+	const Vec4Fx4 vCenters = Vec4Fx4(_vSpheres.XYZ(), Floatx4(1.0f));
+	Floatx4 fClosest = Dot(_fFrustum.m_vPlanes[0], vCenters);
+
+	for (int iPlane = 1; iPlane < FRUSTUM_PLANE_COUNT; ++iPlane) {
+		fClosest = Min(fClosest, Dot(_fFrustum.m_vPlanes[iPlane], vCenters));
+	}
+
+	return MaskLessEqual(-_vSpheres.w, fClosest);
+}
+
+[[nodiscard]] HC_INLINE int CullAABBsF(const FrustumFx4& _fFrustum, const Vec3Fx4& _vMin, const Vec3Fx4& _vMax) {
+	const Vec4Fx4 vCenters = Vec4Fx4((_vMin + _vMax) * 0.5f, Floatx4(1.0f));
+	const Vec3Fx4 vExtents = (_vMax - _vMin) * 0.5f;
+	Floatx4 fClosest = Dot(_fFrustum.m_vPlanes[0], vCenters) + Dot(_fFrustum.m_vAbsNormals[0], vExtents);
+
+	for (int iPlane = 1; iPlane < FRUSTUM_PLANE_COUNT; ++iPlane) {
+		fClosest = Min(fClosest, Dot(_fFrustum.m_vPlanes[iPlane], vCenters) + Dot(_fFrustum.m_vAbsNormals[iPlane], vExtents));
+	}
+
+	return MaskLessEqual(Floatx4(), fClosest);
+}
+
+[[nodiscard]] HC_INLINE int PickAABBsF(const RayFx4& _rRay, const Vec3Fx4& _vMin, const Vec3Fx4& _vMax, const Floatx4& _fMaxDistance, Floatx4& _fDistance) {
+	const Vec3Fx4 vNear = (_vMin - _rRay.m_vOrigin) * _rRay.m_vInvDirection;
+	const Vec3Fx4 vFar = (_vMax - _rRay.m_vOrigin) * _rRay.m_vInvDirection;
+
+	_fDistance = Max(Max(Max(Min(vNear.x, vFar.x), Min(vNear.y, vFar.y)), Min(vNear.z, vFar.z)), Floatx4());
+	const Floatx4 fExit = Min(Min(Min(Max(vNear.x, vFar.x), Max(vNear.y, vFar.y)), Max(vNear.z, vFar.z)), _fMaxDistance);
+
+	return MaskLessEqual(_fDistance, fExit);
+}
+
+//Runs _fnKernel over every group of four and packs the lane masks into _uMask. The last group's unused lanes are masked off.
+template<typename Kernel>
+HC_INLINE void CullBatchF(size_t _sCount, std::span<uint32_t> _uMask, Kernel _fnKernel) {
+	assert(_uMask.size() >= GetMaskWordCount(_sCount));
+
+	for (size_t sWord = 0; sWord < GetMaskWordCount(_sCount); ++sWord) { _uMask[sWord] = 0U; }
+
+	for (size_t sNdx = 0; sNdx < _sCount; sNdx += Floatx4::LANES) {
+		const int iCount = static_cast<int>(std::min<size_t>(Floatx4::LANES, _sCount - sNdx));
+		const uint32_t uLanes = static_cast<uint32_t>(_fnKernel(sNdx, iCount)) & ((1U << iCount) - 1U);
+
+		_uMask[sNdx / 32] |= uLanes << (sNdx % 32);
+	}
+}
+
+namespace Math {
+	/// <summary>
+	/// Frustum test of every sphere in _sSpheres.
+	/// </summary>
+	/// <param name="_fFrustum: View volume"></param>
+	/// <param name="_sSpheres: Bounding spheres to test"></param>
+	/// <param name="_uMask: Receives one bit per sphere, set when it may be visible. At least GetMaskWordCount(_sSpheres.size()) words"></param>
+	HC_INLINE void Intersects(const FrustumF& _fFrustum, std::span<const SphereF> _sSpheres, std::span<uint32_t> _uMask) {
+		const FrustumFx4 fFrustum = FrustumFx4(_fFrustum);
+		const Vec4F* pSpheres = reinterpret_cast<const Vec4F*>(_sSpheres.data());
+
+		CullBatchF(_sSpheres.size(), _uMask, [&](size_t _sNdx, int _iCount) { return CullSpheresF(fFrustum, LoadVec4Fx4(pSpheres + _sNdx, _iCount)); });
+	}
+
+	/// <summary>
+	/// Conservative frustum test of every box in _bBoxes, matching Intersects(FrustumF, AABBF).
+	/// </summary>
+	/// <param name="_fFrustum: View volume"></param>
+	/// <param name="_bBoxes: Bounding boxes to test"></param>
+	/// <param name="_uMask: Receives one bit per box, set when it may be visible. At least GetMaskWordCount(_bBoxes.size()) words"></param>
+	HC_INLINE void Intersects(const FrustumF& _fFrustum, std::span<const AABBF> _bBoxes, std::span<uint32_t> _uMask) {
+		const FrustumFx4 fFrustum = FrustumFx4(_fFrustum);
+
+		CullBatchF(_bBoxes.size(), _uMask, [&](size_t _sNdx, int _iCount) {
+			Vec3Fx4 vMin, vMax;
+			LoadAABBFx4(_bBoxes.data() + _sNdx, vMin, vMax, _iCount);
+			return CullAABBsF(fFrustum, vMin, vMax);
+		});
+	}
+
+	/// <summary>
+	/// Ray test of every box in _bBoxes for picking.
+	/// </summary>
+	/// <param name="_rRay: Picking ray"></param>
+	/// <param name="_bBoxes: Bounding boxes to test"></param>
+	/// <param name="_uMask: Receives one bit per box, set when the ray enters it within _fMaxDistance. At least GetMaskWordCount(_bBoxes.size()) words"></param>
+	/// <param name="_fMaxDistance: Length of the ray, in multiples of its direction"></param>
+	HC_INLINE void Intersects(const RayF& _rRay, std::span<const AABBF> _bBoxes, std::span<uint32_t> _uMask, float _fMaxDistance = FLT_MAX) {
+		const RayFx4 rRay = RayFx4(_rRay);
+		const Floatx4 fMaxDistance = Floatx4(_fMaxDistance);
+
+		CullBatchF(_bBoxes.size(), _uMask, [&](size_t _sNdx, int _iCount) {
+			Vec3Fx4 vMin, vMax;
+			Floatx4 fDistance;
+			LoadAABBFx4(_bBoxes.data() + _sNdx, vMin, vMax, _iCount);
+			return PickAABBsF(rRay, vMin, vMax, fMaxDistance, fDistance);
+		});
+	}
+
+	/// <summary>
+	/// Closest box along _rRay, or -1 when it hits none. _fDistance receives the entry distance of that box.
+	/// </summary>
+	[[nodiscard]] HC_INLINE int64_t Pick(const RayF& _rRay, std::span<const AABBF> _bBoxes, float& _fDistance, float _fMaxDistance = FLT_MAX) {
+		const RayFx4 rRay = RayFx4(_rRay);
+		int64_t iClosest = -1;
+		float fClosest = _fMaxDistance;
+
+		for (size_t sNdx = 0; sNdx < _bBoxes.size(); sNdx += Floatx4::LANES) {
+			const int iCount = static_cast<int>(std::min<size_t>(Floatx4::LANES, _bBoxes.size() - sNdx));
+			Vec3Fx4 vMin, vMax;
+			Floatx4 fDistance;
+
+			LoadAABBFx4(_bBoxes.data() + sNdx, vMin, vMax, iCount);
+
+			//Shrinking the far limit to the best hit so far lets later groups reject anything behind it
+			int iHits = PickAABBsF(rRay, vMin, vMax, Floatx4(fClosest), fDistance) & ((1 << iCount) - 1);
+
+			for (int iLane = 0; iHits != 0; ++iLane, iHits >>= 1) {
+				if ((iHits & 1) && (iClosest < 0 || fDistance[iLane] < fClosest)) {
+					fClosest = fDistance[iLane];
+					iClosest = static_cast<int64_t>(sNdx) + iLane;
+				}
+			}
+		}
+
+		if (iClosest >= 0) { _fDistance = fClosest; }
+
+		return iClosest;
+	}
+}
@@ -0,0 +1,259 @@
+#pragma once
+
+#include <HellfireControl/Math/Internal/Matrix/Matrix_F.hpp>
+#include <HellfireControl/Math/Internal/Quaternion/Quaternion_F.hpp>
+
+/*
+* Bounding volumes and the scalar tests between them. Planes are stored as (normal, distance) with a point on the inside when
+* Dot(normal, point) + distance >= 0. Every test treats touching as intersecting. The batched versions for culling and picking
+* live in Cull_Fx4.hpp.
+*/
+
+/// <summary>
+/// Axis aligned box stored as its two corners.
+/// </summary>
+struct HC_ALIGNAS(16) AABBF
+{
+	Vec3F m_vMin;
+	Vec3F m_vMax;
+
+	HC_CONSTEXPR AABBF() : m_vMin(), m_vMax() {}
+	HC_CONSTEXPR explicit AABBF(const Vec3F& _vMin, const Vec3F& _vMax) : m_vMin(_vMin), m_vMax(_vMax) {}
+
+	[[nodiscard]] HC_INLINE Vec3F GetCenter() const { return (m_vMin + m_vMax) * 0.5f; }
+	[[nodiscard]] HC_INLINE Vec3F GetExtents() const { return (m_vMax - m_vMin) * 0.5f; }
+};
+
+/// <summary>
+/// Bounding sphere packed into one Vec4F so an array of them uploads and transposes like any other Vec4F array.
+/// </summary>
+struct HC_ALIGNAS(16) SphereF
+{
+	Vec4F m_vSphere; //Center in XYZ, radius in W
+
+	HC_CONSTEXPR SphereF() : m_vSphere() {}
+	HC_CONSTEXPR explicit SphereF(const Vec3F& _vCenter, float _fRadius) : m_vSphere(_vCenter, _fRadius) {}
+
+	[[nodiscard]] HC_INLINE Vec3F GetCenter() const { return m_vSphere.XYZ(); }
+	[[nodiscard]] HC_INLINE float GetRadius() const { return m_vSphere.w; }
+};
+
+/// <summary>
+/// Oriented box: a box of half size m_vExtents around the origin, rotated by m_qRotation and then moved to m_vCenter.
+/// </summary>
+struct HC_ALIGNAS(16) OBBF
+{
+	Vec3F m_vCenter;
+	Vec3F m_vExtents;
+	QuaternionF m_qRotation;
+
+	HC_INLINE OBBF() : m_vCenter(), m_vExtents(), m_qRotation(0.0f, 0.0f, 0.0f, 1.0f) {}
+	HC_INLINE explicit OBBF(const Vec3F& _vCenter, const Vec3F& _vExtents, const QuaternionF& _qRotation) : m_vCenter(_vCenter), m_vExtents(_vExtents), m_qRotation(_qRotation) {}
+};
+
+struct HC_ALIGNAS(16) PlaneF
+{
+	Vec4F m_vPlane; //Normal in XYZ, distance in W
+
+	HC_CONSTEXPR PlaneF() : m_vPlane() {}
+	HC_CONSTEXPR explicit PlaneF(const Vec4F& _vPlane) : m_vPlane(_vPlane) {}
+	HC_CONSTEXPR explicit PlaneF(const Vec3F& _vNormal, float _fDistance) : m_vPlane(_vNormal, _fDistance) {}
+	HC_INLINE explicit PlaneF(const Vec3F& _vNormal, const Vec3F& _vPoint) : m_vPlane(_vNormal, -Dot(_vNormal, _vPoint)) {}
+
+	[[nodiscard]] HC_INLINE Vec3F GetNormal() const { return m_vPlane.XYZ(); }
+	[[nodiscard]] HC_INLINE float GetDistance() const { return m_vPlane.w; }
+};
+
+/// <summary>
+/// Half line from m_vOrigin along m_vDirection. Distances returned by the ray tests are in multiples of m_vDirection, so they
+/// are world units when it is normalized.
+/// </summary>
+struct HC_ALIGNAS(16) RayF
+{
+	Vec3F m_vOrigin;
+	Vec3F m_vDirection;
+
+	HC_CONSTEXPR RayF() : m_vOrigin(), m_vDirection(0.0f, 0.0f, 1.0f) {}
+	HC_CONSTEXPR explicit RayF(const Vec3F& _vOrigin, const Vec3F& _vDirection) : m_vOrigin(_vOrigin), m_vDirection(_vDirection) {}
+};
+
+enum FrustumPlane : uint8_t {
+	FRUSTUM_LEFT = 0U,
+	FRUSTUM_RIGHT = 1U,
+	FRUSTUM_BOTTOM = 2U,
+	FRUSTUM_TOP = 3U,
+	FRUSTUM_NEAR = 4U,
+	FRUSTUM_FAR = 5U,
+	FRUSTUM_PLANE_COUNT = 6U
+};
+
+/// <summary>
+/// Six inward facing planes of a view volume.
+/// </summary>
+struct HC_ALIGNAS(16) FrustumF
+{
+	PlaneF m_pPlanes[FRUSTUM_PLANE_COUNT];
+
+	HC_INLINE FrustumF() {}
+
+	/// <summary>
+	/// Extracts the planes of the clip volume of _mViewProjection, which is View * ProjectionF(...) in this library's row vector
+	/// convention. Clip space depth is taken as [0, w], so both the standard and the reversed depth projections work. A plane
+	/// with no normal, such as the far plane of ProjectionFInf, is kept as is and never rejects anything.
+	/// </summary>
+	HC_INLINE explicit FrustumF(const MatrixF& _mViewProjection) {
+		//A row vector point becomes clip coordinates by dotting with each column
+		const MatrixF mColumns = Transpose(_mViewProjection);
+
+		m_pPlanes[FRUSTUM_LEFT] = PlaneF(mColumns[3] + mColumns[0]);
+		m_pPlanes[FRUSTUM_RIGHT] = PlaneF(mColumns[3] - mColumns[0]);
+		m_pPlanes[FRUSTUM_BOTTOM] = PlaneF(mColumns[3] + mColumns[1]);
+		m_pPlanes[FRUSTUM_TOP] = PlaneF(mColumns[3] - mColumns[1]);
+		m_pPlanes[FRUSTUM_NEAR] = PlaneF(mColumns[2]);
+		m_pPlanes[FRUSTUM_FAR] = PlaneF(mColumns[3] - mColumns[2]);
+
+		//Unit normals make the plane distances true distances, which the sphere tests need
+		for (PlaneF& pPlane : m_pPlanes) {
+			const float fLength = Length(pPlane.GetNormal());
+			if (fLength > HC_EPSILON) { pPlane.m_vPlane = pPlane.m_vPlane / fLength; }
+		}
+	}
+};
+
+[[nodiscard]] HC_INLINE PlaneF Normalize(const PlaneF& _pPlane) { return PlaneF(_pPlane.m_vPlane / Length(_pPlane.GetNormal())); }
+
+/// <summary>
+/// Distance from _pPlane to _vPoint, positive on the inside. Only a true distance when the plane normal is normalized.
+/// </summary>
+[[nodiscard]] HC_INLINE float SignedDistance(const PlaneF& _pPlane, const Vec3F& _vPoint) { return Dot(_pPlane.GetNormal(), _vPoint) + _pPlane.GetDistance(); }
+
+[[nodiscard]] HC_INLINE AABBF Merge(const AABBF& _bLeft, const AABBF& _bRight) { return AABBF(Min(_bLeft.m_vMin, _bRight.m_vMin), Max(_bLeft.m_vMax, _bRight.m_vMax)); }
+[[nodiscard]] HC_INLINE AABBF Merge(const AABBF& _bBox, const Vec3F& _vPoint) { return AABBF(Min(_bBox.m_vMin, _vPoint), Max(_bBox.m_vMax, _vPoint)); }
+
+/// <summary>
+/// Smallest AABBF holding _bBox after it is transformed by _mMat. Each row of the rotation part contributes its absolute value
+/// scaled by the matching extent, so this is exact for the eight corners without transforming them.
+/// </summary>
+[[nodiscard]] HC_INLINE AABBF TransformAABB(const AABBF& _bBox, const MatrixF& _mMat) {
+	const Vec3F vCenter = TransformPoint(_mMat, _bBox.GetCenter());
+	const Vec3F vExtents = _bBox.GetExtents();
+	const Vec3F vNewExtents = Abs(_mMat[0].XYZ()) * vExtents.x + Abs(_mMat[1].XYZ()) * vExtents.y + Abs(_mMat[2].XYZ()) * vExtents.z;
+
+	return AABBF(vCenter - vNewExtents, vCenter + vNewExtents);
+}
+
+[[nodiscard]] HC_INLINE bool Contains(const AABBF& _bBox, const Vec3F& _vPoint) {
+	return _vPoint.x >= _bBox.m_vMin.x && _vPoint.y >= _bBox.m_vMin.y && _vPoint.z >= _bBox.m_vMin.z &&
+		   _vPoint.x <= _bBox.m_vMax.x && _vPoint.y <= _bBox.m_vMax.y && _vPoint.z <= _bBox.m_vMax.z;
+}
+
+[[nodiscard]] HC_INLINE bool Contains(const SphereF& _sSphere, const Vec3F& _vPoint) { return LengthSquared(_vPoint - _sSphere.GetCenter()) <= _sSphere.GetRadius() * _sSphere.GetRadius(); }
+
+[[nodiscard]] HC_INLINE bool Intersects(const AABBF& _bLeft, const AABBF& _bRight) {
+	return _bLeft.m_vMin.x <= _bRight.m_vMax.x && _bLeft.m_vMin.y <= _bRight.m_vMax.y && _bLeft.m_vMin.z <= _bRight.m_vMax.z &&
+		   _bRight.m_vMin.x <= _bLeft.m_vMax.x && _bRight.m_vMin.y <= _bLeft.m_vMax.y && _bRight.m_vMin.z <= _bLeft.m_vMax.z;
+}
+
+[[nodiscard]] HC_INLINE bool Intersects(const SphereF& _sLeft, const SphereF& _sRight) {
+	const float fRadius = _sLeft.GetRadius() + _sRight.GetRadius();
+	return LengthSquared(_sLeft.GetCenter() - _sRight.GetCenter()) <= fRadius * fRadius;
+}
+
+[[nodiscard]] HC_INLINE bool Intersects(const AABBF& _bBox, const SphereF& _sSphere) {
+	//Closest point of the box to the sphere center
+	const Vec3F vClosest = Min(Max(_sSphere.GetCenter(), _bBox.m_vMin), _bBox.m_vMax);
+	return Contains(_sSphere, vClosest);
+}
+
+[[nodiscard]] HC_INLINE bool Intersects(const SphereF& _sSphere, const AABBF& _bBox) { return Intersects(_bBox, _sSphere); }
+
+[[nodiscard]] HC_INLINE bool Intersects(const FrustumF& _fFrustum, const SphereF& _sSphere) {
+	for (const PlaneF& pPlane : _fFrustum.m_pPlanes) {
+		if (SignedDistance(pPlane, _sSphere.GetCenter()) < -_sSphere.GetRadius()) { return false; }
+	}
+
+	return true;
+}
+
+/// <summary>
+/// Conservative frustum test: a box that straddles two planes outside a corner of the frustum can still pass.
+/// </summary>
+[[nodiscard]] HC_INLINE bool Intersects(const FrustumF& _fFrustum, const AABBF& _bBox) {
+	const Vec3F vCenter = _bBox.GetCenter();
+	const Vec3F vExtents = _bBox.GetExtents();
+
+	for (const PlaneF& pPlane : _fFrustum.m_pPlanes) {
+		//Distance of the corner furthest along the normal
+		if (SignedDistance(pPlane, vCenter) + Dot(Abs(pPlane.GetNormal()), vExtents) < 0.0f) { return false; }
+	}
+
+	return true;
+}
+
+/// <summary>
+/// Conservative in the same way as the AABBF version.
+/// </summary>
+[[nodiscard]] HC_INLINE bool Intersects(const FrustumF& _fFrustum, const OBBF& _bBox) {
+	const Vec3F vAxisX = RotateByQuaternion(Vec3F(1.0f, 0.0f, 0.0f), _bBox.m_qRotation);
+	const Vec3F vAxisY = RotateByQuaternion(Vec3F(0.0f, 1.0f, 0.0f), _bBox.m_qRotation);
+	const Vec3F vAxisZ = RotateByQuaternion(Vec3F(0.0f, 0.0f, 1.0f), _bBox.m_qRotation);
+
+	for (const PlaneF& pPlane : _fFrustum.m_pPlanes) {
+		const Vec3F vNormal = pPlane.GetNormal();
+		const float fReach = fabsf(Dot(vNormal, vAxisX)) * _bBox.m_vExtents.x + fabsf(Dot(vNormal, vAxisY)) * _bBox.m_vExtents.y + fabsf(Dot(vNormal, vAxisZ)) * _bBox.m_vExtents.z;
+
+		if (SignedDistance(pPlane, _bBox.m_vCenter) + fReach < 0.0f) { return false; }
+	}
+
+	return true;
+}
+
+/// <summary>
+/// Slab test. _fDistance receives the entry distance, or 0 when the ray starts inside the box.
+/// </summary>
+[[nodiscard]] HC_INLINE bool Intersects(const RayF& _rRay, const AABBF& _bBox, float& _fDistance) {
+	const Vec3F vInvDirection = Vec3F(1.0f) / _rRay.m_vDirection;
+	const Vec3F vNear = (_bBox.m_vMin - _rRay.m_vOrigin) * vInvDirection;
+	const Vec3F vFar = (_bBox.m_vMax - _rRay.m_vOrigin) * vInvDirection;
+
+	const float fEnter = fmaxf(HorizontalMax(Min(vNear, vFar)), 0.0f);
+	const float fExit = HorizontalMin(Max(vNear, vFar));
+
+	if (fEnter > fExit) { return false; }
+
+	_fDistance = fEnter;
+	return true;
+}
+
+/// <summary>
+/// _fDistance receives the entry distance, or 0 when the ray starts inside the sphere.
+/// </summary>
+[[nodiscard]] HC_INLINE bool Intersects(const RayF& _rRay, const SphereF& _sSphere, float& _fDistance) {
+	const Vec3F vOffset = _rRay.m_vOrigin - _sSphere.GetCenter();
+	const float fA = LengthSquared(_rRay.m_vDirection);
+	const float fB = Dot(vOffset, _rRay.m_vDirection);
+	const float fC = LengthSquared(vOffset) - _sSphere.GetRadius() * _sSphere.GetRadius();
+	const float fDiscriminant = fB * fB - fA * fC;
+
+	//Missed, or the sphere is entirely behind the origin
+	if (fDiscriminant < 0.0f || (fC > 0.0f && fB > 0.0f)) { return false; }
+
+	_fDistance = fmaxf((-fB - sqrtf(fDiscriminant)) / fA, 0.0f);
+	return true;
+}
+
+/// <summary>
+/// _fDistance receives the distance to the plane. Rays parallel to the plane or pointing away from it miss.
+/// </summary>
+[[nodiscard]] HC_INLINE bool Intersects(const RayF& _rRay, const PlaneF& _pPlane, float& _fDistance) {
+	const float fApproach = Dot(_pPlane.GetNormal(), _rRay.m_vDirection);
+
+	if (HC_FLOAT_COMPARE(fApproach, 0.0f)) { return false; }
+
+	const float fDistance = -SignedDistance(_pPlane, _rRay.m_vOrigin) / fApproach;
+
+	if (fDistance < 0.0f) { return false; }
+
+	_fDistance = fDistance;
+	return true;
+}
@@ -12,23 +12,23 @@ namespace Math {
 		return (_fVal >= 0.0f ? _fLowerBound : _fUpperBound) + fmodf(_fVal, _fUpperBound - _fLowerBound);
 	}
 	
-	HC_INLINE float Pow(float _fBase, float _fExp) { return powf(_fBase, _fExp); }
+	HC_INLINE float Pow(float _fBase, float _fExp) { return Pow(_fBase, _fExp, HC_MATH_PRECISION); }
 
 	HC_INLINE float Sqrt(float _fVal) { return sqrtf(_fVal); }
 
 	HC_INLINE float Log10(float _fVal) { return log10f(_fVal); }
 
-	HC_INLINE float Log2(float _fVal) { return log2f(_fVal); }
+	HC_INLINE float Log2(float _fVal) { return Log2(_fVal, HC_MATH_PRECISION); }
 
 	HC_INLINE float Ln(float _fVal) { return logf(_fVal); }
 
-	HC_INLINE float Exp(float _fVal) { return expf(_fVal); }
+	HC_INLINE float Exp(float _fVal) { return Exp(_fVal, HC_MATH_PRECISION); }
 
-	HC_INLINE float Sin(float _fVal) { return sinf(_fVal); }
+	HC_INLINE float Sin(float _fVal) { return Sin(_fVal, HC_MATH_PRECISION); }
 
-	HC_INLINE float Cos(float _fVal) { return cosf(_fVal); }
+	HC_INLINE float Cos(float _fVal) { return Cos(_fVal, HC_MATH_PRECISION); }
 
-	HC_INLINE float Tan(float _fVal) { return tanf(_fVal); }
+	HC_INLINE float Tan(float _fVal) { return Tan(_fVal, HC_MATH_PRECISION); }
 
 	HC_INLINE float ArcSin(float _fVal) { return asinf(_fVal); }
 
@@ -36,7 +36,7 @@ namespace Math {
 
 	HC_INLINE float ArcTan(float _fVal) { return atanf(_fVal); }
 
-	HC_INLINE float ArcTan2(float _fLeft, float _fRight) { return atan2f(_fLeft, _fRight); }
+	HC_INLINE float ArcTan2(float _fLeft, float _fRight) { return ArcTan2(_fLeft, _fRight, HC_MATH_PRECISION); }
 
 	HC_INLINE float Oscillate(float _fMin, float _fMax, float _fPeriod, float _fTime) {
 		if (_fMax < _fMin) return Oscillate(_fMax, _fMin, _fPeriod, _fTime);
@@ -45,17 +45,17 @@ namespace Math {
 		float fPeriod = (HC_2PI / _fPeriod);
 		float fMid = (_fMin + _fMax) * 0.5f;
 
-		return fAmp * cosf(fPeriod * _fTime) + fMid;
+		return fAmp * Cos(fPeriod * _fTime) + fMid;
 	}
 
 	HC_INLINE float DampedOscillate(float _fMin, float _fMax, float _fPeriod, float _fTime, float _fDampingFactor = 0.2f) {
 		if (_fMax < _fMin) return DampedOscillate(_fMax, _fMin, _fPeriod, _fTime, _fDampingFactor);
 
-		float fAmp = ((_fMax - _fMin) * 0.5f) * expf(-(_fDampingFactor)*_fTime);
+		float fAmp = ((_fMax - _fMin) * 0.5f) * Exp(-(_fDampingFactor)*_fTime);
 		float fPeriod = HC_2PI / _fPeriod;
 		float fMid = (_fMax + _fMin) * 0.5f;
 
-		return fAmp * cosf(fPeriod * _fTime) + fMid;
+		return fAmp * Cos(fPeriod * _fTime) + fMid;
 	}
 
 	HC_INLINE float SmoothStep(float _fStart, float _fEnd, float _fRatio) {
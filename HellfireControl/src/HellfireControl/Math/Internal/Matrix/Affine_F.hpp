@@ -0,0 +1,129 @@
+#pragma once
+
+#include <HellfireControl/Math/Internal/Matrix/Matrix_F.hpp>
+
+/*
+* Compact affine transform. Every world transform has a W column of (0, 0, 0, 1), so only the first three columns of the
+* equivalent MatrixF are kept, each stored as a row. That makes it 48 bytes instead of 64 and matches the std140/std430 layout
+* of a GLSL mat3x4, which transforms a point with vec4(point, 1.0) * matrix.
+*/
+struct HC_ALIGNAS(16) Affine3x4F
+{
+	Vec4F m_vRow0; //X column, X translation in W
+	Vec4F m_vRow1; //Y column, Y translation in W
+	Vec4F m_vRow2; //Z column, Z translation in W
+
+	HC_CONSTEXPR Affine3x4F() : m_vRow0(), m_vRow1(), m_vRow2() {}
+	HC_CONSTEXPR explicit Affine3x4F(const Vec4F& _vRow0, const Vec4F& _vRow1, const Vec4F& _vRow2) : m_vRow0(_vRow0), m_vRow1(_vRow1), m_vRow2(_vRow2) {}
+	HC_INLINE explicit Affine3x4F(const MatrixF& _mMat) {
+		MatrixF mColumns = Transpose(_mMat);
+		m_vRow0 = mColumns.m_vRow0;
+		m_vRow1 = mColumns.m_vRow1;
+		m_vRow2 = mColumns.m_vRow2;
+	}
+	[[nodiscard]] HC_INLINE Vec4F operator[](int _iNdx) const { assert(_iNdx < 3); return (&m_vRow0)[_iNdx]; }
+	[[nodiscard]] HC_INLINE Vec4F& operator[](int _iNdx) { assert(_iNdx < 3); return (&m_vRow0)[_iNdx]; }
+};
+
+static_assert(sizeof(Affine3x4F) == sizeof(Vec4F) * 3, "Affine3x4F rows must be tightly packed for operator[] and GPU upload");
+
+[[nodiscard]] HC_CONSTEXPR Affine3x4F IdentityAffineF() {
+	return Affine3x4F(Vec4F(1.0f, 0.0f, 0.0f, 0.0f), Vec4F(0.0f, 1.0f, 0.0f, 0.0f), Vec4F(0.0f, 0.0f, 1.0f, 0.0f));
+}
+
+[[nodiscard]] HC_INLINE MatrixF ExtractMatrix(const Affine3x4F& _aMat) {
+	return Transpose(MatrixF(_aMat.m_vRow0, _aMat.m_vRow1, _aMat.m_vRow2, Vec4F(0.0f, 0.0f, 0.0f, 1.0f)));
+}
+
+#if HC_USE_SIMD
+//Combines the rows of the left transform weighted by one row of the right. The W weight only carries the translation.
+HC_INLINE __m128 HC_VECTORCALL AffineCombineF(__m128 _fWeights, const Affine3x4F& _aRows) {
+	__m128 fRes = _mm_and_ps(_fWeights, _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1)));
+	fRes = _mm_add_ps(fRes, _mm_mul_ps(HC_SHUFFLE4F(_fWeights, 0, 0, 0, 0), _aRows.m_vRow0.m_fVec));
+	fRes = _mm_add_ps(fRes, _mm_mul_ps(HC_SHUFFLE4F(_fWeights, 1, 1, 1, 1), _aRows.m_vRow1.m_fVec));
+	return _mm_add_ps(fRes, _mm_mul_ps(HC_SHUFFLE4F(_fWeights, 2, 2, 2, 2), _aRows.m_vRow2.m_fVec));
+}
+
+[[nodiscard]] HC_INLINE Affine3x4F operator*(const Affine3x4F& _aLeft, const Affine3x4F& _aRight) {
+	return Affine3x4F(Vec4F(AffineCombineF(_aRight.m_vRow0.m_fVec, _aLeft)),
+					  Vec4F(AffineCombineF(_aRight.m_vRow1.m_fVec, _aLeft)),
+					  Vec4F(AffineCombineF(_aRight.m_vRow2.m_fVec, _aLeft)));
+}
+
+//Dots each row with _fVec and returns the three results in X, Y and Z.
+HC_INLINE __m128 HC_VECTORCALL AffineDotF(const Affine3x4F& _aMat, __m128 _fVec) {
+	__m128 fRow0 = _mm_mul_ps(_aMat.m_vRow0.m_fVec, _fVec);
+	__m128 fRow1 = _mm_mul_ps(_aMat.m_vRow1.m_fVec, _fVec);
+	__m128 fRow2 = _mm_mul_ps(_aMat.m_vRow2.m_fVec, _fVec);
+	__m128 fRow3 = _mm_setzero_ps();
+
+	_MM_TRANSPOSE4_PS(fRow0, fRow1, fRow2, fRow3);
+
+	return _mm_add_ps(_mm_add_ps(fRow0, fRow1), _mm_add_ps(fRow2, fRow3));
+}
+
+[[nodiscard]] HC_INLINE Vec3F TransformPoint(const Affine3x4F& _aMat, const Vec3F& _vPoint) {
+	return Vec3F(AffineDotF(_aMat, _mm_or_ps(_vPoint.m_fVec, _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f))));
+}
+
+[[nodiscard]] HC_INLINE Vec3F TransformDirection(const Affine3x4F& _aMat, const Vec3F& _vDirection) {
+	return Vec3F(AffineDotF(_aMat, _vDirection.m_fVec));
+}
+#else
+[[nodiscard]] HC_INLINE Affine3x4F operator*(const Affine3x4F& _aLeft, const Affine3x4F& _aRight) {
+	Affine3x4F aRes;
+	for (int iNdx = 0; iNdx < 3; ++iNdx) {
+		const Vec4F vWeights = _aRight[iNdx];
+		aRes[iNdx] = Vec4F(0.0f, 0.0f, 0.0f, vWeights.w) + _aLeft[0] * vWeights.x + _aLeft[1] * vWeights.y + _aLeft[2] * vWeights.z;
+	}
+
+	return aRes;
+}
+
+[[nodiscard]] HC_INLINE Vec3F TransformPoint(const Affine3x4F& _aMat, const Vec3F& _vPoint) {
+	const Vec4F vPoint = Vec4F(_vPoint, 1.0f);
+	return Vec3F(Dot(_aMat[0], vPoint), Dot(_aMat[1], vPoint), Dot(_aMat[2], vPoint));
+}
+
+[[nodiscard]] HC_INLINE Vec3F TransformDirection(const Affine3x4F& _aMat, const Vec3F& _vDirection) {
+	const Vec4F vDirection = Vec4F(_vDirection, 0.0f);
+	return Vec3F(Dot(_aMat[0], vDirection), Dot(_aMat[1], vDirection), Dot(_aMat[2], vDirection));
+}
+#endif
+
+HC_INLINE Affine3x4F& operator*=(Affine3x4F& _aLeft, const Affine3x4F& _aRight) { _aLeft = _aLeft * _aRight; return _aLeft; }
+
+/// <summary>
+/// Inverts a rotation and translation only transform. The rotation must be orthonormal.
+/// </summary>
+[[nodiscard]] HC_INLINE Affine3x4F InverseRigid(const Affine3x4F& _aMat) {
+	//Rows 0-2 hold the rotation rows of the equivalent MatrixF, row 3 holds the translation
+	MatrixF mRows = Transpose(MatrixF(_aMat.m_vRow0, _aMat.m_vRow1, _aMat.m_vRow2, Vec4F()));
+	Vec3F vRow0 = AffineRowF(mRows.m_vRow0), vRow1 = AffineRowF(mRows.m_vRow1), vRow2 = AffineRowF(mRows.m_vRow2), vTranslation = AffineRowF(mRows.m_vRow3);
+
+	return Affine3x4F(Vec4F(vRow0, -Dot(vTranslation, vRow0)), Vec4F(vRow1, -Dot(vTranslation, vRow1)), Vec4F(vRow2, -Dot(vTranslation, vRow2)));
+}
+
+/// <summary>
+/// Inverts any affine transform, including shear and non uniform scale, through a 3x3 adjugate.
+/// </summary>
+[[nodiscard]] HC_INLINE Affine3x4F Inverse(const Affine3x4F& _aMat) {
+	MatrixF mRows = Transpose(MatrixF(_aMat.m_vRow0, _aMat.m_vRow1, _aMat.m_vRow2, Vec4F()));
+	Vec3F vRow0 = AffineRowF(mRows.m_vRow0), vRow1 = AffineRowF(mRows.m_vRow1), vRow2 = AffineRowF(mRows.m_vRow2), vTranslation = AffineRowF(mRows.m_vRow3);
+
+	//Cofactors
+	Vec3F vCol0 = Cross(vRow1, vRow2);
+	Vec3F vCol1 = Cross(vRow2, vRow0);
+	Vec3F vCol2 = Cross(vRow0, vRow1);
+
+	float fDet = Dot(vRow0, vCol0);
+
+	//No inverse, return 0
+	if (HC_FLOAT_COMPARE(fDet, 0.0f)) { return Affine3x4F(); }
+
+	float fInvDet = 1.0f / fDet;
+
+	return Affine3x4F(Vec4F(vCol0, -Dot(vTranslation, vCol0)) * fInvDet,
+					  Vec4F(vCol1, -Dot(vTranslation, vCol1)) * fInvDet,
+					  Vec4F(vCol2, -Dot(vTranslation, vCol2)) * fInvDet);
+}
@@ -4,7 +4,4 @@
 
 #include <HellfireControl/Core/Common.hpp>
 #include <HellfireControl/Math/Vector.hpp>
-
-#if HC_USE_SIMD
-#include <intrin.h>
-#endif
+#include <HellfireControl/Math/Internal/Approx/Approx_F.hpp>
\ No newline at end of file
@@ -2,455 +2,126 @@
 
 #include <HellfireControl/Math/Internal/Matrix/Matrix_Common.hpp>
 
-#if HC_USE_SIMD
-
-struct MatrixD {
-	Vec4D m_vRows[4];
-
-	HC_INLINE HC_VECTORCALL MatrixD() {};
-	HC_INLINE explicit HC_VECTORCALL MatrixD(Vec4D _vRow1, Vec4D _vRow2, Vec4D _vRow3, Vec4D _vRow4) { m_vRows[0] = _vRow1; m_vRows[1] = _vRow2; m_vRows[2] = _vRow3; m_vRows[3] = _vRow4; }
-	HC_INLINE explicit HC_VECTORCALL MatrixD(Vec4D* _vRows) { m_vRows[0] = _vRows[0]; m_vRows[1] = _vRows[1]; m_vRows[2] = _vRows[2]; m_vRows[3] = _vRows[3]; }
-	HC_INLINE Vec4D HC_VECTORCALL operator[](int _iNdx) const { assert(_iNdx < 4); return m_vRows[_iNdx]; }
-	HC_INLINE Vec4D& HC_VECTORCALL operator[](int _iNdx) { assert(_iNdx < 4); return m_vRows[_iNdx]; }
-	HC_INLINE Vec4D HC_VECTORCALL Row1() { return m_vRows[0]; }
-	HC_INLINE Vec4D HC_VECTORCALL Row2() { return m_vRows[1]; }
-	HC_INLINE Vec4D HC_VECTORCALL Row3() { return m_vRows[2]; }
-	HC_INLINE Vec4D HC_VECTORCALL Row4() { return m_vRows[3]; }
-	HC_INLINE void HC_VECTORCALL SetRow1(Vec4D _vRow) { m_vRows[0] = _vRow; }
-	HC_INLINE void HC_VECTORCALL SetRow2(Vec4D _vRow) { m_vRows[1] = _vRow; }
-	HC_INLINE void HC_VECTORCALL SetRow3(Vec4D _vRow) { m_vRows[2] = _vRow; }
-	HC_INLINE void HC_VECTORCALL SetRow4(Vec4D _vRow) { m_vRows[3] = _vRow; }
+struct HC_ALIGNAS(128) MatrixD
+{
+	Vec4D m_vRow0; //X Rotation
+	Vec4D m_vRow1; //Y Rotation
+	Vec4D m_vRow2; //Z Rotation
+	Vec4D m_vRow3; //Position
+
+	HC_INLINE MatrixD() : m_vRow0(), m_vRow1(), m_vRow2(), m_vRow3() {}
+	HC_INLINE explicit MatrixD(const Vec4D& _vRow0, const Vec4D& _vRow1, const Vec4D& _vRow2, const Vec4D& _vRow3) : m_vRow0(_vRow0), m_vRow1(_vRow1), m_vRow2(_vRow2), m_vRow3(_vRow3) {}
+	HC_INLINE explicit MatrixD(double _dVal) : m_vRow0(_dVal), m_vRow1(_dVal), m_vRow2(_dVal), m_vRow3(_dVal) {}
+	HC_INLINE Vec4D operator[](int _iNdx) const { assert(_iNdx < 4); return (&m_vRow0)[_iNdx]; }
+	HC_INLINE Vec4D& operator[](int _iNdx) { assert(_iNdx < 4); return (&m_vRow0)[_iNdx]; }
 };
 
-HC_INLINE MatrixD HC_VECTORCALL Transpose(const MatrixD& _mMat) {
-	__m256d temp0 = _mm256_unpacklo_pd(_mMat[0].m_dVec, _mMat[2].m_dVec);
-	__m256d temp1 = _mm256_unpacklo_pd(_mMat[1].m_dVec, _mMat[3].m_dVec);
-	__m256d temp2 = _mm256_unpackhi_pd(_mMat[0].m_dVec, _mMat[2].m_dVec);
-	__m256d temp3 = _mm256_unpackhi_pd(_mMat[1].m_dVec, _mMat[3].m_dVec);
+static_assert(sizeof(MatrixD) == sizeof(Vec4D) * 4, "MatrixD rows must be tightly packed for operator[]");
 
-	_mMat[0] = Vec4D(_mm256_unpacklo_pd(temp0, temp1));
-	_mMat[1] = Vec4D(_mm256_unpackhi_pd(temp0, temp1));
-	_mMat[2] = Vec4D(_mm256_unpacklo_pd(temp2, temp3));
-	_mMat[3] = Vec4D(_mm256_unpackhi_pd(temp2, temp3));
+#if HC_USE_SIMD
+HC_AVX2_TARGET HC_INLINE MatrixD TransposeAVX2(const MatrixD& _mMat) {
+	const __m256d dLow01 = _mm256_unpacklo_pd(_mm256_load_pd(_mMat.m_vRow0.m_dData), _mm256_load_pd(_mMat.m_vRow1.m_dData));
+	const __m256d dHigh01 = _mm256_unpackhi_pd(_mm256_load_pd(_mMat.m_vRow0.m_dData), _mm256_load_pd(_mMat.m_vRow1.m_dData));
+	const __m256d dLow23 = _mm256_unpacklo_pd(_mm256_load_pd(_mMat.m_vRow2.m_dData), _mm256_load_pd(_mMat.m_vRow3.m_dData));
+	const __m256d dHigh23 = _mm256_unpackhi_pd(_mm256_load_pd(_mMat.m_vRow2.m_dData), _mm256_load_pd(_mMat.m_vRow3.m_dData));
 
-	return _mMat;
+	MatrixD mRes;
+	_mm256_store_pd(mRes.m_vRow0.m_dData, _mm256_permute2f128_pd(dLow01, dLow23, 0x20));
+	_mm256_store_pd(mRes.m_vRow1.m_dData, _mm256_permute2f128_pd(dHigh01, dHigh23, 0x20));
+	_mm256_store_pd(mRes.m_vRow2.m_dData, _mm256_permute2f128_pd(dLow01, dLow23, 0x31));
+	_mm256_store_pd(mRes.m_vRow3.m_dData, _mm256_permute2f128_pd(dHigh01, dHigh23, 0x31));
+	return mRes;
 }
-HC_INLINE double HC_VECTORCALL Determinant(const MatrixD& _mMat) {
-	//Sub matrices
-	Vec4D A = Vec4D(_mMat[0][0], _mMat[0][1], _mMat[1][0], _mMat[1][1]);
-	Vec4D B = Vec4D(_mMat[0][2], _mMat[0][3], _mMat[1][2], _mMat[1][3]);
-	Vec4D C = Vec4D(_mMat[2][0], _mMat[2][1], _mMat[3][0], _mMat[3][1]);
-	Vec4D D = Vec4D(_mMat[2][2], _mMat[2][3], _mMat[3][2], _mMat[3][3]);
-
-	//Determinants
-	Vec4D dets = Vec4D((HC_SHUFFLE4D_2(_mMat[0], _mMat[2], 0, 2, 0, 2) * HC_SHUFFLE4D_2(_mMat[1], _mMat[3], 1, 3, 1, 3)) -
-		(HC_SHUFFLE4D_2(_mMat[0], _mMat[2], 1, 3, 1, 3) * HC_SHUFFLE4D_2(_mMat[1], _mMat[3], 0, 2, 0, 2)));
-	double detA = dets.X();
-	double detB = dets.Y();
-	double detC = dets.Z();
-	double detD = dets.W();
-	//D adjmul C
-	Vec4D DC = (D.WWXX() * C) - (D.YYZZ() * C.ZWXY());
-	//A adjmul B
-	Vec4D AB = (A.WWXX() * B) - (A.YYZZ() * B.ZWXY());
 
-	return ((detA * detD) + (detB * detC)) - Sum(AB * DC.XZYW());
-}
-HC_INLINE MatrixD HC_VECTORCALL Inverse(MatrixD _mMat) {
+//Follows the scalar Inverse step for step with separate multiplies and adds, so both paths round the same way.
+HC_AVX2_TARGET HC_INLINE MatrixD InverseAVX2(const MatrixD& _mMat) {
+	const __m256d dRow0 = _mm256_load_pd(_mMat.m_vRow0.m_dData), dRow1 = _mm256_load_pd(_mMat.m_vRow1.m_dData);
+	const __m256d dRow2 = _mm256_load_pd(_mMat.m_vRow2.m_dData), dRow3 = _mm256_load_pd(_mMat.m_vRow3.m_dData);
 
 	//Sub matrices
-	Vec4D A = Vec4D(_mMat[0][0], _mMat[0][1], _mMat[1][0], _mMat[1][1]);
-	Vec4D B = Vec4D(_mMat[0][2], _mMat[0][3], _mMat[1][2], _mMat[1][3]);
-	Vec4D C = Vec4D(_mMat[2][0], _mMat[2][1], _mMat[3][0], _mMat[3][1]);
-	Vec4D D = Vec4D(_mMat[2][2], _mMat[2][3], _mMat[3][2], _mMat[3][3]);
+	const __m256d A = _mm256_permute2f128_pd(dRow0, dRow1, 0x20);
+	const __m256d B = _mm256_permute2f128_pd(dRow0, dRow1, 0x31);
+	const __m256d C = _mm256_permute2f128_pd(dRow2, dRow3, 0x20);
+	const __m256d D = _mm256_permute2f128_pd(dRow2, dRow3, 0x31);
 
 	//Determinants
-	Vec4D dets = (HC_SHUFFLE4D_2(_mMat[0], _mMat[2], 0, 2, 0, 2) * HC_SHUFFLE4D_2(_mMat[1], _mMat[3], 1, 3, 1, 3) -
-		(HC_SHUFFLE4D_2(_mMat[0], _mMat[2], 1, 3, 1, 3) * HC_SHUFFLE4D_2(_mMat[1], _mMat[3], 0, 2, 0, 2)));
-	double detA = dets.X();
-	double detB = dets.Y();
-	double detC = dets.Z();
-	double detD = dets.W();
+	const __m256d dets = _mm256_sub_pd(_mm256_mul_pd(HC_PERMUTE4D(_mm256_unpacklo_pd(dRow0, dRow2), 0, 2, 1, 3), HC_PERMUTE4D(_mm256_unpackhi_pd(dRow1, dRow3), 0, 2, 1, 3)),
+										_mm256_mul_pd(HC_PERMUTE4D(_mm256_unpackhi_pd(dRow0, dRow2), 0, 2, 1, 3), HC_PERMUTE4D(_mm256_unpacklo_pd(dRow1, dRow3), 0, 2, 1, 3)));
+	const __m256d detA = HC_PERMUTE4D(dets, 0, 0, 0, 0);
+	const __m256d detB = HC_PERMUTE4D(dets, 1, 1, 1, 1);
+	const __m256d detC = HC_PERMUTE4D(dets, 2, 2, 2, 2);
+	const __m256d detD = HC_PERMUTE4D(dets, 3, 3, 3, 3);
 
 	//D adjmul C
-	Vec4D DC = (D.WWXX() * C) - (D.YYZZ() * C.ZWXY());
+	const __m256d DC = _mm256_sub_pd(_mm256_mul_pd(HC_PERMUTE4D(D, 3, 3, 0, 0), C), _mm256_mul_pd(HC_PERMUTE4D(D, 1, 1, 2, 2), HC_PERMUTE4D(C, 2, 3, 0, 1)));
 	//A adjmul B
-	Vec4D AB = (A.WWXX() * B) - (A.YYZZ() * B.ZWXY());
+	const __m256d AB = _mm256_sub_pd(_mm256_mul_pd(HC_PERMUTE4D(A, 3, 3, 0, 0), B), _mm256_mul_pd(HC_PERMUTE4D(A, 1, 1, 2, 2), HC_PERMUTE4D(B, 2, 3, 0, 1)));
 	//DetM
-	double detM = ((detA * detD) + (detB * detC)) - Sum(AB * DC.XZYW());
+	const double detM = _mm_cvtsd_f64(_mm_sub_sd(_mm256_castpd256_pd128(_mm256_add_pd(_mm256_mul_pd(detA, detD), _mm256_mul_pd(detB, detC))), HorizontalSumD(_mm256_mul_pd(AB, HC_PERMUTE4D(DC, 0, 2, 1, 3)))));
 	//No inverse, return 0
-	if (detM == 0.0) { return MatrixD(); }
+	if (HC_DOUBLE_COMPARE(detM, 0.0)) { return MatrixD(); }
 	//Reciprocal
-	Vec4D vDet = Vec4D(1.0, -1.0, -1.0, 1.0) / detM;
+	const __m256d vDet = _mm256_div_pd(_mm256_setr_pd(1.0, -1.0, -1.0, 1.0), _mm256_set1_pd(detM));
 
 	//X Row
-	Vec4D X = ((A * detD) - ((B * DC.XWXW()) + (B.YXWZ() * DC.ZYZY()))) * vDet;
+	const __m256d X = _mm256_mul_pd(_mm256_sub_pd(_mm256_mul_pd(A, detD), _mm256_add_pd(_mm256_mul_pd(B, HC_PERMUTE4D(DC, 0, 3, 0, 3)), _mm256_mul_pd(HC_PERMUTE4D(B, 1, 0, 3, 2), HC_PERMUTE4D(DC, 2, 1, 2, 1)))), vDet);
 	//W Row
-	Vec4D W = ((D * detA) - ((C * AB.XWXW()) + (C.YXWZ() * AB.ZYZY()))) * vDet;
+	const __m256d W = _mm256_mul_pd(_mm256_sub_pd(_mm256_mul_pd(D, detA), _mm256_add_pd(_mm256_mul_pd(C, HC_PERMUTE4D(AB, 0, 3, 0, 3)), _mm256_mul_pd(HC_PERMUTE4D(C, 1, 0, 3, 2), HC_PERMUTE4D(AB, 2, 1, 2, 1)))), vDet);
 	//Y Row
-	Vec4D Y = ((C * detB) - ((D * AB.WXWX()) - (D.YXWZ() * AB.ZYZY()))) * vDet;
+	const __m256d Y = _mm256_mul_pd(_mm256_sub_pd(_mm256_mul_pd(C, detB), _mm256_sub_pd(_mm256_mul_pd(D, HC_PERMUTE4D(AB, 3, 0, 3, 0)), _mm256_mul_pd(HC_PERMUTE4D(D, 1, 0, 3, 2), HC_PERMUTE4D(AB, 2, 1, 2, 1)))), vDet);
 	//Z Row
-	Vec4D Z = ((B * detC) - ((A * DC.WXWX()) - (A.YXWZ() * DC.ZYZY()))) * vDet;
-
-	_mMat[0] = HC_SHUFFLE4D_2(X, Y, 3, 1, 3, 1);
-	_mMat[1] = HC_SHUFFLE4D_2(X, Y, 2, 0, 2, 0);
-	_mMat[2] = HC_SHUFFLE4D_2(Z, W, 3, 1, 3, 1);
-	_mMat[3] = HC_SHUFFLE4D_2(Z, W, 2, 0, 2, 0);
-
-	return _mMat;
-}
-HC_INLINE MatrixD HC_VECTORCALL IdentityD() {
-	static MatrixD mMat(Vec4D(1.0, 0.0, 0.0, 0.0),
-		Vec4D(0.0, 1.0, 0.0, 0.0),
-		Vec4D(0.0, 0.0, 1.0, 0.0),
-		Vec4D(0.0, 0.0, 0.0, 1.0));
-	return mMat;
-}
-HC_INLINE MatrixD HC_VECTORCALL ProjectionD(double _fAspectRatio, double _fDOV, double _fNearPlane, double _fDarPlane) {
-	double fDocal = 1.0 / tan(_fDOV);
-	MatrixD mMat;
-	mMat[0] = Vec4D(fDocal / _fAspectRatio, 0.0, 0.0, 0.0);
-	mMat[1] = Vec4D(0.0, -fDocal, 0.0, 0.0);
-	mMat[2] = Vec4D(0.0, 0.0, _fNearPlane / (_fDarPlane - _fNearPlane), -1.0);
-	mMat[3] = Vec4D(0.0, 0.0, (_fNearPlane * _fDarPlane) / (_fDarPlane - _fNearPlane), 0.0);
-
-	return mMat;
-}
-HC_INLINE MatrixD HC_VECTORCALL ProjectionDReversedInf(double _fAspectRatio, double _fDOV, double _fNearPlane) {
-	double fDocal = 1.0 / tan(_fDOV);
-	MatrixD mMat;
-	mMat[0] = Vec4D(fDocal / _fAspectRatio, 0.0, 0.0, 0.0);
-	mMat[1] = Vec4D(0.0, -fDocal, 0.0, 0.0);
-	mMat[2] = Vec4D(0.0, 0.0, 0.0, -1.0);
-	mMat[3] = Vec4D(0.0, 0.0, _fNearPlane, 0.0);
-
-	return mMat;
-}
-HC_INLINE MatrixD HC_VECTORCALL LookAtLH(const Vec4D& _vEye, const Vec4D& _vAt, const Vec4D& _vUp) {
-	Vec4D vZAxis = Normalize(_vAt - _vEye);
-	Vec4D vXAxis = Normalize(Cross(_vUp, vZAxis));
-	Vec4D vYAxis = Normalize(Cross(vZAxis, vXAxis));
-
-	return MatrixD(vXAxis, vYAxis, vZAxis, _vAt);
-}
-HC_INLINE MatrixD HC_VECTORCALL operator+(const MatrixD& _mLeft, const MatrixD& _mRight) {
-	_mLeft[0] = _mLeft[0] + _mRight[0];
-	_mLeft[1] = _mLeft[1] + _mRight[1];
-	_mLeft[2] = _mLeft[2] + _mRight[2];
-	_mLeft[3] = _mLeft[3] + _mRight[3];
-
-	return _mLeft;
-}
-HC_INLINE MatrixD HC_VECTORCALL operator-(const MatrixD& _mLeft, const MatrixD& _mRight) {
-	_mLeft[0] = _mLeft[0] - _mRight[0];
-	_mLeft[1] = _mLeft[1] - _mRight[1];
-	_mLeft[2] = _mLeft[2] - _mRight[2];
-	_mLeft[3] = _mLeft[3] - _mRight[3];
-
-	return _mLeft;
-}
-HC_INLINE MatrixD HC_VECTORCALL operator*(const MatrixD& _mLeft, double _fRight) {
-	_mLeft[0] *= _fRight;
-	_mLeft[1] *= _fRight;
-	_mLeft[2] *= _fRight;
-	_mLeft[3] *= _fRight;
-
-	return _mLeft;
-}
-HC_INLINE MatrixD HC_VECTORCALL operator*(double _fLeft, const MatrixD& _mRight) {
-	_mRight[0] *= _fLeft;
-	_mRight[1] *= _fLeft;
-	_mRight[2] *= _fLeft;
-	_mRight[3] *= _fLeft;
-
-	return _mRight;
-}
-HC_INLINE MatrixD HC_VECTORCALL operator*(const MatrixD& _mLeft, const MatrixD& _mRight) {
-	_mRight = Transpose(_mRight);
-
-	for (int iNdx = 0; iNdx < 4; ++iNdx) {
-		_mLeft[iNdx] = Vec4D(Dot(_mLeft[iNdx], _mRight[0]),
-			Dot(_mLeft[iNdx], _mRight[1]),
-			Dot(_mLeft[iNdx], _mRight[2]),
-			Dot(_mLeft[iNdx], _mRight[3]));
-	}
-
-	return _mLeft;
-}
-HC_INLINE Vec4D HC_VECTORCALL operator*(const MatrixD& _mLeft, const Vec4D& _vRight) {
-	_vRight = Vec4D(Dot(_mLeft[0], _vRight),
-		Dot(_mLeft[1], _vRight),
-		Dot(_mLeft[2], _vRight),
-		Dot(_mLeft[3], _vRight));
-
-	return _vRight;
-}
-HC_INLINE Vec4D HC_VECTORCALL operator*(const Vec4D& _vLeft, const MatrixD& _mRight) {
-	_vLeft = Vec4D(Dot(_vLeft, _mRight[0]),
-		Dot(_vLeft, _mRight[1]),
-		Dot(_vLeft, _mRight[2]),
-		Dot(_vLeft, _mRight[3]));
-
-	return _vLeft;
-}
-HC_INLINE MatrixD HC_VECTORCALL operator/(const MatrixD& _mLeft, double _fRight) {
-	_mLeft[0] /= _fRight;
-	_mLeft[1] /= _fRight;
-	_mLeft[2] /= _fRight;
-	_mLeft[3] /= _fRight;
-
-	return _mLeft;
-}
-HC_INLINE MatrixD HC_VECTORCALL operator/(double _fLeft, const MatrixD& _mRight) {
-	_mRight[0] /= _fLeft;
-	_mRight[1] /= _fLeft;
-	_mRight[2] /= _fLeft;
-	_mRight[3] /= _fLeft;
-
-	return _mRight;
-}
-HC_INLINE MatrixD& HC_VECTORCALL operator+=(MatrixD& _mLeft, const MatrixD& _mRight) { _mLeft = _mLeft + _mRight; return _mLeft; }
-HC_INLINE MatrixD& HC_VECTORCALL operator-=(MatrixD& _mLeft, const MatrixD& _mRight) { _mLeft = _mLeft - _mRight; return _mLeft; }
-HC_INLINE MatrixD& HC_VECTORCALL operator*=(MatrixD& _mLeft, double _fRight) { _mLeft = _mLeft * _fRight; return _mLeft; }
-HC_INLINE MatrixD& HC_VECTORCALL operator*=(MatrixD& _mLeft, const MatrixD& _mRight) { _mLeft = _mLeft * _mRight; return _mLeft; }
-HC_INLINE Vec4D& HC_VECTORCALL operator*=(Vec4D& _vLeft, const MatrixD& _mRight) { _vLeft = _vLeft * _mRight; return _vLeft; }
-HC_INLINE MatrixD& HC_VECTORCALL operator/=(MatrixD& _mLeft, double _fRight) { _mLeft = _mLeft / _fRight; return _mLeft; }
-HC_INLINE MatrixD HC_VECTORCALL operator~(const MatrixD& _mMat) { return MatrixD(); }
-HC_INLINE MatrixD HC_VECTORCALL operator-(const MatrixD& _mMat) { return MatrixD() - _mMat; }
-HC_INLINE MatrixD HC_VECTORCALL RotationXDegD(double _fDeg) {
-	_fDeg = HC_DEG2RAD(_fDeg);
-
-	MatrixD mMat;
-	mMat[0] = Vec4D(1.0, 0.0, 0.0, 0.0);
-	mMat[1] = Vec4D(0.0, cos(_fDeg), sin(_fDeg), 0.0);
-	mMat[2] = Vec4D(0.0, -sin(_fDeg), cos(_fDeg), 0.0);
-	mMat[3] = Vec4D(0.0, 0.0, 0.0, 1.0);
-
-	return mMat;
-}
-HC_INLINE MatrixD HC_VECTORCALL RotationXRadD(double _fRad) {
-	MatrixD mMat;
-	mMat[0] = Vec4D(1.0, 0.0, 0.0, 0.0);
-	mMat[1] = Vec4D(0.0, cos(_fRad), -sin(_fRad), 0.0);
-	mMat[2] = Vec4D(0.0, sin(_fRad), cos(_fRad), 0.0);
-	mMat[3] = Vec4D(0.0, 0.0, 0.0, 1.0);
-
-	return mMat;
-}
-HC_INLINE MatrixD HC_VECTORCALL RotationYDegD(double _fDeg) {
-	_fDeg = HC_DEG2RAD(_fDeg);
-
-	MatrixD mMat;
-	mMat[0] = Vec4D(cos(_fDeg), 0.0, sin(_fDeg), 0.0);
-	mMat[1] = Vec4D(0.0, 1.0, 0.0, 0.0);
-	mMat[2] = Vec4D(-sin(_fDeg), 0.0, cos(_fDeg), 0.0);
-	mMat[3] = Vec4D(0.0, 0.0, 0.0, 1.0);
-
-	return mMat;
-}
-HC_INLINE MatrixD HC_VECTORCALL RotationYRadD(double _fRad) {
-	MatrixD mMat;
-	mMat[0] = Vec4D(cos(_fRad), 0.0, sin(_fRad), 0.0);
-	mMat[1] = Vec4D(0.0, 1.0, 0.0, 0.0);
-	mMat[2] = Vec4D(-sin(_fRad), 0.0, cos(_fRad), 0.0);
-	mMat[3] = Vec4D(0.0, 0.0, 0.0, 1.0);
-
-	return mMat;
-}
-HC_INLINE MatrixD HC_VECTORCALL RotationZDegD(double _fDeg) {
-	_fDeg = HC_DEG2RAD(_fDeg);
-
-	MatrixD mMat;
-	mMat[0] = Vec4D(cos(_fDeg), -sin(_fDeg), 0.0, 0.0);
-	mMat[1] = Vec4D(sin(_fDeg), cos(_fDeg), 0.0, 0.0);
-	mMat[2] = Vec4D(0.0, 0.0, 1.0, 0.0);
-	mMat[3] = Vec4D(0.0, 0.0, 0.0, 1.0);
-
-	return mMat;
-}
-HC_INLINE MatrixD HC_VECTORCALL RotationZRadD(double _fRad) {
-	MatrixD mMat;
-	mMat[0] = Vec4D(cos(_fRad), -sin(_fRad), 0.0, 0.0);
-	mMat[1] = Vec4D(sin(_fRad), cos(_fRad), 0.0, 0.0);
-	mMat[2] = Vec4D(0.0, 0.0, 1.0, 0.0);
-	mMat[3] = Vec4D(0.0, 0.0, 0.0, 1.0);
-
-	return mMat;
-}
-HC_INLINE MatrixD HC_VECTORCALL RotationYawPitchRollDegD(Vec4D _vRotation) {
-	double fYaw = HC_DEG2RAD(_vRotation.X());
-	double fPitch = HC_DEG2RAD(_vRotation.Y());
-	double fRoll = HC_DEG2RAD(_vRotation.Z());
-
-	MatrixD mMat;
-	mMat[0] = Vec4D(cos(fYaw) * cos(fPitch), (cos(fYaw) * sin(fPitch) * sin(fRoll)) - (sin(fYaw) * cos(fRoll)), (cos(fYaw) * sin(fPitch) * cos(fRoll)) + (sin(fYaw) * sin(fRoll)), 0.0);
-	mMat[1] = Vec4D(sin(fYaw) * cos(fPitch), (sin(fYaw) * sin(fPitch) * sin(fRoll)) + (cos(fYaw) * cos(fRoll)), (sin(fYaw) * sin(fPitch) * cos(fRoll)) - (cos(fYaw) * sin(fRoll)), 0.0);
-	mMat[2] = Vec4D(-sin(fPitch), cos(fPitch) * sin(fRoll), cos(fPitch) * cos(fRoll), 0.0);
-	mMat[3] = Vec4D(0.0, 0.0, 0.0, 1.0);
-
-	return mMat;
-}
-HC_INLINE MatrixD HC_VECTORCALL RotationYawPitchRollRadD(Vec4D _vRotation) {
-	double fYaw = _vRotation.X();
-	double fPitch = _vRotation.Y();
-	double fRoll = _vRotation.Z();
-
-	MatrixD mMat;
-	mMat[0] = Vec4D(cos(fYaw) * cos(fPitch), (cos(fYaw) * sin(fPitch) * sin(fRoll)) - (sin(fYaw) * cos(fRoll)), (cos(fYaw) * sin(fPitch) * cos(fRoll)) + (sin(fYaw) * sin(fRoll)), 0.0);
-	mMat[1] = Vec4D(sin(fYaw) * cos(fPitch), (sin(fYaw) * sin(fPitch) * sin(fRoll)) + (cos(fYaw) * cos(fRoll)), (sin(fYaw) * sin(fPitch) * cos(fRoll)) - (cos(fYaw) * sin(fRoll)), 0.0);
-	mMat[2] = Vec4D(-sin(fPitch), cos(fPitch) * sin(fRoll), cos(fPitch) * cos(fRoll), 0.0);
-	mMat[3] = Vec4D(0.0, 0.0, 0.0, 1.0);
-
-	return mMat;
-}
-HC_INLINE MatrixD HC_VECTORCALL TranslationXD(double _fDist) {
-	MatrixD mMat;
-	mMat[0] = Vec4D(1.0, 0.0, 0.0, 0.0);
-	mMat[1] = Vec4D(0.0, 1.0, 0.0, 0.0);
-	mMat[2] = Vec4D(0.0, 0.0, 1.0, 0.0);
-	mMat[3] = Vec4D(_fDist, 0.0, 0.0, 1.0);
-
-	return mMat;
-}
-HC_INLINE MatrixD HC_VECTORCALL TranslationYD(double _fDist) {
-	MatrixD mMat;
-	mMat[0] = Vec4D(1.0, 0.0, 0.0, 0.0);
-	mMat[1] = Vec4D(0.0, 1.0, 0.0, 0.0);
-	mMat[2] = Vec4D(0.0, 0.0, 1.0, 0.0);
-	mMat[3] = Vec4D(0.0, _fDist, 0.0, 1.0);
-
-	return mMat;
-}
-HC_INLINE MatrixD HC_VECTORCALL TranslationZD(double _fDist) {
-	MatrixD mMat;
-	mMat[0] = Vec4D(1.0, 0.0, 0.0, 0.0);
-	mMat[1] = Vec4D(0.0, 1.0, 0.0, 0.0);
-	mMat[2] = Vec4D(0.0, 0.0, 1.0, 0.0);
-	mMat[3] = Vec4D(0.0, _fDist, 0.0, 1.0);
-
-	return mMat;
-}
-HC_INLINE MatrixD HC_VECTORCALL TranslationD(Vec4D _vTranslation) {
-	MatrixD mMat;
-	mMat[0] = Vec4D(1.0, 0.0, 0.0, 0.0);
-	mMat[1] = Vec4D(0.0, 1.0, 0.0, 0.0);
-	mMat[2] = Vec4D(0.0, 0.0, 1.0, 0.0);
-	mMat[3] = _vTranslation;
+	const __m256d Z = _mm256_mul_pd(_mm256_sub_pd(_mm256_mul_pd(B, detC), _mm256_sub_pd(_mm256_mul_pd(A, HC_PERMUTE4D(DC, 3, 0, 3, 0)), _mm256_mul_pd(HC_PERMUTE4D(A, 1, 0, 3, 2), HC_PERMUTE4D(DC, 2, 1, 2, 1)))), vDet);
 
-	return mMat;
+	//Combine calculated values above
+	MatrixD mRes;
+	_mm256_store_pd(mRes.m_vRow0.m_dData, HC_PERMUTE4D(_mm256_unpackhi_pd(X, Y), 2, 0, 3, 1));
+	_mm256_store_pd(mRes.m_vRow1.m_dData, HC_PERMUTE4D(_mm256_unpacklo_pd(X, Y), 2, 0, 3, 1));
+	_mm256_store_pd(mRes.m_vRow2.m_dData, HC_PERMUTE4D(_mm256_unpackhi_pd(Z, W), 2, 0, 3, 1));
+	_mm256_store_pd(mRes.m_vRow3.m_dData, HC_PERMUTE4D(_mm256_unpacklo_pd(Z, W), 2, 0, 3, 1));
+	return mRes;
 }
-HC_INLINE MatrixD HC_VECTORCALL RotationTranslationDegD(Vec4D _vRotation, Vec4D _vTranslation) {
-	MatrixD mMat = RotationYawPitchRollDegD(_vRotation);
-	mMat[3] = _vTranslation;
 
-	return mMat;
+//Accumulates the rows of _mRows weighted by the four values at _pWeights. Each lane rounds its products and adds them in the same
+//order as Dot, so FMA is deliberately not used here.
+HC_AVX2_TARGET HC_INLINE __m256d LinearCombineAVX2(const double* _pWeights, const MatrixD& _mRows) {
+	__m256d dRes = _mm256_mul_pd(_mm256_broadcast_sd(&_pWeights[0]), _mm256_load_pd(_mRows.m_vRow0.m_dData));
+	dRes = _mm256_add_pd(dRes, _mm256_mul_pd(_mm256_broadcast_sd(&_pWeights[1]), _mm256_load_pd(_mRows.m_vRow1.m_dData)));
+	dRes = _mm256_add_pd(dRes, _mm256_mul_pd(_mm256_broadcast_sd(&_pWeights[2]), _mm256_load_pd(_mRows.m_vRow2.m_dData)));
+	return _mm256_add_pd(dRes, _mm256_mul_pd(_mm256_broadcast_sd(&_pWeights[3]), _mm256_load_pd(_mRows.m_vRow3.m_dData)));
 }
-HC_INLINE MatrixD HC_VECTORCALL RotationTranslationRadD(Vec4D _vRotation, Vec4D _vTranslation) {
-	MatrixD mMat = RotationYawPitchRollRadD(_vRotation);
-	mMat[3] = _vTranslation;
 
-	return mMat;
+HC_AVX2_TARGET HC_INLINE MatrixD MultiplyAVX2(const MatrixD& _mLeft, const MatrixD& _mRight) {
+	MatrixD mRes;
+	_mm256_store_pd(mRes.m_vRow0.m_dData, LinearCombineAVX2(_mLeft.m_vRow0.m_dData, _mRight));
+	_mm256_store_pd(mRes.m_vRow1.m_dData, LinearCombineAVX2(_mLeft.m_vRow1.m_dData, _mRight));
+	_mm256_store_pd(mRes.m_vRow2.m_dData, LinearCombineAVX2(_mLeft.m_vRow2.m_dData, _mRight));
+	_mm256_store_pd(mRes.m_vRow3.m_dData, LinearCombineAVX2(_mLeft.m_vRow3.m_dData, _mRight));
+	return mRes;
 }
-HC_INLINE MatrixD HC_VECTORCALL ScaleXD(double _fScale) {
-	MatrixD mMat;
-	mMat[0] = Vec4D(_fScale, 0.0, 0.0, 0.0);
-	mMat[1] = Vec4D(0.0, 1.0, 0.0, 0.0);
-	mMat[2] = Vec4D(0.0, 0.0, 1.0, 0.0);
-	mMat[3] = Vec4D(0.0, 0.0, 0.0, 1.0);
-
-	return mMat;
-}
-HC_INLINE MatrixD HC_VECTORCALL ScaleYD(double _fScale) {
-	MatrixD mMat;
-	mMat[0] = Vec4D(1.0, 0.0, 0.0, 0.0);
-	mMat[1] = Vec4D(0.0, _fScale, 0.0, 0.0);
-	mMat[2] = Vec4D(0.0, 0.0, 1.0, 0.0);
-	mMat[3] = Vec4D(0.0, 0.0, 0.0, 1.0);
-
-	return mMat;
-}
-HC_INLINE MatrixD HC_VECTORCALL ScaleZD(double _fScale) {
-	MatrixD mMat;
-	mMat[0] = Vec4D(1.0, 0.0, 0.0, 0.0);
-	mMat[1] = Vec4D(0.0, 1.0, 0.0, 0.0);
-	mMat[2] = Vec4D(0.0, 0.0, _fScale, 0.0);
-	mMat[3] = Vec4D(0.0, 0.0, 0.0, 1.0);
 
-	return mMat;
-}
-HC_INLINE MatrixD HC_VECTORCALL ScaleXYZD(Vec4D _vScale) {
-	MatrixD mMat;
-	mMat[0] = Vec4D(_vScale.X(), 0.0, 0.0, 0.0);
-	mMat[1] = Vec4D(0.0, _vScale.Y(), 0.0, 0.0);
-	mMat[2] = Vec4D(0.0, 0.0, _vScale.Z(), 0.0);
-	mMat[3] = Vec4D(0.0, 0.0, 0.0, 1.0);
+//Dot product of _vVec with every row of _mMat, matching the scalar operator* semantics. The row products are transposed so each
+//lane adds its x, y, z and w terms left to right, the same order as Dot.
+HC_AVX2_TARGET HC_INLINE Vec4D MultiplyAVX2(const MatrixD& _mMat, const Vec4D& _vVec) {
+	const __m256d dVec = _mm256_load_pd(_vVec.m_dData);
+	const __m256d dProd0 = _mm256_mul_pd(_mm256_load_pd(_mMat.m_vRow0.m_dData), dVec), dProd1 = _mm256_mul_pd(_mm256_load_pd(_mMat.m_vRow1.m_dData), dVec);
+	const __m256d dProd2 = _mm256_mul_pd(_mm256_load_pd(_mMat.m_vRow2.m_dData), dVec), dProd3 = _mm256_mul_pd(_mm256_load_pd(_mMat.m_vRow3.m_dData), dVec);
 
-	return mMat;
-}
-HC_INLINE MatrixD HC_VECTORCALL RotationTranslationScaleDegD(Vec4D _vRotation, Vec4D _vTranslation, Vec4D _vScale) {
-	MatrixD mMat = RotationYawPitchRollDegD(_vRotation);
-	mMat[3] = _vTranslation;
-	mMat *= ScaleXYZD(_vScale);
+	const __m256d dLow01 = _mm256_unpacklo_pd(dProd0, dProd1), dHigh01 = _mm256_unpackhi_pd(dProd0, dProd1);
+	const __m256d dLow23 = _mm256_unpacklo_pd(dProd2, dProd3), dHigh23 = _mm256_unpackhi_pd(dProd2, dProd3);
 
-	return mMat;
-}
-HC_INLINE MatrixD HC_VECTORCALL RotationTranslationScaleRadD(Vec4D _vRotation, Vec4D _vTranslation, Vec4D _vScale) {
-	MatrixD mMat = RotationYawPitchRollRadD(_vRotation);
-	mMat[3] = _vTranslation;
-	mMat *= ScaleXYZD(_vScale);
+	__m256d dRes = _mm256_add_pd(_mm256_permute2f128_pd(dLow01, dLow23, 0x20), _mm256_permute2f128_pd(dHigh01, dHigh23, 0x20));
+	dRes = _mm256_add_pd(dRes, _mm256_permute2f128_pd(dLow01, dLow23, 0x31));
+	dRes = _mm256_add_pd(dRes, _mm256_permute2f128_pd(dHigh01, dHigh23, 0x31));
 
-	return mMat;
+	Vec4D vRes;
+	_mm256_store_pd(vRes.m_dData, dRes);
+	return vRes;
 }
-HC_INLINE MatrixD HC_VECTORCALL TranslateXLocal(double _fDist, MatrixD _mMat) { return _mMat * TranslationXD(_fDist); }
-HC_INLINE MatrixD HC_VECTORCALL TranslateXGlobal(double _fDist, MatrixD _mMat) { return TranslationXD(_fDist) * _mMat; }
-HC_INLINE MatrixD HC_VECTORCALL TranslateYLocal(double _fDist, MatrixD _mMat) { return _mMat * TranslationYD(_fDist); }
-HC_INLINE MatrixD HC_VECTORCALL TranslateYGlobal(double _fDist, MatrixD _mMat) { return TranslationYD(_fDist) * _mMat; }
-HC_INLINE MatrixD HC_VECTORCALL TranslateZLocal(double _fDist, MatrixD _mMat) { return _mMat * TranslationZD(_fDist); }
-HC_INLINE MatrixD HC_VECTORCALL TranslateZGlobal(double _fDist, MatrixD _mMat) { return TranslationZD(_fDist) * _mMat; }
-HC_INLINE MatrixD HC_VECTORCALL TranslateLocal(Vec4D _vTranslation, MatrixD _mMat) { return _mMat * TranslationD(_vTranslation); }
-HC_INLINE MatrixD HC_VECTORCALL TranslateGlobal(Vec4D _vTranslation, MatrixD _mMat) { return TranslationD(_vTranslation) * _mMat; }
-HC_INLINE MatrixD HC_VECTORCALL RotateXLocalDeg(double _fDeg, MatrixD _mMat) { return _mMat * RotationXDegD(_fDeg); }
-HC_INLINE MatrixD HC_VECTORCALL RotateXLocalRad(double _fRad, MatrixD _mMat) { return _mMat * RotationXRadD(_fRad); }
-HC_INLINE MatrixD HC_VECTORCALL RotateXGlobalDeg(double _fDeg, MatrixD _mMat) { return RotationXDegD(_fDeg) * _mMat; }
-HC_INLINE MatrixD HC_VECTORCALL RotateXGlobalRad(double _fDeg, MatrixD _mMat) { return RotationXRadD(_fDeg) * _mMat; }
-HC_INLINE MatrixD HC_VECTORCALL RotateYLocalDeg(double _fDeg, MatrixD _mMat) { return _mMat * RotationYDegD(_fDeg); }
-HC_INLINE MatrixD HC_VECTORCALL RotateYLocalRad(double _fRad, MatrixD _mMat) { return _mMat * RotationYRadD(_fRad); }
-HC_INLINE MatrixD HC_VECTORCALL RotateYGlobalDeg(double _fDeg, MatrixD _mMat) { return RotationYDegD(_fDeg) * _mMat; }
-HC_INLINE MatrixD HC_VECTORCALL RotateYGlobalRad(double _fDeg, MatrixD _mMat) { return RotationYDegD(_fDeg) * _mMat; }
-HC_INLINE MatrixD HC_VECTORCALL RotateZLocalDeg(double _fDeg, MatrixD _mMat) { return _mMat * RotationZDegD(_fDeg); }
-HC_INLINE MatrixD HC_VECTORCALL RotateZLocalRad(double _fRad, MatrixD _mMat) { return _mMat * RotationZRadD(_fRad); }
-HC_INLINE MatrixD HC_VECTORCALL RotateZGlobalDeg(double _fDeg, MatrixD _mMat) { return RotationZDegD(_fDeg) * _mMat; }
-HC_INLINE MatrixD HC_VECTORCALL RotateZGlobalRad(double _fRad, MatrixD _mMat) { return RotationZRadD(_fRad) * _mMat; }
-HC_INLINE MatrixD HC_VECTORCALL RotateYawPitchRollLocalDeg(Vec4D _vRotation, MatrixD _mMat) { return _mMat * RotationYawPitchRollDegD(_vRotation); }
-HC_INLINE MatrixD HC_VECTORCALL RotateYawPitchRollLocalRad(Vec4D _vRotation, MatrixD _mMat) { return _mMat * RotationYawPitchRollRadD(_vRotation); }
-HC_INLINE MatrixD HC_VECTORCALL RotateYawPitchRollGlobalDeg(Vec4D _vRotation, MatrixD _mMat) { return RotationYawPitchRollDegD(_vRotation) * _mMat; }
-HC_INLINE MatrixD HC_VECTORCALL RotateYawPitchRollGlobalRad(Vec4D _vRotation, MatrixD _mMat) { return RotationYawPitchRollRadD(_vRotation) * _mMat; }
-
-#else
-
-struct HC_ALIGNAS(128) MatrixD
-{
-	union {
-		struct {
-			Vec4D m_vRow0;
-			Vec4D m_vRow1;
-			Vec4D m_vRow2;
-			Vec4D m_vRow3;
-		};
-
-		Vec4D m_vRows[4];
-		double m_dM[16];
-		double m_dMat[4][4];
-	};
-
-	HC_INLINE MatrixD() { m_vRows[0] = Vec4D(); m_vRows[1] = Vec4D(); m_vRows[2] = Vec4D(); m_vRows[3] = Vec4D(); }
-	HC_INLINE explicit MatrixD(const Vec4D& _vRow0, const Vec4D& _vRow1, const Vec4D& _vRow2, const Vec4D& _vRow3) { m_vRows[0] = _vRow0; m_vRows[1] = _vRow1; m_vRows[2] = _vRow2; m_vRows[3] = _vRow3; }
-	HC_INLINE explicit MatrixD(double _dVal) { m_vRows[0] = Vec4D(_dVal); m_vRows[1] = Vec4D(_dVal); m_vRows[2] = Vec4D(_dVal); m_vRows[3] = Vec4D(_dVal); }
-	HC_INLINE Vec4D operator[](int _iNdx) const { assert(_iNdx < 4); return m_vRows[_iNdx]; }
-	HC_INLINE Vec4D& operator[](int _iNdx) { assert(_iNdx < 4); return m_vRows[_iNdx]; }
-};
+#endif
 
 [[nodiscard]] HC_INLINE MatrixD Transpose(const MatrixD& _mMat) {
+	HC_AVX2_DISPATCH(TransposeAVX2(_mMat));
+
 	return MatrixD(Vec4D(_mMat[0][0], _mMat[1][0], _mMat[2][0], _mMat[3][0]),
 				   Vec4D(_mMat[0][1], _mMat[1][1], _mMat[2][1], _mMat[3][1]),
 				   Vec4D(_mMat[0][2], _mMat[1][2], _mMat[2][2], _mMat[3][2]),
@@ -481,6 +152,7 @@ struct HC_ALIGNAS(128) MatrixD
 }
 
 [[nodiscard]] HC_INLINE MatrixD Inverse(const MatrixD& _mMat) {
+	HC_AVX2_DISPATCH(InverseAVX2(_mMat));
 
 	//Sub matrices
 	Vec4D A = Vec4D(_mMat[0].XY(), _mMat[1].XY());
@@ -581,6 +253,8 @@ struct HC_ALIGNAS(128) MatrixD
 }
 
 [[nodiscard]] HC_INLINE MatrixD operator*(const MatrixD& _mLeft, const MatrixD& _mRight) {
+	HC_AVX2_DISPATCH(MultiplyAVX2(_mLeft, _mRight));
+
 	MatrixD t = Transpose(_mRight);
 
 	MatrixD res;
@@ -595,6 +269,8 @@ struct HC_ALIGNAS(128) MatrixD
 }
 
 [[nodiscard]] HC_INLINE Vec4D operator*(const MatrixD& _mLeft, const Vec4D& _vRight) {
+	HC_AVX2_DISPATCH(MultiplyAVX2(_mLeft, _vRight));
+
 	return Vec4D(Dot(_mLeft[0], _vRight),
 				 Dot(_mLeft[1], _vRight),
 				 Dot(_mLeft[2], _vRight),
@@ -602,6 +278,8 @@ struct HC_ALIGNAS(128) MatrixD
 }
 
 [[nodiscard]] HC_INLINE Vec4D operator*(const Vec4D& _vLeft, const MatrixD& _mRight) {
+	HC_AVX2_DISPATCH(MultiplyAVX2(_mRight, _vLeft));
+
 	return Vec4D(Dot(_vLeft, _mRight[0]),
 				 Dot(_vLeft, _mRight[1]),
 				 Dot(_vLeft, _mRight[2]),
@@ -853,5 +531,3 @@ HC_INLINE MatrixD& operator/=(MatrixD& _mLeft, double _fRight) { _mLeft = _mLeft
 [[nodiscard]] HC_INLINE MatrixD RotateYawPitchRollLocalRad(const Vec3D& _vRotation, const MatrixD& _mMat) { return _mMat * RotationYawPitchRollRadD(_vRotation); }
 [[nodiscard]] HC_INLINE MatrixD RotateYawPitchRollGlobalDeg(const Vec3D& _vRotation, const MatrixD& _mMat) { return RotationYawPitchRollDegD(_vRotation) * _mMat; }
 [[nodiscard]] HC_INLINE MatrixD RotateYawPitchRollGlobalRad(const Vec3D& _vRotation, const MatrixD& _mMat) { return RotationYawPitchRollRadD(_vRotation) * _mMat; }
-
-#endif
\ No newline at end of file
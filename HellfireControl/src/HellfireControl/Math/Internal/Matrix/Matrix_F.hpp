@@ -2,460 +2,38 @@
 
 #include <HellfireControl/Math/Internal/Matrix/Matrix_Common.hpp>
 
-#if HC_USE_SIMD
-//
-//struct MatrixF {
-//	Vec4F m_vRows[4];
-//
-//	HC_INLINE HC_VECTORCALL MatrixF() {};
-//	HC_INLINE explicit HC_VECTORCALL MatrixF(Vec4F _vRow1, Vec4F _vRow2, Vec4F _vRow3, Vec4F _vRow4) { m_vRows[0] = _vRow1; m_vRows[1] = _vRow2; m_vRows[2] = _vRow3; m_vRows[3] = _vRow4; }
-//	HC_INLINE explicit HC_VECTORCALL MatrixF(Vec4F* _vRows) { m_vRows[0] = _vRows[0]; m_vRows[1] = _vRows[1]; m_vRows[2] = _vRows[2]; m_vRows[3] = _vRows[3]; }
-//	HC_INLINE Vec4F HC_VECTORCALL operator[](int _iNdx) const { assert(_iNdx < 4); return m_vRows[_iNdx]; }
-//	HC_INLINE Vec4F& HC_VECTORCALL operator[](int _iNdx) { assert(_iNdx < 4); return m_vRows[_iNdx]; }
-//	HC_INLINE Vec4F HC_VECTORCALL Row1() { return m_vRows[0]; }
-//	HC_INLINE Vec4F HC_VECTORCALL Row2() { return m_vRows[1]; }
-//	HC_INLINE Vec4F HC_VECTORCALL Row3() { return m_vRows[2]; }
-//	HC_INLINE Vec4F HC_VECTORCALL Row4() { return m_vRows[3]; }
-//	HC_INLINE void HC_VECTORCALL SetRow1(Vec4F _vRow) { m_vRows[0] = _vRow; }
-//	HC_INLINE void HC_VECTORCALL SetRow2(Vec4F _vRow) { m_vRows[1] = _vRow; }
-//	HC_INLINE void HC_VECTORCALL SetRow3(Vec4F _vRow) { m_vRows[2] = _vRow; }
-//	HC_INLINE void HC_VECTORCALL SetRow4(Vec4F _vRow) { m_vRows[3] = _vRow; }
-//};
-//
-//HC_INLINE MatrixF HC_VECTORCALL Transpose(const MatrixF& _mMat) {
-//	__m128 temp0 = _mm_unpacklo_ps(_mMat[0].m_fVec, _mMat[2].m_fVec);
-//	__m128 temp1 = _mm_unpacklo_ps(_mMat[1].m_fVec, _mMat[3].m_fVec);
-//	__m128 temp2 = _mm_unpackhi_ps(_mMat[0].m_fVec, _mMat[2].m_fVec);
-//	__m128 temp3 = _mm_unpackhi_ps(_mMat[1].m_fVec, _mMat[3].m_fVec);
-//
-//	_mMat[0] = Vec4F(_mm_unpacklo_ps(temp0, temp1));
-//	_mMat[1] = Vec4F(_mm_unpackhi_ps(temp0, temp1));
-//	_mMat[2] = Vec4F(_mm_unpacklo_ps(temp2, temp3));
-//	_mMat[3] = Vec4F(_mm_unpackhi_ps(temp2, temp3));
-//
-//	return _mMat;
-//}
-//HC_INLINE float HC_VECTORCALL Determinant(const MatrixF& _mMat) {
-//	//Sub matrices
-//	Vec4F A = Vec4F(_mm_movelh_ps(_mMat[0].m_fVec, _mMat[1].m_fVec));
-//	Vec4F B = Vec4F(_mm_movehl_ps(_mMat[1].m_fVec, _mMat[0].m_fVec));
-//	Vec4F C = Vec4F(_mm_movelh_ps(_mMat[2].m_fVec, _mMat[3].m_fVec));
-//	Vec4F D = Vec4F(_mm_movehl_ps(_mMat[3].m_fVec, _mMat[2].m_fVec));
-//
-//	//Determinants
-//	Vec4F dets = Vec4F(_mm_sub_ps(_mm_mul_ps(HC_SHUFFLE4F_2(_mMat[0], _mMat[2], 0, 2, 0, 2).m_fVec, HC_SHUFFLE4F_2(_mMat[1], _mMat[3], 1, 3, 1, 3).m_fVec),
-//		_mm_mul_ps(HC_SHUFFLE4F_2(_mMat[0], _mMat[2], 1, 3, 1, 3).m_fVec, HC_SHUFFLE4F_2(_mMat[1], _mMat[3], 0, 2, 0, 2).m_fVec)));
-//	float detA = dets.X();
-//	float detB = dets.Y();
-//	float detC = dets.Z();
-//	float detD = dets.W();
-//	//D adjmul C
-//	Vec4F DC = (D.WWXX() * C) - (D.YYZZ() * C.ZWXY());
-//	//A adjmul B
-//	Vec4F AB = (A.WWXX() * B) - (A.YYZZ() * B.ZWXY());
-//
-//	return ((detA * detD) + (detB * detC)) - Sum(AB * DC.XZYW());
-//}
-//HC_INLINE MatrixF HC_VECTORCALL Inverse(const MatrixF& _mMat) {
-//
-//	//Sub matrices
-//	Vec4F A = Vec4F(_mm_movelh_ps(_mMat[0].m_fVec, _mMat[1].m_fVec));
-//	Vec4F B = Vec4F(_mm_movehl_ps(_mMat[1].m_fVec, _mMat[0].m_fVec));
-//	Vec4F C = Vec4F(_mm_movelh_ps(_mMat[2].m_fVec, _mMat[3].m_fVec));
-//	Vec4F D = Vec4F(_mm_movehl_ps(_mMat[3].m_fVec, _mMat[2].m_fVec));
-//
-//	//Determinants
-//	Vec4F dets = (HC_SHUFFLE4F_2(_mMat[0], _mMat[2], 0, 2, 0, 2) * HC_SHUFFLE4F_2(_mMat[1], _mMat[3], 1, 3, 1, 3) -
-//		(HC_SHUFFLE4F_2(_mMat[0], _mMat[2], 1, 3, 1, 3) * HC_SHUFFLE4F_2(_mMat[1], _mMat[3], 0, 2, 0, 2)));
-//	float detA = dets.X();
-//	float detB = dets.Y();
-//	float detC = dets.Z();
-//	float detD = dets.W();
-//
-//	//D adjmul C
-//	Vec4F DC = (D.WWXX() * C) - (D.YYZZ() * C.ZWXY());
-//	//A adjmul B
-//	Vec4F AB = (A.WWXX() * B) - (A.YYZZ() * B.ZWXY());
-//	//DetM
-//	float detM = ((detA * detD) + (detB * detC)) - Sum(AB * DC.XZYW());
-//	//No inverse, return 0
-//	if (detM == 0.0f) { return MatrixF(); }
-//	//Reciprocal
-//	Vec4F vDet = Vec4F(1.0f, -1.0f, -1.0f, 1.0f) / detM;
-//
-//	//X Row
-//	Vec4F X = ((A * detD) - ((B * DC.XWXW()) + (B.YXWZ() * DC.ZYZY()))) * vDet;
-//	//W Row
-//	Vec4F W = ((D * detA) - ((C * AB.XWXW()) + (C.YXWZ() * AB.ZYZY()))) * vDet;
-//	//Y Row
-//	Vec4F Y = ((C * detB) - ((D * AB.WXWX()) - (D.YXWZ() * AB.ZYZY()))) * vDet;
-//	//Z Row
-//	Vec4F Z = ((B * detC) - ((A * DC.WXWX()) - (A.YXWZ() * DC.ZYZY()))) * vDet;
-//
-//	_mMat[0] = HC_SHUFFLE4F_2(X, Y, 3, 1, 3, 1);
-//	_mMat[1] = HC_SHUFFLE4F_2(X, Y, 2, 0, 2, 0);
-//	_mMat[2] = HC_SHUFFLE4F_2(Z, W, 3, 1, 3, 1);
-//	_mMat[3] = HC_SHUFFLE4F_2(Z, W, 2, 0, 2, 0);
-//
-//	return _mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL IdentityF() {
-//	static MatrixF mMat(Vec4F(1.0f, 0.0f, 0.0f, 0.0f),
-//		Vec4F(0.0f, 1.0f, 0.0f, 0.0f),
-//		Vec4F(0.0f, 0.0f, 1.0f, 0.0f),
-//		Vec4F(0.0f, 0.0f, 0.0f, 1.0f));
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL ProjectionF(float _fAspectRatio, float _fFOV, float _fNearPlane, float _fFarPlane) {
-//	float fFocal = 1.0f / tanf(_fFOV);
-//	MatrixF mMat;
-//	mMat[0] = Vec4F(fFocal / _fAspectRatio, 0.0f, 0.0f, 0.0f);
-//	mMat[1] = Vec4F(0.0f, -fFocal, 0.0f, 0.0f);
-//	mMat[2] = Vec4F(0.0f, 0.0f, _fNearPlane / (_fFarPlane - _fNearPlane), -1.0f);
-//	mMat[3] = Vec4F(0.0f, 0.0f, (_fNearPlane * _fFarPlane) / (_fFarPlane - _fNearPlane), 0.0f);
-//
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL ProjectionFInf(float _fAspectRatio, float _fFOV, float _fNearPlane) {
-//	float fFocal = 1.0f / tanf(_fFOV);
-//	MatrixF mMat;
-//	mMat[0] = Vec4F(fFocal / _fAspectRatio, 0.0f, 0.0f, 0.0f);
-//	mMat[1] = Vec4F(0.0f, -fFocal, 0.0f, 0.0f);
-//	mMat[2] = Vec4F(0.0f, 0.0f, 0.0f, -1.0f);
-//	mMat[3] = Vec4F(0.0f, 0.0f, _fNearPlane, 0.0f);
-//
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL LookAtLH(Vec4F _vEye, Vec4F _vAt, Vec4F _vUp) {
-//	Vec4F vZAxis = Normalize(_vAt - _vEye);
-//	Vec4F vXAxis = Normalize(Cross(_vUp, vZAxis));
-//	Vec4F vYAxis = Normalize(Cross(vZAxis, vXAxis));
-//
-//	return MatrixF(vXAxis, vYAxis, vZAxis, _vAt);
-//}
-//HC_INLINE MatrixF HC_VECTORCALL operator+(const MatrixF& _mLeft, const MatrixF& _mRight) {
-//	_mLeft[0] = _mLeft[0] + _mRight[0];
-//	_mLeft[1] = _mLeft[1] + _mRight[1];
-//	_mLeft[2] = _mLeft[2] + _mRight[2];
-//	_mLeft[3] = _mLeft[3] + _mRight[3];
-//
-//	return _mLeft;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL operator-(const MatrixF& _mLeft, const MatrixF& _mRight) {
-//	_mLeft[0] = _mLeft[0] - _mRight[0];
-//	_mLeft[1] = _mLeft[1] - _mRight[1];
-//	_mLeft[2] = _mLeft[2] - _mRight[2];
-//	_mLeft[3] = _mLeft[3] - _mRight[3];
-//
-//	return _mLeft;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL operator*(const MatrixF& _mLeft, float _fRight) {
-//	_mLeft[0] *= _fRight;
-//	_mLeft[1] *= _fRight;
-//	_mLeft[2] *= _fRight;
-//	_mLeft[3] *= _fRight;
-//
-//	return _mLeft;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL operator*(float _fLeft, const MatrixF& _mRight) {
-//	_mRight[0] *= _fLeft;
-//	_mRight[1] *= _fLeft;
-//	_mRight[2] *= _fLeft;
-//	_mRight[3] *= _fLeft;
-//
-//	return _mRight;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL operator*(const MatrixF& _mLeft, const MatrixF& _mRight) {
-//	_mRight = Transpose(_mRight);
-//
-//	for (int iNdx = 0; iNdx < 4; ++iNdx) {
-//		_mLeft[iNdx] = Vec4F(Dot(_mLeft[iNdx], _mRight[0]),
-//			Dot(_mLeft[iNdx], _mRight[1]),
-//			Dot(_mLeft[iNdx], _mRight[2]),
-//			Dot(_mLeft[iNdx], _mRight[3]));
-//	}
-//
-//	return _mLeft;
-//}
-//HC_INLINE Vec4F HC_VECTORCALL operator*(const MatrixF& _mLeft, const Vec4F& _vRight) {
-//	_vRight = Vec4F(Dot(_mLeft[0], _vRight),
-//		Dot(_mLeft[1], _vRight),
-//		Dot(_mLeft[2], _vRight),
-//		Dot(_mLeft[3], _vRight));
-//
-//	return _vRight;
-//}
-//HC_INLINE Vec4F HC_VECTORCALL operator*(const Vec4F& _vLeft, const MatrixF& _mRight) {
-//	_vLeft = Vec4F(Dot(_vLeft, _mRight[0]),
-//		Dot(_vLeft, _mRight[1]),
-//		Dot(_vLeft, _mRight[2]),
-//		Dot(_vLeft, _mRight[3]));
-//
-//	return _vLeft;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL operator/(const MatrixF& _mLeft, float _fRight) {
-//	_mLeft[0] /= _fRight;
-//	_mLeft[1] /= _fRight;
-//	_mLeft[2] /= _fRight;
-//	_mLeft[3] /= _fRight;
-//
-//	return _mLeft;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL operator/(float _fLeft, const MatrixF& _mRight) {
-//	_mRight[0] /= _fLeft;
-//	_mRight[1] /= _fLeft;
-//	_mRight[2] /= _fLeft;
-//	_mRight[3] /= _fLeft;
-//
-//	return _mRight;
-//}
-//HC_INLINE MatrixF& HC_VECTORCALL operator+=(MatrixF& _mLeft, MatrixF _mRight) { _mLeft = _mLeft + _mRight; return _mLeft; }
-//HC_INLINE MatrixF& HC_VECTORCALL operator-=(MatrixF& _mLeft, MatrixF _mRight) { _mLeft = _mLeft - _mRight; return _mLeft; }
-//HC_INLINE MatrixF& HC_VECTORCALL operator*=(MatrixF& _mLeft, float _fRight) { _mLeft = _mLeft * _fRight; return _mLeft; }
-//HC_INLINE MatrixF& HC_VECTORCALL operator*=(MatrixF& _mLeft, MatrixF _mRight) { _mLeft = _mLeft * _mRight; return _mLeft; }
-//HC_INLINE Vec4F& HC_VECTORCALL operator*=(Vec4F& _vLeft, MatrixF _mRight) { _vLeft = _vLeft * _mRight; return _vLeft; }
-//HC_INLINE MatrixF& HC_VECTORCALL operator/=(MatrixF& _mLeft, float _fRight) { _mLeft = _mLeft / _fRight; return _mLeft; }
-//HC_INLINE MatrixF HC_VECTORCALL operator~(MatrixF _mMat) { return MatrixF(); }
-//HC_INLINE MatrixF HC_VECTORCALL operator-(MatrixF _mMat) { return MatrixF() - _mMat; }
-//HC_INLINE MatrixF HC_VECTORCALL RotationXDegF(float _fDeg) {
-//	_fDeg = HC_DEG2RAD(_fDeg);
-//
-//	MatrixF mMat;
-//	mMat[0] = Vec4F(1.0f, 0.0f, 0.0f, 0.0f);
-//	mMat[1] = Vec4F(0.0f, cosf(_fDeg), sinf(_fDeg), 0.0f);
-//	mMat[2] = Vec4F(0.0f, -sinf(_fDeg), cosf(_fDeg), 0.0f);
-//	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
-//
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL RotationXRadF(float _fRad) {
-//	MatrixF mMat;
-//	mMat[0] = Vec4F(1.0f, 0.0f, 0.0f, 0.0f);
-//	mMat[1] = Vec4F(0.0f, cosf(_fRad), -sinf(_fRad), 0.0f);
-//	mMat[2] = Vec4F(0.0f, sinf(_fRad), cosf(_fRad), 0.0f);
-//	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
-//
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL RotationYDegF(float _fDeg) {
-//	_fDeg = HC_DEG2RAD(_fDeg);
-//
-//	MatrixF mMat;
-//	mMat[0] = Vec4F(cosf(_fDeg), 0.0f, sinf(_fDeg), 0.0f);
-//	mMat[1] = Vec4F(0.0f, 1.0f, 0.0f, 0.0f);
-//	mMat[2] = Vec4F(-sinf(_fDeg), 0.0f, cosf(_fDeg), 0.0f);
-//	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
-//
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL RotationYRadF(float _fRad) {
-//	MatrixF mMat;
-//	mMat[0] = Vec4F(cosf(_fRad), 0.0f, sinf(_fRad), 0.0f);
-//	mMat[1] = Vec4F(0.0f, 1.0f, 0.0f, 0.0f);
-//	mMat[2] = Vec4F(-sinf(_fRad), 0.0f, cosf(_fRad), 0.0f);
-//	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
-//
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL RotationZDegF(float _fDeg) {
-//	_fDeg = HC_DEG2RAD(_fDeg);
-//
-//	MatrixF mMat;
-//	mMat[0] = Vec4F(cosf(_fDeg), -sinf(_fDeg), 0.0f, 0.0f);
-//	mMat[1] = Vec4F(sinf(_fDeg), cosf(_fDeg), 0.0f, 0.0f);
-//	mMat[2] = Vec4F(0.0f, 0.0f, 1.0f, 0.0f);
-//	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
-//
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL RotationZRadF(float _fRad) {
-//	MatrixF mMat;
-//	mMat[0] = Vec4F(cosf(_fRad), -sinf(_fRad), 0.0f, 0.0f);
-//	mMat[1] = Vec4F(sinf(_fRad), cosf(_fRad), 0.0f, 0.0f);
-//	mMat[2] = Vec4F(0.0f, 0.0f, 1.0f, 0.0f);
-//	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
-//
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL RotationYawPitchRollDegF(Vec4F _vRotation) {
-//	float fYaw = HC_DEG2RAD(_vRotation.X());
-//	float fPitch = HC_DEG2RAD(_vRotation.Y());
-//	float fRoll = HC_DEG2RAD(_vRotation.Z());
-//
-//	MatrixF mMat;
-//	mMat[0] = Vec4F(cosf(fYaw) * cosf(fPitch), (cosf(fYaw) * sinf(fPitch) * sinf(fRoll)) - (sinf(fYaw) * cosf(fRoll)), (cosf(fYaw) * sinf(fPitch) * cosf(fRoll)) + (sinf(fYaw) * sinf(fRoll)), 0.0f);
-//	mMat[1] = Vec4F(sinf(fYaw) * cosf(fPitch), (sinf(fYaw) * sinf(fPitch) * sinf(fRoll)) + (cosf(fYaw) * cosf(fRoll)), (sinf(fYaw) * sinf(fPitch) * cosf(fRoll)) - (cosf(fYaw) * sinf(fRoll)), 0.0f);
-//	mMat[2] = Vec4F(-sinf(fPitch), cosf(fPitch) * sinf(fRoll), cosf(fPitch) * cosf(fRoll), 0.0f);
-//	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
-//
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL RotationYawPitchRollRadF(Vec4F _vRotation) {
-//	float fYaw = _vRotation.X();
-//	float fPitch = _vRotation.Y();
-//	float fRoll = _vRotation.Z();
-//
-//	MatrixF mMat;
-//	mMat[0] = Vec4F(cosf(fYaw) * cosf(fPitch), (cosf(fYaw) * sinf(fPitch) * sinf(fRoll)) - (sinf(fYaw) * cosf(fRoll)), (cosf(fYaw) * sinf(fPitch) * cosf(fRoll)) + (sinf(fYaw) * sinf(fRoll)), 0.0f);
-//	mMat[1] = Vec4F(sinf(fYaw) * cosf(fPitch), (sinf(fYaw) * sinf(fPitch) * sinf(fRoll)) + (cosf(fYaw) * cosf(fRoll)), (sinf(fYaw) * sinf(fPitch) * cosf(fRoll)) - (cosf(fYaw) * sinf(fRoll)), 0.0f);
-//	mMat[2] = Vec4F(-sinf(fPitch), cosf(fPitch) * sinf(fRoll), cosf(fPitch) * cosf(fRoll), 0.0f);
-//	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
-//
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL TranslationXF(float _fDist) {
-//	MatrixF mMat;
-//	mMat[0] = Vec4F(1.0f, 0.0f, 0.0f, 0.0f);
-//	mMat[1] = Vec4F(0.0f, 1.0f, 0.0f, 0.0f);
-//	mMat[2] = Vec4F(0.0f, 0.0f, 1.0f, 0.0f);
-//	mMat[3] = Vec4F(_fDist, 0.0f, 0.0f, 1.0f);
-//
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL TranslationYF(float _fDist) {
-//	MatrixF mMat;
-//	mMat[0] = Vec4F(1.0f, 0.0f, 0.0f, 0.0f);
-//	mMat[1] = Vec4F(0.0f, 1.0f, 0.0f, 0.0f);
-//	mMat[2] = Vec4F(0.0f, 0.0f, 1.0f, 0.0f);
-//	mMat[3] = Vec4F(0.0f, _fDist, 0.0f, 1.0f);
-//
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL TranslationZF(float _fDist) {
-//	MatrixF mMat;
-//	mMat[0] = Vec4F(1.0f, 0.0f, 0.0f, 0.0f);
-//	mMat[1] = Vec4F(0.0f, 1.0f, 0.0f, 0.0f);
-//	mMat[2] = Vec4F(0.0f, 0.0f, 1.0f, 0.0f);
-//	mMat[3] = Vec4F(0.0f, _fDist, 0.0f, 1.0f);
-//
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL TranslationF(Vec4F _vTranslation) {
-//	MatrixF mMat;
-//	mMat[0] = Vec4F(1.0f, 0.0f, 0.0f, 0.0f);
-//	mMat[1] = Vec4F(0.0f, 1.0f, 0.0f, 0.0f);
-//	mMat[2] = Vec4F(0.0f, 0.0f, 1.0f, 0.0f);
-//	mMat[3] = _vTranslation;
-//
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL RotationTranslationDegF(Vec4F _vRotation, Vec4F _vTranslation) {
-//	MatrixF mMat = RotationYawPitchRollDegF(_vRotation);
-//	mMat[3] = _vTranslation;
-//
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL RotationTranslationRadF(Vec4F _vRotation, Vec4F _vTranslation) {
-//	MatrixF mMat = RotationYawPitchRollRadF(_vRotation);
-//	mMat[3] = _vTranslation;
-//
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL ScaleXF(float _fScale) {
-//	MatrixF mMat;
-//	mMat[0] = Vec4F(_fScale, 0.0f, 0.0f, 0.0f);
-//	mMat[1] = Vec4F(0.0f, 1.0f, 0.0f, 0.0f);
-//	mMat[2] = Vec4F(0.0f, 0.0f, 1.0f, 0.0f);
-//	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
-//
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL ScaleYF(float _fScale) {
-//	MatrixF mMat;
-//	mMat[0] = Vec4F(1.0f, 0.0f, 0.0f, 0.0f);
-//	mMat[1] = Vec4F(0.0f, _fScale, 0.0f, 0.0f);
-//	mMat[2] = Vec4F(0.0f, 0.0f, 1.0f, 0.0f);
-//	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
-//
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL ScaleZF(float _fScale) {
-//	MatrixF mMat;
-//	mMat[0] = Vec4F(1.0f, 0.0f, 0.0f, 0.0f);
-//	mMat[1] = Vec4F(0.0f, 1.0f, 0.0f, 0.0f);
-//	mMat[2] = Vec4F(0.0f, 0.0f, _fScale, 0.0f);
-//	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
-//
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL ScaleXYZF(Vec4F _vScale) {
-//	MatrixF mMat;
-//	mMat[0] = Vec4F(_vScale.X(), 0.0f, 0.0f, 0.0f);
-//	mMat[1] = Vec4F(0.0f, _vScale.Y(), 0.0f, 0.0f);
-//	mMat[2] = Vec4F(0.0f, 0.0f, _vScale.Z(), 0.0f);
-//	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
-//
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL RotationTranslationScaleDegF(Vec4F _vRotation, Vec4F _vTranslation, Vec4F _vScale) {
-//	MatrixF mMat = RotationYawPitchRollDegF(_vRotation);
-//	mMat[3] = _vTranslation;
-//	mMat *= ScaleXYZF(_vScale);
-//
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL RotationTranslationScaleRadF(Vec4F _vRotation, Vec4F _vTranslation, Vec4F _vScale) {
-//	MatrixF mMat = RotationYawPitchRollRadF(_vRotation);
-//	mMat[3] = _vTranslation;
-//	mMat *= ScaleXYZF(_vScale);
-//
-//	return mMat;
-//}
-//HC_INLINE MatrixF HC_VECTORCALL TranslateXLocal(float _fDist, MatrixF _mMat) { return _mMat * TranslationXF(_fDist); }
-//HC_INLINE MatrixF HC_VECTORCALL TranslateXGlobal(float _fDist, MatrixF _mMat) { return TranslationXF(_fDist) * _mMat; }
-//HC_INLINE MatrixF HC_VECTORCALL TranslateYLocal(float _fDist, MatrixF _mMat) { return _mMat * TranslationYF(_fDist); }
-//HC_INLINE MatrixF HC_VECTORCALL TranslateYGlobal(float _fDist, MatrixF _mMat) { return TranslationYF(_fDist) * _mMat; }
-//HC_INLINE MatrixF HC_VECTORCALL TranslateZLocal(float _fDist, MatrixF _mMat) { return _mMat * TranslationZF(_fDist); }
-//HC_INLINE MatrixF HC_VECTORCALL TranslateZGlobal(float _fDist, MatrixF _mMat) { return TranslationZF(_fDist) * _mMat; }
-//HC_INLINE MatrixF HC_VECTORCALL TranslateLocal(Vec4F _vTranslation, MatrixF _mMat) { return _mMat * TranslationF(_vTranslation); }
-//HC_INLINE MatrixF HC_VECTORCALL TranslateGlobal(Vec4F _vTranslation, MatrixF _mMat) { return TranslationF(_vTranslation) * _mMat; }
-//HC_INLINE MatrixF HC_VECTORCALL RotateXLocalDeg(float _fDeg, MatrixF _mMat) { return _mMat * RotationXDegF(_fDeg); }
-//HC_INLINE MatrixF HC_VECTORCALL RotateXLocalRad(float _fRad, MatrixF _mMat) { return _mMat * RotationXRadF(_fRad); }
-//HC_INLINE MatrixF HC_VECTORCALL RotateXGlobalDeg(float _fDeg, MatrixF _mMat) { return RotationXDegF(_fDeg) * _mMat; }
-//HC_INLINE MatrixF HC_VECTORCALL RotateXGlobalRad(float _fDeg, MatrixF _mMat) { return RotationXRadF(_fDeg) * _mMat; }
-//HC_INLINE MatrixF HC_VECTORCALL RotateYLocalDeg(float _fDeg, MatrixF _mMat) { return _mMat * RotationYDegF(_fDeg); }
-//HC_INLINE MatrixF HC_VECTORCALL RotateYLocalRad(float _fRad, MatrixF _mMat) { return _mMat * RotationYRadF(_fRad); }
-//HC_INLINE MatrixF HC_VECTORCALL RotateYGlobalDeg(float _fDeg, MatrixF _mMat) { return RotationYDegF(_fDeg) * _mMat; }
-//HC_INLINE MatrixF HC_VECTORCALL RotateYGlobalRad(float _fDeg, MatrixF _mMat) { return RotationYDegF(_fDeg) * _mMat; }
-//HC_INLINE MatrixF HC_VECTORCALL RotateZLocalDeg(float _fDeg, MatrixF _mMat) { return _mMat * RotationZDegF(_fDeg); }
-//HC_INLINE MatrixF HC_VECTORCALL RotateZLocalRad(float _fRad, MatrixF _mMat) { return _mMat * RotationZRadF(_fRad); }
-//HC_INLINE MatrixF HC_VECTORCALL RotateZGlobalDeg(float _fDeg, MatrixF _mMat) { return RotationZDegF(_fDeg) * _mMat; }
-//HC_INLINE MatrixF HC_VECTORCALL RotateZGlobalRad(float _fRad, MatrixF _mMat) { return RotationZRadF(_fRad) * _mMat; }
-//HC_INLINE MatrixF HC_VECTORCALL RotateYawPitchRollLocalDeg(Vec4F _vRotation, MatrixF _mMat) { return _mMat * RotationYawPitchRollDegF(_vRotation); }
-//HC_INLINE MatrixF HC_VECTORCALL RotateYawPitchRollLocalRad(Vec4F _vRotation, MatrixF _mMat) { return _mMat * RotationYawPitchRollRadF(_vRotation); }
-//HC_INLINE MatrixF HC_VECTORCALL RotateYawPitchRollGlobalDeg(Vec4F _vRotation, MatrixF _mMat) { return RotationYawPitchRollDegF(_vRotation) * _mMat; }
-//HC_INLINE MatrixF HC_VECTORCALL RotateYawPitchRollGlobalRad(Vec4F _vRotation, MatrixF _mMat) { return RotationYawPitchRollRadF(_vRotation) * _mMat; }
-
-#else
-
 struct HC_ALIGNAS(64) MatrixF
 {
-	union {
-		struct {
-			Vec4F m_vRow0; //X Rotation
-			Vec4F m_vRow1; //Y Rotation
-			Vec4F m_vRow2; //Z Rotation
-			Vec4F m_vRow3; //Position
-		};
-
-		Vec4F m_vRows[4];
-		float m_fM[16];
-		float m_fMat[4][4];
-	};
-
-	HC_INLINE MatrixF() { m_vRows[0] = Vec4F(); m_vRows[1] = Vec4F(); m_vRows[2] = Vec4F(); m_vRows[3] = Vec4F(); }
-	HC_INLINE explicit MatrixF(const Vec4F& _vRow0, const Vec4F& _vRow1, const Vec4F& _vRow2, const Vec4F& _vRow3) { m_vRows[0] = _vRow0; m_vRows[1] = _vRow1; m_vRows[2] = _vRow2; m_vRows[3] = _vRow3; }
-	HC_INLINE explicit MatrixF(float _fVal) { m_vRows[0] = Vec4F(_fVal); m_vRows[1] = Vec4F(_fVal); m_vRows[2] = Vec4F(_fVal); m_vRows[3] = Vec4F(_fVal); }
-	[[nodiscard]] HC_INLINE Vec4F operator[](int _iNdx) const { assert(_iNdx < 4); return m_vRows[_iNdx]; }
-	[[nodiscard]] HC_INLINE Vec4F& operator[](int _iNdx) { assert(_iNdx < 4); return m_vRows[_iNdx]; }
+	Vec4F m_vRow0; //X Rotation
+	Vec4F m_vRow1; //Y Rotation
+	Vec4F m_vRow2; //Z Rotation
+	Vec4F m_vRow3; //Position
+
+	HC_CONSTEXPR MatrixF() : m_vRow0(), m_vRow1(), m_vRow2(), m_vRow3() {}
+	HC_CONSTEXPR explicit MatrixF(const Vec4F& _vRow0, const Vec4F& _vRow1, const Vec4F& _vRow2, const Vec4F& _vRow3) : m_vRow0(_vRow0), m_vRow1(_vRow1), m_vRow2(_vRow2), m_vRow3(_vRow3) {}
+	HC_CONSTEXPR explicit MatrixF(float _fVal) : m_vRow0(_fVal), m_vRow1(_fVal), m_vRow2(_fVal), m_vRow3(_fVal) {}
+	[[nodiscard]] HC_INLINE Vec4F operator[](int _iNdx) const { assert(_iNdx < 4); return (&m_vRow0)[_iNdx]; }
+	[[nodiscard]] HC_INLINE Vec4F& operator[](int _iNdx) { assert(_iNdx < 4); return (&m_vRow0)[_iNdx]; }
 };
 
+static_assert(sizeof(MatrixF) == sizeof(Vec4F) * 4, "MatrixF rows must be tightly packed for operator[]");
+
+#if HC_USE_SIMD
+[[nodiscard]] HC_INLINE MatrixF Transpose(const MatrixF& _mMat) {
+	__m128 fRow0 = _mMat.m_vRow0.m_fVec, fRow1 = _mMat.m_vRow1.m_fVec, fRow2 = _mMat.m_vRow2.m_fVec, fRow3 = _mMat.m_vRow3.m_fVec;
+
+	_MM_TRANSPOSE4_PS(fRow0, fRow1, fRow2, fRow3);
+
+	return MatrixF(Vec4F(fRow0), Vec4F(fRow1), Vec4F(fRow2), Vec4F(fRow3));
+}
+#else
 [[nodiscard]] HC_INLINE MatrixF Transpose(const MatrixF& _mMat) {
 	return MatrixF(Vec4F(_mMat[0][0], _mMat[1][0], _mMat[2][0], _mMat[3][0]),
 				   Vec4F(_mMat[0][1], _mMat[1][1], _mMat[2][1], _mMat[3][1]),
 				   Vec4F(_mMat[0][2], _mMat[1][2], _mMat[2][2], _mMat[3][2]),
 				   Vec4F(_mMat[0][3], _mMat[1][3], _mMat[2][3], _mMat[3][3]));
 }
+#endif
 
 [[nodiscard]] HC_INLINE float Determinant(const MatrixF& _mMat) {
 	//Sub matrices
@@ -480,6 +58,52 @@ struct HC_ALIGNAS(64) MatrixF
 	return ((detA * detD) + (detB * detC)) - Sum(AB * DC.XZYW());
 }
 
+#if HC_USE_SIMD
+[[nodiscard]] HC_INLINE MatrixF Inverse(const MatrixF& _mMat) {
+	const __m128 fRow0 = _mMat.m_vRow0.m_fVec, fRow1 = _mMat.m_vRow1.m_fVec, fRow2 = _mMat.m_vRow2.m_fVec, fRow3 = _mMat.m_vRow3.m_fVec;
+
+	//Sub matrices
+	__m128 A = _mm_movelh_ps(fRow0, fRow1);
+	__m128 B = _mm_movehl_ps(fRow1, fRow0);
+	__m128 C = _mm_movelh_ps(fRow2, fRow3);
+	__m128 D = _mm_movehl_ps(fRow3, fRow2);
+
+	//Determinants, broadcast so they can be used directly as multipliers
+	__m128 dets = _mm_sub_ps(_mm_mul_ps(HC_SHUFFLE4F_2(fRow0, fRow2, 0, 2, 0, 2), HC_SHUFFLE4F_2(fRow1, fRow3, 1, 3, 1, 3)),
+							 _mm_mul_ps(HC_SHUFFLE4F_2(fRow0, fRow2, 1, 3, 1, 3), HC_SHUFFLE4F_2(fRow1, fRow3, 0, 2, 0, 2)));
+	__m128 detA = HC_SHUFFLE4F(dets, 0, 0, 0, 0);
+	__m128 detB = HC_SHUFFLE4F(dets, 1, 1, 1, 1);
+	__m128 detC = HC_SHUFFLE4F(dets, 2, 2, 2, 2);
+	__m128 detD = HC_SHUFFLE4F(dets, 3, 3, 3, 3);
+
+	//D adjmul C
+	__m128 DC = _mm_sub_ps(_mm_mul_ps(HC_SHUFFLE4F(D, 3, 3, 0, 0), C), _mm_mul_ps(HC_SHUFFLE4F(D, 1, 1, 2, 2), HC_SHUFFLE4F(C, 2, 3, 0, 1)));
+	//A adjmul B
+	__m128 AB = _mm_sub_ps(_mm_mul_ps(HC_SHUFFLE4F(A, 3, 3, 0, 0), B), _mm_mul_ps(HC_SHUFFLE4F(A, 1, 1, 2, 2), HC_SHUFFLE4F(B, 2, 3, 0, 1)));
+
+	//Determinant of M
+	float detM = _mm_cvtss_f32(_mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), HorizontalSumF(_mm_mul_ps(AB, HC_SHUFFLE4F(DC, 0, 2, 1, 3)))));
+
+	if (HC_FLOAT_COMPARE(detM, 0.0f)) {
+		return MatrixF();
+	}
+
+	__m128 vDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), _mm_set1_ps(detM));
+
+	//X Row
+	__m128 X = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(A, detD), _mm_add_ps(_mm_mul_ps(B, HC_SHUFFLE4F(DC, 0, 3, 0, 3)), _mm_mul_ps(HC_SHUFFLE4F(B, 1, 0, 3, 2), HC_SHUFFLE4F(DC, 2, 1, 2, 1)))), vDet);
+	//W Row
+	__m128 W = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(D, detA), _mm_add_ps(_mm_mul_ps(C, HC_SHUFFLE4F(AB, 0, 3, 0, 3)), _mm_mul_ps(HC_SHUFFLE4F(C, 1, 0, 3, 2), HC_SHUFFLE4F(AB, 2, 1, 2, 1)))), vDet);
+	//Y Row
+	__m128 Y = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(C, detB), _mm_sub_ps(_mm_mul_ps(D, HC_SHUFFLE4F(AB, 3, 0, 3, 0)), _mm_mul_ps(HC_SHUFFLE4F(D, 1, 0, 3, 2), HC_SHUFFLE4F(AB, 2, 1, 2, 1)))), vDet);
+	//Z Row
+	__m128 Z = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(B, detC), _mm_sub_ps(_mm_mul_ps(A, HC_SHUFFLE4F(DC, 3, 0, 3, 0)), _mm_mul_ps(HC_SHUFFLE4F(A, 1, 0, 3, 2), HC_SHUFFLE4F(DC, 2, 1, 2, 1)))), vDet);
+
+	//Combine calculated values above
+	return MatrixF(Vec4F(HC_SHUFFLE4F_2(X, Y, 3, 1, 3, 1)), Vec4F(HC_SHUFFLE4F_2(X, Y, 2, 0, 2, 0)),
+				   Vec4F(HC_SHUFFLE4F_2(Z, W, 3, 1, 3, 1)), Vec4F(HC_SHUFFLE4F_2(Z, W, 2, 0, 2, 0)));
+}
+#else
 [[nodiscard]] HC_INLINE MatrixF Inverse(const MatrixF& _mMat) {
 
 	//Sub matrices
@@ -521,13 +145,83 @@ struct HC_ALIGNAS(64) MatrixF
 
 	return mRet;
 }
+#endif
 
-[[nodiscard]] HC_INLINE MatrixF IdentityF() {
-	static MatrixF mMat(Vec4F(1.0f, 0.0f, 0.0f, 0.0f),
-						Vec4F(0.0f, 1.0f, 0.0f, 0.0f),
-						Vec4F(0.0f, 0.0f, 1.0f, 0.0f),
-						Vec4F(0.0f, 0.0f, 0.0f, 1.0f));
-	return mMat;
+/*
+* Affine inverses. These expect a W column of (0, 0, 0, 1), which every builder below produces. The upper 3x3 inverse is
+* the transpose of the rows _vCol0-2, and the translation is moved back through it.
+*/
+#if HC_USE_SIMD
+[[nodiscard]] HC_INLINE Vec3F AffineRowF(const Vec4F& _vRow) { return Vec3F(MaskXYZF(_vRow.m_fVec)); }
+
+[[nodiscard]] HC_INLINE MatrixF ComposeAffineInverseF(const Vec3F& _vCol0, const Vec3F& _vCol1, const Vec3F& _vCol2, const Vec3F& _vTranslation) {
+	__m128 fRow0 = _vCol0.m_fVec, fRow1 = _vCol1.m_fVec, fRow2 = _vCol2.m_fVec, fRow3 = _mm_setzero_ps();
+
+	_MM_TRANSPOSE4_PS(fRow0, fRow1, fRow2, fRow3);
+
+	fRow3 = _mm_mul_ps(HC_SHUFFLE4F(_vTranslation.m_fVec, 0, 0, 0, 0), fRow0);
+	fRow3 = _mm_add_ps(fRow3, _mm_mul_ps(HC_SHUFFLE4F(_vTranslation.m_fVec, 1, 1, 1, 1), fRow1));
+	fRow3 = _mm_add_ps(fRow3, _mm_mul_ps(HC_SHUFFLE4F(_vTranslation.m_fVec, 2, 2, 2, 2), fRow2));
+
+	return MatrixF(Vec4F(fRow0), Vec4F(fRow1), Vec4F(fRow2), Vec4F(_mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), fRow3)));
+}
+#else
+[[nodiscard]] HC_INLINE Vec3F AffineRowF(const Vec4F& _vRow) { return _vRow.XYZ(); }
+
+[[nodiscard]] HC_INLINE MatrixF ComposeAffineInverseF(const Vec3F& _vCol0, const Vec3F& _vCol1, const Vec3F& _vCol2, const Vec3F& _vTranslation) {
+	return Transpose(MatrixF(Vec4F(_vCol0, -Dot(_vTranslation, _vCol0)),
+							 Vec4F(_vCol1, -Dot(_vTranslation, _vCol1)),
+							 Vec4F(_vCol2, -Dot(_vTranslation, _vCol2)),
+							 Vec4F(0.0f, 0.0f, 0.0f, 1.0f)));
+}
+#endif
+
+/// <summary>
+/// Inverts a rotation and translation only matrix. The rotation rows must be orthonormal.
+/// </summary>
+[[nodiscard]] HC_INLINE MatrixF InverseRigid(const MatrixF& _mMat) {
+	return ComposeAffineInverseF(AffineRowF(_mMat[0]), AffineRowF(_mMat[1]), AffineRowF(_mMat[2]), AffineRowF(_mMat[3]));
+}
+
+/// <summary>
+/// Inverts a translation, rotation and scale matrix. The rotation rows must be orthogonal, but may be of any non zero length.
+/// </summary>
+[[nodiscard]] HC_INLINE MatrixF InverseTRS(const MatrixF& _mMat) {
+	Vec3F vRow0 = AffineRowF(_mMat[0]), vRow1 = AffineRowF(_mMat[1]), vRow2 = AffineRowF(_mMat[2]);
+	Vec3F vScaleSq = Vec3F(Dot(vRow0, vRow0), Dot(vRow1, vRow1), Dot(vRow2, vRow2));
+
+	//No inverse, return 0
+	if (HC_FLOAT_COMPARE(vScaleSq.x, 0.0f) || HC_FLOAT_COMPARE(vScaleSq.y, 0.0f) || HC_FLOAT_COMPARE(vScaleSq.z, 0.0f)) { return MatrixF(); }
+
+	return ComposeAffineInverseF(vRow0 / vScaleSq.x, vRow1 / vScaleSq.y, vRow2 / vScaleSq.z, AffineRowF(_mMat[3]));
+}
+
+/// <summary>
+/// Inverts any matrix with a W column of (0, 0, 0, 1), including shear and non uniform scale, through a 3x3 adjugate.
+/// </summary>
+[[nodiscard]] HC_INLINE MatrixF InverseAffine(const MatrixF& _mMat) {
+	Vec3F vRow0 = AffineRowF(_mMat[0]), vRow1 = AffineRowF(_mMat[1]), vRow2 = AffineRowF(_mMat[2]);
+
+	//Cofactors
+	Vec3F vCol0 = Cross(vRow1, vRow2);
+	Vec3F vCol1 = Cross(vRow2, vRow0);
+	Vec3F vCol2 = Cross(vRow0, vRow1);
+
+	float fDet = Dot(vRow0, vCol0);
+
+	//No inverse, return 0
+	if (HC_FLOAT_COMPARE(fDet, 0.0f)) { return MatrixF(); }
+
+	float fInvDet = 1.0f / fDet;
+
+	return ComposeAffineInverseF(vCol0 * fInvDet, vCol1 * fInvDet, vCol2 * fInvDet, AffineRowF(_mMat[3]));
+}
+
+[[nodiscard]] HC_CONSTEXPR MatrixF IdentityF() {
+	return MatrixF(Vec4F(1.0f, 0.0f, 0.0f, 0.0f),
+				   Vec4F(0.0f, 1.0f, 0.0f, 0.0f),
+				   Vec4F(0.0f, 0.0f, 1.0f, 0.0f),
+				   Vec4F(0.0f, 0.0f, 0.0f, 1.0f));
 }
 
 [[nodiscard]] HC_INLINE MatrixF ProjectionF(float _fAspectRatio, float _fFOV, float _fNearPlane, float _fFarPlane) {
@@ -580,6 +274,30 @@ struct HC_ALIGNAS(64) MatrixF
 	return MatrixF(_mRight[0] * _fLeft, _mRight[1] * _fLeft, _mRight[2] * _fLeft, _mRight[3] * _fLeft);
 }
 
+#if HC_USE_SIMD
+//Accumulates the rows of the right matrix weighted by one row of the left. Each lane adds its four products in the same order as Dot.
+HC_INLINE __m128 HC_VECTORCALL LinearCombineF(__m128 _fWeights, const MatrixF& _mRows) {
+	__m128 fRes = _mm_mul_ps(HC_SHUFFLE4F(_fWeights, 0, 0, 0, 0), _mRows.m_vRow0.m_fVec);
+	fRes = _mm_add_ps(fRes, _mm_mul_ps(HC_SHUFFLE4F(_fWeights, 1, 1, 1, 1), _mRows.m_vRow1.m_fVec));
+	fRes = _mm_add_ps(fRes, _mm_mul_ps(HC_SHUFFLE4F(_fWeights, 2, 2, 2, 2), _mRows.m_vRow2.m_fVec));
+	return _mm_add_ps(fRes, _mm_mul_ps(HC_SHUFFLE4F(_fWeights, 3, 3, 3, 3), _mRows.m_vRow3.m_fVec));
+}
+
+[[nodiscard]] HC_INLINE MatrixF operator*(const MatrixF& _mLeft, const MatrixF& _mRight) {
+	return MatrixF(Vec4F(LinearCombineF(_mLeft.m_vRow0.m_fVec, _mRight)),
+				   Vec4F(LinearCombineF(_mLeft.m_vRow1.m_fVec, _mRight)),
+				   Vec4F(LinearCombineF(_mLeft.m_vRow2.m_fVec, _mRight)),
+				   Vec4F(LinearCombineF(_mLeft.m_vRow3.m_fVec, _mRight)));
+}
+
+[[nodiscard]] HC_INLINE Vec4F operator*(const MatrixF& _mLeft, const Vec4F& _vRight) {
+	return Vec4F(LinearCombineF(_vRight.m_fVec, Transpose(_mLeft)));
+}
+
+[[nodiscard]] HC_INLINE Vec4F operator*(const Vec4F& _vLeft, const MatrixF& _mRight) {
+	return Vec4F(LinearCombineF(_vLeft.m_fVec, Transpose(_mRight)));
+}
+#else
 [[nodiscard]] HC_INLINE MatrixF operator*(const MatrixF& _mLeft, const MatrixF& _mRight) {
 	MatrixF t = Transpose(_mRight);
 
@@ -607,6 +325,7 @@ struct HC_ALIGNAS(64) MatrixF
 				 Dot(_vLeft, _mRight[2]),
 				 Dot(_vLeft, _mRight[3]));
 }
+#endif
 
 [[nodiscard]] HC_INLINE MatrixF operator/(const MatrixF& _mLeft, float _fRight) {
 	return MatrixF(_mLeft[0] / _fRight, _mLeft[1] / _fRight, _mLeft[2] / _fRight, _mLeft[3] / _fRight);
@@ -625,138 +344,130 @@ HC_INLINE MatrixF& operator/=(MatrixF& _mLeft, float _fRight) { _mLeft = _mLeft
 [[nodiscard]] HC_INLINE MatrixF operator~(const MatrixF& _mMat) { return MatrixF(); }
 [[nodiscard]] HC_INLINE MatrixF operator-(const MatrixF& _mMat) { return MatrixF(-_mMat[0], -_mMat[1], -_mMat[2], -_mMat[3]); }
 
-[[nodiscard]] HC_INLINE MatrixF RotationXDegF(float _fDeg) {
+[[nodiscard]] HC_CONSTEXPR MatrixF RotationXDegF(float _fDeg) {
 	_fDeg = HC_DEG2RAD(_fDeg);
 
-	MatrixF mMat;
-	mMat[0] = Vec4F(1.0f, 0.0f, 0.0f, 0.0f);
-	mMat[1] = Vec4F(0.0f, cosf(_fDeg), sinf(_fDeg), 0.0f);
-	mMat[2] = Vec4F(0.0f, -sinf(_fDeg), cosf(_fDeg), 0.0f);
-	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
+	float fSin = 0.0f, fCos = 0.0f;
+	ConstexprSinCosF(_fDeg, fSin, fCos);
 
-	return mMat;
+	return MatrixF(Vec4F(1.0f, 0.0f, 0.0f, 0.0f),
+				   Vec4F(0.0f, fCos, fSin, 0.0f),
+				   Vec4F(0.0f, -fSin, fCos, 0.0f),
+				   Vec4F(0.0f, 0.0f, 0.0f, 1.0f));
 }
 
-[[nodiscard]] HC_INLINE MatrixF RotationXRadF(float _fRad) {
-	MatrixF mMat;
-	mMat[0] = Vec4F(1.0f, 0.0f, 0.0f, 0.0f);
-	mMat[1] = Vec4F(0.0f, cosf(_fRad), -sinf(_fRad), 0.0f);
-	mMat[2] = Vec4F(0.0f, sinf(_fRad), cosf(_fRad), 0.0f);
-	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
+[[nodiscard]] HC_CONSTEXPR MatrixF RotationXRadF(float _fRad) {
+	float fSin = 0.0f, fCos = 0.0f;
+	ConstexprSinCosF(_fRad, fSin, fCos);
 
-	return mMat;
+	return MatrixF(Vec4F(1.0f, 0.0f, 0.0f, 0.0f),
+				   Vec4F(0.0f, fCos, -fSin, 0.0f),
+				   Vec4F(0.0f, fSin, fCos, 0.0f),
+				   Vec4F(0.0f, 0.0f, 0.0f, 1.0f));
 }
 
-[[nodiscard]] HC_INLINE MatrixF RotationYDegF(float _fDeg) {
+[[nodiscard]] HC_CONSTEXPR MatrixF RotationYDegF(float _fDeg) {
 	_fDeg = HC_DEG2RAD(_fDeg);
 
-	MatrixF mMat;
-	mMat[0] = Vec4F(cosf(_fDeg), 0.0f, sinf(_fDeg), 0.0f);
-	mMat[1] = Vec4F(0.0f, 1.0f, 0.0f, 0.0f);
-	mMat[2] = Vec4F(-sinf(_fDeg), 0.0f, cosf(_fDeg), 0.0f);
-	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
+	float fSin = 0.0f, fCos = 0.0f;
+	ConstexprSinCosF(_fDeg, fSin, fCos);
 
-	return mMat;
+	return MatrixF(Vec4F(fCos, 0.0f, fSin, 0.0f),
+				   Vec4F(0.0f, 1.0f, 0.0f, 0.0f),
+				   Vec4F(-fSin, 0.0f, fCos, 0.0f),
+				   Vec4F(0.0f, 0.0f, 0.0f, 1.0f));
 }
 
-[[nodiscard]] HC_INLINE MatrixF RotationYRadF(float _fRad) {
-	MatrixF mMat;
-	mMat[0] = Vec4F(cosf(_fRad), 0.0f, sinf(_fRad), 0.0f);
-	mMat[1] = Vec4F(0.0f, 1.0f, 0.0f, 0.0f);
-	mMat[2] = Vec4F(-sinf(_fRad), 0.0f, cosf(_fRad), 0.0f);
-	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
+[[nodiscard]] HC_CONSTEXPR MatrixF RotationYRadF(float _fRad) {
+	float fSin = 0.0f, fCos = 0.0f;
+	ConstexprSinCosF(_fRad, fSin, fCos);
 
-	return mMat;
+	return MatrixF(Vec4F(fCos, 0.0f, fSin, 0.0f),
+				   Vec4F(0.0f, 1.0f, 0.0f, 0.0f),
+				   Vec4F(-fSin, 0.0f, fCos, 0.0f),
+				   Vec4F(0.0f, 0.0f, 0.0f, 1.0f));
 }
 
-[[nodiscard]] HC_INLINE MatrixF RotationZDegF(float _fDeg) {
+[[nodiscard]] HC_CONSTEXPR MatrixF RotationZDegF(float _fDeg) {
 	_fDeg = HC_DEG2RAD(_fDeg);
 
-	MatrixF mMat;
-	mMat[0] = Vec4F(cosf(_fDeg), -sinf(_fDeg), 0.0f, 0.0f);
-	mMat[1] = Vec4F(sinf(_fDeg), cosf(_fDeg), 0.0f, 0.0f);
-	mMat[2] = Vec4F(0.0f, 0.0f, 1.0f, 0.0f);
-	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
+	float fSin = 0.0f, fCos = 0.0f;
+	ConstexprSinCosF(_fDeg, fSin, fCos);
 
-	return mMat;
+	return MatrixF(Vec4F(fCos, -fSin, 0.0f, 0.0f),
+				   Vec4F(fSin, fCos, 0.0f, 0.0f),
+				   Vec4F(0.0f, 0.0f, 1.0f, 0.0f),
+				   Vec4F(0.0f, 0.0f, 0.0f, 1.0f));
 }
 
-[[nodiscard]] HC_INLINE MatrixF RotationZRadF(float _fRad) {
-	MatrixF mMat;
-	mMat[0] = Vec4F(cosf(_fRad), -sinf(_fRad), 0.0f, 0.0f);
-	mMat[1] = Vec4F(sinf(_fRad), cosf(_fRad), 0.0f, 0.0f);
-	mMat[2] = Vec4F(0.0f, 0.0f, 1.0f, 0.0f);
-	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
+[[nodiscard]] HC_CONSTEXPR MatrixF RotationZRadF(float _fRad) {
+	float fSin = 0.0f, fCos = 0.0f;
+	ConstexprSinCosF(_fRad, fSin, fCos);
 
-	return mMat;
+	return MatrixF(Vec4F(fCos, -fSin, 0.0f, 0.0f),
+				   Vec4F(fSin, fCos, 0.0f, 0.0f),
+				   Vec4F(0.0f, 0.0f, 1.0f, 0.0f),
+				   Vec4F(0.0f, 0.0f, 0.0f, 1.0f));
 }
 
-[[nodiscard]] HC_INLINE MatrixF RotationYawPitchRollDegF(const Vec3F& _vRotation) {
-	float fYaw = HC_DEG2RAD(_vRotation.x);
-	float fPitch = HC_DEG2RAD(_vRotation.y);
-	float fRoll = HC_DEG2RAD(_vRotation.z);
+[[nodiscard]] HC_CONSTEXPR MatrixF RotationYawPitchRollDegF(const Vec3F& _vRotation) {
+	float fYaw = HC_DEG2RAD(_vRotation[0]);
+	float fPitch = HC_DEG2RAD(_vRotation[1]);
+	float fRoll = HC_DEG2RAD(_vRotation[2]);
 
-	MatrixF mMat;
-	mMat[0] = Vec4F(cosf(fYaw) * cosf(fPitch), (cosf(fYaw) * sinf(fPitch) * sinf(fRoll)) - (sinf(fYaw) * cosf(fRoll)), (cosf(fYaw) * sinf(fPitch) * cosf(fRoll)) + (sinf(fYaw) * sinf(fRoll)), 0.0f);
-	mMat[1] = Vec4F(sinf(fYaw) * cosf(fPitch), (sinf(fYaw) * sinf(fPitch) * sinf(fRoll)) + (cosf(fYaw) * cosf(fRoll)), (sinf(fYaw) * sinf(fPitch) * cosf(fRoll)) - (cosf(fYaw) * sinf(fRoll)), 0.0f);
-	mMat[2] = Vec4F(-sinf(fPitch), cosf(fPitch) * sinf(fRoll), cosf(fPitch) * cosf(fRoll), 0.0f);
-	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
+	float fSinYaw = 0.0f, fCosYaw = 0.0f, fSinPitch = 0.0f, fCosPitch = 0.0f, fSinRoll = 0.0f, fCosRoll = 0.0f;
+	ConstexprSinCosF(fYaw, fSinYaw, fCosYaw);
+	ConstexprSinCosF(fPitch, fSinPitch, fCosPitch);
+	ConstexprSinCosF(fRoll, fSinRoll, fCosRoll);
 
-	return mMat;
+	return MatrixF(Vec4F(fCosYaw * fCosPitch, (fCosYaw * fSinPitch * fSinRoll) - (fSinYaw * fCosRoll), (fCosYaw * fSinPitch * fCosRoll) + (fSinYaw * fSinRoll), 0.0f),
+				   Vec4F(fSinYaw * fCosPitch, (fSinYaw * fSinPitch * fSinRoll) + (fCosYaw * fCosRoll), (fSinYaw * fSinPitch * fCosRoll) - (fCosYaw * fSinRoll), 0.0f),
+				   Vec4F(-fSinPitch, fCosPitch * fSinRoll, fCosPitch * fCosRoll, 0.0f),
+				   Vec4F(0.0f, 0.0f, 0.0f, 1.0f));
 }
 
-[[nodiscard]] HC_INLINE MatrixF RotationYawPitchRollRadF(const Vec3F& _vRotation) {
-	float fYaw = _vRotation.x;
-	float fPitch = _vRotation.y;
-	float fRoll = _vRotation.z;
+[[nodiscard]] HC_CONSTEXPR MatrixF RotationYawPitchRollRadF(const Vec3F& _vRotation) {
+	float fYaw = _vRotation[0];
+	float fPitch = _vRotation[1];
+	float fRoll = _vRotation[2];
 
-	MatrixF mMat;
-	mMat[0] = Vec4F(cosf(fYaw) * cosf(fPitch), (cosf(fYaw) * sinf(fPitch) * sinf(fRoll)) - (sinf(fYaw) * cosf(fRoll)), (cosf(fYaw) * sinf(fPitch) * cosf(fRoll)) + (sinf(fYaw) * sinf(fRoll)), 0.0f);
-	mMat[1] = Vec4F(sinf(fYaw) * cosf(fPitch), (sinf(fYaw) * sinf(fPitch) * sinf(fRoll)) + (cosf(fYaw) * cosf(fRoll)), (sinf(fYaw) * sinf(fPitch) * cosf(fRoll)) - (cosf(fYaw) * sinf(fRoll)), 0.0f);
-	mMat[2] = Vec4F(-sinf(fPitch), cosf(fPitch) * sinf(fRoll), cosf(fPitch) * cosf(fRoll), 0.0f);
-	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
+	float fSinYaw = 0.0f, fCosYaw = 0.0f, fSinPitch = 0.0f, fCosPitch = 0.0f, fSinRoll = 0.0f, fCosRoll = 0.0f;
+	ConstexprSinCosF(fYaw, fSinYaw, fCosYaw);
+	ConstexprSinCosF(fPitch, fSinPitch, fCosPitch);
+	ConstexprSinCosF(fRoll, fSinRoll, fCosRoll);
 
-	return mMat;
+	return MatrixF(Vec4F(fCosYaw * fCosPitch, (fCosYaw * fSinPitch * fSinRoll) - (fSinYaw * fCosRoll), (fCosYaw * fSinPitch * fCosRoll) + (fSinYaw * fSinRoll), 0.0f),
+				   Vec4F(fSinYaw * fCosPitch, (fSinYaw * fSinPitch * fSinRoll) + (fCosYaw * fCosRoll), (fSinYaw * fSinPitch * fCosRoll) - (fCosYaw * fSinRoll), 0.0f),
+				   Vec4F(-fSinPitch, fCosPitch * fSinRoll, fCosPitch * fCosRoll, 0.0f),
+				   Vec4F(0.0f, 0.0f, 0.0f, 1.0f));
 }
 
-[[nodiscard]] HC_INLINE MatrixF TranslationXF(float _fDist) {
-	MatrixF mMat;
-	mMat[0] = Vec4F(1.0f, 0.0f, 0.0f, 0.0f);
-	mMat[1] = Vec4F(0.0f, 1.0f, 0.0f, 0.0f);
-	mMat[2] = Vec4F(0.0f, 0.0f, 1.0f, 0.0f);
-	mMat[3] = Vec4F(_fDist, 0.0f, 0.0f, 1.0f);
-
-	return mMat;
+[[nodiscard]] HC_CONSTEXPR MatrixF TranslationXF(float _fDist) {
+	return MatrixF(Vec4F(1.0f, 0.0f, 0.0f, 0.0f),
+				   Vec4F(0.0f, 1.0f, 0.0f, 0.0f),
+				   Vec4F(0.0f, 0.0f, 1.0f, 0.0f),
+				   Vec4F(_fDist, 0.0f, 0.0f, 1.0f));
 }
 
-[[nodiscard]] HC_INLINE MatrixF TranslationYF(float _fDist) {
-	MatrixF mMat;
-	mMat[0] = Vec4F(1.0f, 0.0f, 0.0f, 0.0f);
-	mMat[1] = Vec4F(0.0f, 1.0f, 0.0f, 0.0f);
-	mMat[2] = Vec4F(0.0f, 0.0f, 1.0f, 0.0f);
-	mMat[3] = Vec4F(0.0f, _fDist, 0.0f, 1.0f);
-
-	return mMat;
+[[nodiscard]] HC_CONSTEXPR MatrixF TranslationYF(float _fDist) {
+	return MatrixF(Vec4F(1.0f, 0.0f, 0.0f, 0.0f),
+				   Vec4F(0.0f, 1.0f, 0.0f, 0.0f),
+				   Vec4F(0.0f, 0.0f, 1.0f, 0.0f),
+				   Vec4F(0.0f, _fDist, 0.0f, 1.0f));
 }
 
-[[nodiscard]] HC_INLINE MatrixF TranslationZF(float _fDist) {
-	MatrixF mMat;
-	mMat[0] = Vec4F(1.0f, 0.0f, 0.0f, 0.0f);
-	mMat[1] = Vec4F(0.0f, 1.0f, 0.0f, 0.0f);
-	mMat[2] = Vec4F(0.0f, 0.0f, 1.0f, 0.0f);
-	mMat[3] = Vec4F(0.0f, _fDist, 0.0f, 1.0f);
-
-	return mMat;
+[[nodiscard]] HC_CONSTEXPR MatrixF TranslationZF(float _fDist) {
+	return MatrixF(Vec4F(1.0f, 0.0f, 0.0f, 0.0f),
+				   Vec4F(0.0f, 1.0f, 0.0f, 0.0f),
+				   Vec4F(0.0f, 0.0f, 1.0f, 0.0f),
+				   Vec4F(0.0f, _fDist, 0.0f, 1.0f));
 }
 
-[[nodiscard]] HC_INLINE MatrixF TranslationF(const Vec3F& _vTranslation) {
-	MatrixF mMat;
-	mMat[0] = Vec4F(1.0f, 0.0f, 0.0f, 0.0f);
-	mMat[1] = Vec4F(0.0f, 1.0f, 0.0f, 0.0f);
-	mMat[2] = Vec4F(0.0f, 0.0f, 1.0f, 0.0f);
-	mMat[3] = Vec4F(_vTranslation, 1.0f);
-
-	return mMat;
+[[nodiscard]] HC_CONSTEXPR MatrixF TranslationF(const Vec3F& _vTranslation) {
+	return MatrixF(Vec4F(1.0f, 0.0f, 0.0f, 0.0f),
+				   Vec4F(0.0f, 1.0f, 0.0f, 0.0f),
+				   Vec4F(0.0f, 0.0f, 1.0f, 0.0f),
+				   Vec4F(_vTranslation, 1.0f));
 }
 
 [[nodiscard]] HC_INLINE MatrixF RotationTranslationDegF(const Vec3F& _vRotation, const Vec3F& _vTranslation) {
@@ -773,50 +484,44 @@ HC_INLINE MatrixF& operator/=(MatrixF& _mLeft, float _fRight) { _mLeft = _mLeft
 	return mMat;
 }
 
-[[nodiscard]] HC_INLINE MatrixF ScaleXF(float _fScale) {
-	MatrixF mMat;
-	mMat[0] = Vec4F(_fScale, 0.0f, 0.0f, 0.0f);
-	mMat[1] = Vec4F(0.0f, 1.0f, 0.0f, 0.0f);
-	mMat[2] = Vec4F(0.0f, 0.0f, 1.0f, 0.0f);
-	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
-
-	return mMat;
+[[nodiscard]] HC_CONSTEXPR MatrixF ScaleXF(float _fScale) {
+	return MatrixF(Vec4F(_fScale, 0.0f, 0.0f, 0.0f),
+				   Vec4F(0.0f, 1.0f, 0.0f, 0.0f),
+				   Vec4F(0.0f, 0.0f, 1.0f, 0.0f),
+				   Vec4F(0.0f, 0.0f, 0.0f, 1.0f));
 }
 
-[[nodiscard]] HC_INLINE MatrixF ScaleYF(float _fScale) {
-	MatrixF mMat;
-	mMat[0] = Vec4F(1.0f, 0.0f, 0.0f, 0.0f);
-	mMat[1] = Vec4F(0.0f, _fScale, 0.0f, 0.0f);
-	mMat[2] = Vec4F(0.0f, 0.0f, 1.0f, 0.0f);
-	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
-
-	return mMat;
+[[nodiscard]] HC_CONSTEXPR MatrixF ScaleYF(float _fScale) {
+	return MatrixF(Vec4F(1.0f, 0.0f, 0.0f, 0.0f),
+				   Vec4F(0.0f, _fScale, 0.0f, 0.0f),
+				   Vec4F(0.0f, 0.0f, 1.0f, 0.0f),
+				   Vec4F(0.0f, 0.0f, 0.0f, 1.0f));
 }
 
-[[nodiscard]] HC_INLINE MatrixF ScaleZF(float _fScale) {
-	MatrixF mMat;
-	mMat[0] = Vec4F(1.0f, 0.0f, 0.0f, 0.0f);
-	mMat[1] = Vec4F(0.0f, 1.0f, 0.0f, 0.0f);
-	mMat[2] = Vec4F(0.0f, 0.0f, _fScale, 0.0f);
-	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
-
-	return mMat;
+[[nodiscard]] HC_CONSTEXPR MatrixF ScaleZF(float _fScale) {
+	return MatrixF(Vec4F(1.0f, 0.0f, 0.0f, 0.0f),
+				   Vec4F(0.0f, 1.0f, 0.0f, 0.0f),
+				   Vec4F(0.0f, 0.0f, _fScale, 0.0f),
+				   Vec4F(0.0f, 0.0f, 0.0f, 1.0f));
 }
 
-[[nodiscard]] HC_INLINE MatrixF ScaleXYZF(const Vec3F& _vScale) {
-	MatrixF mMat;
-	mMat[0] = Vec4F(_vScale.x, 0.0f, 0.0f, 0.0f);
-	mMat[1] = Vec4F(0.0f, _vScale.y, 0.0f, 0.0f);
-	mMat[2] = Vec4F(0.0f, 0.0f, _vScale.z, 0.0f);
-	mMat[3] = Vec4F(0.0f, 0.0f, 0.0f, 1.0f);
-
-	return mMat;
+[[nodiscard]] HC_CONSTEXPR MatrixF ScaleXYZF(const Vec3F& _vScale) {
+	return MatrixF(Vec4F(_vScale[0], 0.0f, 0.0f, 0.0f),
+				   Vec4F(0.0f, _vScale[1], 0.0f, 0.0f),
+				   Vec4F(0.0f, 0.0f, _vScale[2], 0.0f),
+				   Vec4F(0.0f, 0.0f, 0.0f, 1.0f));
 }
 
 [[nodiscard]] HC_INLINE MatrixF RotationTranslationScaleDegF(const Vec3F& _vRotation, const Vec3F& _vTranslation, const Vec3F& _vScale) {
 	MatrixF mMat = RotationYawPitchRollDegF(_vRotation);
 	mMat[3] = Vec4F(_vTranslation, 1.0f);
-	mMat *= ScaleXYZF(_vScale);
+
+	//Same result as multiplying by ScaleXYZF, without the full 4x4 product
+	Vec4F vScale = Vec4F(_vScale, 1.0f);
+	mMat[0] *= vScale;
+	mMat[1] *= vScale;
+	mMat[2] *= vScale;
+	mMat[3] *= vScale;
 
 	return mMat;
 }
@@ -824,7 +529,13 @@ HC_INLINE MatrixF& operator/=(MatrixF& _mLeft, float _fRight) { _mLeft = _mLeft
 [[nodiscard]] HC_INLINE MatrixF RotationTranslationScaleRadF(const Vec3F& _vRotation, const Vec3F& _vTranslation, const Vec3F& _vScale) {
 	MatrixF mMat = RotationYawPitchRollRadF(_vRotation);
 	mMat[3] = Vec4F(_vTranslation, 1.0f);
-	mMat *= ScaleXYZF(_vScale);
+
+	//Same result as multiplying by ScaleXYZF, without the full 4x4 product
+	Vec4F vScale = Vec4F(_vScale, 1.0f);
+	mMat[0] *= vScale;
+	mMat[1] *= vScale;
+	mMat[2] *= vScale;
+	mMat[3] *= vScale;
 
 	return mMat;
 }
@@ -853,5 +564,3 @@ HC_INLINE MatrixF& operator/=(MatrixF& _mLeft, float _fRight) { _mLeft = _mLeft
 [[nodiscard]] HC_INLINE MatrixF RotateYawPitchRollLocalRad(const Vec3F& _vRotation, const MatrixF& _mMat) { return _mMat * RotationYawPitchRollRadF(_vRotation); }
 [[nodiscard]] HC_INLINE MatrixF RotateYawPitchRollGlobalDeg(const Vec3F& _vRotation, const MatrixF& _mMat) { return RotationYawPitchRollDegF(_vRotation) * _mMat; }
 [[nodiscard]] HC_INLINE MatrixF RotateYawPitchRollGlobalRad(const Vec3F& _vRotation, const MatrixF& _mMat) { return RotationYawPitchRollRadF(_vRotation) * _mMat; }
-
-#endif
\ No newline at end of file
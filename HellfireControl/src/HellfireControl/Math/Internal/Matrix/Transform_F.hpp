@@ -0,0 +1,181 @@
+#pragma once
+
+#include <HellfireControl/Math/Internal/Matrix/Matrix_F.hpp>
+#include <HellfireControl/Util/Parallel.hpp>
+
+#include <span>
+#include <algorithm>
+
+//Spans shorter than this are always transformed on the calling thread, and each worker gets at least half this many.
+//Below it the cost of starting workers outweighs the split.
+#define HC_TRANSFORM_PARALLEL_MIN_COUNT 16384
+
+/*
+* Batched transforms follow the row vector convention the matrix builders use, with the translation held in row 3:
+*	Point:		x * Row0 + y * Row1 + z * Row2 + Row3
+*	Direction:	x * Row0 + y * Row1 + z * Row2
+* Vec4F inputs are treated as having a W of 1 (points) or 0 (directions) and keep the full four lane result, so projective
+* matrices still produce a usable clip space W. Every function accepts the same span for input and output.
+*/
+
+[[nodiscard]] HC_INLINE Vec3F TransformPoint(const MatrixF& _mMat, const Vec3F& _vPoint) {
+	return (_mMat[0] * _vPoint.x + _mMat[1] * _vPoint.y + _mMat[2] * _vPoint.z + _mMat[3]).XYZ();
+}
+
+[[nodiscard]] HC_INLINE Vec3F TransformDirection(const MatrixF& _mMat, const Vec3F& _vDirection) {
+	return (_mMat[0] * _vDirection.x + _mMat[1] * _vDirection.y + _mMat[2] * _vDirection.z).XYZ();
+}
+
+[[nodiscard]] HC_INLINE Vec4F TransformPoint(const MatrixF& _mMat, const Vec4F& _vPoint) {
+	return _mMat[0] * _vPoint.x + _mMat[1] * _vPoint.y + _mMat[2] * _vPoint.z + _mMat[3];
+}
+
+[[nodiscard]] HC_INLINE Vec4F TransformDirection(const MatrixF& _mMat, const Vec4F& _vDirection) {
+	return _mMat[0] * _vDirection.x + _mMat[1] * _vDirection.y + _mMat[2] * _vDirection.z;
+}
+
+//Vec3F and Vec4F are both padded to 16 bytes, so one kernel walks either kind of span as packed float4s.
+static_assert(sizeof(Vec3F) == 16 && sizeof(Vec4F) == 16, "Batched transforms expect 16 byte vectors");
+
+#if HC_USE_SIMD
+HC_INLINE __m128 HC_VECTORCALL TransformLanesF(__m128 _fVec, __m128 _fRow0, __m128 _fRow1, __m128 _fRow2, __m128 _fRow3) {
+	__m128 fRes = _mm_mul_ps(HC_SHUFFLE4F(_fVec, 0, 0, 0, 0), _fRow0);
+	fRes = _mm_add_ps(fRes, _mm_mul_ps(HC_SHUFFLE4F(_fVec, 1, 1, 1, 1), _fRow1));
+	fRes = _mm_add_ps(fRes, _mm_mul_ps(HC_SHUFFLE4F(_fVec, 2, 2, 2, 2), _fRow2));
+	return _mm_add_ps(fRes, _fRow3);
+}
+
+//Transforms four vectors per iteration so the independent multiply chains overlap. Each group is fully loaded before
+//any of it is stored, which keeps in place transforms safe.
+HC_INLINE void TransformBatchF(const float* _pIn, float* _pOut, size_t _sCount, __m128 _fRow0, __m128 _fRow1, __m128 _fRow2, __m128 _fRow3) {
+	size_t sNdx = 0;
+
+	for (; sNdx + 4 <= _sCount; sNdx += 4) {
+		const float* pIn = _pIn + sNdx * 4;
+		float* pOut = _pOut + sNdx * 4;
+
+		__m128 fVec0 = _mm_load_ps(pIn);
+		__m128 fVec1 = _mm_load_ps(pIn + 4);
+		__m128 fVec2 = _mm_load_ps(pIn + 8);
+		__m128 fVec3 = _mm_load_ps(pIn + 12);
+
+		_mm_store_ps(pOut, TransformLanesF(fVec0, _fRow0, _fRow1, _fRow2, _fRow3));
+		_mm_store_ps(pOut + 4, TransformLanesF(fVec1, _fRow0, _fRow1, _fRow2, _fRow3));
+		_mm_store_ps(pOut + 8, TransformLanesF(fVec2, _fRow0, _fRow1, _fRow2, _fRow3));
+		_mm_store_ps(pOut + 12, TransformLanesF(fVec3, _fRow0, _fRow1, _fRow2, _fRow3));
+	}
+
+	for (; sNdx < _sCount; ++sNdx) {
+		_mm_store_ps(_pOut + sNdx * 4, TransformLanesF(_mm_load_ps(_pIn + sNdx * 4), _fRow0, _fRow1, _fRow2, _fRow3));
+	}
+}
+
+HC_INLINE void TransformBatchF(const Vec3F* _pIn, Vec3F* _pOut, size_t _sCount, const MatrixF& _mMat, bool _bTranslate) {
+	//Masking the rows keeps the padding lane of every Vec3F at zero without a per vector mask.
+	TransformBatchF(reinterpret_cast<const float*>(_pIn), reinterpret_cast<float*>(_pOut), _sCount,
+					MaskXYZF(_mMat.m_vRow0.m_fVec), MaskXYZF(_mMat.m_vRow1.m_fVec), MaskXYZF(_mMat.m_vRow2.m_fVec),
+					_bTranslate ? MaskXYZF(_mMat.m_vRow3.m_fVec) : _mm_setzero_ps());
+}
+
+HC_INLINE void TransformBatchF(const Vec4F* _pIn, Vec4F* _pOut, size_t _sCount, const MatrixF& _mMat, bool _bTranslate) {
+	TransformBatchF(reinterpret_cast<const float*>(_pIn), reinterpret_cast<float*>(_pOut), _sCount,
+					_mMat.m_vRow0.m_fVec, _mMat.m_vRow1.m_fVec, _mMat.m_vRow2.m_fVec,
+					_bTranslate ? _mMat.m_vRow3.m_fVec : _mm_setzero_ps());
+}
+#else
+HC_INLINE void TransformBatchF(const Vec3F* _pIn, Vec3F* _pOut, size_t _sCount, const MatrixF& _mMat, bool _bTranslate) {
+	const Vec4F vRow3 = _bTranslate ? _mMat[3] : Vec4F();
+
+	for (size_t sNdx = 0; sNdx < _sCount; ++sNdx) {
+		const Vec3F vIn = _pIn[sNdx];
+		_pOut[sNdx] = (_mMat[0] * vIn.x + _mMat[1] * vIn.y + _mMat[2] * vIn.z + vRow3).XYZ();
+	}
+}
+
+HC_INLINE void TransformBatchF(const Vec4F* _pIn, Vec4F* _pOut, size_t _sCount, const MatrixF& _mMat, bool _bTranslate) {
+	const Vec4F vRow3 = _bTranslate ? _mMat[3] : Vec4F();
+
+	for (size_t sNdx = 0; sNdx < _sCount; ++sNdx) {
+		const Vec4F vIn = _pIn[sNdx];
+		_pOut[sNdx] = _mMat[0] * vIn.x + _mMat[1] * vIn.y + _mMat[2] * vIn.z + vRow3;
+	}
+}
+#endif
+
+/// <summary>
+/// Transforms every point in _vIn by _mMat, translation included, and writes the results to _vOut.
+/// </summary>
+/// <param name="_mMat: Transform to apply"></param>
+/// <param name="_vIn: Points to transform"></param>
+/// <param name="_vOut: Destination. Must be at least as long as _vIn and may be the same span"></param>
+HC_INLINE void TransformPoints(const MatrixF& _mMat, std::span<const Vec3F> _vIn, std::span<Vec3F> _vOut) {
+	assert(_vOut.size() >= _vIn.size());
+	TransformBatchF(_vIn.data(), _vOut.data(), _vIn.size(), _mMat, true);
+}
+
+HC_INLINE void TransformPoints(const MatrixF& _mMat, std::span<const Vec4F> _vIn, std::span<Vec4F> _vOut) {
+	assert(_vOut.size() >= _vIn.size());
+	TransformBatchF(_vIn.data(), _vOut.data(), _vIn.size(), _mMat, true);
+}
+
+HC_INLINE void TransformPoints(const MatrixF& _mMat, std::span<Vec3F> _vPoints) { TransformBatchF(_vPoints.data(), _vPoints.data(), _vPoints.size(), _mMat, true); }
+HC_INLINE void TransformPoints(const MatrixF& _mMat, std::span<Vec4F> _vPoints) { TransformBatchF(_vPoints.data(), _vPoints.data(), _vPoints.size(), _mMat, true); }
+
+/// <summary>
+/// Transforms every direction in _vIn by _mMat, ignoring translation, and writes the results to _vOut.
+/// </summary>
+/// <param name="_mMat: Transform to apply"></param>
+/// <param name="_vIn: Directions to transform"></param>
+/// <param name="_vOut: Destination. Must be at least as long as _vIn and may be the same span"></param>
+HC_INLINE void TransformDirections(const MatrixF& _mMat, std::span<const Vec3F> _vIn, std::span<Vec3F> _vOut) {
+	assert(_vOut.size() >= _vIn.size());
+	TransformBatchF(_vIn.data(), _vOut.data(), _vIn.size(), _mMat, false);
+}
+
+HC_INLINE void TransformDirections(const MatrixF& _mMat, std::span<const Vec4F> _vIn, std::span<Vec4F> _vOut) {
+	assert(_vOut.size() >= _vIn.size());
+	TransformBatchF(_vIn.data(), _vOut.data(), _vIn.size(), _mMat, false);
+}
+
+HC_INLINE void TransformDirections(const MatrixF& _mMat, std::span<Vec3F> _vDirections) { TransformBatchF(_vDirections.data(), _vDirections.data(), _vDirections.size(), _mMat, false); }
+HC_INLINE void TransformDirections(const MatrixF& _mMat, std::span<Vec4F> _vDirections) { TransformBatchF(_vDirections.data(), _vDirections.data(), _vDirections.size(), _mMat, false); }
+
+/// <summary>
+/// Multithreaded TransformPoints for very large spans. Spans under HC_TRANSFORM_PARALLEL_MIN_COUNT run on the calling thread.
+/// </summary>
+/// <param name="_mMat: Transform to apply"></param>
+/// <param name="_vIn: Points to transform"></param>
+/// <param name="_vOut: Destination. Must be at least as long as _vIn and may be the same span"></param>
+/// <param name="_uThreadCount: Number of threads to use. 0 uses one per hardware thread"></param>
+HC_INLINE void TransformPointsParallel(const MatrixF& _mMat, std::span<const Vec3F> _vIn, std::span<Vec3F> _vOut, uint32_t _uThreadCount = 0) {
+	assert(_vOut.size() >= _vIn.size());
+	Util::ParallelFor(_vIn.size(), _uThreadCount, HC_TRANSFORM_PARALLEL_MIN_COUNT / 2, 4, [&](size_t _sFirst, size_t _sLast) { TransformBatchF(_vIn.data() + _sFirst, _vOut.data() + _sFirst, _sLast - _sFirst, _mMat, true); });
+}
+
+HC_INLINE void TransformPointsParallel(const MatrixF& _mMat, std::span<const Vec4F> _vIn, std::span<Vec4F> _vOut, uint32_t _uThreadCount = 0) {
+	assert(_vOut.size() >= _vIn.size());
+	Util::ParallelFor(_vIn.size(), _uThreadCount, HC_TRANSFORM_PARALLEL_MIN_COUNT / 2, 4, [&](size_t _sFirst, size_t _sLast) { TransformBatchF(_vIn.data() + _sFirst, _vOut.data() + _sFirst, _sLast - _sFirst, _mMat, true); });
+}
+
+HC_INLINE void TransformPointsParallel(const MatrixF& _mMat, std::span<Vec3F> _vPoints, uint32_t _uThreadCount = 0) { TransformPointsParallel(_mMat, std::span<const Vec3F>(_vPoints), _vPoints, _uThreadCount); }
+HC_INLINE void TransformPointsParallel(const MatrixF& _mMat, std::span<Vec4F> _vPoints, uint32_t _uThreadCount = 0) { TransformPointsParallel(_mMat, std::span<const Vec4F>(_vPoints), _vPoints, _uThreadCount); }
+
+/// <summary>
+/// Multithreaded TransformDirections for very large spans. Spans under HC_TRANSFORM_PARALLEL_MIN_COUNT run on the calling thread.
+/// </summary>
+/// <param name="_mMat: Transform to apply"></param>
+/// <param name="_vIn: Directions to transform"></param>
+/// <param name="_vOut: Destination. Must be at least as long as _vIn and may be the same span"></param>
+/// <param name="_uThreadCount: Number of threads to use. 0 uses one per hardware thread"></param>
+HC_INLINE void TransformDirectionsParallel(const MatrixF& _mMat, std::span<const Vec3F> _vIn, std::span<Vec3F> _vOut, uint32_t _uThreadCount = 0) {
+	assert(_vOut.size() >= _vIn.size());
+	Util::ParallelFor(_vIn.size(), _uThreadCount, HC_TRANSFORM_PARALLEL_MIN_COUNT / 2, 4, [&](size_t _sFirst, size_t _sLast) { TransformBatchF(_vIn.data() + _sFirst, _vOut.data() + _sFirst, _sLast - _sFirst, _mMat, false); });
+}
+
+HC_INLINE void TransformDirectionsParallel(const MatrixF& _mMat, std::span<const Vec4F> _vIn, std::span<Vec4F> _vOut, uint32_t _uThreadCount = 0) {
+	assert(_vOut.size() >= _vIn.size());
+	Util::ParallelFor(_vIn.size(), _uThreadCount, HC_TRANSFORM_PARALLEL_MIN_COUNT / 2, 4, [&](size_t _sFirst, size_t _sLast) { TransformBatchF(_vIn.data() + _sFirst, _vOut.data() + _sFirst, _sLast - _sFirst, _mMat, false); });
+}
+
+HC_INLINE void TransformDirectionsParallel(const MatrixF& _mMat, std::span<Vec3F> _vDirections, uint32_t _uThreadCount = 0) { TransformDirectionsParallel(_mMat, std::span<const Vec3F>(_vDirections), _vDirections, _uThreadCount); }
+HC_INLINE void TransformDirectionsParallel(const MatrixF& _mMat, std::span<Vec4F> _vDirections, uint32_t _uThreadCount = 0) { TransformDirectionsParallel(_mMat, std::span<const Vec4F>(_vDirections), _vDirections, _uThreadCount); }
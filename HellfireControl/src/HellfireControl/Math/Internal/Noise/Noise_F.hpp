@@ -0,0 +1,418 @@
+#pragma once
+
+#include <HellfireControl/Math/Internal/Wide/Wide_Fx4.hpp>
+#include <HellfireControl/Math/Random.hpp>
+#include <HellfireControl/Util/Parallel.hpp>
+
+#include <span>
+#include <vector>
+
+/*
+* Lattice noise evaluated four positions at a time. Every kernel is written once over Floatx4/Uintx4 and is generic in the
+* number of dimensions, so 2D, 3D and 4D share one implementation. Lattice points are hashed rather than looked up in a
+* permutation table, which keeps SSE2 free of gathers and makes the seed a plain integer. A single sample runs through the
+* same kernel as a batch, so both give identical results. Positions must stay within +/-2^31 on every axis.
+*/
+
+enum NoiseType : uint8_t {
+	NOISE_VALUE = 0U,		//Interpolated random values at the lattice points. Cheapest, visibly blocky
+	NOISE_PERLIN = 1U,		//Interpolated random gradients on the square lattice
+	NOISE_SIMPLEX = 2U		//Random gradients on the simplex lattice. Fewer corners and fewer axis aligned artifacts than Perlin
+};
+
+enum NoiseFractal : uint8_t {
+	FRACTAL_NONE = 0U,		//A single octave
+	FRACTAL_FBM = 1U,		//Octaves summed with falling amplitude
+	FRACTAL_RIDGED = 2U		//Octaves folded around zero into sharp crests, for mountain ranges and veins
+};
+
+#define HC_NOISE_PRIME_X 501125321U
+#define HC_NOISE_PRIME_Y 1136930381U
+#define HC_NOISE_PRIME_Z 1720413743U
+#define HC_NOISE_PRIME_W 1066037191U
+#define HC_NOISE_OCTAVE_STEP 0x9E3779B9U	//Added to the seed per octave so octaves are uncorrelated
+
+//Bring the gradient noises to just inside [-1, 1]. Measured from the extremes of millions of samples per kernel, with a
+//clamp behind them for the rare position that beats the measurement.
+#define HC_NOISE_PERLIN_SCALE_2D 1.18f
+#define HC_NOISE_PERLIN_SCALE_3D 1.17f
+#define HC_NOISE_PERLIN_SCALE_4D 1.08f
+#define HC_NOISE_SIMPLEX_SCALE_2D 71.0f
+#define HC_NOISE_SIMPLEX_SCALE_3D 63.0f
+#define HC_NOISE_SIMPLEX_SCALE_4D 60.0f
+
+#define HC_NOISE_PARALLEL_MIN 16384	//Below this many samples a grid fill stays on the calling thread
+
+#pragma region Kernels
+HC_CONSTEXPR uint32_t NOISE_PRIMES[4] = { HC_NOISE_PRIME_X, HC_NOISE_PRIME_Y, HC_NOISE_PRIME_Z, HC_NOISE_PRIME_W };
+
+//lowbias32 by Chris Wellons: two multiplies and three shifts, enough to decorrelate neighboring lattice points
+[[nodiscard]] HC_INLINE Uintx4 NoiseHashF(Uintx4 _uVal) {
+	_uVal = _uVal ^ (_uVal >> 16);
+	_uVal = _uVal * 0x7FEB352DU;
+	_uVal = _uVal ^ (_uVal >> 15);
+	_uVal = _uVal * 0x846CA68BU;
+	return _uVal ^ (_uVal >> 16);
+}
+
+//Component _iAxis of the gradient picked by _uHash. Each axis takes its own byte, so the gradients fill the cube [-1, 1]^Dims.
+[[nodiscard]] HC_INLINE Floatx4 NoiseGradientF(const Uintx4& _uHash, int _iAxis) {
+	return ToFloatx4((_uHash >> (_iAxis * 8)) & 0xFFU) * (2.0f / 255.0f) - Floatx4(1.0f);
+}
+
+//6t^5 - 15t^4 + 10t^3, so the interpolation is continuous in its first and second derivatives
+[[nodiscard]] HC_INLINE Floatx4 NoiseFadeF(const Floatx4& _fVal) {
+	return _fVal * _fVal * _fVal * (_fVal * (_fVal * 6.0f - Floatx4(15.0f)) + Floatx4(10.0f));
+}
+
+//Value and Perlin noise: hash the 2^Dims corners of the cell, then blend them one axis at a time
+template<int Dims, bool Gradient>
+[[nodiscard]] HC_INLINE Floatx4 LatticeNoiseF(const Floatx4* _pPos, uint32_t _uSeed) {
+	constexpr int iCorners = 1 << Dims;
+	Floatx4 fFrac[Dims], fFade[Dims], fCorners[iCorners];
+	Uintx4 uCell[Dims];
+
+	for (int iAxis = 0; iAxis < Dims; ++iAxis) {
+		const Floatx4 fCell = Floor(_pPos[iAxis]);
+		fFrac[iAxis] = _pPos[iAxis] - fCell;
+		fFade[iAxis] = NoiseFadeF(fFrac[iAxis]);
+		uCell[iAxis] = ToUintx4(fCell) * NOISE_PRIMES[iAxis];
+	}
+
+	for (int iCorner = 0; iCorner < iCorners; ++iCorner) {
+		Uintx4 uHash = Uintx4(_uSeed);
+
+		for (int iAxis = 0; iAxis < Dims; ++iAxis) { uHash += (iCorner >> iAxis) & 1 ? uCell[iAxis] + NOISE_PRIMES[iAxis] : uCell[iAxis]; }
+
+		uHash = NoiseHashF(uHash);
+
+		if constexpr (Gradient) {
+			Floatx4 fDot;
+			for (int iAxis = 0; iAxis < Dims; ++iAxis) {
+				fDot += NoiseGradientF(uHash, iAxis) * ((iCorner >> iAxis) & 1 ? fFrac[iAxis] - Floatx4(1.0f) : fFrac[iAxis]);
+			}
+			fCorners[iCorner] = fDot;
+		}
+		else {
+			fCorners[iCorner] = ToFloatx4(uHash >> 8) * (1.0f / 8388608.0f) - Floatx4(1.0f);
+		}
+	}
+
+	//Corners differing only in bit iAxis sit next to each other after the previous passes, so each pass halves the list
+	for (int iAxis = 0, iCount = iCorners; iAxis < Dims; ++iAxis) {
+		iCount /= 2;
+		for (int iCorner = 0; iCorner < iCount; ++iCorner) {
+			fCorners[iCorner] = fCorners[iCorner * 2] + (fCorners[iCorner * 2 + 1] - fCorners[iCorner * 2]) * fFade[iAxis];
+		}
+	}
+
+	if constexpr (Gradient) {
+		constexpr float fScale = Dims == 2 ? HC_NOISE_PERLIN_SCALE_2D : (Dims == 3 ? HC_NOISE_PERLIN_SCALE_3D : HC_NOISE_PERLIN_SCALE_4D);
+		return Min(Max(fCorners[0] * fScale, Floatx4(-1.0f)), Floatx4(1.0f));
+	}
+	else {
+		return fCorners[0];
+	}
+}
+
+//Simplex noise in any dimension: skew into the simplex lattice, order the offsets to find which of the Dims! simplices holds
+//the point, then sum a radial falloff around each of its Dims + 1 corners
+template<int Dims>
+[[nodiscard]] HC_INLINE Floatx4 SimplexNoiseF(const Floatx4* _pPos, uint32_t _uSeed) {
+	//(sqrt(n + 1) - 1) / n and (1 - 1 / sqrt(n + 1)) / n
+	constexpr float fSkew = Dims == 2 ? 0.366025403784f : (Dims == 3 ? 1.0f / 3.0f : 0.309016994375f);
+	constexpr float fUnskew = Dims == 2 ? 0.211324865405f : (Dims == 3 ? 1.0f / 6.0f : 0.138196601125f);
+	constexpr float fScale = Dims == 2 ? HC_NOISE_SIMPLEX_SCALE_2D : (Dims == 3 ? HC_NOISE_SIMPLEX_SCALE_3D : HC_NOISE_SIMPLEX_SCALE_4D);
+
+	Floatx4 fSum;
+	for (int iAxis = 0; iAxis < Dims; ++iAxis) { fSum += _pPos[iAxis]; }
+
+	const Floatx4 fSkewed = fSum * fSkew;
+	Floatx4 fCell[Dims], fOffset[Dims], fCellSum;
+	Uintx4 uCell[Dims], uRank[Dims];
+
+	for (int iAxis = 0; iAxis < Dims; ++iAxis) {
+		fCell[iAxis] = Floor(_pPos[iAxis] + fSkewed);
+		fCellSum += fCell[iAxis];
+		uCell[iAxis] = ToUintx4(fCell[iAxis]) * NOISE_PRIMES[iAxis];
+	}
+
+	const Floatx4 fUnskewed = fCellSum * fUnskew;
+	for (int iAxis = 0; iAxis < Dims; ++iAxis) { fOffset[iAxis] = _pPos[iAxis] - (fCell[iAxis] - fUnskewed); }
+
+	//Rank each axis by how many others it beats. Ties go to the later axis so the ranks always form a permutation.
+	for (int iLeft = 0; iLeft < Dims; ++iLeft) {
+		for (int iRight = iLeft + 1; iRight < Dims; ++iRight) {
+			const Uintx4 uLeftWins = MaskGreater(fOffset[iLeft], fOffset[iRight]) & 1U;
+			uRank[iLeft] += uLeftWins;
+			uRank[iRight] += Uintx4(1U) - uLeftWins;
+		}
+	}
+
+	Floatx4 fRes;
+
+	for (int iCorner = 0; iCorner <= Dims; ++iCorner) {
+		Uintx4 uHash = Uintx4(_uSeed);
+		Floatx4 fCorner[Dims], fDistance;
+
+		//Corner k steps along the k highest ranked axes
+		for (int iAxis = 0; iAxis < Dims; ++iAxis) {
+			const Uintx4 uStep = MaskGreater(uRank[iAxis], Uintx4(static_cast<uint32_t>(Dims - 1 - iCorner)));
+			fCorner[iAxis] = fOffset[iAxis] - Select(uStep, Floatx4(1.0f), Floatx4()) + Floatx4(fUnskew * iCorner);
+			uHash += uCell[iAxis] + (uStep & NOISE_PRIMES[iAxis]);
+			fDistance += fCorner[iAxis] * fCorner[iAxis];
+		}
+
+		uHash = NoiseHashF(uHash);
+
+		Floatx4 fDot;
+		for (int iAxis = 0; iAxis < Dims; ++iAxis) { fDot += NoiseGradientF(uHash, iAxis) * fCorner[iAxis]; }
+
+		//A falloff radius of 0.5 keeps each corner's reach inside its neighboring simplices, so there are no seams
+		Floatx4 fFalloff = Max(Floatx4(0.5f) - fDistance, Floatx4());
+		fFalloff = fFalloff * fFalloff;
+		fRes += fFalloff * fFalloff * fDot;
+	}
+
+	return Min(Max(fRes * fScale, Floatx4(-1.0f)), Floatx4(1.0f));
+}
+
+template<int Dims>
+[[nodiscard]] HC_INLINE Floatx4 NoiseBasisF(NoiseType _ntType, const Floatx4* _pPos, uint32_t _uSeed) {
+	switch (_ntType) {
+	case NOISE_VALUE:
+		return LatticeNoiseF<Dims, false>(_pPos, _uSeed);
+	case NOISE_PERLIN:
+		return LatticeNoiseF<Dims, true>(_pPos, _uSeed);
+	default:
+		return SimplexNoiseF<Dims>(_pPos, _uSeed);
+	}
+}
+#pragma endregion
+
+/// <summary>
+/// A seeded noise field of one type, optionally layered into octaves. Samples come back in [-1, 1].
+/// </summary>
+class Noise {
+private:
+	/// <summary>
+	/// Seed of the first octave
+	/// </summary>
+	uint32_t m_uSeed;
+
+	/// <summary>
+	/// The basis function every octave uses
+	/// </summary>
+	NoiseType m_ntType;
+
+	/// <summary>
+	/// How octaves are combined
+	/// </summary>
+	NoiseFractal m_nfFractal = FRACTAL_NONE;
+
+	/// <summary>
+	/// Number of octaves. Ignored by FRACTAL_NONE
+	/// </summary>
+	int m_iOctaves = 1;
+
+	/// <summary>
+	/// Frequency of the first octave. Positions are multiplied by this before sampling
+	/// </summary>
+	float m_fFrequency = 1.0f;
+
+	/// <summary>
+	/// Frequency multiplier between octaves
+	/// </summary>
+	float m_fLacunarity = 2.0f;
+
+	/// <summary>
+	/// Amplitude multiplier between octaves
+	/// </summary>
+	float m_fGain = 0.5f;
+
+public:
+	/// <summary>
+	/// Creates a field with the given seed.
+	/// </summary>
+	/// <param name="_uSeed: Seed of the field. Equal seeds give equal fields"></param>
+	/// <param name="_ntType: Basis function"></param>
+	HC_INLINE explicit Noise(uint32_t _uSeed, NoiseType _ntType = NOISE_SIMPLEX) : m_uSeed(_uSeed), m_ntType(_ntType) {}
+
+	/// <summary>
+	/// Creates a field seeded from _rRandom, so seeding one Random reproduces every field built from it.
+	/// </summary>
+	/// <param name="_rRandom: Generator to draw the seed from"></param>
+	/// <param name="_ntType: Basis function"></param>
+	HC_INLINE explicit Noise(Random& _rRandom, NoiseType _ntType = NOISE_SIMPLEX) : m_uSeed(_rRandom.GenerateUnsignedInt()), m_ntType(_ntType) {}
+
+	/// <summary>
+	/// Layers the field into octaves.
+	/// </summary>
+	/// <param name="_nfFractal: How octaves are combined"></param>
+	/// <param name="_iOctaves: Number of octaves"></param>
+	/// <param name="_fLacunarity: Frequency multiplier between octaves"></param>
+	/// <param name="_fGain: Amplitude multiplier between octaves"></param>
+	HC_INLINE void SetFractal(NoiseFractal _nfFractal, int _iOctaves = 5, float _fLacunarity = 2.0f, float _fGain = 0.5f) {
+		assert(_iOctaves > 0);
+
+		m_nfFractal = _nfFractal;
+		m_iOctaves = _iOctaves;
+		m_fLacunarity = _fLacunarity;
+		m_fGain = _fGain;
+	}
+
+	/// <summary>
+	/// Sets the frequency of the first octave. Features are roughly 1 / _fFrequency apart.
+	/// </summary>
+	HC_INLINE void SetFrequency(float _fFrequency) { m_fFrequency = _fFrequency; }
+
+	[[nodiscard]] HC_INLINE uint32_t GetSeed() const { return m_uSeed; }
+
+	[[nodiscard]] HC_INLINE NoiseType GetType() const { return m_ntType; }
+
+	/// <summary>
+	/// Samples the field at one position.
+	/// </summary>
+	[[nodiscard]] HC_INLINE float Sample(const Vec2F& _vPos) const { return SampleOne<2>(_vPos); }
+	[[nodiscard]] HC_INLINE float Sample(const Vec3F& _vPos) const { return SampleOne<3>(_vPos); }
+	[[nodiscard]] HC_INLINE float Sample(const Vec4F& _vPos) const { return SampleOne<4>(_vPos); }
+
+	/// <summary>
+	/// Samples the field at every position in _vPos, four at a time.
+	/// </summary>
+	/// <param name="_vPos: Positions to sample"></param>
+	/// <param name="_fOut: Receives one sample per position"></param>
+	HC_INLINE void Sample(std::span<const Vec2F> _vPos, std::span<float> _fOut) const { SampleBatch<2>(_vPos, _fOut); }
+	HC_INLINE void Sample(std::span<const Vec3F> _vPos, std::span<float> _fOut) const { SampleBatch<3>(_vPos, _fOut); }
+	HC_INLINE void Sample(std::span<const Vec4F> _vPos, std::span<float> _fOut) const { SampleBatch<4>(_vPos, _fOut); }
+
+	/// <summary>
+	/// Fills a row-major _uWidth x _uHeight grid of samples taken _vStep apart from _vOrigin, split by rows across threads.
+	/// </summary>
+	/// <param name="_fOut: Receives the grid. At least _uWidth * _uHeight floats"></param>
+	/// <param name="_uWidth: Samples per row"></param>
+	/// <param name="_uHeight: Number of rows"></param>
+	/// <param name="_vOrigin: Position of the first sample"></param>
+	/// <param name="_vStep: Distance between neighboring samples on each axis"></param>
+	/// <param name="_uThreads: Worker count. 0 uses every hardware thread"></param>
+	HC_INLINE void FillGrid(std::span<float> _fOut, uint32_t _uWidth, uint32_t _uHeight, const Vec2F& _vOrigin, const Vec2F& _vStep, uint32_t _uThreads = 0U) const {
+		assert(_fOut.size() >= static_cast<size_t>(_uWidth) * _uHeight);
+
+		ParallelRows(_uHeight, _uWidth, _uThreads, [&](uint32_t _uRow) {
+			FillRow<2>(_fOut.data() + static_cast<size_t>(_uRow) * _uWidth, _uWidth, { _vOrigin.x, _vOrigin.y + _vStep.y * _uRow }, _vStep.x);
+		});
+	}
+
+	/// <summary>
+	/// Fills a _uWidth x _uHeight x _uDepth volume, x fastest then y then z, split by rows across threads.
+	/// </summary>
+	/// <param name="_fOut: Receives the volume. At least _uWidth * _uHeight * _uDepth floats"></param>
+	/// <param name="_uWidth: Samples per row"></param>
+	/// <param name="_uHeight: Rows per slice"></param>
+	/// <param name="_uDepth: Number of slices"></param>
+	/// <param name="_vOrigin: Position of the first sample"></param>
+	/// <param name="_vStep: Distance between neighboring samples on each axis"></param>
+	/// <param name="_uThreads: Worker count. 0 uses every hardware thread"></param>
+	HC_INLINE void FillGrid(std::span<float> _fOut, uint32_t _uWidth, uint32_t _uHeight, uint32_t _uDepth, const Vec3F& _vOrigin, const Vec3F& _vStep, uint32_t _uThreads = 0U) const {
+		assert(_fOut.size() >= static_cast<size_t>(_uWidth) * _uHeight * _uDepth);
+
+		ParallelRows(_uHeight * _uDepth, _uWidth, _uThreads, [&](uint32_t _uRow) {
+			const float fY = _vOrigin.y + _vStep.y * (_uRow % _uHeight), fZ = _vOrigin.z + _vStep.z * (_uRow / _uHeight);
+			FillRow<3>(_fOut.data() + static_cast<size_t>(_uRow) * _uWidth, _uWidth, { _vOrigin.x, fY, fZ }, _vStep.x);
+		});
+	}
+
+private:
+	/// <summary>
+	/// Evaluates the whole octave stack for four positions.
+	/// </summary>
+	template<int Dims>
+	[[nodiscard]] HC_INLINE Floatx4 Evaluate(const Floatx4* _pPos) const {
+		Floatx4 fPos[Dims];
+		for (int iAxis = 0; iAxis < Dims; ++iAxis) { fPos[iAxis] = _pPos[iAxis] * m_fFrequency; }
+
+		if (m_nfFractal == FRACTAL_NONE) { return NoiseBasisF<Dims>(m_ntType, fPos, m_uSeed); }
+
+		Floatx4 fSum;
+		float fAmplitude = 1.0f, fTotal = 0.0f;
+		uint32_t uSeed = m_uSeed;
+
+		for (int iOctave = 0; iOctave < m_iOctaves; ++iOctave) {
+			Floatx4 fOctave = NoiseBasisF<Dims>(m_ntType, fPos, uSeed);
+
+			//Folding at zero turns every zero crossing into a crest, and squaring sharpens it
+			if (m_nfFractal == FRACTAL_RIDGED) {
+				fOctave = Floatx4(1.0f) - Abs(fOctave);
+				fOctave = fOctave * fOctave * 2.0f - Floatx4(1.0f);
+			}
+
+			fSum += fOctave * fAmplitude;
+			fTotal += fAmplitude;
+			fAmplitude *= m_fGain;
+			uSeed += HC_NOISE_OCTAVE_STEP;
+
+			for (int iAxis = 0; iAxis < Dims; ++iAxis) { fPos[iAxis] = fPos[iAxis] * m_fLacunarity; }
+		}
+
+		return fSum * (1.0f / fTotal);
+	}
+
+	template<int Dims, typename Vec>
+	[[nodiscard]] HC_INLINE float SampleOne(const Vec& _vPos) const {
+		Floatx4 fPos[Dims];
+		for (int iAxis = 0; iAxis < Dims; ++iAxis) { fPos[iAxis] = Floatx4(_vPos[iAxis]); }
+
+		return Evaluate<Dims>(fPos)[0];
+	}
+
+	template<int Dims, typename Vec>
+	HC_INLINE void SampleBatch(std::span<const Vec> _vPos, std::span<float> _fOut) const {
+		assert(_fOut.size() >= _vPos.size());
+
+		for (size_t sFirst = 0; sFirst < _vPos.size(); sFirst += Floatx4::LANES) {
+			const int iCount = static_cast<int>(std::min<size_t>(Floatx4::LANES, _vPos.size() - sFirst));
+			Floatx4 fPos[Dims];
+
+			//Short groups repeat their last position so every lane holds a real sample
+			for (int iLane = 0; iLane < Floatx4::LANES; ++iLane) {
+				const Vec& vPos = _vPos[sFirst + std::min(iLane, iCount - 1)];
+				for (int iAxis = 0; iAxis < Dims; ++iAxis) { fPos[iAxis][iLane] = vPos[iAxis]; }
+			}
+
+			const Floatx4 fRes = Evaluate<Dims>(fPos);
+			for (int iLane = 0; iLane < iCount; ++iLane) { _fOut[sFirst + iLane] = fRes[iLane]; }
+		}
+	}
+
+	/// <summary>
+	/// Fills one row of a grid. Only x changes along a row, so the other axes are broadcast once.
+	/// </summary>
+	template<int Dims>
+	HC_INLINE void FillRow(float* _pOut, uint32_t _uWidth, const std::array<float, Dims>& _fStart, float _fStepX) const {
+		Floatx4 fPos[Dims];
+		for (int iAxis = 1; iAxis < Dims; ++iAxis) { fPos[iAxis] = Floatx4(_fStart[iAxis]); }
+
+		const Floatx4 fLanes = Floatx4(0.0f, 1.0f, 2.0f, 3.0f);
+
+		for (uint32_t uCol = 0; uCol < _uWidth; uCol += Floatx4::LANES) {
+			fPos[0] = Floatx4(_fStart[0]) + (fLanes + Floatx4(static_cast<float>(uCol))) * _fStepX;
+
+			const Floatx4 fRes = Evaluate<Dims>(fPos);
+			const uint32_t uCount = std::min<uint32_t>(Floatx4::LANES, _uWidth - uCol);
+			for (uint32_t uLane = 0; uLane < uCount; ++uLane) { _pOut[uCol + uLane] = fRes[static_cast<int>(uLane)]; }
+		}
+	}
+
+	/// <summary>
+	/// Runs _fnRow over every row, in contiguous bands of rows per thread. Each thread gets at least half of HC_NOISE_PARALLEL_MIN
+	/// samples, so small grids stay on the calling thread.
+	/// </summary>
+	template<typename Func>
+	static void ParallelRows(uint32_t _uRows, uint32_t _uWidth, uint32_t _uThreads, Func _fnRow) {
+		const size_t sMinRows = (HC_NOISE_PARALLEL_MIN / 2 + std::max(_uWidth, 1U) - 1) / std::max(_uWidth, 1U);
+
+		Util::ParallelFor(_uRows, _uThreads, sMinRows, 1, [&](size_t _sFirst, size_t _sLast) {
+			for (size_t sRow = _sFirst; sRow < _sLast; ++sRow) { _fnRow(static_cast<uint32_t>(sRow)); }
+		});
+	}
+};
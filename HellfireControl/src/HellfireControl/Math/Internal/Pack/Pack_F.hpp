@@ -0,0 +1,501 @@
+#pragma once
+
+#include <HellfireControl/Math/Internal/Wide/Wide_Fx4.hpp>
+
+#include <bit>
+#include <cstring>
+#include <span>
+
+/*
+* Compressed formats for vertex streams and replicated state:
+*	Half:			IEEE 754 binary16, rounded to nearest even. Out of range values become infinity and NaNs stay NaN.
+*	Snorm/Unorm:	[-1, 1] or [0, 1] scaled to the full integer range and rounded to nearest even, the GPU's decode rules.
+*	Normal:			Octahedral encoding of a unit Vec3F as two snorm16s in one uint32_t, X in the low half.
+*	Quaternion:		Smallest three. The index of the largest component in the top 2 bits, then the other three at 10 bits each.
+* The span versions convert four values per step under HC_USE_SIMD and give bit identical results to the scalar versions.
+* Half conversion uses F16C when the CPU has it.
+*/
+
+#define HC_PACK_QUATERNION_BITS 10
+#define HC_PACK_QUATERNION_MASK 1023
+//Maps a smallest three component in [-1/sqrt(2), 1/sqrt(2)] onto [0, 2 * HC_PACK_QUATERNION_BIAS], keeping an exact code for zero
+#define HC_PACK_QUATERNION_SCALE 722.663130f
+#define HC_PACK_QUATERNION_BIAS 511.0f
+
+#pragma region Scalar
+[[nodiscard]] HC_INLINE uint16_t FloatToHalf(float _fVal) {
+	//Rebias in the float domain so the rounding carry moves into the exponent for free
+	const uint32_t uBits = std::bit_cast<uint32_t>(_fVal);
+	const uint32_t uSign = (uBits >> 16) & 0x8000U;
+	const uint32_t uAbs = uBits & 0x7FFFFFFFU;
+	uint32_t uRes;
+
+	if (uAbs >= 0x47800000U) {
+		//Too large for half, infinity or NaN. NaNs keep a mantissa bit so they stay NaN.
+		uRes = uAbs > 0x7F800000U ? 0x7E00U : 0x7C00U;
+	}
+	else if (uAbs < 0x38800000U) {
+		//Half denormal. Adding 0.5 lines the mantissa up with the half denormal spacing and rounds it.
+		uRes = std::bit_cast<uint32_t>(std::bit_cast<float>(uAbs) + 0.5f) - 0x3F000000U;
+	}
+	else {
+		const uint32_t uOdd = (uAbs >> 13) & 1U;
+		uRes = (uAbs + 0xC8000FFFU + uOdd) >> 13;
+	}
+
+	return static_cast<uint16_t>(uRes | uSign);
+}
+
+[[nodiscard]] HC_INLINE float HalfToFloat(uint16_t _uVal) {
+	//Shift the exponent and mantissa into place, then scale by 2^112 to rebias. Denormals come out of the multiply normalized.
+	const uint32_t uExpMantissa = _uVal & 0x7FFFU;
+	const float fScaled = std::bit_cast<float>(uExpMantissa << 13) * std::bit_cast<float>(0x77800000U);
+	const uint32_t uInfNaN = uExpMantissa > 0x7BFFU ? 0x7F800000U : 0U;
+
+	return std::bit_cast<float>(std::bit_cast<uint32_t>(fScaled) | uInfNaN | (static_cast<uint32_t>(_uVal & 0x8000U) << 16));
+}
+
+//Rounds to nearest even through the current rounding mode, the same rounding the SSE conversions use
+[[nodiscard]] HC_INLINE int32_t PackRoundF(float _fVal) { return static_cast<int32_t>(lrintf(_fVal)); }
+
+[[nodiscard]] HC_INLINE int8_t PackSnorm8(float _fVal) { return static_cast<int8_t>(PackRoundF(fminf(fmaxf(_fVal, -1.0f), 1.0f) * 127.0f)); }
+[[nodiscard]] HC_INLINE uint8_t PackUnorm8(float _fVal) { return static_cast<uint8_t>(PackRoundF(fminf(fmaxf(_fVal, 0.0f), 1.0f) * 255.0f)); }
+[[nodiscard]] HC_INLINE int16_t PackSnorm16(float _fVal) { return static_cast<int16_t>(PackRoundF(fminf(fmaxf(_fVal, -1.0f), 1.0f) * 32767.0f)); }
+[[nodiscard]] HC_INLINE uint16_t PackUnorm16(float _fVal) { return static_cast<uint16_t>(PackRoundF(fminf(fmaxf(_fVal, 0.0f), 1.0f) * 65535.0f)); }
+
+//The most negative code decodes to -1 as well, so every code is valid
+[[nodiscard]] HC_INLINE float UnpackSnorm8(int8_t _iVal) { return fmaxf(static_cast<float>(_iVal) * (1.0f / 127.0f), -1.0f); }
+[[nodiscard]] HC_INLINE float UnpackUnorm8(uint8_t _uVal) { return static_cast<float>(_uVal) * (1.0f / 255.0f); }
+[[nodiscard]] HC_INLINE float UnpackSnorm16(int16_t _iVal) { return fmaxf(static_cast<float>(_iVal) * (1.0f / 32767.0f), -1.0f); }
+[[nodiscard]] HC_INLINE float UnpackUnorm16(uint16_t _uVal) { return static_cast<float>(_uVal) * (1.0f / 65535.0f); }
+
+/// <summary>
+/// Projects a unit vector onto the octahedron |x| + |y| + |z| = 1 and unfolds the lower half over the corners, giving a point
+/// in [-1, 1]^2.
+/// </summary>
+[[nodiscard]] HC_INLINE Vec2F EncodeOctahedral(const Vec3F& _vNormal) {
+	const float fInvLength = 1.0f / (fabsf(_vNormal.x) + fabsf(_vNormal.y) + fabsf(_vNormal.z));
+	const float fX = _vNormal.x * fInvLength;
+	const float fY = _vNormal.y * fInvLength;
+
+	if (_vNormal.z * fInvLength < 0.0f) {
+		return Vec2F(copysignf(1.0f - fabsf(fY), fX), copysignf(1.0f - fabsf(fX), fY));
+	}
+
+	return Vec2F(fX, fY);
+}
+
+[[nodiscard]] HC_INLINE Vec3F DecodeOctahedral(const Vec2F& _vEncoded) {
+	const float fZ = 1.0f - fabsf(_vEncoded.x) - fabsf(_vEncoded.y);
+	const float fFold = fmaxf(-fZ, 0.0f);
+
+	return Normalize(Vec3F(_vEncoded.x + copysignf(fFold, -_vEncoded.x), _vEncoded.y + copysignf(fFold, -_vEncoded.y), fZ));
+}
+
+[[nodiscard]] HC_INLINE uint32_t PackNormal(const Vec3F& _vNormal) {
+	const Vec2F vEncoded = EncodeOctahedral(_vNormal);
+	return static_cast<uint16_t>(PackSnorm16(vEncoded.x)) | (static_cast<uint32_t>(static_cast<uint16_t>(PackSnorm16(vEncoded.y))) << 16);
+}
+
+[[nodiscard]] HC_INLINE Vec3F UnpackNormal(uint32_t _uPacked) {
+	return DecodeOctahedral(Vec2F(UnpackSnorm16(static_cast<int16_t>(_uPacked & 0xFFFFU)), UnpackSnorm16(static_cast<int16_t>(_uPacked >> 16))));
+}
+
+/// <summary>
+/// Smallest three compression of a unit quaternion. The largest component is dropped and rebuilt from the other three, after
+/// flipping the quaternion so it is positive, which leaves the others within +-1/sqrt(2). Worst case error is about 0.004 radians.
+/// </summary>
+[[nodiscard]] HC_INLINE uint32_t PackQuaternion(const QuaternionF& _qQuat) {
+	int iLargest = 0;
+	for (int iNdx = 1; iNdx < 4; ++iNdx) {
+		if (fabsf(_qQuat[iNdx]) > fabsf(_qQuat[iLargest])) { iLargest = iNdx; }
+	}
+
+	const float fSign = _qQuat[iLargest] < 0.0f ? -1.0f : 1.0f;
+	uint32_t uRes = static_cast<uint32_t>(iLargest) << (HC_PACK_QUATERNION_BITS * 3);
+	int iShift = HC_PACK_QUATERNION_BITS * 2;
+
+	for (int iNdx = 0; iNdx < 4; ++iNdx) {
+		if (iNdx == iLargest) { continue; }
+
+		const float fQuantized = fminf(fmaxf(_qQuat[iNdx] * fSign * HC_PACK_QUATERNION_SCALE + HC_PACK_QUATERNION_BIAS, 0.0f), HC_PACK_QUATERNION_BIAS * 2.0f);
+		uRes |= static_cast<uint32_t>(PackRoundF(fQuantized)) << iShift;
+		iShift -= HC_PACK_QUATERNION_BITS;
+	}
+
+	return uRes;
+}
+
+[[nodiscard]] HC_INLINE QuaternionF UnpackQuaternion(uint32_t _uPacked) {
+	const int iLargest = static_cast<int>(_uPacked >> (HC_PACK_QUATERNION_BITS * 3));
+	QuaternionF qRes;
+	float fSumSquares = 0.0f;
+	int iShift = HC_PACK_QUATERNION_BITS * 2;
+
+	for (int iNdx = 0; iNdx < 4; ++iNdx) {
+		if (iNdx == iLargest) { continue; }
+
+		const float fVal = (static_cast<float>((_uPacked >> iShift) & HC_PACK_QUATERNION_MASK) - HC_PACK_QUATERNION_BIAS) * (1.0f / HC_PACK_QUATERNION_SCALE);
+		qRes[iNdx] = fVal;
+		fSumSquares += fVal * fVal;
+		iShift -= HC_PACK_QUATERNION_BITS;
+	}
+
+	qRes[iLargest] = sqrtf(fmaxf(1.0f - fSumSquares, 0.0f));
+
+	return qRes;
+}
+#pragma endregion
+
+#pragma region Batch Kernels
+#if HC_USE_SIMD
+HC_INLINE __m128i HC_VECTORCALL FloatToHalfF(__m128 _fVal) {
+	//FloatToHalf on four lanes. Every branch is computed and the lanes pick theirs with masks.
+	const __m128i iBits = _mm_castps_si128(_fVal);
+	const __m128i iSign = _mm_and_si128(_mm_srli_epi32(iBits, 16), _mm_set1_epi32(0x8000));
+	const __m128i iAbs = _mm_and_si128(iBits, _mm_set1_epi32(0x7FFFFFFF));
+
+	const __m128i iInfNaN = _mm_or_si128(_mm_set1_epi32(0x7C00), _mm_and_si128(_mm_cmpgt_epi32(iAbs, _mm_set1_epi32(0x7F800000)), _mm_set1_epi32(0x0200)));
+	const __m128i iDenormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(iAbs), _mm_set1_ps(0.5f))), _mm_set1_epi32(0x3F000000));
+	const __m128i iOdd = _mm_and_si128(_mm_srli_epi32(iAbs, 13), _mm_set1_epi32(1));
+	const __m128i iNormal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(iAbs, _mm_set1_epi32(static_cast<int>(0xC8000FFFU))), iOdd), 13);
+
+	const __m128i iIsDenormal = _mm_cmplt_epi32(iAbs, _mm_set1_epi32(0x38800000));
+	const __m128i iIsFinite = _mm_cmplt_epi32(iAbs, _mm_set1_epi32(0x47800000));
+	const __m128i iFinite = _mm_or_si128(_mm_and_si128(iIsDenormal, iDenormal), _mm_andnot_si128(iIsDenormal, iNormal));
+
+	return _mm_or_si128(_mm_or_si128(_mm_and_si128(iIsFinite, iFinite), _mm_andnot_si128(iIsFinite, iInfNaN)), iSign);
+}
+
+HC_INLINE __m128 HC_VECTORCALL HalfToFloatF(__m128i _iVal) {
+	const __m128i iExpMantissa = _mm_and_si128(_iVal, _mm_set1_epi32(0x7FFF));
+	const __m128 fScaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(iExpMantissa, 13)), _mm_castsi128_ps(_mm_set1_epi32(0x77800000)));
+	const __m128i iInfNaN = _mm_and_si128(_mm_cmpgt_epi32(iExpMantissa, _mm_set1_epi32(0x7BFF)), _mm_set1_epi32(0x7F800000));
+	const __m128i iSign = _mm_slli_epi32(_mm_and_si128(_iVal, _mm_set1_epi32(0x8000)), 16);
+
+	return _mm_or_ps(fScaled, _mm_castsi128_ps(_mm_or_si128(iInfNaN, iSign)));
+}
+
+//Narrows four 32 bit lanes holding 16 bit values to the low 64 bits. packs saturates as signed, so sign extend first.
+HC_INLINE __m128i HC_VECTORCALL PackLow16F(__m128i _iVal) { return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(_iVal, 16), 16), _mm_setzero_si128()); }
+
+HC_F16C_TARGET HC_INLINE void FloatToHalfBatchF16C(const float* _pIn, uint16_t* _pOut, size_t _sCount) {
+	size_t sNdx = 0;
+	for (; sNdx + 8 <= _sCount; sNdx += 8) {
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(_pOut + sNdx), _mm_cvtps_ph(_mm_loadu_ps(_pIn + sNdx), _MM_FROUND_TO_NEAREST_INT));
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(_pOut + sNdx + 4), _mm_cvtps_ph(_mm_loadu_ps(_pIn + sNdx + 4), _MM_FROUND_TO_NEAREST_INT));
+	}
+
+	for (; sNdx < _sCount; ++sNdx) { _pOut[sNdx] = FloatToHalf(_pIn[sNdx]); }
+}
+
+HC_F16C_TARGET HC_INLINE void HalfToFloatBatchF16C(const uint16_t* _pIn, float* _pOut, size_t _sCount) {
+	size_t sNdx = 0;
+	for (; sNdx + 8 <= _sCount; sNdx += 8) {
+		_mm_storeu_ps(_pOut + sNdx, _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(_pIn + sNdx))));
+		_mm_storeu_ps(_pOut + sNdx + 4, _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(_pIn + sNdx + 4))));
+	}
+
+	for (; sNdx < _sCount; ++sNdx) { _pOut[sNdx] = HalfToFloat(_pIn[sNdx]); }
+}
+
+HC_INLINE void FloatToHalfBatchF(const float* _pIn, uint16_t* _pOut, size_t _sCount) {
+	if (HC_F16C_AVAILABLE()) { FloatToHalfBatchF16C(_pIn, _pOut, _sCount); return; }
+
+	size_t sNdx = 0;
+	for (; sNdx + 4 <= _sCount; sNdx += 4) {
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(_pOut + sNdx), PackLow16F(FloatToHalfF(_mm_loadu_ps(_pIn + sNdx))));
+	}
+
+	for (; sNdx < _sCount; ++sNdx) { _pOut[sNdx] = FloatToHalf(_pIn[sNdx]); }
+}
+
+HC_INLINE void HalfToFloatBatchF(const uint16_t* _pIn, float* _pOut, size_t _sCount) {
+	if (HC_F16C_AVAILABLE()) { HalfToFloatBatchF16C(_pIn, _pOut, _sCount); return; }
+
+	size_t sNdx = 0;
+	for (; sNdx + 4 <= _sCount; sNdx += 4) {
+		const __m128i iHalves = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(_pIn + sNdx));
+		_mm_storeu_ps(_pOut + sNdx, HalfToFloatF(_mm_unpacklo_epi16(iHalves, _mm_setzero_si128())));
+	}
+
+	for (; sNdx < _sCount; ++sNdx) { _pOut[sNdx] = HalfToFloat(_pIn[sNdx]); }
+}
+
+//Clamps four floats to [_fMin, 1], scales them and rounds to 32 bit lanes
+HC_INLINE __m128i HC_VECTORCALL QuantizeF(__m128 _fVal, float _fMin, float _fScale) {
+	return _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_fVal, _mm_set1_ps(_fMin)), _mm_set1_ps(1.0f)), _mm_set1_ps(_fScale)));
+}
+
+HC_INLINE void PackSnorm8BatchF(const float* _pIn, int8_t* _pOut, size_t _sCount) {
+	size_t sNdx = 0;
+	for (; sNdx + 4 <= _sCount; sNdx += 4) {
+		const __m128i iWords = _mm_packs_epi32(QuantizeF(_mm_loadu_ps(_pIn + sNdx), -1.0f, 127.0f), _mm_setzero_si128());
+		const int32_t iBytes = _mm_cvtsi128_si32(_mm_packs_epi16(iWords, _mm_setzero_si128()));
+		memcpy(_pOut + sNdx, &iBytes, sizeof(iBytes));
+	}
+
+	for (; sNdx < _sCount; ++sNdx) { _pOut[sNdx] = PackSnorm8(_pIn[sNdx]); }
+}
+
+HC_INLINE void PackUnorm8BatchF(const float* _pIn, uint8_t* _pOut, size_t _sCount) {
+	size_t sNdx = 0;
+	for (; sNdx + 4 <= _sCount; sNdx += 4) {
+		const __m128i iWords = _mm_packs_epi32(QuantizeF(_mm_loadu_ps(_pIn + sNdx), 0.0f, 255.0f), _mm_setzero_si128());
+		const int32_t iBytes = _mm_cvtsi128_si32(_mm_packus_epi16(iWords, _mm_setzero_si128()));
+		memcpy(_pOut + sNdx, &iBytes, sizeof(iBytes));
+	}
+
+	for (; sNdx < _sCount; ++sNdx) { _pOut[sNdx] = PackUnorm8(_pIn[sNdx]); }
+}
+
+HC_INLINE void PackSnorm16BatchF(const float* _pIn, int16_t* _pOut, size_t _sCount) {
+	size_t sNdx = 0;
+	for (; sNdx + 4 <= _sCount; sNdx += 4) {
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(_pOut + sNdx), _mm_packs_epi32(QuantizeF(_mm_loadu_ps(_pIn + sNdx), -1.0f, 32767.0f), _mm_setzero_si128()));
+	}
+
+	for (; sNdx < _sCount; ++sNdx) { _pOut[sNdx] = PackSnorm16(_pIn[sNdx]); }
+}
+
+HC_INLINE void PackUnorm16BatchF(const float* _pIn, uint16_t* _pOut, size_t _sCount) {
+	size_t sNdx = 0;
+	for (; sNdx + 4 <= _sCount; sNdx += 4) {
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(_pOut + sNdx), PackLow16F(QuantizeF(_mm_loadu_ps(_pIn + sNdx), 0.0f, 65535.0f)));
+	}
+
+	for (; sNdx < _sCount; ++sNdx) { _pOut[sNdx] = PackUnorm16(_pIn[sNdx]); }
+}
+
+//Sign or zero extended 32 bit lanes back to floats. Signed codes clamp at -1 like UnpackSnorm.
+HC_INLINE __m128 HC_VECTORCALL DequantizeF(__m128i _iVal, float _fScale, bool _bSigned) {
+	const __m128 fRes = _mm_mul_ps(_mm_cvtepi32_ps(_iVal), _mm_set1_ps(_fScale));
+	return _bSigned ? _mm_max_ps(fRes, _mm_set1_ps(-1.0f)) : fRes;
+}
+
+HC_INLINE void UnpackSnorm8BatchF(const int8_t* _pIn, float* _pOut, size_t _sCount) {
+	size_t sNdx = 0;
+	for (; sNdx + 4 <= _sCount; sNdx += 4) {
+		int32_t iBytes;
+		memcpy(&iBytes, _pIn + sNdx, sizeof(iBytes));
+		const __m128i iBytesVec = _mm_cvtsi32_si128(iBytes);
+		//Move each byte to the top of its lane, then shift back down to sign extend
+		const __m128i iLanes = _mm_srai_epi32(_mm_unpacklo_epi16(_mm_unpacklo_epi8(iBytesVec, iBytesVec), _mm_unpacklo_epi8(iBytesVec, iBytesVec)), 24);
+		_mm_storeu_ps(_pOut + sNdx, DequantizeF(iLanes, 1.0f / 127.0f, true));
+	}
+
+	for (; sNdx < _sCount; ++sNdx) { _pOut[sNdx] = UnpackSnorm8(_pIn[sNdx]); }
+}
+
+HC_INLINE void UnpackUnorm8BatchF(const uint8_t* _pIn, float* _pOut, size_t _sCount) {
+	size_t sNdx = 0;
+	for (; sNdx + 4 <= _sCount; sNdx += 4) {
+		int32_t iBytes;
+		memcpy(&iBytes, _pIn + sNdx, sizeof(iBytes));
+		const __m128i iLanes = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(iBytes), _mm_setzero_si128()), _mm_setzero_si128());
+		_mm_storeu_ps(_pOut + sNdx, DequantizeF(iLanes, 1.0f / 255.0f, false));
+	}
+
+	for (; sNdx < _sCount; ++sNdx) { _pOut[sNdx] = UnpackUnorm8(_pIn[sNdx]); }
+}
+
+HC_INLINE void UnpackSnorm16BatchF(const int16_t* _pIn, float* _pOut, size_t _sCount) {
+	size_t sNdx = 0;
+	for (; sNdx + 4 <= _sCount; sNdx += 4) {
+		const __m128i iWords = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(_pIn + sNdx));
+		_mm_storeu_ps(_pOut + sNdx, DequantizeF(_mm_srai_epi32(_mm_unpacklo_epi16(iWords, iWords), 16), 1.0f / 32767.0f, true));
+	}
+
+	for (; sNdx < _sCount; ++sNdx) { _pOut[sNdx] = UnpackSnorm16(_pIn[sNdx]); }
+}
+
+HC_INLINE void UnpackUnorm16BatchF(const uint16_t* _pIn, float* _pOut, size_t _sCount) {
+	size_t sNdx = 0;
+	for (; sNdx + 4 <= _sCount; sNdx += 4) {
+		const __m128i iWords = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(_pIn + sNdx));
+		_mm_storeu_ps(_pOut + sNdx, DequantizeF(_mm_unpacklo_epi16(iWords, _mm_setzero_si128()), 1.0f / 65535.0f, false));
+	}
+
+	for (; sNdx < _sCount; ++sNdx) { _pOut[sNdx] = UnpackUnorm16(_pIn[sNdx]); }
+}
+
+//Per lane _iMask ? _fTrue : _fFalse
+HC_INLINE __m128 HC_VECTORCALL PackSelectF(__m128i _iMask, __m128 _fTrue, __m128 _fFalse) {
+	const __m128 fMask = _mm_castsi128_ps(_iMask);
+	return _mm_or_ps(_mm_and_ps(fMask, _fTrue), _mm_andnot_ps(fMask, _fFalse));
+}
+
+HC_INLINE void PackNormalsF(const Vec3Fx4& _vNormals, uint32_t* _pOut, int _iCount) {
+	const Floatx4 fInvLength = Floatx4(1.0f) / (Abs(_vNormals.x) + Abs(_vNormals.y) + Abs(_vNormals.z));
+	const Floatx4 fX = _vNormals.x * fInvLength, fY = _vNormals.y * fInvLength, fZ = _vNormals.z * fInvLength;
+
+	//Lanes below the XY plane fold over the corners, matching EncodeOctahedral
+	const __m128 fFoldX = _mm_or_ps(_mm_sub_ps(_mm_set1_ps(1.0f), AbsF(fY.m_fVec)), _mm_and_ps(fX.m_fVec, _mm_set1_ps(-0.0f)));
+	const __m128 fFoldY = _mm_or_ps(_mm_sub_ps(_mm_set1_ps(1.0f), AbsF(fX.m_fVec)), _mm_and_ps(fY.m_fVec, _mm_set1_ps(-0.0f)));
+	const __m128i iBelow = _mm_castps_si128(_mm_cmplt_ps(fZ.m_fVec, _mm_setzero_ps()));
+
+	const __m128i iX = QuantizeF(PackSelectF(iBelow, fFoldX, fX.m_fVec), -1.0f, 32767.0f);
+	const __m128i iY = QuantizeF(PackSelectF(iBelow, fFoldY, fY.m_fVec), -1.0f, 32767.0f);
+	const __m128i iPacked = _mm_or_si128(_mm_and_si128(iX, _mm_set1_epi32(0xFFFF)), _mm_slli_epi32(iY, 16));
+
+	if (_iCount == Floatx4::LANES) { _mm_storeu_si128(reinterpret_cast<__m128i*>(_pOut), iPacked); return; }
+
+	alignas(16) uint32_t uLanes[4];
+	_mm_store_si128(reinterpret_cast<__m128i*>(uLanes), iPacked);
+	for (int iLane = 0; iLane < _iCount; ++iLane) { _pOut[iLane] = uLanes[iLane]; }
+}
+
+HC_INLINE void UnpackNormalsF(const uint32_t* _pIn, Vec3F* _pOut, int _iCount) {
+	alignas(16) uint32_t uLanes[4] = {};
+	for (int iLane = 0; iLane < _iCount; ++iLane) { uLanes[iLane] = _pIn[iLane]; }
+
+	const __m128i iPacked = _mm_load_si128(reinterpret_cast<const __m128i*>(uLanes));
+	const __m128 fX = DequantizeF(_mm_srai_epi32(_mm_slli_epi32(iPacked, 16), 16), 1.0f / 32767.0f, true);
+	const __m128 fY = DequantizeF(_mm_srai_epi32(iPacked, 16), 1.0f / 32767.0f, true);
+	const __m128 fZ = _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.0f), AbsF(fX)), AbsF(fY));
+	const __m128 fFold = _mm_max_ps(_mm_sub_ps(_mm_setzero_ps(), fZ), _mm_setzero_ps());
+
+	//Move each coordinate towards zero by the fold, as DecodeOctahedral does
+	const __m128 fSignX = _mm_and_ps(fX, _mm_set1_ps(-0.0f)), fSignY = _mm_and_ps(fY, _mm_set1_ps(-0.0f));
+	const Vec3Fx4 vDecoded = Vec3Fx4(Floatx4(_mm_sub_ps(fX, _mm_or_ps(fFold, fSignX))), Floatx4(_mm_sub_ps(fY, _mm_or_ps(fFold, fSignY))), Floatx4(fZ));
+
+	Store(Normalize(vDecoded), _pOut, _iCount);
+}
+
+HC_INLINE void PackQuaternionsF(const QuaternionFx4& _qQuats, uint32_t* _pOut, int _iCount) {
+	const __m128 fAbsX = AbsF(_qQuats.x.m_fVec), fAbsY = AbsF(_qQuats.y.m_fVec), fAbsZ = AbsF(_qQuats.z.m_fVec), fAbsW = AbsF(_qQuats.w.m_fVec);
+	const __m128 fLargest = _mm_max_ps(_mm_max_ps(fAbsX, fAbsY), _mm_max_ps(fAbsZ, fAbsW));
+
+	//Ties go to the lowest index, like the scalar search
+	const __m128i iIsX = _mm_castps_si128(_mm_cmpeq_ps(fAbsX, fLargest));
+	const __m128i iIsY = _mm_andnot_si128(iIsX, _mm_castps_si128(_mm_cmpeq_ps(fAbsY, fLargest)));
+	const __m128i iXorY = _mm_or_si128(iIsX, iIsY);
+	const __m128i iIsZ = _mm_andnot_si128(iXorY, _mm_castps_si128(_mm_cmpeq_ps(fAbsZ, fLargest)));
+	const __m128i iIsW = _mm_andnot_si128(_mm_or_si128(iXorY, iIsZ), _mm_set1_epi32(-1));
+
+	//Flip every lane whose largest component is negative
+	const __m128 fLargestSigned = PackSelectF(iIsX, _qQuats.x.m_fVec, PackSelectF(iIsY, _qQuats.y.m_fVec, PackSelectF(iIsZ, _qQuats.z.m_fVec, _qQuats.w.m_fVec)));
+	const __m128 fSign = _mm_and_ps(fLargestSigned, _mm_set1_ps(-0.0f));
+
+	//The three kept components, in index order
+	const __m128 fA = _mm_xor_ps(PackSelectF(iIsX, _qQuats.y.m_fVec, _qQuats.x.m_fVec), fSign);
+	const __m128 fB = _mm_xor_ps(PackSelectF(iXorY, _qQuats.z.m_fVec, _qQuats.y.m_fVec), fSign);
+	const __m128 fC = _mm_xor_ps(PackSelectF(iIsW, _qQuats.z.m_fVec, _qQuats.w.m_fVec), fSign);
+
+	const __m128 fScale = _mm_set1_ps(HC_PACK_QUATERNION_SCALE), fBias = _mm_set1_ps(HC_PACK_QUATERNION_BIAS);
+	const __m128 fMax = _mm_set1_ps(HC_PACK_QUATERNION_BIAS * 2.0f);
+	const __m128i iA = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(fA, fScale), fBias), _mm_setzero_ps()), fMax));
+	const __m128i iB = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(fB, fScale), fBias), _mm_setzero_ps()), fMax));
+	const __m128i iC = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(fC, fScale), fBias), _mm_setzero_ps()), fMax));
+
+	const __m128i iIndex = _mm_or_si128(_mm_or_si128(_mm_and_si128(iIsY, _mm_set1_epi32(1)), _mm_and_si128(iIsZ, _mm_set1_epi32(2))), _mm_and_si128(iIsW, _mm_set1_epi32(3)));
+	const __m128i iPacked = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(iIndex, HC_PACK_QUATERNION_BITS * 3), _mm_slli_epi32(iA, HC_PACK_QUATERNION_BITS * 2)),
+										 _mm_or_si128(_mm_slli_epi32(iB, HC_PACK_QUATERNION_BITS), iC));
+
+	if (_iCount == Floatx4::LANES) { _mm_storeu_si128(reinterpret_cast<__m128i*>(_pOut), iPacked); return; }
+
+	alignas(16) uint32_t uLanes[4];
+	_mm_store_si128(reinterpret_cast<__m128i*>(uLanes), iPacked);
+	for (int iLane = 0; iLane < _iCount; ++iLane) { _pOut[iLane] = uLanes[iLane]; }
+}
+
+HC_INLINE void UnpackQuaternionsF(const uint32_t* _pIn, QuaternionF* _pOut, int _iCount) {
+	alignas(16) uint32_t uLanes[4] = {};
+	for (int iLane = 0; iLane < _iCount; ++iLane) { uLanes[iLane] = _pIn[iLane]; }
+
+	const __m128i iPacked = _mm_load_si128(reinterpret_cast<const __m128i*>(uLanes));
+	const __m128i iField = _mm_set1_epi32(HC_PACK_QUATERNION_MASK);
+	const __m128 fBias = _mm_set1_ps(HC_PACK_QUATERNION_BIAS), fInvScale = _mm_set1_ps(1.0f / HC_PACK_QUATERNION_SCALE);
+
+	const __m128 fA = _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(iPacked, HC_PACK_QUATERNION_BITS * 2), iField)), fBias), fInvScale);
+	const __m128 fB = _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(iPacked, HC_PACK_QUATERNION_BITS), iField)), fBias), fInvScale);
+	const __m128 fC = _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(_mm_and_si128(iPacked, iField)), fBias), fInvScale);
+	const __m128 fSumSquares = _mm_add_ps(_mm_add_ps(_mm_mul_ps(fA, fA), _mm_mul_ps(fB, fB)), _mm_mul_ps(fC, fC));
+	const __m128 fD = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(1.0f), fSumSquares), _mm_setzero_ps()));
+
+	const __m128i iIndex = _mm_srli_epi32(iPacked, HC_PACK_QUATERNION_BITS * 3);
+	const __m128i iIsX = _mm_cmpeq_epi32(iIndex, _mm_setzero_si128());
+	const __m128i iIsY = _mm_cmpeq_epi32(iIndex, _mm_set1_epi32(1));
+	const __m128i iIsZ = _mm_cmpeq_epi32(iIndex, _mm_set1_epi32(2));
+	const __m128i iIsW = _mm_cmpeq_epi32(iIndex, _mm_set1_epi32(3));
+
+	const QuaternionFx4 qRes = QuaternionFx4(Floatx4(PackSelectF(iIsX, fD, fA)),
+											 Floatx4(PackSelectF(iIsX, fA, PackSelectF(iIsY, fD, fB))),
+											 Floatx4(PackSelectF(iIsW, fC, PackSelectF(iIsZ, fD, fB))),
+											 Floatx4(PackSelectF(iIsW, fD, fC)));
+
+	Store(qRes, _pOut, _iCount);
+}
+#else
+HC_INLINE void FloatToHalfBatchF(const float* _pIn, uint16_t* _pOut, size_t _sCount) { for (size_t sNdx = 0; sNdx < _sCount; ++sNdx) { _pOut[sNdx] = FloatToHalf(_pIn[sNdx]); } }
+HC_INLINE void HalfToFloatBatchF(const uint16_t* _pIn, float* _pOut, size_t _sCount) { for (size_t sNdx = 0; sNdx < _sCount; ++sNdx) { _pOut[sNdx] = HalfToFloat(_pIn[sNdx]); } }
+HC_INLINE void PackSnorm8BatchF(const float* _pIn, int8_t* _pOut, size_t _sCount) { for (size_t sNdx = 0; sNdx < _sCount; ++sNdx) { _pOut[sNdx] = PackSnorm8(_pIn[sNdx]); } }
+HC_INLINE void PackUnorm8BatchF(const float* _pIn, uint8_t* _pOut, size_t _sCount) { for (size_t sNdx = 0; sNdx < _sCount; ++sNdx) { _pOut[sNdx] = PackUnorm8(_pIn[sNdx]); } }
+HC_INLINE void PackSnorm16BatchF(const float* _pIn, int16_t* _pOut, size_t _sCount) { for (size_t sNdx = 0; sNdx < _sCount; ++sNdx) { _pOut[sNdx] = PackSnorm16(_pIn[sNdx]); } }
+HC_INLINE void PackUnorm16BatchF(const float* _pIn, uint16_t* _pOut, size_t _sCount) { for (size_t sNdx = 0; sNdx < _sCount; ++sNdx) { _pOut[sNdx] = PackUnorm16(_pIn[sNdx]); } }
+HC_INLINE void UnpackSnorm8BatchF(const int8_t* _pIn, float* _pOut, size_t _sCount) { for (size_t sNdx = 0; sNdx < _sCount; ++sNdx) { _pOut[sNdx] = UnpackSnorm8(_pIn[sNdx]); } }
+HC_INLINE void UnpackUnorm8BatchF(const uint8_t* _pIn, float* _pOut, size_t _sCount) { for (size_t sNdx = 0; sNdx < _sCount; ++sNdx) { _pOut[sNdx] = UnpackUnorm8(_pIn[sNdx]); } }
+HC_INLINE void UnpackSnorm16BatchF(const int16_t* _pIn, float* _pOut, size_t _sCount) { for (size_t sNdx = 0; sNdx < _sCount; ++sNdx) { _pOut[sNdx] = UnpackSnorm16(_pIn[sNdx]); } }
+HC_INLINE void UnpackUnorm16BatchF(const uint16_t* _pIn, float* _pOut, size_t _sCount) { for (size_t sNdx = 0; sNdx < _sCount; ++sNdx) { _pOut[sNdx] = UnpackUnorm16(_pIn[sNdx]); } }
+
+HC_INLINE void PackNormalsF(const Vec3Fx4& _vNormals, uint32_t* _pOut, int _iCount) { for (int iLane = 0; iLane < _iCount; ++iLane) { _pOut[iLane] = PackNormal(_vNormals.GetLane(iLane)); } }
+HC_INLINE void UnpackNormalsF(const uint32_t* _pIn, Vec3F* _pOut, int _iCount) { for (int iLane = 0; iLane < _iCount; ++iLane) { _pOut[iLane] = UnpackNormal(_pIn[iLane]); } }
+HC_INLINE void PackQuaternionsF(const QuaternionFx4& _qQuats, uint32_t* _pOut, int _iCount) { for (int iLane = 0; iLane < _iCount; ++iLane) { _pOut[iLane] = PackQuaternion(_qQuats.GetLane(iLane)); } }
+HC_INLINE void UnpackQuaternionsF(const uint32_t* _pIn, QuaternionF* _pOut, int _iCount) { for (int iLane = 0; iLane < _iCount; ++iLane) { _pOut[iLane] = UnpackQuaternion(_pIn[iLane]); } }
+#endif
+#pragma endregion
+
+namespace Math {
+	//Every span version converts min(input size, output size) values
+
+	HC_INLINE void PackHalf(std::span<const float> _fIn, std::span<uint16_t> _uOut) { FloatToHalfBatchF(_fIn.data(), _uOut.data(), std::min(_fIn.size(), _uOut.size())); }
+	HC_INLINE void UnpackHalf(std::span<const uint16_t> _uIn, std::span<float> _fOut) { HalfToFloatBatchF(_uIn.data(), _fOut.data(), std::min(_uIn.size(), _fOut.size())); }
+	HC_INLINE void PackSnorm8(std::span<const float> _fIn, std::span<int8_t> _iOut) { PackSnorm8BatchF(_fIn.data(), _iOut.data(), std::min(_fIn.size(), _iOut.size())); }
+	HC_INLINE void PackUnorm8(std::span<const float> _fIn, std::span<uint8_t> _uOut) { PackUnorm8BatchF(_fIn.data(), _uOut.data(), std::min(_fIn.size(), _uOut.size())); }
+	HC_INLINE void PackSnorm16(std::span<const float> _fIn, std::span<int16_t> _iOut) { PackSnorm16BatchF(_fIn.data(), _iOut.data(), std::min(_fIn.size(), _iOut.size())); }
+	HC_INLINE void PackUnorm16(std::span<const float> _fIn, std::span<uint16_t> _uOut) { PackUnorm16BatchF(_fIn.data(), _uOut.data(), std::min(_fIn.size(), _uOut.size())); }
+	HC_INLINE void UnpackSnorm8(std::span<const int8_t> _iIn, std::span<float> _fOut) { UnpackSnorm8BatchF(_iIn.data(), _fOut.data(), std::min(_iIn.size(), _fOut.size())); }
+	HC_INLINE void UnpackUnorm8(std::span<const uint8_t> _uIn, std::span<float> _fOut) { UnpackUnorm8BatchF(_uIn.data(), _fOut.data(), std::min(_uIn.size(), _fOut.size())); }
+	HC_INLINE void UnpackSnorm16(std::span<const int16_t> _iIn, std::span<float> _fOut) { UnpackSnorm16BatchF(_iIn.data(), _fOut.data(), std::min(_iIn.size(), _fOut.size())); }
+	HC_INLINE void UnpackUnorm16(std::span<const uint16_t> _uIn, std::span<float> _fOut) { UnpackUnorm16BatchF(_uIn.data(), _fOut.data(), std::min(_uIn.size(), _fOut.size())); }
+
+	/// <summary>
+	/// Octahedral encodes every normal in _vIn to 32 bits, matching PackNormal.
+	/// </summary>
+	HC_INLINE void PackNormals(std::span<const Vec3F> _vIn, std::span<uint32_t> _uOut) {
+		const size_t sCount = std::min(_vIn.size(), _uOut.size());
+
+		for (size_t sNdx = 0; sNdx < sCount; sNdx += Floatx4::LANES) {
+			const int iCount = static_cast<int>(std::min<size_t>(Floatx4::LANES, sCount - sNdx));
+			PackNormalsF(LoadVec3Fx4(_vIn.data() + sNdx, iCount), _uOut.data() + sNdx, iCount);
+		}
+	}
+
+	HC_INLINE void UnpackNormals(std::span<const uint32_t> _uIn, std::span<Vec3F> _vOut) {
+		const size_t sCount = std::min(_uIn.size(), _vOut.size());
+
+		for (size_t sNdx = 0; sNdx < sCount; sNdx += Floatx4::LANES) {
+			UnpackNormalsF(_uIn.data() + sNdx, _vOut.data() + sNdx, static_cast<int>(std::min<size_t>(Floatx4::LANES, sCount - sNdx)));
+		}
+	}
+
+	/// <summary>
+	/// Smallest three compresses every unit quaternion in _qIn to 32 bits, matching PackQuaternion.
+	/// </summary>
+	HC_INLINE void PackQuaternions(std::span<const QuaternionF> _qIn, std::span<uint32_t> _uOut) {
+		const size_t sCount = std::min(_qIn.size(), _uOut.size());
+
+		for (size_t sNdx = 0; sNdx < sCount; sNdx += Floatx4::LANES) {
+			const int iCount = static_cast<int>(std::min<size_t>(Floatx4::LANES, sCount - sNdx));
+			PackQuaternionsF(LoadQuaternionFx4(_qIn.data() + sNdx, iCount), _uOut.data() + sNdx, iCount);
+		}
+	}
+
+	HC_INLINE void UnpackQuaternions(std::span<const uint32_t> _uIn, std::span<QuaternionF> _qOut) {
+		const size_t sCount = std::min(_uIn.size(), _qOut.size());
+
+		for (size_t sNdx = 0; sNdx < sCount; sNdx += Floatx4::LANES) {
+			UnpackQuaternionsF(_uIn.data() + sNdx, _qOut.data() + sNdx, static_cast<int>(std::min<size_t>(Floatx4::LANES, sCount - sNdx)));
+		}
+	}
+}
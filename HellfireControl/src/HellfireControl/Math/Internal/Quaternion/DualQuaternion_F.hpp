@@ -0,0 +1,151 @@
+#pragma once
+
+#include <HellfireControl/Math/Internal/Quaternion/Quaternion_F.hpp>
+
+#include <span>
+
+/*
+* Rigid transform (rotation and translation) as a unit dual quaternion. A point is rotated exactly as RotateByQuaternion does
+* with the real part, then translated. At 32 bytes it is half a MatrixF, and the GPU layout is two vec4s per bone, real part
+* first. Blending dual quaternions keeps the blended transform rigid, so skinned joints do not collapse the way blended
+* matrices do when they twist.
+*/
+struct HC_ALIGNAS(16) DualQuaternionF
+{
+	QuaternionF m_qReal; //Rotation
+	QuaternionF m_qDual; //Half the translation, multiplied by the rotation
+
+	HC_INLINE DualQuaternionF() : m_qReal(0.0f, 0.0f, 0.0f, 1.0f), m_qDual() {}
+	HC_INLINE explicit DualQuaternionF(const QuaternionF& _qReal, const QuaternionF& _qDual) : m_qReal(_qReal), m_qDual(_qDual) {}
+
+	/// <summary>
+	/// Rotates by _qRotation and then translates by _vTranslation.
+	/// </summary>
+	HC_INLINE explicit DualQuaternionF(const Vec3F& _vTranslation, const QuaternionF& _qRotation) : m_qReal(_qRotation), m_qDual(QuaternionF(Vec4F(_vTranslation, 0.0f)) * _qRotation * 0.5f) {}
+
+	/// <summary>
+	/// Converts the rotation and translation of a MatrixF. Any scale in _mMat is dropped.
+	/// </summary>
+	HC_INLINE explicit DualQuaternionF(const MatrixF& _mMat) {
+		const MatrixF mRotation(Vec4F(Normalize(_mMat[0].XYZ()), 0.0f), Vec4F(Normalize(_mMat[1].XYZ()), 0.0f), Vec4F(Normalize(_mMat[2].XYZ()), 0.0f), Vec4F(0.0f, 0.0f, 0.0f, 1.0f));
+
+		m_qReal = Normalize(QuaternionF(mRotation));
+		m_qDual = QuaternionF(Vec4F(_mMat[3].XYZ(), 0.0f)) * m_qReal * 0.5f;
+	}
+};
+
+static_assert(sizeof(DualQuaternionF) == sizeof(QuaternionF) * 2, "DualQuaternionF must be two tightly packed quaternions for GPU upload");
+
+[[nodiscard]] HC_INLINE DualQuaternionF operator+(const DualQuaternionF& _dqLeft, const DualQuaternionF& _dqRight) { return DualQuaternionF(_dqLeft.m_qReal + _dqRight.m_qReal, _dqLeft.m_qDual + _dqRight.m_qDual); }
+[[nodiscard]] HC_INLINE DualQuaternionF operator*(const DualQuaternionF& _dqLeft, float _fRight) { return DualQuaternionF(_dqLeft.m_qReal * _fRight, _dqLeft.m_qDual * _fRight); }
+[[nodiscard]] HC_INLINE DualQuaternionF operator*(float _fLeft, const DualQuaternionF& _dqRight) { return _dqRight * _fLeft; }
+[[nodiscard]] HC_INLINE DualQuaternionF operator-(const DualQuaternionF& _dqVal) { return DualQuaternionF(-_dqVal.m_qReal, -_dqVal.m_qDual); }
+HC_INLINE DualQuaternionF& operator+=(DualQuaternionF& _dqLeft, const DualQuaternionF& _dqRight) { _dqLeft = _dqLeft + _dqRight; return _dqLeft; }
+HC_INLINE DualQuaternionF& operator*=(DualQuaternionF& _dqLeft, float _fRight) { _dqLeft = _dqLeft * _fRight; return _dqLeft; }
+HC_INLINE bool operator==(const DualQuaternionF& _dqLeft, const DualQuaternionF& _dqRight) { return _dqLeft.m_qReal == _dqRight.m_qReal && _dqLeft.m_qDual == _dqRight.m_qDual; }
+HC_INLINE bool operator!=(const DualQuaternionF& _dqLeft, const DualQuaternionF& _dqRight) { return !(_dqLeft == _dqRight); }
+
+/// <summary>
+/// Composes two transforms in the same order as MatrixF: _dqLeft is applied first, then _dqRight. That matches
+/// ExtractMatrix(_dqLeft * _dqRight) == ExtractMatrix(_dqLeft) * ExtractMatrix(_dqRight).
+/// </summary>
+[[nodiscard]] HC_INLINE DualQuaternionF operator*(const DualQuaternionF& _dqLeft, const DualQuaternionF& _dqRight) {
+	return DualQuaternionF(_dqRight.m_qReal * _dqLeft.m_qReal, _dqRight.m_qReal * _dqLeft.m_qDual + _dqRight.m_qDual * _dqLeft.m_qReal);
+}
+
+HC_INLINE DualQuaternionF& operator*=(DualQuaternionF& _dqLeft, const DualQuaternionF& _dqRight) { _dqLeft = _dqLeft * _dqRight; return _dqLeft; }
+
+/// <summary>
+/// Scales both parts to a unit real part and removes any drift that made the dual part non orthogonal to it.
+/// </summary>
+[[nodiscard]] HC_INLINE DualQuaternionF Normalize(const DualQuaternionF& _dqVal) {
+	const float fInvLength = 1.0f / Length(_dqVal.m_qReal.m_vQuat);
+	const QuaternionF qReal = _dqVal.m_qReal * fInvLength;
+	const QuaternionF qDual = _dqVal.m_qDual * fInvLength;
+
+	return DualQuaternionF(qReal, qDual - qReal * Dot(qReal.m_vQuat, qDual.m_vQuat));
+}
+
+/// <summary>
+/// Inverse of a unit dual quaternion.
+/// </summary>
+[[nodiscard]] HC_INLINE DualQuaternionF Inverse(const DualQuaternionF& _dqVal) { return DualQuaternionF(Conjugate(_dqVal.m_qReal), Conjugate(_dqVal.m_qDual)); }
+
+[[nodiscard]] HC_INLINE QuaternionF ExtractRotation(const DualQuaternionF& _dqVal) { return _dqVal.m_qReal; }
+
+[[nodiscard]] HC_INLINE Vec3F ExtractTranslation(const DualQuaternionF& _dqVal) { return (_dqVal.m_qDual * Conjugate(_dqVal.m_qReal)).m_vQuat.XYZ() * 2.0f; }
+
+[[nodiscard]] HC_INLINE Vec3F TransformDirection(const DualQuaternionF& _dqVal, const Vec3F& _vDirection) {
+	//Rotation without the two quaternion products: v + 2w(q x v) + 2q x (q x v)
+	const Vec3F vAxis = _dqVal.m_qReal.m_vQuat.XYZ();
+	const Vec3F vCross = Cross(vAxis, _vDirection) * 2.0f;
+
+	return _vDirection + vCross * _dqVal.m_qReal.w + Cross(vAxis, vCross);
+}
+
+[[nodiscard]] HC_INLINE Vec3F TransformPoint(const DualQuaternionF& _dqVal, const Vec3F& _vPoint) {
+	//Expanded 2 * Dual * Conjugate(Real), the same translation ExtractTranslation returns
+	const Vec3F vRealAxis = _dqVal.m_qReal.m_vQuat.XYZ();
+	const Vec3F vDualAxis = _dqVal.m_qDual.m_vQuat.XYZ();
+	const Vec3F vTranslation = (vDualAxis * _dqVal.m_qReal.w - vRealAxis * _dqVal.m_qDual.w + Cross(vRealAxis, vDualAxis)) * 2.0f;
+
+	return TransformDirection(_dqVal, _vPoint) + vTranslation;
+}
+
+/// <summary>
+/// Builds the MatrixF that TransformPoint(MatrixF, Vec3F) treats the same way as TransformPoint(_dqVal, Vec3F).
+/// </summary>
+[[nodiscard]] HC_INLINE MatrixF ExtractMatrix(const DualQuaternionF& _dqVal) {
+	return MatrixF(Vec4F(TransformDirection(_dqVal, Vec3F(1.0f, 0.0f, 0.0f)), 0.0f),
+				   Vec4F(TransformDirection(_dqVal, Vec3F(0.0f, 1.0f, 0.0f)), 0.0f),
+				   Vec4F(TransformDirection(_dqVal, Vec3F(0.0f, 0.0f, 1.0f)), 0.0f),
+				   Vec4F(ExtractTranslation(_dqVal), 1.0f));
+}
+
+namespace Math {
+	/// <summary>
+	/// Dual quaternion linear blend of _dqTransforms weighted by _fWeights, as used for skinning. Every transform is flipped onto
+	/// the hemisphere of the first before it is accumulated so the blend takes the shorter path.
+	/// </summary>
+	/// <param name="_dqTransforms: Unit transforms to blend"></param>
+	/// <param name="_fWeights: One weight per transform. They do not need to sum to one"></param>
+	/// <returns>
+	/// DualQuaternionF: Normalized blend
+	/// </returns>
+	[[nodiscard]] HC_INLINE DualQuaternionF Blend(std::span<const DualQuaternionF> _dqTransforms, std::span<const float> _fWeights) {
+		assert(_fWeights.size() == _dqTransforms.size() && !_dqTransforms.empty());
+
+		const Vec4F vPivot = _dqTransforms[0].m_qReal.m_vQuat;
+		DualQuaternionF dqRes = DualQuaternionF(QuaternionF(), QuaternionF());
+
+		for (size_t sNdx = 0; sNdx < _dqTransforms.size(); ++sNdx) {
+			const float fWeight = Dot(vPivot, _dqTransforms[sNdx].m_qReal.m_vQuat) < 0.0f ? -_fWeights[sNdx] : _fWeights[sNdx];
+			dqRes += _dqTransforms[sNdx] * fWeight;
+		}
+
+		return Normalize(dqRes);
+	}
+}
+
+/// <summary>
+/// Builds a skinning palette: each entry moves a bind pose vertex by its bone's inverse bind pose and then by the bone's
+/// current transform. The result can be handed straight to Buffer::Update as two vec4s per bone.
+/// </summary>
+/// <param name="_mBoneTransforms: Current model space transform of every bone. Scale is dropped"></param>
+/// <param name="_mInverseBindPoses: Inverse bind pose of every bone. Must be as long as _mBoneTransforms"></param>
+/// <param name="_dqPalette: Destination. Must be at least as long as _mBoneTransforms"></param>
+HC_INLINE void BuildSkinPalette(std::span<const MatrixF> _mBoneTransforms, std::span<const MatrixF> _mInverseBindPoses, std::span<DualQuaternionF> _dqPalette) {
+	assert(_mInverseBindPoses.size() == _mBoneTransforms.size() && _dqPalette.size() >= _mBoneTransforms.size());
+
+	for (size_t sNdx = 0; sNdx < _mBoneTransforms.size(); ++sNdx) {
+		_dqPalette[sNdx] = DualQuaternionF(_mInverseBindPoses[sNdx] * _mBoneTransforms[sNdx]);
+	}
+}
+
+HC_INLINE void BuildSkinPalette(std::span<const DualQuaternionF> _dqBoneTransforms, std::span<const DualQuaternionF> _dqInverseBindPoses, std::span<DualQuaternionF> _dqPalette) {
+	assert(_dqInverseBindPoses.size() == _dqBoneTransforms.size() && _dqPalette.size() >= _dqBoneTransforms.size());
+
+	for (size_t sNdx = 0; sNdx < _dqBoneTransforms.size(); ++sNdx) {
+		_dqPalette[sNdx] = _dqInverseBindPoses[sNdx] * _dqBoneTransforms[sNdx];
+	}
+}
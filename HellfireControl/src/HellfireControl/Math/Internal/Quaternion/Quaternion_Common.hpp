@@ -5,7 +5,3 @@
 #include <HellfireControl/Core/Common.hpp>
 #include <HellfireControl/Math/Vector.hpp>
 #include <HellfireControl/Math/Matrix.hpp>
-
-#if HC_USE_SIMD
-#include <intrin.h>
-#endif
\ No newline at end of file
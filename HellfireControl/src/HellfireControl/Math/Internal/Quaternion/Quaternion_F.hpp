@@ -2,55 +2,6 @@
 
 #include <HellfireControl/Math/Internal/Quaternion/Quaternion_Common.hpp>
 
-#if HC_USE_SIMD
-
-struct QuaternionF {
-	Vec4F m_vQuat;
-
-	HC_INLINE HC_VECTORCALL QuaternionF() {}
-	HC_INLINE HC_VECTORCALL QuaternionF(float _fX, float _fY, float _fZ, float _fW) { m_vQuat = Vec4F(_fX, _fY, _fZ, _fW); }
-	HC_INLINE HC_VECTORCALL QuaternionF(int _fX, int _fY, int _fZ, int _fW) { m_vQuat = Vec4F(static_cast<float>(_fX), static_cast<float>(_fY), static_cast<float>(_fZ), static_cast<float>(_fW)); }
-	HC_INLINE HC_VECTORCALL QuaternionF(double _fX, double _fY, double _fZ, double _fW) { m_vQuat = Vec4F(static_cast<float>(_fX), static_cast<float>(_fY), static_cast<float>(_fZ), static_cast<float>(_fW)); }
-	HC_INLINE HC_VECTORCALL QuaternionF(MatrixF _mMat) {
-		//FIXME: All of this is god-awful unoptimized crap. Make into optimized SIMD code ASAP! - Owen
-		float fSum = 0.0f;
-		if (_mMat[2][2] < 0.0f) {
-			if (_mMat[0][0] > _mMat[1][1]) {
-				fSum = 1.0f + _mMat[0][0] - _mMat[1][1] - _mMat[2][2];
-				m_vQuat = Vec4F(fSum, _mMat[0][1] + _mMat[1][0], _mMat[2][0] + _mMat[0][2], _mMat[1][2] - _mMat[2][2]);
-			}
-			else {
-				fSum = 1.0f - _mMat[0][0] + _mMat[1][1] - _mMat[2][2];
-				m_vQuat = Vec4F(_mMat[0][1] + _mMat[1][0], fSum, _mMat[1][2] + _mMat[2][1], _mMat[2][0] - _mMat[0][2]);
-			}
-		}
-		else {
-			if (_mMat[0][0] < _mMat[1][1]) {
-				fSum = 1.0f - _mMat[0][0] - _mMat[1][1] + _mMat[2][2];
-				m_vQuat = Vec4F(_mMat[2][0] + _mMat[0][2], _mMat[1][2] + _mMat[2][1], fSum, _mMat[0][1] - _mMat[1][0]);
-			}
-			else {
-				fSum = 1.0f + _mMat[0][0] + _mMat[1][1] + _mMat[2][2];
-				m_vQuat = Vec4F(_mMat[1][2] - _mMat[2][1], _mMat[2][0] - _mMat[0][2], _mMat[0][1] - _mMat[1][0], fSum);
-			}
-		}
-
-		m_vQuat *= 0.5f / sqrtf(fSum);
-	}
-	HC_INLINE float HC_VECTORCALL operator[](int _iNdx) const { return m_vQuat[_iNdx]; }
-	HC_INLINE float& HC_VECTORCALL operator[](int _iNdx) { return m_vQuat[_iNdx]; }
-	HC_INLINE float HC_VECTORCALL X() const { return m_vQuat.X(); }
-	HC_INLINE float HC_VECTORCALL Y() const { return m_vQuat.Y(); }
-	HC_INLINE float HC_VECTORCALL Z() const { return m_vQuat.Z(); }
-	HC_INLINE float HC_VECTORCALL W() const { return m_vQuat.W(); }
-	HC_INLINE void HC_VECTORCALL SetX(float _fX) { m_vQuat.SetX(_fX); }
-	HC_INLINE void HC_VECTORCALL SetY(float _fY) { m_vQuat.SetY(_fY); }
-	HC_INLINE void HC_VECTORCALL SetZ(float _fZ) { m_vQuat.SetZ(_fZ); }
-	HC_INLINE void HC_VECTORCALL SetW(float _fW) { m_vQuat.SetW(_fW); }
-};
-
-#else
-
 struct HC_ALIGNAS(16) QuaternionF
 {
 	union {
@@ -109,7 +60,7 @@ struct HC_ALIGNAS(16) QuaternionF
 		if (_mRotation[2][2] < 0.0f) {
 			if (_mRotation[0][0] > _mRotation[1][1]) {
 				fSum = 1.0f + _mRotation[0][0] - _mRotation[1][1] - _mRotation[2][2];
-				m_vQuat = Vec4F(fSum, _mRotation[0][1] + _mRotation[1][0], _mRotation[2][0] + _mRotation[0][2], _mRotation[1][2] - _mRotation[2][2]);
+				m_vQuat = Vec4F(fSum, _mRotation[0][1] + _mRotation[1][0], _mRotation[2][0] + _mRotation[0][2], _mRotation[1][2] - _mRotation[2][1]);
 			}
 			else {
 				fSum = 1.0f - _mRotation[0][0] + _mRotation[1][1] - _mRotation[2][2];
@@ -117,7 +68,7 @@ struct HC_ALIGNAS(16) QuaternionF
 			}
 		}
 		else {
-			if (_mRotation[0][0] < _mRotation[1][1]) {
+			if (_mRotation[0][0] < -_mRotation[1][1]) {
 				fSum = 1.0f - _mRotation[0][0] - _mRotation[1][1] + _mRotation[2][2];
 				m_vQuat = Vec4F(_mRotation[2][0] + _mRotation[0][2], _mRotation[1][2] + _mRotation[2][1], fSum, _mRotation[0][1] - _mRotation[1][0]);
 			}
@@ -160,12 +111,26 @@ HC_INLINE bool operator!=(const QuaternionF& _qLeft, const QuaternionF& _qRight)
 [[nodiscard]] HC_INLINE QuaternionF Cross(const QuaternionF& _qLeft, const QuaternionF& _qRight) { return Cross(_qLeft.m_vQuat, _qRight.m_vQuat); }
 [[nodiscard]] HC_INLINE QuaternionF Conjugate(const QuaternionF& _qQuat) { return QuaternionF(-_qQuat.x, -_qQuat.y, -_qQuat.z, _qQuat.w); }
 
+#if HC_USE_SIMD
+[[nodiscard]] HC_INLINE QuaternionF operator*(const QuaternionF& _qLeft, const QuaternionF& _qRight) {
+	const __m128 fLeft = _qLeft.m_vQuat.m_fVec;
+	const __m128 fRight = _qRight.m_vQuat.m_fVec;
+
+	__m128 fRes = _mm_mul_ps(HC_SHUFFLE4F(fLeft, 3, 3, 3, 3), fRight);
+	fRes = _mm_add_ps(fRes, _mm_xor_ps(_mm_mul_ps(HC_SHUFFLE4F(fLeft, 0, 0, 0, 0), HC_SHUFFLE4F(fRight, 3, 2, 1, 0)), _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f)));
+	fRes = _mm_add_ps(fRes, _mm_xor_ps(_mm_mul_ps(HC_SHUFFLE4F(fLeft, 1, 1, 1, 1), HC_SHUFFLE4F(fRight, 2, 3, 0, 1)), _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f)));
+	fRes = _mm_add_ps(fRes, _mm_xor_ps(_mm_mul_ps(HC_SHUFFLE4F(fLeft, 2, 2, 2, 2), HC_SHUFFLE4F(fRight, 1, 0, 3, 2)), _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f)));
+
+	return QuaternionF(Vec4F(fRes));
+}
+#else
 [[nodiscard]] HC_INLINE QuaternionF operator*(const QuaternionF& _qLeft, const QuaternionF& _qRight) {
 	return QuaternionF(_qLeft.w * _qRight.x + _qLeft.x * _qRight.w + _qLeft.y * _qRight.z - _qLeft.z * _qRight.y,
 		_qLeft.w * _qRight.y - _qLeft.x * _qRight.z + _qLeft.y * _qRight.w + _qLeft.z * _qRight.x,
 		_qLeft.w * _qRight.z + _qLeft.x * _qRight.y - _qLeft.y * _qRight.x + _qLeft.z * _qRight.w,
 		_qLeft.w * _qRight.w - _qLeft.x * _qRight.x - _qLeft.y * _qRight.y - _qLeft.z * _qRight.z);
 }
+#endif
 
 [[nodiscard]] HC_INLINE QuaternionF operator/(const QuaternionF& _qLeft, const QuaternionF& _qRight) { return _qLeft * (1.0f / _qRight); }
 [[nodiscard]] HC_INLINE Vec3F operator*(const QuaternionF& _qLeft, const Vec3F& _vRight) { return (_qLeft * QuaternionF(Vec4F(_vRight, 0.0f)) * Conjugate(_qLeft)).m_vQuat.XYZ(); }
@@ -210,6 +175,24 @@ HC_INLINE Vec4F& operator*=(Vec4F& _vLeft, const QuaternionF& _qRight) { _vLeft
 	return mRotationMat;
 }
 
+/// <summary>
+/// Builds ScaleXYZF(_vScale) * ExtractMatrix(_qRotation) * TranslationF(_vTranslation) directly, without the matrix products.
+/// Scale is applied first, in local space. The result can be inverted with InverseTRS.
+/// </summary>
+/// <param name="_vTranslation: Translation, written to the position row"></param>
+/// <param name="_qRotation: Unit quaternion rotation"></param>
+/// <param name="_vScale: Per axis scale"></param>
+[[nodiscard]] HC_INLINE MatrixF ComposeTRS(const Vec3F& _vTranslation, const QuaternionF& _qRotation, const Vec3F& _vScale) {
+	MatrixF mMat = ExtractMatrix(_qRotation);
+
+	mMat[0] *= _vScale.x;
+	mMat[1] *= _vScale.y;
+	mMat[2] *= _vScale.z;
+	mMat[3] = Vec4F(_vTranslation, 1.0f);
+
+	return mMat;
+}
+
 [[nodiscard]] HC_INLINE Vec3F ExtractEulerAngles(const QuaternionF& _qQuat) {
 	Vec3F vEulerAngles;
 	float fSin, fCos;
@@ -231,5 +214,3 @@ HC_INLINE Vec4F& operator*=(Vec4F& _vLeft, const QuaternionF& _qRight) { _vLeft
 	
 	return vEulerAngles;
 }
-
-#endif
\ No newline at end of file
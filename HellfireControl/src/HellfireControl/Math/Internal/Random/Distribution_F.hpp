@@ -0,0 +1,459 @@
+#pragma once
+
+#include <HellfireControl/Math/Random.hpp>
+#include <HellfireControl/Math/Internal/Approx/Approx_F.hpp>
+
+#include <cfloat>
+#include <span>
+#include <vector>
+
+/*
+* Batched samplers for the non-uniform distributions gameplay and rendering keep asking for. Every sampler is templated on
+* its generator and only calls FillUnsignedInts, so Random and RandomStream both work. Bits are drawn in blocks of
+* HC_DISTRIBUTION_BLOCK_SIZE; a rejection sampler may leave part of its last block unused, so the number of values a call
+* consumes from a RandomStream is not a function of the output size alone. Give each batch its own Substream when that matters.
+*/
+
+#define HC_DISTRIBUTION_BLOCK_SIZE 256
+#define HC_DISTRIBUTION_UNIT 5.9604644775390625e-8f	//2^-24, one step of a 24 bit uniform float
+
+#define HC_ZIGGURAT_LAYERS 128
+#define HC_ZIGGURAT_R 3.442619855899				//Start of the tail
+#define HC_ZIGGURAT_AREA 9.91256303526217e-3		//Area of each layer
+#define HC_ZIGGURAT_SCALE 16777216.0				//Range of the 25 bit signed value below the layer index
+
+//Below this mean Poisson sampling inverts the CDF directly. Above it, the PTRS rejection sampler is cheaper.
+#define HC_POISSON_INVERSION_LIMIT 10.0f
+
+#pragma region Kernels
+/// <summary>
+/// Hands out the bits of a generator one at a time, refilling HC_DISTRIBUTION_BLOCK_SIZE values at once.
+/// </summary>
+template<typename Generator>
+class RandomBitsF {
+private:
+	Generator& m_gGenerator;
+	alignas(16) uint32_t m_uBits[HC_DISTRIBUTION_BLOCK_SIZE];
+	int m_iNext = HC_DISTRIBUTION_BLOCK_SIZE;
+
+public:
+	HC_INLINE explicit RandomBitsF(Generator& _gGenerator) : m_gGenerator(_gGenerator) {}
+
+	[[nodiscard]] HC_INLINE uint32_t Next() {
+		if (m_iNext == HC_DISTRIBUTION_BLOCK_SIZE) {
+			m_gGenerator.FillUnsignedInts(std::span<uint32_t>(m_uBits));
+			m_iNext = 0;
+		}
+
+		return m_uBits[m_iNext++];
+	}
+
+	//Uniform in (0, 1), safe to take the log of
+	[[nodiscard]] HC_INLINE double NextOpenUnit() { return (static_cast<double>(Next() >> 8) + 0.5) * HC_DISTRIBUTION_UNIT; }
+};
+
+//Runs _fnKernel over _sCount outputs, HC_DISTRIBUTION_BLOCK_SIZE / _sBitsPerValue at a time, with exactly the bits each block needs
+template<typename Generator, typename Kernel>
+HC_INLINE void SampleBlocksF(Generator& _gGenerator, size_t _sCount, size_t _sBitsPerValue, Kernel _fnKernel) {
+	alignas(16) uint32_t uBits[HC_DISTRIBUTION_BLOCK_SIZE];
+	const size_t sBlock = HC_DISTRIBUTION_BLOCK_SIZE / _sBitsPerValue;
+
+	for (size_t sFirst = 0; sFirst < _sCount; sFirst += sBlock) {
+		const size_t sValues = std::min(sBlock, _sCount - sFirst);
+
+		_gGenerator.FillUnsignedInts(std::span<uint32_t>(uBits, sValues * _sBitsPerValue));
+		_fnKernel(sFirst, sValues, uBits);
+	}
+}
+
+//Four uniform floats in (0, 1) from four words of bits. Centering on the 24 bit step keeps 0 out for Log2.
+[[nodiscard]] HC_INLINE Vec4F OpenUnitsF(const uint32_t* _pBits) {
+#if HC_USE_SIMD
+	const __m128i iBits = _mm_srli_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_pBits)), 8);
+	return Vec4F(_mm_mul_ps(_mm_add_ps(_mm_cvtepi32_ps(iBits), _mm_set1_ps(0.5f)), _mm_set1_ps(HC_DISTRIBUTION_UNIT)));
+#else
+	return Vec4F((static_cast<float>(_pBits[0] >> 8) + 0.5f) * HC_DISTRIBUTION_UNIT, (static_cast<float>(_pBits[1] >> 8) + 0.5f) * HC_DISTRIBUTION_UNIT,
+		(static_cast<float>(_pBits[2] >> 8) + 0.5f) * HC_DISTRIBUTION_UNIT, (static_cast<float>(_pBits[3] >> 8) + 0.5f) * HC_DISTRIBUTION_UNIT);
+#endif
+}
+
+//Gathers lanes past the end of the bits as the last full word so the tail of a block can still run four wide
+[[nodiscard]] HC_INLINE Vec4F OpenUnitsF(const uint32_t* _pBits, size_t _sStride, size_t _sCount) {
+	uint32_t uLanes[4];
+
+	for (size_t sLane = 0; sLane < 4; ++sLane) { uLanes[sLane] = _pBits[std::min(sLane, _sCount - 1) * _sStride]; }
+
+	return OpenUnitsF(uLanes);
+}
+
+[[nodiscard]] HC_INLINE Vec4F SqrtF(const Vec4F& _vVal) {
+#if HC_USE_SIMD
+	return Vec4F(_mm_sqrt_ps(_vVal.m_fVec));
+#else
+	return Vec4F(sqrtf(_vVal[0]), sqrtf(_vVal[1]), sqrtf(_vVal[2]), sqrtf(_vVal[3]));
+#endif
+}
+
+/// <summary>
+/// The layers of the 128 layer normal ziggurat. A value lands under the curve without further tests whenever its magnitude
+/// is below m_uBound of its layer, which covers about 99% of draws.
+/// </summary>
+struct ZigguratF {
+	uint32_t m_uBound[HC_ZIGGURAT_LAYERS];
+	float m_fWidth[HC_ZIGGURAT_LAYERS];
+	float m_fHeight[HC_ZIGGURAT_LAYERS];
+
+	HC_INLINE ZigguratF() {
+		double dEdge = HC_ZIGGURAT_R, dPrevEdge = HC_ZIGGURAT_R;
+		const double dBase = HC_ZIGGURAT_AREA / exp(-0.5 * dEdge * dEdge);
+
+		m_uBound[0] = static_cast<uint32_t>((dEdge / dBase) * HC_ZIGGURAT_SCALE);
+		m_uBound[1] = 0U;
+		m_fWidth[0] = static_cast<float>(dBase / HC_ZIGGURAT_SCALE);
+		m_fWidth[HC_ZIGGURAT_LAYERS - 1] = static_cast<float>(dEdge / HC_ZIGGURAT_SCALE);
+		m_fHeight[0] = 1.0f;
+		m_fHeight[HC_ZIGGURAT_LAYERS - 1] = static_cast<float>(exp(-0.5 * dEdge * dEdge));
+
+		for (int iLayer = HC_ZIGGURAT_LAYERS - 2; iLayer >= 1; --iLayer) {
+			dEdge = sqrt(-2.0 * log(HC_ZIGGURAT_AREA / dEdge + exp(-0.5 * dEdge * dEdge)));
+			m_uBound[iLayer + 1] = static_cast<uint32_t>((dEdge / dPrevEdge) * HC_ZIGGURAT_SCALE);
+			dPrevEdge = dEdge;
+			m_fHeight[iLayer] = static_cast<float>(exp(-0.5 * dEdge * dEdge));
+			m_fWidth[iLayer] = static_cast<float>(dEdge / HC_ZIGGURAT_SCALE);
+		}
+	}
+};
+
+[[nodiscard]] HC_INLINE const ZigguratF& GetZigguratF() {
+	static const ZigguratF s_zTable;
+	return s_zTable;
+}
+
+//The rare draws that land outside a layer's inner rectangle: either the tail past HC_ZIGGURAT_R or the wedge under the curve
+template<typename Generator>
+[[nodiscard]] float SampleNormalSlowF(RandomBitsF<Generator>& _rBits, const ZigguratF& _zTable, uint32_t _uBits) {
+	for (;;) {
+		const int iLayer = static_cast<int>(_uBits >> 25);
+		const int32_t iVal = static_cast<int32_t>(_uBits << 7) >> 7;
+		const float fVal = static_cast<float>(iVal) * _zTable.m_fWidth[iLayer];
+
+		if (static_cast<uint32_t>(abs(iVal)) < _zTable.m_uBound[iLayer]) { return fVal; }
+
+		if (iLayer == 0) {
+			double dTail, dHeight;
+
+			do {
+				dTail = -log(_rBits.NextOpenUnit()) / HC_ZIGGURAT_R;
+				dHeight = -log(_rBits.NextOpenUnit());
+			} while (dHeight + dHeight < dTail * dTail);
+
+			return static_cast<float>(iVal > 0 ? HC_ZIGGURAT_R + dTail : -HC_ZIGGURAT_R - dTail);
+		}
+
+		const float fHeight = _zTable.m_fHeight[iLayer] + static_cast<float>(_rBits.NextOpenUnit()) * (_zTable.m_fHeight[iLayer - 1] - _zTable.m_fHeight[iLayer]);
+
+		if (fHeight < expf(-0.5f * fVal * fVal)) { return fVal; }
+
+		_uBits = _rBits.Next();
+	}
+}
+
+//Standard normal value. The high 7 bits pick the layer and the low 25 give the signed offset, so the two never share bits.
+//The lowest bits of xoshiro128+ are its weakest, so they only ever land in the least significant end of the offset.
+template<typename Generator>
+[[nodiscard]] HC_INLINE float SampleNormalF(RandomBitsF<Generator>& _rBits, const ZigguratF& _zTable) {
+	const uint32_t uBits = _rBits.Next();
+	const int iLayer = static_cast<int>(uBits >> 25);
+	const int32_t iVal = static_cast<int32_t>(uBits << 7) >> 7;
+
+	if (static_cast<uint32_t>(abs(iVal)) < _zTable.m_uBound[iLayer]) { return static_cast<float>(iVal) * _zTable.m_fWidth[iLayer]; }
+
+	return SampleNormalSlowF(_rBits, _zTable, uBits);
+}
+
+//Poisson by sequential search of the CDF, for small means
+template<typename Generator>
+[[nodiscard]] HC_INLINE uint32_t SamplePoissonInversionF(RandomBitsF<Generator>& _rBits, double _dMean, double _dZero) {
+	const double dUnit = _rBits.NextOpenUnit();
+	double dProb = _dZero, dSum = _dZero;
+	uint32_t uRes = 0U;
+
+	while (dUnit > dSum && dProb > 0.0) {
+		++uRes;
+		dProb *= _dMean / uRes;
+		dSum += dProb;
+	}
+
+	return uRes;
+}
+
+/// <summary>
+/// The constants of Hormann's PTRS sampler for one mean, computed once per batch.
+/// </summary>
+struct PoissonPTRSF {
+	double m_dMean, m_dLogMean, m_dA, m_dB, m_dInvAlpha, m_dAccept;
+
+	HC_INLINE explicit PoissonPTRSF(double _dMean) : m_dMean(_dMean), m_dLogMean(log(_dMean)) {
+		m_dB = 0.931 + 2.53 * sqrt(_dMean);
+		m_dA = -0.059 + 0.02483 * m_dB;
+		m_dInvAlpha = 1.1239 + 1.1328 / (m_dB - 3.4);
+		m_dAccept = 0.9277 - 3.6224 / (m_dB - 2.0);
+	}
+};
+
+//Poisson by transformed rejection with squeeze. Most draws are accepted by the squeeze without touching lgamma.
+template<typename Generator>
+[[nodiscard]] uint32_t SamplePoissonPTRSF(RandomBitsF<Generator>& _rBits, const PoissonPTRSF& _pConsts) {
+	for (;;) {
+		const double dU = _rBits.NextOpenUnit() - 0.5;
+		const double dV = _rBits.NextOpenUnit();
+		const double dUs = 0.5 - fabs(dU);
+		const double dK = floor((2.0 * _pConsts.m_dA / dUs + _pConsts.m_dB) * dU + _pConsts.m_dMean + 0.43);
+
+		if (dUs >= 0.07 && dV <= _pConsts.m_dAccept) { return static_cast<uint32_t>(dK); }
+
+		if (dK < 0.0 || (dUs < 0.013 && dV > dUs)) { continue; }
+
+		if (log(dV) + log(_pConsts.m_dInvAlpha) - log(_pConsts.m_dA / (dUs * dUs) + _pConsts.m_dB) <= -_pConsts.m_dMean + dK * _pConsts.m_dLogMean - lgamma(dK + 1.0)) {
+			return static_cast<uint32_t>(dK);
+		}
+	}
+}
+
+//Four points on the unit sphere from eight words of bits: height uniform in [-1, 1] and angle uniform around it (Archimedes)
+HC_INLINE void SampleOnSphereF(const uint32_t* _pBits, size_t _sCount, Vec3F* _pOut, MathPrecision _mpPrecision) {
+	const Vec4F vHeight = Vec4F(1.0f) - OpenUnitsF(_pBits, 2, _sCount) * 2.0f;
+	const Vec4F vRadius = SqrtF(Max(Vec4F(1.0f) - vHeight * vHeight, Vec4F(0.0f)));
+	Vec4F vSin, vCos;
+
+	Math::SinCos(OpenUnitsF(_pBits + 1, 2, _sCount) * HC_2PI, vSin, vCos, _mpPrecision);
+
+	const Vec4F vX = vRadius * vCos, vY = vRadius * vSin;
+
+	for (size_t sLane = 0; sLane < _sCount; ++sLane) { _pOut[sLane] = Vec3F(vX[static_cast<int>(sLane)], vY[static_cast<int>(sLane)], vHeight[static_cast<int>(sLane)]); }
+}
+
+//Four points in a disk of radius _fRadius. The square root undoes the area growing with radius, so points come out uniform.
+HC_INLINE void SampleInDiskF(const uint32_t* _pBits, size_t _sCount, Vec2F* _pOut, float _fRadius, MathPrecision _mpPrecision) {
+	const Vec4F vRadius = SqrtF(OpenUnitsF(_pBits, 2, _sCount)) * _fRadius;
+	Vec4F vSin, vCos;
+
+	Math::SinCos(OpenUnitsF(_pBits + 1, 2, _sCount) * HC_2PI, vSin, vCos, _mpPrecision);
+
+	const Vec4F vX = vRadius * vCos, vY = vRadius * vSin;
+
+	for (size_t sLane = 0; sLane < _sCount; ++sLane) { _pOut[sLane] = Vec2F(vX[static_cast<int>(sLane)], vY[static_cast<int>(sLane)]); }
+}
+#pragma endregion
+
+/// <summary>
+/// Draws indices in proportion to a fixed set of weights in constant time, using Vose's alias method. Building the table
+/// is O(n); each draw then costs one 32-bit value and no search.
+/// </summary>
+class AliasTable {
+private:
+	/// <summary>
+	/// One column of the table: keep the column when the coin is below m_uThreshold, otherwise take m_uAlias.
+	/// </summary>
+	struct Entry {
+		uint32_t m_uThreshold;
+		uint32_t m_uAlias;
+	};
+
+	/// <summary>
+	/// The columns, one per weight
+	/// </summary>
+	std::vector<Entry> m_eEntries;
+
+public:
+	/// <summary>
+	/// Builds the table. Weights need not sum to one, but must be non-negative and not all zero.
+	/// </summary>
+	/// <param name="_fWeights: Relative weight of each index"></param>
+	HC_INLINE explicit AliasTable(std::span<const float> _fWeights) : m_eEntries(_fWeights.size()) {
+		assert(!_fWeights.empty() && _fWeights.size() <= UINT_MAX);
+
+		double dTotal = 0.0;
+		for (const float fWeight : _fWeights) {
+			assert(fWeight >= 0.0f && fWeight <= FLT_MAX);
+			dTotal += fWeight;
+		}
+
+		assert(dTotal > 0.0);
+
+		const double dScale = static_cast<double>(_fWeights.size()) / dTotal;
+		std::vector<double> vScaled(_fWeights.size());
+		std::vector<uint32_t> vSmall, vLarge;
+
+		for (uint32_t uNdx = 0; uNdx < _fWeights.size(); ++uNdx) {
+			vScaled[uNdx] = _fWeights[uNdx] * dScale;
+			(vScaled[uNdx] < 1.0 ? vSmall : vLarge).push_back(uNdx);
+		}
+
+		while (!vSmall.empty() && !vLarge.empty()) {
+			const uint32_t uSmall = vSmall.back(), uLarge = vLarge.back();
+			vSmall.pop_back();
+			vLarge.pop_back();
+
+			m_eEntries[uSmall] = { static_cast<uint32_t>(vScaled[uSmall] * 4294967296.0), uLarge };
+
+			vScaled[uLarge] = (vScaled[uLarge] + vScaled[uSmall]) - 1.0;
+			(vScaled[uLarge] < 1.0 ? vSmall : vLarge).push_back(uLarge);
+		}
+
+		//Whatever is left is full up to rounding, so it always keeps its own index
+		for (const uint32_t uNdx : vSmall) { m_eEntries[uNdx] = { UINT_MAX, uNdx }; }
+		for (const uint32_t uNdx : vLarge) { m_eEntries[uNdx] = { UINT_MAX, uNdx }; }
+	}
+
+	/// <summary>
+	/// Returns the number of weights in the table.
+	/// </summary>
+	[[nodiscard]] HC_INLINE size_t GetSize() const { return m_eEntries.size(); }
+
+	/// <summary>
+	/// Draws one index.
+	/// </summary>
+	/// <param name="_gGenerator: Random or RandomStream to draw from"></param>
+	/// <returns>
+	/// uint32_t: An index into the weights, chosen in proportion to its weight
+	/// </returns>
+	template<typename Generator>
+	[[nodiscard]] HC_INLINE uint32_t Sample(Generator& _gGenerator) const {
+		uint32_t uBits;
+		_gGenerator.FillUnsignedInts(std::span<uint32_t>(&uBits, 1));
+		return Select(uBits);
+	}
+
+	/// <summary>
+	/// Fills _uOut with independent draws.
+	/// </summary>
+	/// <param name="_gGenerator: Random or RandomStream to draw from"></param>
+	/// <param name="_uOut: Indices to overwrite"></param>
+	template<typename Generator>
+	HC_INLINE void Sample(Generator& _gGenerator, std::span<uint32_t> _uOut) const {
+		_gGenerator.FillUnsignedInts(_uOut);
+		for (uint32_t& uVal : _uOut) { uVal = Select(uVal); }
+	}
+
+private:
+	/// <summary>
+	/// Maps 32 random bits to an index. The high half of _uBits * size picks the column and the low half is the coin.
+	/// </summary>
+	[[nodiscard]] HC_INLINE uint32_t Select(uint32_t _uBits) const {
+		const uint64_t uProduct = static_cast<uint64_t>(_uBits) * m_eEntries.size();
+		const Entry& eEntry = m_eEntries[static_cast<size_t>(uProduct >> 32)];
+
+		return static_cast<uint32_t>(uProduct) < eEntry.m_uThreshold ? static_cast<uint32_t>(uProduct >> 32) : eEntry.m_uAlias;
+	}
+};
+
+namespace Math {
+	/// <summary>
+	/// Fills _fOut with normally distributed values using the Marsaglia-Tsang ziggurat.
+	/// </summary>
+	/// <param name="_gGenerator: Random or RandomStream to draw from"></param>
+	/// <param name="_fOut: Values to overwrite"></param>
+	/// <param name="_fMean: Mean of the distribution"></param>
+	/// <param name="_fStdDev: Standard deviation of the distribution"></param>
+	template<typename Generator>
+	HC_INLINE void SampleNormal(Generator& _gGenerator, std::span<float> _fOut, float _fMean = 0.0f, float _fStdDev = 1.0f) {
+		const ZigguratF& zTable = GetZigguratF();
+		RandomBitsF<Generator> rBits(_gGenerator);
+
+		for (float& fVal : _fOut) { fVal = _fMean + _fStdDev * SampleNormalF(rBits, zTable); }
+	}
+
+	/// <summary>
+	/// Fills _fOut with exponentially distributed values, four at a time, by inverting the CDF.
+	/// </summary>
+	/// <param name="_gGenerator: Random or RandomStream to draw from"></param>
+	/// <param name="_fOut: Values to overwrite"></param>
+	/// <param name="_fRate: Events per unit. The mean of the result is 1 / _fRate"></param>
+	/// <param name="_mpPrecision: PRECISION_FAST swaps the log for the polynomial in Approx_F.hpp"></param>
+	template<typename Generator>
+	HC_INLINE void SampleExponential(Generator& _gGenerator, std::span<float> _fOut, float _fRate = 1.0f, MathPrecision _mpPrecision = HC_MATH_PRECISION) {
+		assert(_fRate > 0.0f);
+
+		const float fScale = -HC_APPROX_LN2 / _fRate;
+
+		SampleBlocksF(_gGenerator, _fOut.size(), 1, [&](size_t _sFirst, size_t _sCount, const uint32_t* _pBits) {
+			for (size_t sNdx = 0; sNdx < _sCount; sNdx += 4) {
+				const size_t sLanes = std::min<size_t>(4, _sCount - sNdx);
+				const Vec4F vRes = Log2(OpenUnitsF(_pBits + sNdx, 1, sLanes), _mpPrecision) * fScale;
+
+				for (size_t sLane = 0; sLane < sLanes; ++sLane) { _fOut[_sFirst + sNdx + sLane] = vRes[static_cast<int>(sLane)]; }
+			}
+		});
+	}
+
+	/// <summary>
+	/// Fills _uOut with Poisson distributed counts. Small means search the CDF, larger ones use Hormann's PTRS rejection sampler.
+	/// </summary>
+	/// <param name="_gGenerator: Random or RandomStream to draw from"></param>
+	/// <param name="_uOut: Counts to overwrite"></param>
+	/// <param name="_fMean: Expected number of events"></param>
+	template<typename Generator>
+	HC_INLINE void SamplePoisson(Generator& _gGenerator, std::span<uint32_t> _uOut, float _fMean) {
+		assert(_fMean >= 0.0f);
+
+		RandomBitsF<Generator> rBits(_gGenerator);
+
+		if (_fMean < HC_POISSON_INVERSION_LIMIT) {
+			const double dZero = exp(-static_cast<double>(_fMean));
+			for (uint32_t& uVal : _uOut) { uVal = SamplePoissonInversionF(rBits, _fMean, dZero); }
+			return;
+		}
+
+		const PoissonPTRSF pConsts = PoissonPTRSF(_fMean);
+		for (uint32_t& uVal : _uOut) { uVal = SamplePoissonPTRSF(rBits, pConsts); }
+	}
+
+	/// <summary>
+	/// Fills _vOut with points uniformly distributed on the unit sphere, four at a time.
+	/// </summary>
+	/// <param name="_gGenerator: Random or RandomStream to draw from"></param>
+	/// <param name="_vOut: Directions to overwrite"></param>
+	/// <param name="_mpPrecision: PRECISION_FAST swaps sin and cos for the polynomials in Approx_F.hpp"></param>
+	template<typename Generator>
+	HC_INLINE void SampleOnSphere(Generator& _gGenerator, std::span<Vec3F> _vOut, MathPrecision _mpPrecision = HC_MATH_PRECISION) {
+		SampleBlocksF(_gGenerator, _vOut.size(), 2, [&](size_t _sFirst, size_t _sCount, const uint32_t* _pBits) {
+			for (size_t sNdx = 0; sNdx < _sCount; sNdx += 4) {
+				SampleOnSphereF(_pBits + sNdx * 2, std::min<size_t>(4, _sCount - sNdx), _vOut.data() + _sFirst + sNdx, _mpPrecision);
+			}
+		});
+	}
+
+	/// <summary>
+	/// Fills _vOut with points uniformly distributed on the half of the unit sphere that _vNormal points into.
+	/// </summary>
+	/// <param name="_gGenerator: Random or RandomStream to draw from"></param>
+	/// <param name="_vOut: Directions to overwrite"></param>
+	/// <param name="_vNormal: Pole of the hemisphere. Need not be normalized"></param>
+	/// <param name="_mpPrecision: PRECISION_FAST swaps sin and cos for the polynomials in Approx_F.hpp"></param>
+	template<typename Generator>
+	HC_INLINE void SampleOnHemisphere(Generator& _gGenerator, std::span<Vec3F> _vOut, const Vec3F& _vNormal, MathPrecision _mpPrecision = HC_MATH_PRECISION) {
+		SampleOnSphere(_gGenerator, _vOut, _mpPrecision);
+
+		//Mirroring the lower half onto the upper keeps the density uniform
+		for (Vec3F& vDir : _vOut) {
+			if (Dot(vDir, _vNormal) < 0.0f) { vDir = -vDir; }
+		}
+	}
+
+	/// <summary>
+	/// Fills _vOut with points uniformly distributed inside a disk centered on the origin, four at a time.
+	/// </summary>
+	/// <param name="_gGenerator: Random or RandomStream to draw from"></param>
+	/// <param name="_vOut: Points to overwrite"></param>
+	/// <param name="_fRadius: Radius of the disk"></param>
+	/// <param name="_mpPrecision: PRECISION_FAST swaps sin and cos for the polynomials in Approx_F.hpp"></param>
+	template<typename Generator>
+	HC_INLINE void SampleInDisk(Generator& _gGenerator, std::span<Vec2F> _vOut, float _fRadius = 1.0f, MathPrecision _mpPrecision = HC_MATH_PRECISION) {
+		SampleBlocksF(_gGenerator, _vOut.size(), 2, [&](size_t _sFirst, size_t _sCount, const uint32_t* _pBits) {
+			for (size_t sNdx = 0; sNdx < _sCount; sNdx += 4) {
+				SampleInDiskF(_pBits + sNdx * 2, std::min<size_t>(4, _sCount - sNdx), _vOut.data() + _sFirst + sNdx, _fRadius, _mpPrecision);
+			}
+		});
+	}
+}
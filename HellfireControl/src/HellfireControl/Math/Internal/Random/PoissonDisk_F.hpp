@@ -0,0 +1,282 @@
+#pragma once
+
+#include <HellfireControl/Math/Internal/Random/Distribution_F.hpp>
+
+#include <array>
+#include <vector>
+
+/*
+* Poisson-disk point sets after Bridson, "Fast Poisson Disk Sampling in Arbitrary Dimensions". New points are proposed in
+* the shell between r and 2r around an active point and tested only against the handful of grid cells within r, so a set
+* of n points costs O(n) rather than the O(n^2) of testing every candidate against every point. The grid cells are at most
+* r / sqrt(dimensions) wide, so each holds at most one point. The wrapped variants treat the domain as a torus, which makes
+* the result tile without seams.
+*/
+
+#define HC_POISSON_DISK_ATTEMPTS 30	//Candidates tried around an active point before it is retired. Bridson's k.
+#define HC_POISSON_DISK_EMPTY -1.0e18f	//Coordinate of the point parked in empty cells, far enough that it never conflicts
+
+#pragma region Kernels
+//A uniform point in the 2D annulus between _fRadius and twice _fRadius. The fast sin and cos only nudge where candidates land;
+//spacing is still checked exactly.
+template<typename Generator>
+[[nodiscard]] HC_INLINE Vec2F PoissonDiskOffsetF(RandomBitsF<Generator>& _rBits, float _fRadius, Vec2F) {
+	float fSin, fCos;
+	Math::SinCos(static_cast<float>(_rBits.NextOpenUnit()) * HC_2PI, fSin, fCos, PRECISION_FAST);
+
+	const float fDistance = _fRadius * sqrtf(1.0f + 3.0f * static_cast<float>(_rBits.NextOpenUnit()));
+
+	return Vec2F(fCos * fDistance, fSin * fDistance);
+}
+
+//A uniform point in the 3D shell between _fRadius and twice _fRadius
+template<typename Generator>
+[[nodiscard]] HC_INLINE Vec3F PoissonDiskOffsetF(RandomBitsF<Generator>& _rBits, float _fRadius, Vec3F) {
+	const float fHeight = 1.0f - 2.0f * static_cast<float>(_rBits.NextOpenUnit());
+	const float fRing = sqrtf(fmaxf(1.0f - fHeight * fHeight, 0.0f));
+	float fSin, fCos;
+	Math::SinCos(static_cast<float>(_rBits.NextOpenUnit()) * HC_2PI, fSin, fCos, PRECISION_FAST);
+
+	const float fDistance = _fRadius * cbrtf(1.0f + 7.0f * static_cast<float>(_rBits.NextOpenUnit()));
+
+	return Vec3F(fRing * fCos * fDistance, fRing * fSin * fDistance, fHeight * fDistance);
+}
+
+/// <summary>
+/// The acceleration grid over the domain. Each cell holds a copy of the one point inside it, so the neighborhood test reads
+/// contiguous memory and never branches on emptiness: empty cells hold a point at HC_POISSON_DISK_EMPTY on every axis.
+/// Unwrapped grids carry a border of empty cells as deep as the search reach, so the neighborhood walk needs no bounds checks.
+/// </summary>
+template<typename Vec, int Dims>
+struct PoissonDiskGridF {
+	Vec m_vExtent;
+	float m_fRadiusSquared;
+	bool m_bWrap;
+	int m_iCells[Dims];
+	int m_iReach;
+	int m_iBorder;
+	size_t m_sStride[Dims];
+	float m_fInvCell[Dims];
+	std::vector<Vec> m_vGrid;
+
+	//Offsets of the neighboring cells close enough to hold a conflicting point, as cell coordinates and as flat grid steps
+	std::vector<std::array<int, Dims>> m_iOffsets;
+	std::vector<ptrdiff_t> m_iSteps;
+
+	HC_INLINE PoissonDiskGridF(const Vec& _vExtent, float _fRadius, bool _bWrap) : m_vExtent(_vExtent), m_fRadiusSquared(_fRadius * _fRadius), m_bWrap(_bWrap) {
+		const float fMaxCell = _fRadius / sqrtf(static_cast<float>(Dims));
+		size_t sTotal = 1;
+
+		m_iReach = 1;
+		for (int iAxis = 0; iAxis < Dims; ++iAxis) {
+			//Rounding the count up shrinks the cells just enough that whole cells cover the domain, which wrapping needs
+			m_iCells[iAxis] = std::max(1, static_cast<int>(ceilf(_vExtent[iAxis] / fMaxCell)));
+			m_fInvCell[iAxis] = static_cast<float>(m_iCells[iAxis]) / _vExtent[iAxis];
+			m_iReach = std::max(m_iReach, static_cast<int>(ceilf(_fRadius * m_fInvCell[iAxis])));
+		}
+
+		m_iBorder = _bWrap ? 0 : m_iReach;
+		for (int iAxis = 0; iAxis < Dims; ++iAxis) {
+			m_sStride[iAxis] = sTotal;
+			sTotal *= static_cast<size_t>(m_iCells[iAxis] + 2 * m_iBorder);
+		}
+
+		Vec vEmpty;
+		for (int iAxis = 0; iAxis < Dims; ++iAxis) { vEmpty[iAxis] = HC_POISSON_DISK_EMPTY; }
+
+		m_vGrid.assign(sTotal, vEmpty);
+
+		//Keep only the cells whose nearest corner is within the radius. In 2D that drops the four corners of the 5x5 block.
+		std::array<int, Dims> iOffset;
+		iOffset.fill(-m_iReach);
+
+		for (;;) {
+			float fNearest = 0.0f;
+			ptrdiff_t iStep = 0;
+
+			for (int iAxis = 0; iAxis < Dims; ++iAxis) {
+				const float fGap = static_cast<float>(std::max(abs(iOffset[iAxis]) - 1, 0)) / m_fInvCell[iAxis];
+				fNearest += fGap * fGap;
+				iStep += static_cast<ptrdiff_t>(iOffset[iAxis]) * static_cast<ptrdiff_t>(m_sStride[iAxis]);
+			}
+
+			if (fNearest < m_fRadiusSquared) {
+				m_iOffsets.push_back(iOffset);
+				m_iSteps.push_back(iStep);
+			}
+
+			int iAxis = 0;
+			for (; iAxis < Dims && ++iOffset[iAxis] > m_iReach; ++iAxis) { iOffset[iAxis] = -m_iReach; }
+			if (iAxis == Dims) { break; }
+		}
+	}
+
+	[[nodiscard]] HC_INLINE int GetCell(const Vec& _vPoint, int _iAxis) const {
+		return std::min(static_cast<int>(_vPoint[_iAxis] * m_fInvCell[_iAxis]), m_iCells[_iAxis] - 1);
+	}
+
+	[[nodiscard]] HC_INLINE size_t GetIndex(const int* _pCell) const {
+		size_t sRes = 0;
+
+		for (int iAxis = 0; iAxis < Dims; ++iAxis) { sRes += static_cast<size_t>(_pCell[iAxis] + m_iBorder) * m_sStride[iAxis]; }
+
+		return sRes;
+	}
+
+	[[nodiscard]] HC_INLINE float DistanceSquared(const Vec& _vLeft, const Vec& _vRight) const {
+		float fRes = 0.0f;
+
+		for (int iAxis = 0; iAxis < Dims; ++iAxis) {
+			float fDelta = fabsf(_vLeft[iAxis] - _vRight[iAxis]);
+			if (m_bWrap) { fDelta = fminf(fDelta, m_vExtent[iAxis] - fDelta); }
+			fRes += fDelta * fDelta;
+		}
+
+		return fRes;
+	}
+
+	//Brings _vPoint back into the domain, wrapping it around when the grid is a torus. False when it fell outside.
+	[[nodiscard]] HC_INLINE bool Contain(Vec& _vPoint) const {
+		for (int iAxis = 0; iAxis < Dims; ++iAxis) {
+			if (_vPoint[iAxis] >= 0.0f && _vPoint[iAxis] < m_vExtent[iAxis]) { continue; }
+			if (!m_bWrap) { return false; }
+
+			_vPoint[iAxis] -= floorf(_vPoint[iAxis] / m_vExtent[iAxis]) * m_vExtent[iAxis];
+			if (_vPoint[iAxis] >= m_vExtent[iAxis]) { _vPoint[iAxis] = 0.0f; }
+		}
+
+		return true;
+	}
+
+	//True when no accepted point lies within the radius of _vPoint
+	[[nodiscard]] HC_INLINE bool IsFree(const Vec& _vPoint) const {
+		int iCenter[Dims];
+		bool bInterior = true;
+
+		for (int iAxis = 0; iAxis < Dims; ++iAxis) {
+			iCenter[iAxis] = GetCell(_vPoint, iAxis);
+			bInterior &= iCenter[iAxis] >= m_iReach && iCenter[iAxis] < m_iCells[iAxis] - m_iReach;
+		}
+
+		//Unwrapped grids and cells away from the seams walk flat steps from the center
+		if (!m_bWrap || bInterior) {
+			const Vec* pCenter = m_vGrid.data() + GetIndex(iCenter);
+
+			for (const ptrdiff_t iStep : m_iSteps) {
+				if (DistanceSquared(_vPoint, pCenter[iStep]) < m_fRadiusSquared) { return false; }
+			}
+
+			return true;
+		}
+
+		for (const std::array<int, Dims>& iOffset : m_iOffsets) {
+			int iCell[Dims];
+
+			for (int iAxis = 0; iAxis < Dims; ++iAxis) { iCell[iAxis] = ((iCenter[iAxis] + iOffset[iAxis]) % m_iCells[iAxis] + m_iCells[iAxis]) % m_iCells[iAxis]; }
+
+			if (DistanceSquared(_vPoint, m_vGrid[GetIndex(iCell)]) < m_fRadiusSquared) { return false; }
+		}
+
+		return true;
+	}
+
+	HC_INLINE void Insert(const Vec& _vPoint) {
+		int iCell[Dims];
+
+		for (int iAxis = 0; iAxis < Dims; ++iAxis) { iCell[iAxis] = GetCell(_vPoint, iAxis); }
+
+		m_vGrid[GetIndex(iCell)] = _vPoint;
+	}
+};
+
+template<typename Vec, int Dims, typename Generator>
+[[nodiscard]] std::vector<Vec> PoissonDiskF(Generator& _gGenerator, const Vec& _vExtent, float _fRadius, int _iAttempts, bool _bWrap) {
+	assert(_fRadius > 0.0f && _iAttempts > 0);
+
+	PoissonDiskGridF<Vec, Dims> pGrid = PoissonDiskGridF<Vec, Dims>(_vExtent, _fRadius, _bWrap);
+	RandomBitsF<Generator> rBits(_gGenerator);
+	std::vector<Vec> vPoints;
+	std::vector<uint32_t> vActive;
+
+	Vec vFirst;
+	for (int iAxis = 0; iAxis < Dims; ++iAxis) { vFirst[iAxis] = static_cast<float>(rBits.NextOpenUnit()) * _vExtent[iAxis]; }
+
+	vPoints.push_back(vFirst);
+	vActive.push_back(0U);
+	pGrid.Insert(vFirst);
+
+	while (!vActive.empty()) {
+		const size_t sActive = static_cast<size_t>((static_cast<uint64_t>(rBits.Next()) * vActive.size()) >> 32);
+		const Vec vCenter = vPoints[vActive[sActive]];
+		bool bPlaced = false;
+
+		for (int iAttempt = 0; iAttempt < _iAttempts && !bPlaced; ++iAttempt) {
+			Vec vCandidate = vCenter + PoissonDiskOffsetF(rBits, _fRadius, Vec());
+
+			if (!pGrid.Contain(vCandidate) || !pGrid.IsFree(vCandidate)) { continue; }
+
+			pGrid.Insert(vCandidate);
+			vActive.push_back(static_cast<uint32_t>(vPoints.size()));
+			vPoints.push_back(vCandidate);
+			bPlaced = true;
+		}
+
+		//A point that could not place anything around it never will, so it leaves the active list for good
+		if (!bPlaced) {
+			vActive[sActive] = vActive.back();
+			vActive.pop_back();
+		}
+	}
+
+	return vPoints;
+}
+#pragma endregion
+
+namespace Math {
+	/// <summary>
+	/// Scatters points over the rectangle from the origin to _vExtent so that no two are closer than _fRadius, and no gap is
+	/// left where another would fit. Runs in time linear in the number of points.
+	/// </summary>
+	/// <param name="_gGenerator: Random or RandomStream to draw from"></param>
+	/// <param name="_vExtent: Size of the domain"></param>
+	/// <param name="_fRadius: Minimum distance between points"></param>
+	/// <param name="_iAttempts: Candidates tried around each point. Higher packs slightly tighter and costs more"></param>
+	/// <returns>
+	/// std::vector&lt;Vec2F&gt;: The points, in the order they were placed
+	/// </returns>
+	template<typename Generator>
+	[[nodiscard]] HC_INLINE std::vector<Vec2F> PoissonDisk(Generator& _gGenerator, const Vec2F& _vExtent, float _fRadius, int _iAttempts = HC_POISSON_DISK_ATTEMPTS) {
+		return PoissonDiskF<Vec2F, 2>(_gGenerator, _vExtent, _fRadius, _iAttempts, false);
+	}
+
+	/// <summary>
+	/// Scatters points through the box from the origin to _vExtent so that no two are closer than _fRadius.
+	/// </summary>
+	/// <param name="_gGenerator: Random or RandomStream to draw from"></param>
+	/// <param name="_vExtent: Size of the domain"></param>
+	/// <param name="_fRadius: Minimum distance between points"></param>
+	/// <param name="_iAttempts: Candidates tried around each point. Higher packs slightly tighter and costs more"></param>
+	/// <returns>
+	/// std::vector&lt;Vec3F&gt;: The points, in the order they were placed
+	/// </returns>
+	template<typename Generator>
+	[[nodiscard]] HC_INLINE std::vector<Vec3F> PoissonDisk(Generator& _gGenerator, const Vec3F& _vExtent, float _fRadius, int _iAttempts = HC_POISSON_DISK_ATTEMPTS) {
+		return PoissonDiskF<Vec3F, 3>(_gGenerator, _vExtent, _fRadius, _iAttempts, false);
+	}
+
+	/// <summary>
+	/// Generates a blue-noise tile over the unit square. Distances wrap around the edges, so copies of the tile laid side by
+	/// side keep the spacing across the seams. Generate once, then scale and repeat it for placement or dither patterns.
+	/// </summary>
+	/// <param name="_gGenerator: Random or RandomStream to draw from"></param>
+	/// <param name="_fRadius: Minimum distance between points, as a fraction of the tile. Must be below 0.5"></param>
+	/// <param name="_iAttempts: Candidates tried around each point"></param>
+	/// <returns>
+	/// std::vector&lt;Vec2F&gt;: The points, each in [0, 1)
+	/// </returns>
+	template<typename Generator>
+	[[nodiscard]] HC_INLINE std::vector<Vec2F> BlueNoiseTile(Generator& _gGenerator, float _fRadius, int _iAttempts = HC_POISSON_DISK_ATTEMPTS) {
+		assert(_fRadius < 0.5f);
+		return PoissonDiskF<Vec2F, 2>(_gGenerator, Vec2F(1.0f, 1.0f), _fRadius, _iAttempts, true);
+	}
+}
@@ -5,6 +5,69 @@
 #include <HellfireControl/Math/Random.hpp>
 #include <HellfireControl/Math/Internal/Random/Random_Common.hpp>
 
+#if HC_USE_SIMD
+//One xoshiro128+ step on every lane
+HC_INLINE __m128i HC_VECTORCALL NextLanesF(__m128i (&_iState)[4]) {
+	const __m128i iRes = _mm_add_epi32(_iState[0], _iState[3]);
+	const __m128i iShifted = _mm_slli_epi32(_iState[1], 9);
+
+	_iState[2] = _mm_xor_si128(_iState[2], _iState[0]);
+	_iState[3] = _mm_xor_si128(_iState[3], _iState[1]);
+	_iState[1] = _mm_xor_si128(_iState[1], _iState[2]);
+	_iState[0] = _mm_xor_si128(_iState[0], _iState[3]);
+	_iState[2] = _mm_xor_si128(_iState[2], iShifted);
+	_iState[3] = _mm_or_si128(_mm_slli_epi32(_iState[3], 11), _mm_srli_epi32(_iState[3], 21));
+
+	return iRes;
+}
+
+//Runs _fnKernel on _sSteps consecutive lane steps, keeping the state in registers throughout
+template<typename Kernel>
+HC_INLINE void FillLanesF(uint32_t (&_uLanes)[4][4], size_t _sSteps, Kernel _fnKernel) {
+	__m128i iState[4];
+	for (int iWord = 0; iWord < 4; ++iWord) { iState[iWord] = _mm_load_si128(reinterpret_cast<const __m128i*>(_uLanes[iWord])); }
+
+	for (size_t sStep = 0; sStep < _sSteps; ++sStep) { _fnKernel(sStep, NextLanesF(iState)); }
+
+	for (int iWord = 0; iWord < 4; ++iWord) { _mm_store_si128(reinterpret_cast<__m128i*>(_uLanes[iWord]), iState[iWord]); }
+}
+
+//Maps the top 24 bits of each lane onto [_fMin, _fMin + _fRange]
+HC_INLINE __m128 HC_VECTORCALL LanesToFloatF(__m128i _iBits, __m128 _fMin, __m128 _fRange) {
+	return _mm_add_ps(_fMin, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(_iBits, 8)), _fRange));
+}
+#else
+struct RandomLanes { uint32_t m_uLanes[4]; };
+
+HC_INLINE RandomLanes NextLanesF(uint32_t (&_uState)[4][4]) {
+	RandomLanes rRes;
+
+	for (int iLane = 0; iLane < 4; ++iLane) {
+		const uint32_t uShifted = _uState[1][iLane] << 9;
+		rRes.m_uLanes[iLane] = _uState[0][iLane] + _uState[3][iLane];
+
+		_uState[2][iLane] ^= _uState[0][iLane];
+		_uState[3][iLane] ^= _uState[1][iLane];
+		_uState[1][iLane] ^= _uState[2][iLane];
+		_uState[0][iLane] ^= _uState[3][iLane];
+		_uState[2][iLane] ^= uShifted;
+		_uState[3][iLane] = (_uState[3][iLane] << 11) | (_uState[3][iLane] >> 21);
+	}
+
+	return rRes;
+}
+
+template<typename Kernel>
+HC_INLINE void FillLanesF(uint32_t (&_uLanes)[4][4], size_t _sSteps, Kernel _fnKernel) {
+	for (size_t sStep = 0; sStep < _sSteps; ++sStep) { _fnKernel(sStep, NextLanesF(_uLanes)); }
+}
+
+HC_INLINE float LanesToFloatF(uint32_t _uBits, float _fMin, float _fRange) { return _fMin + static_cast<float>(_uBits >> 8) * _fRange; }
+#endif
+
+//2^-24, the spacing of the 24 bit values LanesToFloatF scales
+#define HC_RANDOM_FLOAT_STEP 5.9604644775390625e-8f
+
 Random::Random() {
 	m_uSeed = (uint64_t)time(NULL);
 
@@ -15,6 +78,7 @@ Random::Random() {
 	}
 
 	Regenerate();
+	SeedLanes();
 }
 
 Random::Random(uint64_t _uSeed) {
@@ -27,66 +91,83 @@ Random::Random(uint64_t _uSeed) {
 	}
 
 	Regenerate();
+	SeedLanes();
 }
 
-char Random::GenerateChar(char _cMin = 0, char _cMax = CHAR_MAX) {
+char Random::GenerateChar(char _cMin, char _cMax) {
 	if (_cMax < _cMin) return GenerateChar(_cMax, _cMin);
 
-	uint64_t u32Range = static_cast<uint64_t>(_cMax - _cMin + 1);
-
-	return static_cast<char>(GetNextVal() % u32Range) + _cMin;
+	return static_cast<char>(GenerateBounded(static_cast<uint32_t>(_cMax - _cMin + 1)) + _cMin);
 }
 
-short Random::GenerateShort(short _sMin = 0, short _sMax = SHRT_MAX) {
+short Random::GenerateShort(short _sMin, short _sMax) {
 	if (_sMax < _sMin) return GenerateShort(_sMax, _sMin);
 
-	uint64_t u32Range = static_cast<uint64_t>(_sMax - _sMin + 1);
-
-	return static_cast<short>(GetNextVal() % u32Range) + _sMin;
+	return static_cast<short>(GenerateBounded(static_cast<uint32_t>(_sMax - _sMin + 1)) + _sMin);
 }
 
-int Random::GenerateInt(int _iMin = 0, int _iMax = INT_MAX) {
+int Random::GenerateInt(int _iMin, int _iMax) {
 	if (_iMax < _iMin) return GenerateInt(_iMax, _iMin);
 
-	uint64_t u32Range = static_cast<uint64_t>(_iMax - _iMin + 1);
+	//Wraps to 0 for the full range of int, which needs no reduction
+	const uint32_t u32Range = static_cast<uint32_t>(_iMax) - static_cast<uint32_t>(_iMin) + 1U;
+	const uint32_t u32Offset = u32Range != 0U ? GenerateBounded(u32Range) : static_cast<uint32_t>(GetNextVal());
 
-	return static_cast<int>(GetNextVal() % u32Range) + _iMin;
+	return static_cast<int>(static_cast<uint32_t>(_iMin) + u32Offset);
 }
 
-uint32_t Random::GenerateUnsignedInt(uint32_t _uMin = 0, uint32_t _uMax = UINT_MAX) {
+uint32_t Random::GenerateUnsignedInt(uint32_t _uMin, uint32_t _uMax) {
 	if (_uMax < _uMin) return GenerateUnsignedInt(_uMax, _uMin);
 
-	uint32_t u32Range = _uMax - _uMin;
+	const uint32_t u32Range = _uMax - _uMin;
 	
-	return (GetNextVal() % u32Range) + _uMin;
+	return u32Range != 0U ? GenerateBounded(u32Range) + _uMin : _uMin;
 }
 
-int64_t Random::GenerateLong(int64_t _lMin = 0, int64_t _lMax = LLONG_MAX) {
+int64_t Random::GenerateLong(int64_t _lMin, int64_t _lMax) {
 	if (_lMax < _lMin) return GenerateLong(_lMax, _lMin);
 
-	uint64_t u64Val = static_cast<uint64_t>((static_cast<uint64_t>(GetNextVal()) << 32) | GetNextVal()); //Fuse two generated numbers
-	uint64_t u64Range = static_cast<uint64_t>(_lMax - _lMin + 1);
+	//Wraps to 0 for the full range of int64_t, which needs no reduction
+	const uint64_t u64Range = static_cast<uint64_t>(_lMax) - static_cast<uint64_t>(_lMin) + 1ULL;
+	if (u64Range == 0ULL) return static_cast<int64_t>(static_cast<uint64_t>(_lMin) + GetNext64());
+
+	//Same rejection as GenerateBounded, widened to 64 bits
+	uint64_t u64Low;
+	uint64_t u64High = MulHiLo64F(GetNext64(), u64Range, u64Low);
+
+	if (u64Low < u64Range) {
+		const uint64_t u64Threshold = (0ULL - u64Range) % u64Range;
 
-	return static_cast<int64_t>(u64Val % u64Range) + _lMin;
+		while (u64Low < u64Threshold) {
+			u64High = MulHiLo64F(GetNext64(), u64Range, u64Low);
+		}
+	}
+
+	return static_cast<int64_t>(static_cast<uint64_t>(_lMin) + u64High);
 }
 
-float Random::GenerateFloat(float _fMin = 0.0f, float _fMax = 1.0f) {
+float Random::GenerateFloat(float _fMin, float _fMax) {
 	if (_fMax < _fMin) return GenerateFloat(_fMax, _fMin);
 
-	float fScale = static_cast<float>(INT_MAX) / (_fMax - _fMin);
+	//23 random mantissa bits under a fixed exponent give a float in [1, 2)
+	const float fUnit = std::bit_cast<float>(0x3F800000U | (static_cast<uint32_t>(GetNextVal()) >> 9)) - 1.0f;
+	const float fRes = _fMin + fUnit * (_fMax - _fMin);
 
-	return (static_cast<float>(GenerateInt()) / fScale) + _fMin;
+	//Rounding can land exactly on _fMax for wide ranges
+	return fRes < _fMax ? fRes : std::nextafter(_fMax, _fMin);
 }
 
-double Random::GenerateDouble(double _dMin = 0.0f, double _dMax = 1.0f) {
+double Random::GenerateDouble(double _dMin, double _dMax) {
 	if (_dMax < _dMin) return GenerateDouble(_dMax, _dMin);
 
-	double dScale = static_cast<double>(LLONG_MAX) / (_dMax - _dMin);
+	const double dUnit = std::bit_cast<double>(0x3FF0000000000000ULL | (GetNext64() >> 12)) - 1.0;
+	const double dRes = _dMin + dUnit * (_dMax - _dMin);
 
-	return (static_cast<double>(GenerateLong()) / dScale) + _dMin;
+	return dRes < _dMax ? dRes : std::nextafter(_dMax, _dMin);
 }
 
 void Random::SetSeed(uint64_t _uSeed) {
+	m_uSeed = _uSeed;
 	m_iNext = 0;
 
 	m_uState[0] = _uSeed;
@@ -96,6 +177,7 @@ void Random::SetSeed(uint64_t _uSeed) {
 	}
 
 	Regenerate();
+	SeedLanes();
 }
 
 uint64_t Random::GetNextVal() {
@@ -113,6 +195,29 @@ uint64_t Random::GetNextVal() {
 	return uVal;
 }
 
+uint64_t Random::GetNext64() {
+	const uint64_t u64High = static_cast<uint32_t>(GetNextVal());
+
+	return (u64High << 32) | static_cast<uint32_t>(GetNextVal()); //Fuse two generated numbers
+}
+
+uint32_t Random::GenerateBounded(uint32_t _uRange) {
+	//Multiply-shift maps 32 random bits onto [0, _uRange) without a division (Lemire). The low half of the product says
+	//whether this draw falls in the slightly overrepresented part of the range, and only then is the exact threshold,
+	//and its division, needed.
+	uint64_t u64Product = static_cast<uint64_t>(static_cast<uint32_t>(GetNextVal())) * _uRange;
+
+	if (static_cast<uint32_t>(u64Product) < _uRange) {
+		const uint32_t u32Threshold = (0U - _uRange) % _uRange;
+
+		while (static_cast<uint32_t>(u64Product) < u32Threshold) {
+			u64Product = static_cast<uint64_t>(static_cast<uint32_t>(GetNextVal())) * _uRange;
+		}
+	}
+
+	return static_cast<uint32_t>(u64Product >> 32);
+}
+
 void Random::Regenerate() {
 	const int iM = 397;
 	const int iFirstHalf = s_iStateSize - iM;
@@ -132,3 +237,157 @@ void Random::Regenerate() {
 	uBits = (m_uState[iNdx] & 0x80000000) | (m_uState[0] & 0x7fffffff);
 	m_uState[iNdx] = m_uState[iM - 1] ^ (uBits >> 1) ^ ((uBits & 1) * 0x9908b0df);
 }
+
+void Random::FillUnsignedInts(std::span<uint32_t> _uOut) {
+	const size_t sSteps = (_uOut.size() + s_iLaneCount - 1) / s_iLaneCount;
+
+#if HC_USE_SIMD
+	FillLanesF(m_uLanes, sSteps, [&](size_t _sStep, __m128i _iBits) {
+		const size_t sFirst = _sStep * s_iLaneCount;
+
+		if (sFirst + s_iLaneCount <= _uOut.size()) { _mm_storeu_si128(reinterpret_cast<__m128i*>(_uOut.data() + sFirst), _iBits); return; }
+
+		alignas(16) uint32_t uTail[4];
+		_mm_store_si128(reinterpret_cast<__m128i*>(uTail), _iBits);
+		for (size_t sNdx = sFirst; sNdx < _uOut.size(); ++sNdx) { _uOut[sNdx] = uTail[sNdx - sFirst]; }
+	});
+#else
+	FillLanesF(m_uLanes, sSteps, [&](size_t _sStep, const RandomLanes& _rBits) {
+		const size_t sFirst = _sStep * s_iLaneCount;
+		for (size_t sNdx = sFirst; sNdx < _uOut.size() && sNdx < sFirst + s_iLaneCount; ++sNdx) { _uOut[sNdx] = _rBits.m_uLanes[sNdx - sFirst]; }
+	});
+#endif
+}
+
+void Random::FillFloats(std::span<float> _fOut, float _fMin, float _fMax) {
+	if (_fMax < _fMin) { FillFloats(_fOut, _fMax, _fMin); return; }
+
+	const size_t sSteps = (_fOut.size() + s_iLaneCount - 1) / s_iLaneCount;
+	const float fRange = (_fMax - _fMin) * HC_RANDOM_FLOAT_STEP;
+
+#if HC_USE_SIMD
+	const __m128 fMin = _mm_set1_ps(_fMin), fRange4 = _mm_set1_ps(fRange);
+
+	FillLanesF(m_uLanes, sSteps, [&](size_t _sStep, __m128i _iBits) {
+		const size_t sFirst = _sStep * s_iLaneCount;
+		const __m128 fVals = LanesToFloatF(_iBits, fMin, fRange4);
+
+		if (sFirst + s_iLaneCount <= _fOut.size()) { _mm_storeu_ps(_fOut.data() + sFirst, fVals); return; }
+
+		alignas(16) float fTail[4];
+		_mm_store_ps(fTail, fVals);
+		for (size_t sNdx = sFirst; sNdx < _fOut.size(); ++sNdx) { _fOut[sNdx] = fTail[sNdx - sFirst]; }
+	});
+#else
+	FillLanesF(m_uLanes, sSteps, [&](size_t _sStep, const RandomLanes& _rBits) {
+		const size_t sFirst = _sStep * s_iLaneCount;
+		for (size_t sNdx = sFirst; sNdx < _fOut.size() && sNdx < sFirst + s_iLaneCount; ++sNdx) { _fOut[sNdx] = LanesToFloatF(_rBits.m_uLanes[sNdx - sFirst], _fMin, fRange); }
+	});
+#endif
+}
+
+void Random::FillInts(std::span<int> _iOut, int _iMin, int _iMax) {
+	if (_iMax < _iMin) { FillInts(_iOut, _iMax, _iMin); return; }
+
+	//Multiply-shift reduction, rejecting the few values that would make some results more likely than others (Lemire).
+	//A range of 0 means all 2^32 values, which needs no reduction.
+	const uint32_t uRange = static_cast<uint32_t>(_iMax) - static_cast<uint32_t>(_iMin) + 1U;
+	const uint32_t uThreshold = uRange != 0U ? (0U - uRange) % uRange : 0U;
+	size_t sFilled = 0;
+
+	const auto AppendLane = [&](uint32_t _uBits) {
+		const uint64_t uProduct = static_cast<uint64_t>(_uBits) * uRange;
+		if (uRange == 0U) { _iOut[sFilled++] = static_cast<int>(_uBits + static_cast<uint32_t>(_iMin)); }
+		else if (static_cast<uint32_t>(uProduct) >= uThreshold) { _iOut[sFilled++] = static_cast<int>(static_cast<uint32_t>(uProduct >> 32) + static_cast<uint32_t>(_iMin)); }
+	};
+
+	while (sFilled < _iOut.size()) {
+		const size_t sSteps = (_iOut.size() - sFilled + s_iLaneCount - 1) / s_iLaneCount;
+
+#if HC_USE_SIMD
+		const __m128i iRange = _mm_set1_epi32(static_cast<int>(uRange)), iMin = _mm_set1_epi32(_iMin);
+		const __m128i iThreshold = _mm_set1_epi32(static_cast<int>(uThreshold ^ 0x80000000U)), iSignBit = _mm_set1_epi32(static_cast<int>(0x80000000U));
+
+		FillLanesF(m_uLanes, sSteps, [&](size_t, __m128i _iBits) {
+			if (sFilled >= _iOut.size()) { return; }
+
+			__m128i iHigh, iLow;
+			MulHiLoF(_iBits, iRange, iHigh, iLow);
+			const bool bAllAccepted = uRange == 0U || _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(_mm_xor_si128(iLow, iSignBit), iThreshold))) == 0;
+
+			if (bAllAccepted && sFilled + s_iLaneCount <= _iOut.size()) {
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(_iOut.data() + sFilled), _mm_add_epi32(uRange == 0U ? _iBits : iHigh, iMin));
+				sFilled += s_iLaneCount;
+				return;
+			}
+
+			alignas(16) uint32_t uBits[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(uBits), _iBits);
+			for (int iLane = 0; iLane < s_iLaneCount && sFilled < _iOut.size(); ++iLane) { AppendLane(uBits[iLane]); }
+		});
+#else
+		FillLanesF(m_uLanes, sSteps, [&](size_t, const RandomLanes& _rBits) {
+			for (int iLane = 0; iLane < s_iLaneCount && sFilled < _iOut.size(); ++iLane) { AppendLane(_rBits.m_uLanes[iLane]); }
+		});
+#endif
+	}
+}
+
+void Random::FillVec3(std::span<Vec3F> _vOut, const Vec3F& _vMin, const Vec3F& _vMax) {
+	const Vec3F vLow = Min(_vMin, _vMax);
+	const Vec3F vRange = (Max(_vMin, _vMax) - vLow) * HC_RANDOM_FLOAT_STEP;
+
+	//Three steps make four points: the X, Y and Z of each lane
+	const size_t sGroups = (_vOut.size() + s_iLaneCount - 1) / s_iLaneCount;
+
+#if HC_USE_SIMD
+	const __m128 fMin[3] = { _mm_set1_ps(vLow.x), _mm_set1_ps(vLow.y), _mm_set1_ps(vLow.z) };
+	const __m128 fRange[3] = { _mm_set1_ps(vRange.x), _mm_set1_ps(vRange.y), _mm_set1_ps(vRange.z) };
+	__m128 fAxes[4] = { _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps() };
+
+	FillLanesF(m_uLanes, sGroups * 3, [&](size_t _sStep, __m128i _iBits) {
+		const int iAxis = static_cast<int>(_sStep % 3);
+		fAxes[iAxis] = LanesToFloatF(_iBits, fMin[iAxis], fRange[iAxis]);
+
+		if (iAxis != 2) { return; }
+
+		__m128 fPoint0 = fAxes[0], fPoint1 = fAxes[1], fPoint2 = fAxes[2], fPoint3 = fAxes[3];
+		_MM_TRANSPOSE4_PS(fPoint0, fPoint1, fPoint2, fPoint3);
+
+		const size_t sFirst = (_sStep / 3) * s_iLaneCount;
+		const __m128 fPoints[4] = { fPoint0, fPoint1, fPoint2, fPoint3 };
+		for (size_t sNdx = sFirst; sNdx < _vOut.size() && sNdx < sFirst + s_iLaneCount; ++sNdx) { _vOut[sNdx].m_fVec = fPoints[sNdx - sFirst]; }
+	});
+#else
+	RandomLanes rAxes[3];
+
+	FillLanesF(m_uLanes, sGroups * 3, [&](size_t _sStep, const RandomLanes& _rBits) {
+		rAxes[_sStep % 3] = _rBits;
+
+		if (_sStep % 3 != 2) { return; }
+
+		const size_t sFirst = (_sStep / 3) * s_iLaneCount;
+		for (size_t sNdx = sFirst; sNdx < _vOut.size() && sNdx < sFirst + s_iLaneCount; ++sNdx) {
+			const int iLane = static_cast<int>(sNdx - sFirst);
+			_vOut[sNdx] = Vec3F(LanesToFloatF(rAxes[0].m_uLanes[iLane], vLow.x, vRange.x), LanesToFloatF(rAxes[1].m_uLanes[iLane], vLow.y, vRange.y), LanesToFloatF(rAxes[2].m_uLanes[iLane], vLow.z, vRange.z));
+		}
+	});
+#endif
+}
+
+void Random::SeedLanes() {
+	//SplitMix64 spreads the seed over every word, so similar seeds still give unrelated streams and no lane starts at zero
+	uint64_t uMix = m_uSeed;
+
+	for (int iWord = 0; iWord < 4; ++iWord) {
+		for (int iLane = 0; iLane < s_iLaneCount; iLane += 2) {
+			uint64_t uVal = (uMix += 0x9E3779B97F4A7C15ULL);
+			uVal = (uVal ^ (uVal >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			uVal = (uVal ^ (uVal >> 27)) * 0x94D049BB133111EBULL;
+			uVal ^= uVal >> 31;
+
+			m_uLanes[iWord][iLane] = static_cast<uint32_t>(uVal);
+			m_uLanes[iWord][iLane + 1] = static_cast<uint32_t>(uVal >> 32);
+		}
+	}
+}
@@ -0,0 +1,252 @@
+#pragma once
+
+#include <HellfireControl/Core/Common.hpp>
+
+#include <HellfireControl/Math/Vector.hpp>
+
+#include <span>
+
+/*
+* Philox4x32-10 (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3"). Each 128 bit counter is encrypted with the
+* 64 bit key into four 32 bit values, so any block of any stream can be computed directly without stepping through the ones
+* before it. Counter words 0 and 1 hold the block index within the stream, words 2 and 3 hold the stream id, and the key is
+* the root seed.
+*/
+
+#define HC_PHILOX_ROUNDS 10
+#define HC_PHILOX_MULTIPLIER_0 0xD2511F53U
+#define HC_PHILOX_MULTIPLIER_1 0xCD9E8D57U
+#define HC_PHILOX_WEYL_0 0x9E3779B9U
+#define HC_PHILOX_WEYL_1 0xBB67AE85U
+
+//SplitMix64's finalizer. Spreads every input bit over the whole output.
+[[nodiscard]] HC_CONSTEXPR uint64_t MixRandomStreamF(uint64_t _uVal) {
+	_uVal = (_uVal ^ (_uVal >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	_uVal = (_uVal ^ (_uVal >> 27)) * 0x94D049BB133111EBULL;
+	return _uVal ^ (_uVal >> 31);
+}
+
+HC_INLINE void PhiloxF(const uint32_t (&_uCounter)[4], uint64_t _uKey, uint32_t (&_uOut)[4]) {
+	uint32_t uC0 = _uCounter[0], uC1 = _uCounter[1], uC2 = _uCounter[2], uC3 = _uCounter[3];
+	uint32_t uK0 = static_cast<uint32_t>(_uKey), uK1 = static_cast<uint32_t>(_uKey >> 32);
+
+	for (int iRound = 0; iRound < HC_PHILOX_ROUNDS; ++iRound) {
+		const uint64_t uProduct0 = static_cast<uint64_t>(HC_PHILOX_MULTIPLIER_0) * uC0;
+		const uint64_t uProduct1 = static_cast<uint64_t>(HC_PHILOX_MULTIPLIER_1) * uC2;
+
+		uC0 = static_cast<uint32_t>(uProduct1 >> 32) ^ uC1 ^ uK0;
+		uC2 = static_cast<uint32_t>(uProduct0 >> 32) ^ uC3 ^ uK1;
+		uC1 = static_cast<uint32_t>(uProduct1);
+		uC3 = static_cast<uint32_t>(uProduct0);
+
+		uK0 += HC_PHILOX_WEYL_0;
+		uK1 += HC_PHILOX_WEYL_1;
+	}
+
+	_uOut[0] = uC0; _uOut[1] = uC1; _uOut[2] = uC2; _uOut[3] = uC3;
+}
+
+#if HC_USE_SIMD
+//Full 32x32->64 bit products of every lane, split into high and low halves
+HC_INLINE void HC_VECTORCALL MulHiLoF(__m128i _iLeft, __m128i _iRight, __m128i& _iHigh, __m128i& _iLow) {
+	const __m128i iEven = _mm_mul_epu32(_iLeft, _iRight);
+	const __m128i iOdd = _mm_mul_epu32(_mm_srli_epi64(_iLeft, 32), _mm_srli_epi64(_iRight, 32));
+
+	_iHigh = _mm_unpacklo_epi32(_mm_shuffle_epi32(iEven, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_epi32(iOdd, _MM_SHUFFLE(3, 1, 3, 1)));
+	_iLow = _mm_unpacklo_epi32(_mm_shuffle_epi32(iEven, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_epi32(iOdd, _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+/// <summary>
+/// Four consecutive Philox blocks starting at _uBlock, written in stream order to _pOut.
+/// </summary>
+HC_INLINE void PhiloxBlocksF(uint64_t _uBlock, uint64_t _uStream, uint64_t _uKey, uint32_t* _pOut) {
+	//One register per counter word, one lane per block
+	const __m128i iBlockLow = _mm_add_epi32(_mm_set1_epi32(static_cast<int>(static_cast<uint32_t>(_uBlock))), _mm_set_epi32(3, 2, 1, 0));
+	//Carry into the high word for lanes that wrapped past 2^32
+	const __m128i iCarry = _mm_srli_epi32(_mm_cmplt_epi32(_mm_xor_si128(iBlockLow, _mm_set1_epi32(static_cast<int>(0x80000000U))), _mm_set1_epi32(static_cast<int>(static_cast<uint32_t>(_uBlock) ^ 0x80000000U))), 31);
+
+	__m128i iC0 = iBlockLow;
+	__m128i iC1 = _mm_add_epi32(_mm_set1_epi32(static_cast<int>(static_cast<uint32_t>(_uBlock >> 32))), iCarry);
+	__m128i iC2 = _mm_set1_epi32(static_cast<int>(static_cast<uint32_t>(_uStream)));
+	__m128i iC3 = _mm_set1_epi32(static_cast<int>(static_cast<uint32_t>(_uStream >> 32)));
+	__m128i iK0 = _mm_set1_epi32(static_cast<int>(static_cast<uint32_t>(_uKey)));
+	__m128i iK1 = _mm_set1_epi32(static_cast<int>(static_cast<uint32_t>(_uKey >> 32)));
+
+	const __m128i iM0 = _mm_set1_epi32(static_cast<int>(HC_PHILOX_MULTIPLIER_0)), iM1 = _mm_set1_epi32(static_cast<int>(HC_PHILOX_MULTIPLIER_1));
+	const __m128i iW0 = _mm_set1_epi32(static_cast<int>(HC_PHILOX_WEYL_0)), iW1 = _mm_set1_epi32(static_cast<int>(HC_PHILOX_WEYL_1));
+
+	for (int iRound = 0; iRound < HC_PHILOX_ROUNDS; ++iRound) {
+		__m128i iHigh0, iLow0, iHigh1, iLow1;
+		MulHiLoF(iM0, iC0, iHigh0, iLow0);
+		MulHiLoF(iM1, iC2, iHigh1, iLow1);
+
+		iC0 = _mm_xor_si128(_mm_xor_si128(iHigh1, iC1), iK0);
+		iC2 = _mm_xor_si128(_mm_xor_si128(iHigh0, iC3), iK1);
+		iC1 = iLow1;
+		iC3 = iLow0;
+
+		iK0 = _mm_add_epi32(iK0, iW0);
+		iK1 = _mm_add_epi32(iK1, iW1);
+	}
+
+	//Back to one block per register
+	__m128 fC0 = _mm_castsi128_ps(iC0), fC1 = _mm_castsi128_ps(iC1), fC2 = _mm_castsi128_ps(iC2), fC3 = _mm_castsi128_ps(iC3);
+	_MM_TRANSPOSE4_PS(fC0, fC1, fC2, fC3);
+
+	_mm_storeu_ps(reinterpret_cast<float*>(_pOut), fC0);
+	_mm_storeu_ps(reinterpret_cast<float*>(_pOut + 4), fC1);
+	_mm_storeu_ps(reinterpret_cast<float*>(_pOut + 8), fC2);
+	_mm_storeu_ps(reinterpret_cast<float*>(_pOut + 12), fC3);
+}
+#else
+HC_INLINE void PhiloxBlocksF(uint64_t _uBlock, uint64_t _uStream, uint64_t _uKey, uint32_t* _pOut) {
+	for (uint64_t uNdx = 0; uNdx < 4; ++uNdx) {
+		const uint64_t uBlock = _uBlock + uNdx;
+		const uint32_t uCounter[4] = { static_cast<uint32_t>(uBlock), static_cast<uint32_t>(uBlock >> 32), static_cast<uint32_t>(_uStream), static_cast<uint32_t>(_uStream >> 32) };
+		uint32_t uOut[4];
+
+		PhiloxF(uCounter, _uKey, uOut);
+		for (int iWord = 0; iWord < 4; ++iWord) { _pOut[uNdx * 4 + iWord] = uOut[iWord]; }
+	}
+}
+#endif
+
+/// <summary>
+/// A counter-based random number generator. Unlike Random, the value at any position of any stream can be computed directly,
+/// so work split across threads draws the same numbers however it is split: give each entity or task its own Substream of a
+/// shared root and the results depend only on the root seed.
+/// </summary>
+class RandomStream {
+private:
+	/// <summary>
+	/// The root seed, used as the Philox key
+	/// </summary>
+	uint64_t m_uSeed;
+
+	/// <summary>
+	/// Identifies this stream among every stream of the same seed
+	/// </summary>
+	uint64_t m_uStream;
+
+	/// <summary>
+	/// Index of the next value in the stream. Each block holds four.
+	/// </summary>
+	uint64_t m_uPosition = 0;
+
+	/// <summary>
+	/// The block m_uPosition currently points into, and which block it is
+	/// </summary>
+	uint32_t m_uBuffer[4] = {};
+	uint64_t m_uBufferBlock = UINT64_MAX;
+
+public:
+	/// <summary>
+	/// Opens stream _uStream of the root seed _uSeed, at its first value.
+	/// </summary>
+	/// <param name="_uSeed: The root seed shared by every stream"></param>
+	/// <param name="_uStream: Which stream of that seed to draw from"></param>
+	HC_INLINE explicit RandomStream(uint64_t _uSeed, uint64_t _uStream = 0) : m_uSeed(_uSeed), m_uStream(_uStream) {}
+
+	/// <summary>
+	/// Derives an independent child stream, for example one per thread, entity or chunk. The child depends only on this
+	/// stream's seed and id and on _uId, never on how far this stream has been read, so substreams can nest.
+	/// </summary>
+	/// <param name="_uId: Identifies the child, such as an entity id"></param>
+	/// <returns>
+	/// RandomStream: The child stream, at its first value
+	/// </returns>
+	[[nodiscard]] HC_INLINE RandomStream Substream(uint64_t _uId) const { return RandomStream(m_uSeed, MixRandomStreamF(m_uStream ^ MixRandomStreamF(_uId + 0x9E3779B97F4A7C15ULL))); }
+
+	/// <summary>
+	/// Generates the next raw 32 bit value of the stream.
+	/// </summary>
+	[[nodiscard]] HC_INLINE uint32_t GenerateUnsignedInt() {
+		const uint64_t uBlock = m_uPosition / 4;
+
+		if (uBlock != m_uBufferBlock) {
+			const uint32_t uCounter[4] = { static_cast<uint32_t>(uBlock), static_cast<uint32_t>(uBlock >> 32), static_cast<uint32_t>(m_uStream), static_cast<uint32_t>(m_uStream >> 32) };
+			PhiloxF(uCounter, m_uSeed, m_uBuffer);
+			m_uBufferBlock = uBlock;
+		}
+
+		return m_uBuffer[m_uPosition++ % 4];
+	}
+
+	/// <summary>
+	/// Generates a random int between _iMin and _iMax, both inclusive, without bias.
+	/// </summary>
+	[[nodiscard]] HC_INLINE int GenerateInt(int _iMin, int _iMax) {
+		if (_iMax < _iMin) { return GenerateInt(_iMax, _iMin); }
+
+		const uint32_t uRange = static_cast<uint32_t>(_iMax) - static_cast<uint32_t>(_iMin) + 1U;
+		if (uRange == 0U) { return static_cast<int>(GenerateUnsignedInt()); }
+
+		//Multiply-shift reduction, rejecting the low products that would favour some results (Lemire)
+		const uint32_t uThreshold = (0U - uRange) % uRange;
+		uint64_t uProduct;
+		do { uProduct = static_cast<uint64_t>(GenerateUnsignedInt()) * uRange; } while (static_cast<uint32_t>(uProduct) < uThreshold);
+
+		return static_cast<int>(static_cast<uint32_t>(uProduct >> 32) + static_cast<uint32_t>(_iMin));
+	}
+
+	/// <summary>
+	/// Generates a random float between _fMin and _fMax from the top 24 bits of the next value.
+	/// </summary>
+	[[nodiscard]] HC_INLINE float GenerateFloat(float _fMin = 0.0f, float _fMax = 1.0f) {
+		return _fMin + static_cast<float>(GenerateUnsignedInt() >> 8) * ((_fMax - _fMin) * 5.9604644775390625e-8f);
+	}
+
+	/// <summary>
+	/// Fills _uOut with the next _uOut.size() values, exactly as repeated GenerateUnsignedInt calls would, sixteen per step.
+	/// </summary>
+	HC_INLINE void FillUnsignedInts(std::span<uint32_t> _uOut) {
+		size_t sNdx = 0;
+
+		//Finish the current block, then go four whole blocks at a time
+		for (; sNdx < _uOut.size() && m_uPosition % 4 != 0; ++sNdx) { _uOut[sNdx] = GenerateUnsignedInt(); }
+
+		for (; sNdx + 16 <= _uOut.size(); sNdx += 16) {
+			PhiloxBlocksF(m_uPosition / 4, m_uStream, m_uSeed, _uOut.data() + sNdx);
+			m_uPosition += 16;
+		}
+
+		for (; sNdx < _uOut.size(); ++sNdx) { _uOut[sNdx] = GenerateUnsignedInt(); }
+	}
+
+	/// <summary>
+	/// Fills _fOut with random floats between _fMin and _fMax, matching repeated GenerateFloat calls.
+	/// </summary>
+	HC_INLINE void FillFloats(std::span<float> _fOut, float _fMin = 0.0f, float _fMax = 1.0f) {
+		const float fScale = (_fMax - _fMin) * 5.9604644775390625e-8f;
+		alignas(16) uint32_t uBits[256];
+
+		for (size_t sFirst = 0; sFirst < _fOut.size(); sFirst += std::size(uBits)) {
+			const size_t sCount = std::min(std::size(uBits), _fOut.size() - sFirst);
+			float* pOut = _fOut.data() + sFirst;
+			size_t sNdx = 0;
+
+			FillUnsignedInts(std::span<uint32_t>(uBits, sCount));
+#if HC_USE_SIMD
+			const __m128 fMin = _mm_set1_ps(_fMin), fScale4 = _mm_set1_ps(fScale);
+			for (; sNdx + 4 <= sCount; sNdx += 4) {
+				_mm_storeu_ps(pOut + sNdx, _mm_add_ps(fMin, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(_mm_load_si128(reinterpret_cast<const __m128i*>(uBits + sNdx)), 8)), fScale4)));
+			}
+#endif
+			for (; sNdx < sCount; ++sNdx) { pOut[sNdx] = _fMin + static_cast<float>(uBits[sNdx] >> 8) * fScale; }
+		}
+	}
+
+	/// <summary>
+	/// Skips the next _uCount values in constant time.
+	/// </summary>
+	HC_INLINE void Discard(uint64_t _uCount) { m_uPosition += _uCount; }
+
+	/// <summary>
+	/// Moves to value _uPosition of the stream in constant time.
+	/// </summary>
+	HC_INLINE void Seek(uint64_t _uPosition) { m_uPosition = _uPosition; }
+
+	[[nodiscard]] HC_INLINE uint64_t GetPosition() const { return m_uPosition; }
+	[[nodiscard]] HC_INLINE uint64_t GetSeed() const { return m_uSeed; }
+	[[nodiscard]] HC_INLINE uint64_t GetStream() const { return m_uStream; }
+};
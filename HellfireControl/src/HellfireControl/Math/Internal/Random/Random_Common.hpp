@@ -3,4 +3,22 @@
 #include <HellfireControl/Core/Common.hpp>
 
 #include <math.h>
-#include <time.h>
\ No newline at end of file
+#include <time.h>
+#include <bit>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+//Full 64x64->128 bit product, returning the high half and writing the low half to _uLow
+HC_INLINE uint64_t MulHiLo64F(uint64_t _uLeft, uint64_t _uRight, uint64_t& _uLow) {
+#if defined(_MSC_VER)
+	uint64_t uHigh;
+	_uLow = _umul128(_uLeft, _uRight, &uHigh);
+	return uHigh;
+#else
+	const unsigned __int128 uProduct = static_cast<unsigned __int128>(_uLeft) * _uRight;
+	_uLow = static_cast<uint64_t>(uProduct);
+	return static_cast<uint64_t>(uProduct >> 64);
+#endif
+}
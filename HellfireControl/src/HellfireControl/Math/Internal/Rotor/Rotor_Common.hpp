@@ -6,7 +6,3 @@
 
 #include <HellfireControl/Math/Vector.hpp>
 #include <HellfireControl/Math/Math.hpp>
-
-#if HC_USE_SIMD
-#include <intrin.h>
-#endif
\ No newline at end of file
@@ -2,14 +2,6 @@
 
 #include <HellfireControl/Math/Internal/Rotor/Rotor_Common.hpp>
 
-#if HC_USE_SIMD
-
-struct RotorD {
-	//TODO: Implement SIMD (requires new SIMD backend)
-};
-
-#else
-
 struct HC_ALIGNAS(32) RotorD {
 	union {
 		Vec4D m_vRot = Vec4D();
@@ -185,6 +177,3 @@ HC_INLINE Vec4D& operator*=(Vec4D& _vLeft, const RotorD& _rRight) { _vLeft = _vL
 
 	return vEulerAngles;
 }
-
-
-#endif
\ No newline at end of file
@@ -2,14 +2,6 @@
 
 #include <HellfireControl/Math/Internal/Rotor/Rotor_Common.hpp>
 
-#if HC_USE_SIMD
-
-struct RotorF {
-	//TODO: Implement SIMD (requires new SIMD backend)
-};
-
-#else
-
 struct HC_ALIGNAS(16) RotorF {
 	union {
 		Vec4F m_vRot = Vec4F();
@@ -98,12 +90,26 @@ struct HC_ALIGNAS(16) RotorF {
 [[nodiscard]] HC_INLINE RotorF Normalize(const RotorF& _rRot) { return Normalize(_rRot.m_vRot); }
 [[nodiscard]] HC_INLINE float Dot(const RotorF& _rLeft, const RotorF& _rRight) { return Dot(_rLeft.m_vRot, _rRight.m_vRot); }
 
+#if HC_USE_SIMD
+[[nodiscard]] HC_INLINE RotorF operator*(const RotorF& _rLeft, const RotorF& _rRight) {
+	const __m128 fLeft = _rLeft.m_vRot.m_fVec;
+	const __m128 fRight = _rRight.m_vRot.m_fVec;
+
+	__m128 fRes = _mm_mul_ps(HC_SHUFFLE4F(fLeft, 3, 3, 3, 3), fRight);
+	fRes = _mm_add_ps(fRes, _mm_xor_ps(_mm_mul_ps(HC_SHUFFLE4F(fLeft, 0, 0, 0, 0), HC_SHUFFLE4F(fRight, 3, 2, 1, 0)), _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f)));
+	fRes = _mm_add_ps(fRes, _mm_xor_ps(_mm_mul_ps(HC_SHUFFLE4F(fLeft, 1, 1, 1, 1), HC_SHUFFLE4F(fRight, 2, 3, 0, 1)), _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f)));
+	fRes = _mm_add_ps(fRes, _mm_xor_ps(_mm_mul_ps(HC_SHUFFLE4F(fLeft, 2, 2, 2, 2), HC_SHUFFLE4F(fRight, 1, 0, 3, 2)), _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f)));
+
+	return RotorF(Vec4F(fRes));
+}
+#else
 [[nodiscard]] HC_INLINE RotorF operator*(const RotorF& _rLeft, const RotorF& _rRight) {
 	return RotorF(_rLeft.b01 * _rRight.a + _rLeft.a * _rRight.b01 + _rLeft.b12 * _rRight.b02 - _rLeft.b02 * _rRight.b12,
 				  _rLeft.b02 * _rRight.a + _rLeft.a * _rRight.b02 - _rLeft.b12 * _rRight.b01 + _rLeft.b01 * _rRight.b12,
 				  _rLeft.b12 * _rRight.a + _rLeft.a * _rRight.b12 + _rLeft.b02 * _rRight.b01 - _rLeft.b01 * _rRight.b02,
 				  _rLeft.a * _rRight.a - _rLeft.b01 * _rRight.b01 - _rLeft.b02 * _rRight.b02 - _rLeft.b12 * _rRight.b12);
 }
+#endif
 
 [[nodiscard]] HC_INLINE Vec3F RotateByRotor(const Vec3F& _vVector, const RotorF& _rRot) {
 	const float fX = _rRot.a * _vVector.x + _rRot.b01 * _vVector.y - _rRot.b02 * _vVector.z;
@@ -159,6 +165,20 @@ HC_INLINE Vec4F& operator*=(Vec4F& _vLeft, const RotorF& _rRight) { _vLeft = _vL
 	return mMat;
 }
 
+/// <summary>
+/// Builds ScaleXYZF(_vScale) * ExtractMatrix(_rRotation) * TranslationF(_vTranslation) directly, without the matrix products.
+/// Scale is applied first, in local space. The result can be inverted with InverseTRS.
+/// </summary>
+/// <param name="_vTranslation: Translation, written to the position row"></param>
+/// <param name="_rRotation: Unit rotor rotation"></param>
+/// <param name="_vScale: Per axis scale"></param>
+[[nodiscard]] HC_INLINE MatrixF ComposeTRS(const Vec3F& _vTranslation, const RotorF& _rRotation, const Vec3F& _vScale) {
+	return MatrixF(RotateByRotor(Vec4F(_vScale.x, 0.0f, 0.0f, 0.0f), _rRotation),
+				   RotateByRotor(Vec4F(0.0f, _vScale.y, 0.0f, 0.0f), _rRotation),
+				   RotateByRotor(Vec4F(0.0f, 0.0f, _vScale.z, 0.0f), _rRotation),
+				   Vec4F(_vTranslation, 1.0f));
+}
+
 [[nodiscard]] HC_INLINE Vec3F ExtractEulerAngles(const RotorF& _rRot) {
 	Vec3F vEulerAngles;
 	float fSin, fCos;
@@ -185,5 +205,3 @@ HC_INLINE Vec4F& operator*=(Vec4F& _vLeft, const RotorF& _rRight) { _vLeft = _vL
 
 	return vEulerAngles;
 }
-
-#endif
\ No newline at end of file
@@ -2,166 +2,52 @@
 
 #include <HellfireControl/Math/Internal/Vector/Vector_Common.hpp>
 
-#if HC_USE_SIMD
-/*#define HC_SHUFFLE3F(_vec, _x, _y, _z) Vec3F(_mm_shuffle_ps((_vec).m_fVec, (_vec).m_fVec, _MM_SHUFFLE(_z, _z, _y, _x)))
-
-struct Vec3F {
-	__m128 m_fVec;
-
-	HC_INLINE HC_VECTORCALL Vec3F() { m_fVec = _mm_setzero_ps(); }
-	HC_INLINE explicit HC_VECTORCALL Vec3F(const float* _pValues) { m_fVec = _mm_set_ps(_pValues[2], _pValues[2], _pValues[1], _pValues[0]); }
-	HC_INLINE explicit HC_VECTORCALL Vec3F(float _fX, float _fY, float _fZ) { m_fVec = _mm_set_ps(_fZ, _fZ, _fY, _fX); }
-	HC_INLINE explicit HC_VECTORCALL Vec3F(int _iX, int _iY, int _iZ) { m_fVec = _mm_set_ps(static_cast<float>(_iZ), static_cast<float>(_iZ), static_cast<float>(_iY), static_cast<float>(_iX)); }
-	HC_INLINE explicit HC_VECTORCALL Vec3F(__m128 _vData) { m_fVec = _vData; }
-	HC_INLINE float HC_VECTORCALL operator[](int _iNdx) const { assert(_iNdx < 3); return m_fVec.m128_f32[_iNdx]; }
-	HC_INLINE float& HC_VECTORCALL operator[](int _iNdx) { assert(_iNdx < 3); return m_fVec.m128_f32[_iNdx]; }
-	HC_INLINE float HC_VECTORCALL X() const { return _mm_cvtss_f32(m_fVec); }
-	HC_INLINE float HC_VECTORCALL Y() const { return _mm_cvtss_f32(_mm_shuffle_ps(m_fVec, m_fVec, _MM_SHUFFLE(1, 1, 1, 1))); }
-	HC_INLINE float HC_VECTORCALL Z() const { return _mm_cvtss_f32(_mm_shuffle_ps(m_fVec, m_fVec, _MM_SHUFFLE(2, 2, 2, 2))); }
-	HC_INLINE float HC_VECTORCALL R() const { return _mm_cvtss_f32(m_fVec); }
-	HC_INLINE float HC_VECTORCALL G() const { return _mm_cvtss_f32(_mm_shuffle_ps(m_fVec, m_fVec, _MM_SHUFFLE(1, 1, 1, 1))); }
-	HC_INLINE float HC_VECTORCALL B() const { return _mm_cvtss_f32(_mm_shuffle_ps(m_fVec, m_fVec, _MM_SHUFFLE(2, 2, 2, 2))); }
-	HC_INLINE void HC_VECTORCALL SetX(float _fX) { m_fVec = _mm_move_ss(m_fVec, _mm_set_ss(_fX)); }
-	HC_INLINE void HC_VECTORCALL SetY(float _fY) { __m128 fTemp = _mm_move_ss(m_fVec, _mm_set_ss(_fY)); fTemp = _mm_shuffle_ps(fTemp, fTemp, _MM_SHUFFLE(3, 2, 0, 0)); m_fVec = _mm_move_ss(fTemp, m_fVec); }
-	HC_INLINE void HC_VECTORCALL SetZ(float _fZ) { __m128 fTemp = _mm_move_ss(m_fVec, _mm_set_ss(_fZ)); fTemp = _mm_shuffle_ps(fTemp, fTemp, _MM_SHUFFLE(3, 0, 1, 0)); m_fVec = _mm_move_ss(fTemp, m_fVec); }
-	HC_INLINE void HC_VECTORCALL SetR(float _fR) { m_fVec = _mm_move_ss(m_fVec, _mm_set_ss(_fR)); }
-	HC_INLINE void HC_VECTORCALL SetG(float _fG) { __m128 fTemp = _mm_move_ss(m_fVec, _mm_set_ss(_fG)); fTemp = _mm_shuffle_ps(fTemp, fTemp, _MM_SHUFFLE(3, 2, 0, 0)); m_fVec = _mm_move_ss(fTemp, m_fVec); }
-	HC_INLINE void HC_VECTORCALL SetB(float _fB) { __m128 fTemp = _mm_move_ss(m_fVec, _mm_set_ss(_fB)); fTemp = _mm_shuffle_ps(fTemp, fTemp, _MM_SHUFFLE(3, 0, 1, 0)); m_fVec = _mm_move_ss(fTemp, m_fVec); }
-	HC_INLINE Vec2F HC_VECTORCALL XX() const { return HC_SHUFFLE2F(*this, 0, 0); }
-	HC_INLINE Vec2F HC_VECTORCALL YY() const { return HC_SHUFFLE2F(*this, 1, 1); }
-	HC_INLINE Vec2F HC_VECTORCALL ZZ() const { return HC_SHUFFLE2F(*this, 2, 2); }
-	HC_INLINE Vec2F HC_VECTORCALL XY() const { return HC_SHUFFLE2F(*this, 0, 1); }
-	HC_INLINE Vec2F HC_VECTORCALL XZ() const { return HC_SHUFFLE2F(*this, 0, 2); }
-	HC_INLINE Vec2F HC_VECTORCALL YX() const { return HC_SHUFFLE2F(*this, 1, 0); }
-	HC_INLINE Vec2F HC_VECTORCALL YZ() const { return HC_SHUFFLE2F(*this, 1, 2); }
-	HC_INLINE Vec2F HC_VECTORCALL ZX() const { return HC_SHUFFLE2F(*this, 2, 0); }
-	HC_INLINE Vec2F HC_VECTORCALL ZY() const { return HC_SHUFFLE2F(*this, 2, 1); }
-	HC_INLINE Vec2F HC_VECTORCALL RR() const { return HC_SHUFFLE2F(*this, 0, 0); }
-	HC_INLINE Vec2F HC_VECTORCALL GG() const { return HC_SHUFFLE2F(*this, 1, 1); }
-	HC_INLINE Vec2F HC_VECTORCALL BB() const { return HC_SHUFFLE2F(*this, 2, 2); }
-	HC_INLINE Vec2F HC_VECTORCALL RG() const { return HC_SHUFFLE2F(*this, 0, 1); }
-	HC_INLINE Vec2F HC_VECTORCALL RB() const { return HC_SHUFFLE2F(*this, 0, 2); }
-	HC_INLINE Vec2F HC_VECTORCALL GR() const { return HC_SHUFFLE2F(*this, 1, 0); }
-	HC_INLINE Vec2F HC_VECTORCALL GB() const { return HC_SHUFFLE2F(*this, 1, 2); }
-	HC_INLINE Vec2F HC_VECTORCALL BR() const { return HC_SHUFFLE2F(*this, 2, 0); }
-	HC_INLINE Vec2F HC_VECTORCALL BG() const { return HC_SHUFFLE2F(*this, 2, 1); }
-	HC_INLINE Vec3F HC_VECTORCALL XXX() const { return HC_SHUFFLE3F(*this, 0, 0, 0); }
-	HC_INLINE Vec3F HC_VECTORCALL XXY() const { return HC_SHUFFLE3F(*this, 0, 0, 1); }
-	HC_INLINE Vec3F HC_VECTORCALL XXZ() const { return HC_SHUFFLE3F(*this, 0, 0, 2); }
-	HC_INLINE Vec3F HC_VECTORCALL XYX() const { return HC_SHUFFLE3F(*this, 0, 1, 0); }
-	HC_INLINE Vec3F HC_VECTORCALL XYY() const { return HC_SHUFFLE3F(*this, 0, 1, 1); }
-	HC_INLINE Vec3F HC_VECTORCALL XZX() const { return HC_SHUFFLE3F(*this, 0, 2, 0); }
-	HC_INLINE Vec3F HC_VECTORCALL XZY() const { return HC_SHUFFLE3F(*this, 0, 2, 1); }
-	HC_INLINE Vec3F HC_VECTORCALL XZZ() const { return HC_SHUFFLE3F(*this, 0, 2, 2); }
-	HC_INLINE Vec3F HC_VECTORCALL YXX() const { return HC_SHUFFLE3F(*this, 1, 0, 0); }
-	HC_INLINE Vec3F HC_VECTORCALL YXY() const { return HC_SHUFFLE3F(*this, 1, 0, 1); }
-	HC_INLINE Vec3F HC_VECTORCALL YXZ() const { return HC_SHUFFLE3F(*this, 1, 0, 2); }
-	HC_INLINE Vec3F HC_VECTORCALL YYX() const { return HC_SHUFFLE3F(*this, 1, 1, 0); }
-	HC_INLINE Vec3F HC_VECTORCALL YYY() const { return HC_SHUFFLE3F(*this, 1, 1, 1); }
-	HC_INLINE Vec3F HC_VECTORCALL YYZ() const { return HC_SHUFFLE3F(*this, 1, 1, 2); }
-	HC_INLINE Vec3F HC_VECTORCALL YZX() const { return HC_SHUFFLE3F(*this, 1, 2, 0); }
-	HC_INLINE Vec3F HC_VECTORCALL YZY() const { return HC_SHUFFLE3F(*this, 1, 2, 1); }
-	HC_INLINE Vec3F HC_VECTORCALL YZZ() const { return HC_SHUFFLE3F(*this, 1, 2, 2); }
-	HC_INLINE Vec3F HC_VECTORCALL ZXX() const { return HC_SHUFFLE3F(*this, 2, 0, 0); }
-	HC_INLINE Vec3F HC_VECTORCALL ZXY() const { return HC_SHUFFLE3F(*this, 2, 0, 1); }
-	HC_INLINE Vec3F HC_VECTORCALL ZXZ() const { return HC_SHUFFLE3F(*this, 2, 0, 2); }
-	HC_INLINE Vec3F HC_VECTORCALL ZYX() const { return HC_SHUFFLE3F(*this, 2, 1, 0); }
-	HC_INLINE Vec3F HC_VECTORCALL ZYY() const { return HC_SHUFFLE3F(*this, 2, 1, 1); }
-	HC_INLINE Vec3F HC_VECTORCALL ZYZ() const { return HC_SHUFFLE3F(*this, 2, 1, 2); }
-	HC_INLINE Vec3F HC_VECTORCALL ZZX() const { return HC_SHUFFLE3F(*this, 2, 2, 0); }
-	HC_INLINE Vec3F HC_VECTORCALL ZZY() const { return HC_SHUFFLE3F(*this, 2, 2, 1); }
-	HC_INLINE Vec3F HC_VECTORCALL ZZZ() const { return HC_SHUFFLE3F(*this, 2, 2, 2); }
-	HC_INLINE Vec3F HC_VECTORCALL RRR() const { return HC_SHUFFLE3F(*this, 0, 0, 0); }
-	HC_INLINE Vec3F HC_VECTORCALL RRG() const { return HC_SHUFFLE3F(*this, 0, 0, 1); }
-	HC_INLINE Vec3F HC_VECTORCALL RRB() const { return HC_SHUFFLE3F(*this, 0, 0, 2); }
-	HC_INLINE Vec3F HC_VECTORCALL RGR() const { return HC_SHUFFLE3F(*this, 0, 1, 0); }
-	HC_INLINE Vec3F HC_VECTORCALL RGG() const { return HC_SHUFFLE3F(*this, 0, 1, 1); }
-	HC_INLINE Vec3F HC_VECTORCALL RBR() const { return HC_SHUFFLE3F(*this, 0, 2, 0); }
-	HC_INLINE Vec3F HC_VECTORCALL RBG() const { return HC_SHUFFLE3F(*this, 0, 2, 1); }
-	HC_INLINE Vec3F HC_VECTORCALL RBB() const { return HC_SHUFFLE3F(*this, 0, 2, 2); }
-	HC_INLINE Vec3F HC_VECTORCALL GRR() const { return HC_SHUFFLE3F(*this, 1, 0, 0); }
-	HC_INLINE Vec3F HC_VECTORCALL GRG() const { return HC_SHUFFLE3F(*this, 1, 0, 1); }
-	HC_INLINE Vec3F HC_VECTORCALL GRB() const { return HC_SHUFFLE3F(*this, 1, 0, 2); }
-	HC_INLINE Vec3F HC_VECTORCALL GGR() const { return HC_SHUFFLE3F(*this, 1, 1, 0); }
-	HC_INLINE Vec3F HC_VECTORCALL GGG() const { return HC_SHUFFLE3F(*this, 1, 1, 1); }
-	HC_INLINE Vec3F HC_VECTORCALL GGB() const { return HC_SHUFFLE3F(*this, 1, 1, 2); }
-	HC_INLINE Vec3F HC_VECTORCALL GBR() const { return HC_SHUFFLE3F(*this, 1, 2, 0); }
-	HC_INLINE Vec3F HC_VECTORCALL GBG() const { return HC_SHUFFLE3F(*this, 1, 2, 1); }
-	HC_INLINE Vec3F HC_VECTORCALL GBB() const { return HC_SHUFFLE3F(*this, 1, 2, 2); }
-	HC_INLINE Vec3F HC_VECTORCALL BRR() const { return HC_SHUFFLE3F(*this, 2, 0, 0); }
-	HC_INLINE Vec3F HC_VECTORCALL BRG() const { return HC_SHUFFLE3F(*this, 2, 0, 1); }
-	HC_INLINE Vec3F HC_VECTORCALL BRB() const { return HC_SHUFFLE3F(*this, 2, 0, 2); }
-	HC_INLINE Vec3F HC_VECTORCALL BGR() const { return HC_SHUFFLE3F(*this, 2, 1, 0); }
-	HC_INLINE Vec3F HC_VECTORCALL BGG() const { return HC_SHUFFLE3F(*this, 2, 1, 1); }
-	HC_INLINE Vec3F HC_VECTORCALL BGB() const { return HC_SHUFFLE3F(*this, 2, 1, 2); }
-	HC_INLINE Vec3F HC_VECTORCALL BBR() const { return HC_SHUFFLE3F(*this, 2, 2, 0); }
-	HC_INLINE Vec3F HC_VECTORCALL BBG() const { return HC_SHUFFLE3F(*this, 2, 2, 1); }
-	HC_INLINE Vec3F HC_VECTORCALL BBB() const { return HC_SHUFFLE3F(*this, 2, 2, 2); }
-};
-
-HC_INLINE Vec3F HC_VECTORCALL operator+(Vec3F _vLeft, Vec3F _vRight) { _vLeft.m_fVec = _mm_add_ps(_vLeft.m_fVec, _vRight.m_fVec); return _vLeft; }
-HC_INLINE Vec3F HC_VECTORCALL operator-(Vec3F _vLeft, Vec3F _vRight) { _vLeft.m_fVec = _mm_sub_ps(_vLeft.m_fVec, _vRight.m_fVec); return _vLeft; }
-HC_INLINE Vec3F HC_VECTORCALL operator*(Vec3F _vLeft, float _fRight) { _vLeft.m_fVec = _mm_mul_ps(_vLeft.m_fVec, _mm_set1_ps(_fRight)); return _vLeft; }
-HC_INLINE Vec3F HC_VECTORCALL operator*(float _fLeft, Vec3F _vRight) { _vRight.m_fVec = _mm_mul_ps(_mm_set1_ps(_fLeft), _vRight.m_fVec); return _vRight; }
-HC_INLINE Vec3F HC_VECTORCALL operator/(Vec3F _vLeft, float _fRight) { _vLeft.m_fVec = _mm_div_ps(_vLeft.m_fVec, _mm_set1_ps(_fRight)); return _vLeft; }
-HC_INLINE Vec3F HC_VECTORCALL operator/(float _fLeft, Vec3F _vRight) { _vRight.m_fVec = _mm_div_ps(_mm_set1_ps(_fLeft), _vRight.m_fVec); return _vRight; }
-HC_INLINE Vec3F HC_VECTORCALL operator*(Vec3F _vLeft, Vec3F _vRight) { _vLeft.m_fVec = _mm_mul_ps(_vLeft.m_fVec, _vRight.m_fVec); return _vLeft; }
-HC_INLINE Vec3F HC_VECTORCALL operator/(Vec3F _vLeft, Vec3F _vRight) { _vLeft.m_fVec = _mm_div_ps(_vLeft.m_fVec, _vRight.m_fVec); return _vLeft; }
-HC_INLINE Vec3F& HC_VECTORCALL operator+=(Vec3F& _vLeft, Vec3F _vRight) { _vLeft = _vLeft + _vRight; return _vLeft; }
-HC_INLINE Vec3F& HC_VECTORCALL operator-=(Vec3F& _vLeft, Vec3F _vRight) { _vLeft = _vLeft - _vRight; return _vLeft; }
-HC_INLINE Vec3F& HC_VECTORCALL operator*=(Vec3F& _vLeft, Vec3F _vRight) { _vLeft = _vLeft * _vRight; return _vLeft; }
-HC_INLINE Vec3F& HC_VECTORCALL operator/=(Vec3F& _vLeft, Vec3F _vRight) { _vLeft = _vLeft / _vRight; return _vLeft; }
-HC_INLINE Vec3F& HC_VECTORCALL operator*=(Vec3F& _vLeft, float _fRight) { _vLeft = _vLeft * _fRight; return _vLeft; }
-HC_INLINE Vec3F& HC_VECTORCALL operator/=(Vec3F& _vLeft, float _fRight) { _vLeft = _vLeft / _fRight; return _vLeft; }
-HC_INLINE Vec3F HC_VECTORCALL operator~(Vec3F _vVector) { return Vec3F(); }
-HC_INLINE Vec3F HC_VECTORCALL operator-(Vec3F _vVector) { return Vec3F() - _vVector; }
-HC_INLINE bool HC_VECTORCALL operator==(Vec3F _vLeft, Vec3F _vRight) { _vLeft.m_fVec = _mm_cmpeq_ps(_vLeft.m_fVec, _vRight.m_fVec); return (_mm_movemask_ps(_vLeft.m_fVec) & 7) == 7; }
-HC_INLINE bool HC_VECTORCALL operator<(Vec3F _vLeft, Vec3F _vRight) { _vLeft.m_fVec = _mm_cmplt_ps(_vLeft.m_fVec, _vRight.m_fVec); return (_mm_movemask_ps(_vLeft.m_fVec) & 7) == 7; }
-HC_INLINE bool HC_VECTORCALL operator>(Vec3F _vLeft, Vec3F _vRight) { _vLeft.m_fVec = _mm_cmpgt_ps(_vLeft.m_fVec, _vRight.m_fVec); return (_mm_movemask_ps(_vLeft.m_fVec) & 7) == 7; }
-HC_INLINE bool HC_VECTORCALL operator<=(Vec3F _vLeft, Vec3F _vRight) { _vLeft.m_fVec = _mm_cmple_ps(_vLeft.m_fVec, _vRight.m_fVec); return (_mm_movemask_ps(_vLeft.m_fVec) & 7) == 7; }
-HC_INLINE bool HC_VECTORCALL operator>=(Vec3F _vLeft, Vec3F _vRight) { _vLeft.m_fVec = _mm_cmpge_ps(_vLeft.m_fVec, _vRight.m_fVec); return (_mm_movemask_ps(_vLeft.m_fVec) & 7) == 7; }
-HC_INLINE bool HC_VECTORCALL operator!=(Vec3F _vLeft, Vec3F _vRight) { _vLeft.m_fVec = _mm_cmpneq_ps(_vLeft.m_fVec, _vRight.m_fVec); return (_mm_movemask_ps(_vLeft.m_fVec) & 7) != 0; }
-HC_INLINE Vec3F HC_VECTORCALL Min(Vec3F _vLeft, Vec3F _vRight) { _vLeft.m_fVec = _mm_min_ps(_vLeft.m_fVec, _vRight.m_fVec); return _vLeft; }
-HC_INLINE Vec3F HC_VECTORCALL Max(Vec3F _vLeft, Vec3F _vRight) { _vLeft.m_fVec = _mm_max_ps(_vLeft.m_fVec, _vRight.m_fVec); return _vLeft; }
-HC_INLINE Vec3F HC_VECTORCALL Clamp(Vec3F _vVector, Vec3F _vMin, Vec3F _vMax) { return Min(Max(_vVector, _vMax), _vMin); }
-HC_INLINE float HC_VECTORCALL HorizontalMin(Vec3F _vVector) { _vVector = Min(_vVector, HC_SHUFFLE3F(_vVector, 1, 0, 2)); return Min(_vVector, HC_SHUFFLE3F(_vVector, 2, 0, 1)).X(); }
-HC_INLINE float HC_VECTORCALL HorizontalMax(Vec3F _vVector) { _vVector = Max(_vVector, HC_SHUFFLE3F(_vVector, 1, 0, 2)); return Max(_vVector, HC_SHUFFLE3F(_vVector, 2, 0, 1)).X(); }
-HC_INLINE float HC_VECTORCALL Sum(const Vec3F _vVector) { return _vVector.X() + _vVector.Y() + _vVector.Z(); }
-HC_INLINE float HC_VECTORCALL Dot(Vec3F _vLeft, Vec3F _vRight) { return Sum(_vLeft * _vRight); }
-HC_INLINE float HC_VECTORCALL Length(Vec3F _vVector) { return sqrtf(Dot(_vVector, _vVector)); }
-HC_INLINE float HC_VECTORCALL LengthSquared(Vec3F _vVector) { return Dot(_vVector, _vVector); }
-HC_INLINE Vec3F HC_VECTORCALL Normalize(Vec3F _vVector) { return _vVector * (1.0f / Length(_vVector)); }
-HC_INLINE float HC_VECTORCALL AngleBetween(Vec3F _vLeft, Vec3F _vRight) { return acosf(Dot(_vLeft, _vRight)); }
-HC_INLINE Vec3F HC_VECTORCALL Cross(Vec3F _vLeft, Vec3F _vRight) { return (_vLeft.ZXY() * _vRight - _vLeft * _vRight.ZXY()).ZXY(); }
-HC_INLINE Vec3F HC_VECTORCALL Abs(Vec3F _vVector) { _vVector.m_fVec = _mm_andnot_ps(_vVector.m_fVec, SignBitMaskF().m_fVec); return _vVector; }*/
-
-#else
-
 struct HC_ALIGNAS(16) Vec3F
 {
 	union
 	{
+#if HC_USE_SIMD
+		float m_fData[4]; //Fourth lane is the SSE padding, see the constructors below
+#else
 		float m_fData[3];
+#endif
 		struct
 		{
 			float x;
 			float y;
 			float z;
 		};
+#if HC_USE_SIMD
+		__m128 m_fVec;
+#endif
 	};
 
-	HC_INLINE Vec3F() { m_fData[0] = 0.0f; m_fData[1] = 0.0f; m_fData[2] = 0.0f; }
-	HC_INLINE explicit Vec3F(float _fVal) { m_fData[0] = _fVal; m_fData[1] = _fVal; m_fData[2] = _fVal; }
-	HC_INLINE explicit Vec3F(int _iVal) { m_fData[0] = static_cast<float>(_iVal); m_fData[1] = static_cast<float>(_iVal); m_fData[2] = static_cast<float>(_iVal); }
-	HC_INLINE explicit Vec3F(double _dVal) { m_fData[0] = static_cast<float>(_dVal); m_fData[1] = static_cast<float>(_dVal); m_fData[2] = static_cast<float>(_dVal); }
-	HC_INLINE explicit Vec3F(float _fX, float _fY, float _fZ) { m_fData[0] = _fX; m_fData[1] = _fY; m_fData[2] = _fZ; }
-	HC_INLINE explicit Vec3F(int _iX, int _iY, int _iZ) { m_fData[0] = static_cast<float>(_iX); m_fData[1] = static_cast<float>(_iY); m_fData[2] = static_cast<float>(_iZ); }
-	HC_INLINE explicit Vec3F(double _dX, double _dY, double _dZ) { m_fData[0] = static_cast<float>(_dX); m_fData[1] = static_cast<float>(_dY); m_fData[2] = static_cast<float>(_dZ); }
-	HC_INLINE explicit Vec3F(const Vec2F& _vXY, float _fZ) { m_fData[0] = _vXY.x; m_fData[1] = _vXY.y; m_fData[2] = _fZ; }
-	HC_INLINE explicit Vec3F(float _fX, const Vec2F& _vYZ) { m_fData[0] = _fX; m_fData[1] = _vYZ.x; m_fData[2] = _vYZ.y; }
+#if HC_USE_SIMD
+	//The padding lane is kept at zero so that it never carries denormals or NaNs through the SSE path.
+	HC_CONSTEXPR Vec3F() : m_fData{ 0.0f, 0.0f, 0.0f, 0.0f } {}
+	HC_CONSTEXPR explicit Vec3F(float _fVal) : m_fData{ _fVal, _fVal, _fVal, 0.0f } {}
+	HC_CONSTEXPR explicit Vec3F(int _iVal) : m_fData{ static_cast<float>(_iVal), static_cast<float>(_iVal), static_cast<float>(_iVal), 0.0f } {}
+	HC_CONSTEXPR explicit Vec3F(double _dVal) : m_fData{ static_cast<float>(_dVal), static_cast<float>(_dVal), static_cast<float>(_dVal), 0.0f } {}
+	HC_CONSTEXPR explicit Vec3F(float _fX, float _fY, float _fZ) : m_fData{ _fX, _fY, _fZ, 0.0f } {}
+	HC_CONSTEXPR explicit Vec3F(int _iX, int _iY, int _iZ) : m_fData{ static_cast<float>(_iX), static_cast<float>(_iY), static_cast<float>(_iZ), 0.0f } {}
+	HC_CONSTEXPR explicit Vec3F(double _dX, double _dY, double _dZ) : m_fData{ static_cast<float>(_dX), static_cast<float>(_dY), static_cast<float>(_dZ), 0.0f } {}
+	HC_CONSTEXPR explicit Vec3F(const Vec2F& _vXY, float _fZ) : m_fData{ _vXY[0], _vXY[1], _fZ, 0.0f } {}
+	HC_CONSTEXPR explicit Vec3F(float _fX, const Vec2F& _vYZ) : m_fData{ _fX, _vYZ[0], _vYZ[1], 0.0f } {}
+	HC_INLINE explicit Vec3F(__m128 _fVec) { m_fVec = _fVec; }
+#else
+	HC_CONSTEXPR Vec3F() : m_fData{ 0.0f, 0.0f, 0.0f } {}
+	HC_CONSTEXPR explicit Vec3F(float _fVal) : m_fData{ _fVal, _fVal, _fVal } {}
+	HC_CONSTEXPR explicit Vec3F(int _iVal) : m_fData{ static_cast<float>(_iVal), static_cast<float>(_iVal), static_cast<float>(_iVal) } {}
+	HC_CONSTEXPR explicit Vec3F(double _dVal) : m_fData{ static_cast<float>(_dVal), static_cast<float>(_dVal), static_cast<float>(_dVal) } {}
+	HC_CONSTEXPR explicit Vec3F(float _fX, float _fY, float _fZ) : m_fData{ _fX, _fY, _fZ } {}
+	HC_CONSTEXPR explicit Vec3F(int _iX, int _iY, int _iZ) : m_fData{ static_cast<float>(_iX), static_cast<float>(_iY), static_cast<float>(_iZ) } {}
+	HC_CONSTEXPR explicit Vec3F(double _dX, double _dY, double _dZ) : m_fData{ static_cast<float>(_dX), static_cast<float>(_dY), static_cast<float>(_dZ) } {}
+	HC_CONSTEXPR explicit Vec3F(const Vec2F& _vXY, float _fZ) : m_fData{ _vXY[0], _vXY[1], _fZ } {}
+	HC_CONSTEXPR explicit Vec3F(float _fX, const Vec2F& _vYZ) : m_fData{ _fX, _vYZ[0], _vYZ[1] } {}
+#endif
 
-	[[nodiscard]] HC_INLINE float operator[](int _iNdx) const { assert(_iNdx < 3); return m_fData[_iNdx]; }
-	[[nodiscard]] HC_INLINE float& operator[](int _iNdx) { assert(_iNdx < 3); return m_fData[_iNdx]; }
+	[[nodiscard]] HC_CONSTEXPR float operator[](int _iNdx) const { assert(_iNdx < 3); return m_fData[_iNdx]; }
+	[[nodiscard]] HC_CONSTEXPR float& operator[](int _iNdx) { assert(_iNdx < 3); return m_fData[_iNdx]; }
 	[[nodiscard]] HC_INLINE Vec2F XX() const { return Vec2F(x, x); }
 	[[nodiscard]] HC_INLINE Vec2F YY() const { return Vec2F(y, y); }
 	[[nodiscard]] HC_INLINE Vec2F ZZ() const { return Vec2F(z, z); }
@@ -199,15 +85,20 @@ struct HC_ALIGNAS(16) Vec3F
 	[[nodiscard]] HC_INLINE Vec3F ZZZ() const { return Vec3F(z, z, z); }
 };
 
-[[nodiscard]] HC_INLINE Vec3F operator+(const Vec3F& _vLeft, const Vec3F& _vRight) { return Vec3F(_vLeft.x + _vRight.x, _vLeft.y + _vRight.y, _vLeft.z + _vRight.z); }
-[[nodiscard]] HC_INLINE Vec3F operator-(const Vec3F& _vLeft, const Vec3F& _vRight) { return Vec3F(_vLeft.x - _vRight.x, _vLeft.y - _vRight.y, _vLeft.z - _vRight.z); }
-[[nodiscard]] HC_INLINE Vec3F operator*(const Vec3F& _vLeft, float _fRight) { return Vec3F(_vLeft.x * _fRight, _vLeft.y * _fRight, _vLeft.z * _fRight); }
-[[nodiscard]] HC_INLINE Vec3F operator*(float _fLeft, const Vec3F& _vRight) { return Vec3F(_vRight.x * _fLeft, _vRight.y * _fLeft, _vRight.z * _fLeft); }
-[[nodiscard]] HC_INLINE Vec3F operator/(const Vec3F& _vLeft, float _fRight) { return Vec3F(_vLeft.x / _fRight, _vLeft.y / _fRight, _vLeft.z / _fRight); }
-[[nodiscard]] HC_INLINE Vec3F operator/(float _fLeft, const Vec3F& _vRight) { return Vec3F(_vRight.x / _fLeft, _vRight.y / _fLeft, _vRight.z / _fLeft); }
-[[nodiscard]] HC_INLINE Vec3F operator*(const Vec3F& _vLeft, const Vec3F& _vRight) { return Vec3F(_vLeft.x * _vRight.x, _vLeft.y * _vRight.y, _vLeft.z * _vRight.z); }
-[[nodiscard]] HC_INLINE Vec3F operator/(const Vec3F& _vLeft, const Vec3F& _vRight) { return Vec3F(_vLeft.x / _vRight.x, _vLeft.y / _vRight.y, _vLeft.z / _vRight.z); }
-[[nodiscard]] HC_INLINE Vec3F operator^(const Vec3F& _vLeft, const Vec3F& _vRight) { return Vec3F(_vLeft[1] * _vRight[2] - _vLeft[2] * _vRight[1], _vLeft[2] * _vRight[0] - _vLeft[0] * _vRight[2], _vLeft[0] * _vRight[1] - _vLeft[1] * _vRight[0]); }
+#if HC_USE_SIMD
+
+[[nodiscard]] HC_INLINE Vec3F operator+(const Vec3F& _vLeft, const Vec3F& _vRight) { return Vec3F(_mm_add_ps(_vLeft.m_fVec, _vRight.m_fVec)); }
+[[nodiscard]] HC_INLINE Vec3F operator-(const Vec3F& _vLeft, const Vec3F& _vRight) { return Vec3F(_mm_sub_ps(_vLeft.m_fVec, _vRight.m_fVec)); }
+[[nodiscard]] HC_INLINE Vec3F operator*(const Vec3F& _vLeft, float _fRight) { return Vec3F(_mm_mul_ps(_vLeft.m_fVec, _mm_set1_ps(_fRight))); }
+[[nodiscard]] HC_INLINE Vec3F operator*(float _fLeft, const Vec3F& _vRight) { return Vec3F(_mm_mul_ps(_vRight.m_fVec, _mm_set1_ps(_fLeft))); }
+[[nodiscard]] HC_INLINE Vec3F operator/(const Vec3F& _vLeft, float _fRight) { return Vec3F(_mm_div_ps(_vLeft.m_fVec, _mm_set1_ps(_fRight))); }
+[[nodiscard]] HC_INLINE Vec3F operator/(float _fLeft, const Vec3F& _vRight) { return Vec3F(_mm_div_ps(_vRight.m_fVec, _mm_set1_ps(_fLeft))); }
+[[nodiscard]] HC_INLINE Vec3F operator*(const Vec3F& _vLeft, const Vec3F& _vRight) { return Vec3F(_mm_mul_ps(_vLeft.m_fVec, _vRight.m_fVec)); }
+[[nodiscard]] HC_INLINE Vec3F operator/(const Vec3F& _vLeft, const Vec3F& _vRight) { return Vec3F(MaskXYZF(_mm_div_ps(_vLeft.m_fVec, _vRight.m_fVec))); }
+[[nodiscard]] HC_INLINE Vec3F operator^(const Vec3F& _vLeft, const Vec3F& _vRight) {
+	__m128 fRes = _mm_sub_ps(_mm_mul_ps(HC_SHUFFLE4F(_vLeft.m_fVec, 2, 0, 1, 3), _vRight.m_fVec), _mm_mul_ps(_vLeft.m_fVec, HC_SHUFFLE4F(_vRight.m_fVec, 2, 0, 1, 3)));
+	return Vec3F(HC_SHUFFLE4F(fRes, 2, 0, 1, 3));
+}
 HC_INLINE Vec3F& operator+=(Vec3F& _vLeft, const Vec3F& _vRight) { _vLeft = _vLeft + _vRight; return _vLeft; }
 HC_INLINE Vec3F& operator-=(Vec3F& _vLeft, const Vec3F& _vRight) { _vLeft = _vLeft - _vRight; return _vLeft; }
 HC_INLINE Vec3F& operator*=(Vec3F& _vLeft, const Vec3F& _vRight) { _vLeft = _vLeft * _vRight; return _vLeft; }
@@ -216,24 +107,65 @@ HC_INLINE Vec3F& operator*=(Vec3F& _vLeft, float _fRight) { _vLeft = _vLeft * _f
 HC_INLINE Vec3F& operator/=(Vec3F& _vLeft, float _fRight) { _vLeft = _vLeft / _fRight; return _vLeft; }
 HC_INLINE Vec3F& operator^=(Vec3F& _vLeft, const Vec3F& _vRight) { _vLeft = _vLeft ^ _vRight; return _vLeft; }
 [[nodiscard]] HC_INLINE Vec3F operator~(const Vec3F& _vVector) { return Vec3F(); }
-[[nodiscard]] HC_INLINE Vec3F operator-(const Vec3F& _vVector) { return Vec3F(-_vVector.x, -_vVector.y, -_vVector.z); }
-HC_INLINE bool operator==(const Vec3F& _vLeft, const Vec3F& _vRight) { return HC_FLOAT_COMPARE(_vLeft.x, _vRight.x) && HC_FLOAT_COMPARE(_vLeft.y, _vRight.y) && HC_FLOAT_COMPARE(_vLeft.z, _vRight.z); }
-HC_INLINE bool operator<(const Vec3F& _vLeft, const Vec3F& _vRight) { return _vLeft.x < _vRight.x && _vLeft.y < _vRight.y && _vLeft.z < _vRight.z; }
-HC_INLINE bool operator>(const Vec3F& _vLeft, const Vec3F& _vRight) { return _vLeft.x > _vRight.x && _vLeft.y > _vRight.y && _vLeft.z > _vRight.z; }
+[[nodiscard]] HC_INLINE Vec3F operator-(const Vec3F& _vVector) { return Vec3F(_mm_xor_ps(_vVector.m_fVec, _mm_set1_ps(-0.0f))); }
+HC_INLINE bool operator==(const Vec3F& _vLeft, const Vec3F& _vRight) { return (CompareMaskF(_vLeft.m_fVec, _vRight.m_fVec) & 7) == 7; }
+HC_INLINE bool operator<(const Vec3F& _vLeft, const Vec3F& _vRight) { return (_mm_movemask_ps(_mm_cmplt_ps(_vLeft.m_fVec, _vRight.m_fVec)) & 7) == 7; }
+HC_INLINE bool operator>(const Vec3F& _vLeft, const Vec3F& _vRight) { return (_mm_movemask_ps(_mm_cmpgt_ps(_vLeft.m_fVec, _vRight.m_fVec)) & 7) == 7; }
 HC_INLINE bool operator<=(const Vec3F& _vLeft, const Vec3F& _vRight) { return !(_vLeft > _vRight); }
 HC_INLINE bool operator>=(const Vec3F& _vLeft, const Vec3F& _vRight) { return !(_vLeft < _vRight); }
 HC_INLINE bool operator!=(const Vec3F& _vLeft, const Vec3F& _vRight) { return !(_vLeft == _vRight); }
-[[nodiscard]] HC_INLINE Vec3F Min(const Vec3F& _vLeft, const Vec3F& _vRight) { return Vec3F(HC_TERNARY(_vLeft.x, _vRight.x, <), HC_TERNARY(_vLeft.y, _vRight.y, <), HC_TERNARY(_vLeft.z, _vRight.z, <)); }
-[[nodiscard]] HC_INLINE Vec3F Max(const Vec3F& _vLeft, const Vec3F& _vRight) { return Vec3F(HC_TERNARY(_vLeft.x, _vRight.x, >), HC_TERNARY(_vLeft.y, _vRight.y, >), HC_TERNARY(_vLeft.z, _vRight.z, >)); }
+[[nodiscard]] HC_INLINE Vec3F Min(const Vec3F& _vLeft, const Vec3F& _vRight) { return Vec3F(_mm_min_ps(_vLeft.m_fVec, _vRight.m_fVec)); }
+[[nodiscard]] HC_INLINE Vec3F Max(const Vec3F& _vLeft, const Vec3F& _vRight) { return Vec3F(_mm_max_ps(_vLeft.m_fVec, _vRight.m_fVec)); }
 [[nodiscard]] HC_INLINE float HorizontalMin(const Vec3F& _vVector) { return Min(Min(_vVector, _vVector.YXZ()), _vVector.ZXY()).x; }
 [[nodiscard]] HC_INLINE float HorizontalMax(const Vec3F& _vVector) { return Max(Max(_vVector, _vVector.YXZ()), _vVector.ZXY()).x; }
-[[nodiscard]] HC_INLINE float Sum(const Vec3F& _vVector) { return _vVector.x + _vVector.y + _vVector.z; }
-[[nodiscard]] HC_INLINE float Dot(const Vec3F& _vLeft, const Vec3F& _vRight) { return Sum(_vLeft * _vRight); }
+[[nodiscard]] HC_INLINE float Sum(const Vec3F& _vVector) { return _mm_cvtss_f32(HorizontalSumF(MaskXYZF(_vVector.m_fVec))); }
+[[nodiscard]] HC_INLINE float Dot(const Vec3F& _vLeft, const Vec3F& _vRight) { return _mm_cvtss_f32(HorizontalSumF(MaskXYZF(_mm_mul_ps(_vLeft.m_fVec, _vRight.m_fVec)))); }
 [[nodiscard]] HC_INLINE float Length(const Vec3F& _vVector) { return sqrtf(Dot(_vVector, _vVector)); }
 [[nodiscard]] HC_INLINE float LengthSquared(const Vec3F& _vVector) { return Dot(_vVector, _vVector); }
+[[nodiscard]] HC_INLINE Vec3F Normalize(const Vec3F& _vVector) {
+	__m128 fLength = _mm_sqrt_ps(HorizontalSumF(MaskXYZF(_mm_mul_ps(_vVector.m_fVec, _vVector.m_fVec))));
+	return Vec3F(_mm_mul_ps(_vVector.m_fVec, _mm_div_ps(_mm_set1_ps(1.0f), fLength)));
+}
+[[nodiscard]] HC_INLINE float AngleBetween(const Vec3F& _vLeft, const Vec3F& _vRight) { return acosf(Dot(_vLeft, _vRight)); }
+[[nodiscard]] HC_INLINE Vec3F Cross(const Vec3F& _vLeft, const Vec3F& _vRight) { return _vLeft ^ _vRight; }
+[[nodiscard]] HC_INLINE Vec3F Abs(const Vec3F& _vVector) { return Vec3F(AbsF(_vVector.m_fVec)); }
+
+#else
+[[nodiscard]] HC_CONSTEXPR Vec3F operator+(const Vec3F& _vLeft, const Vec3F& _vRight) { return Vec3F(_vLeft[0] + _vRight[0], _vLeft[1] + _vRight[1], _vLeft[2] + _vRight[2]); }
+[[nodiscard]] HC_CONSTEXPR Vec3F operator-(const Vec3F& _vLeft, const Vec3F& _vRight) { return Vec3F(_vLeft[0] - _vRight[0], _vLeft[1] - _vRight[1], _vLeft[2] - _vRight[2]); }
+[[nodiscard]] HC_CONSTEXPR Vec3F operator*(const Vec3F& _vLeft, float _fRight) { return Vec3F(_vLeft[0] * _fRight, _vLeft[1] * _fRight, _vLeft[2] * _fRight); }
+[[nodiscard]] HC_CONSTEXPR Vec3F operator*(float _fLeft, const Vec3F& _vRight) { return Vec3F(_vRight[0] * _fLeft, _vRight[1] * _fLeft, _vRight[2] * _fLeft); }
+[[nodiscard]] HC_CONSTEXPR Vec3F operator/(const Vec3F& _vLeft, float _fRight) { return Vec3F(_vLeft[0] / _fRight, _vLeft[1] / _fRight, _vLeft[2] / _fRight); }
+[[nodiscard]] HC_CONSTEXPR Vec3F operator/(float _fLeft, const Vec3F& _vRight) { return Vec3F(_vRight[0] / _fLeft, _vRight[1] / _fLeft, _vRight[2] / _fLeft); }
+[[nodiscard]] HC_CONSTEXPR Vec3F operator*(const Vec3F& _vLeft, const Vec3F& _vRight) { return Vec3F(_vLeft[0] * _vRight[0], _vLeft[1] * _vRight[1], _vLeft[2] * _vRight[2]); }
+[[nodiscard]] HC_CONSTEXPR Vec3F operator/(const Vec3F& _vLeft, const Vec3F& _vRight) { return Vec3F(_vLeft[0] / _vRight[0], _vLeft[1] / _vRight[1], _vLeft[2] / _vRight[2]); }
+[[nodiscard]] HC_CONSTEXPR Vec3F operator^(const Vec3F& _vLeft, const Vec3F& _vRight) { return Vec3F(_vLeft[1] * _vRight[2] - _vLeft[2] * _vRight[1], _vLeft[2] * _vRight[0] - _vLeft[0] * _vRight[2], _vLeft[0] * _vRight[1] - _vLeft[1] * _vRight[0]); }
+HC_CONSTEXPR Vec3F& operator+=(Vec3F& _vLeft, const Vec3F& _vRight) { _vLeft = _vLeft + _vRight; return _vLeft; }
+HC_CONSTEXPR Vec3F& operator-=(Vec3F& _vLeft, const Vec3F& _vRight) { _vLeft = _vLeft - _vRight; return _vLeft; }
+HC_CONSTEXPR Vec3F& operator*=(Vec3F& _vLeft, const Vec3F& _vRight) { _vLeft = _vLeft * _vRight; return _vLeft; }
+HC_CONSTEXPR Vec3F& operator/=(Vec3F& _vLeft, const Vec3F& _vRight) { _vLeft = _vLeft / _vRight; return _vLeft; }
+HC_CONSTEXPR Vec3F& operator*=(Vec3F& _vLeft, float _fRight) { _vLeft = _vLeft * _fRight; return _vLeft; }
+HC_CONSTEXPR Vec3F& operator/=(Vec3F& _vLeft, float _fRight) { _vLeft = _vLeft / _fRight; return _vLeft; }
+HC_CONSTEXPR Vec3F& operator^=(Vec3F& _vLeft, const Vec3F& _vRight) { _vLeft = _vLeft ^ _vRight; return _vLeft; }
+[[nodiscard]] HC_CONSTEXPR Vec3F operator~(const Vec3F& _vVector) { return Vec3F(); }
+[[nodiscard]] HC_CONSTEXPR Vec3F operator-(const Vec3F& _vVector) { return Vec3F(-_vVector[0], -_vVector[1], -_vVector[2]); }
+HC_INLINE bool operator==(const Vec3F& _vLeft, const Vec3F& _vRight) { return HC_FLOAT_COMPARE(_vLeft.x, _vRight.x) && HC_FLOAT_COMPARE(_vLeft.y, _vRight.y) && HC_FLOAT_COMPARE(_vLeft.z, _vRight.z); }
+HC_CONSTEXPR bool operator<(const Vec3F& _vLeft, const Vec3F& _vRight) { return _vLeft[0] < _vRight[0] && _vLeft[1] < _vRight[1] && _vLeft[2] < _vRight[2]; }
+HC_CONSTEXPR bool operator>(const Vec3F& _vLeft, const Vec3F& _vRight) { return _vLeft[0] > _vRight[0] && _vLeft[1] > _vRight[1] && _vLeft[2] > _vRight[2]; }
+HC_CONSTEXPR bool operator<=(const Vec3F& _vLeft, const Vec3F& _vRight) { return !(_vLeft > _vRight); }
+HC_CONSTEXPR bool operator>=(const Vec3F& _vLeft, const Vec3F& _vRight) { return !(_vLeft < _vRight); }
+HC_INLINE bool operator!=(const Vec3F& _vLeft, const Vec3F& _vRight) { return !(_vLeft == _vRight); }
+[[nodiscard]] HC_CONSTEXPR Vec3F Min(const Vec3F& _vLeft, const Vec3F& _vRight) { return Vec3F(HC_TERNARY(_vLeft[0], _vRight[0], <), HC_TERNARY(_vLeft[1], _vRight[1], <), HC_TERNARY(_vLeft[2], _vRight[2], <)); }
+[[nodiscard]] HC_CONSTEXPR Vec3F Max(const Vec3F& _vLeft, const Vec3F& _vRight) { return Vec3F(HC_TERNARY(_vLeft[0], _vRight[0], >), HC_TERNARY(_vLeft[1], _vRight[1], >), HC_TERNARY(_vLeft[2], _vRight[2], >)); }
+[[nodiscard]] HC_INLINE float HorizontalMin(const Vec3F& _vVector) { return Min(Min(_vVector, _vVector.YXZ()), _vVector.ZXY()).x; }
+[[nodiscard]] HC_INLINE float HorizontalMax(const Vec3F& _vVector) { return Max(Max(_vVector, _vVector.YXZ()), _vVector.ZXY()).x; }
+[[nodiscard]] HC_CONSTEXPR float Sum(const Vec3F& _vVector) { return _vVector[0] + _vVector[1] + _vVector[2]; }
+[[nodiscard]] HC_CONSTEXPR float Dot(const Vec3F& _vLeft, const Vec3F& _vRight) { return Sum(_vLeft * _vRight); }
+[[nodiscard]] HC_INLINE float Length(const Vec3F& _vVector) { return sqrtf(Dot(_vVector, _vVector)); }
+[[nodiscard]] HC_CONSTEXPR float LengthSquared(const Vec3F& _vVector) { return Dot(_vVector, _vVector); }
 [[nodiscard]] HC_INLINE Vec3F Normalize(const Vec3F& _vVector) { return _vVector * (1.0f / Length(_vVector)); }
 [[nodiscard]] HC_INLINE float AngleBetween(const Vec3F& _vLeft, const Vec3F& _vRight) { return acosf(Dot(_vLeft, _vRight)); }
-[[nodiscard]] HC_INLINE Vec3F Cross(const Vec3F& _vLeft, const Vec3F& _vRight) { return (_vLeft.ZXY() * _vRight - _vLeft * _vRight.ZXY()).ZXY(); }
+[[nodiscard]] HC_CONSTEXPR Vec3F Cross(const Vec3F& _vLeft, const Vec3F& _vRight) { return _vLeft ^ _vRight; }
 [[nodiscard]] HC_INLINE Vec3F Abs(const Vec3F& _vVector) { return Vec3F(abs(_vVector.x), abs(_vVector.y), abs(_vVector.z)); }
 
-#endif
\ No newline at end of file
+#endif
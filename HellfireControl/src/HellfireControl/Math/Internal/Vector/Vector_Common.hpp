@@ -5,7 +5,15 @@
 #include <math.h>
 
 #if HC_USE_SIMD
+#if defined(_MSC_VER)
 #include <intrin.h>
+#else
+#include <immintrin.h>
+#endif
+
+//Internal shuffle macro for the SSE backend. Lanes are given in x, y, z, w order to match the swizzle functions.
+#define HC_SHUFFLE4F(_vec, _x, _y, _z, _w) _mm_shuffle_ps((_vec), (_vec), _MM_SHUFFLE((_w), (_z), (_y), (_x)))
+#define HC_SHUFFLE4F_2(_vec1, _vec2, _x, _y, _z, _w) _mm_shuffle_ps((_vec1), (_vec2), _MM_SHUFFLE((_w), (_z), (_y), (_x)))
 
 typedef struct {
 	union {
@@ -30,7 +38,108 @@ HC_INLINE maskd_t SignBitMaskD() {
 	static maskd_t g_mMask = { 0x8000000000000000, 0x8000000000000000, 0x8000000000000000, 0x8000000000000000 };
 	return g_mMask;
 }
+
+//Masks off the W lane so that Vec3F padding never leaks into horizontal operations.
+HC_INLINE __m128 HC_VECTORCALL MaskXYZF(__m128 _fVec) { return _mm_and_ps(_fVec, _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1))); }
+
+HC_INLINE __m128 HC_VECTORCALL AbsF(__m128 _fVec) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), _fVec); }
+
+//Per-lane equivalent of HC_FLOAT_COMPARE, returned as a movemask.
+HC_INLINE int HC_VECTORCALL CompareMaskF(__m128 _fLeft, __m128 _fRight) { return _mm_movemask_ps(_mm_cmplt_ps(AbsF(_mm_sub_ps(_fLeft, _fRight)), _mm_set1_ps(HC_EPSILON))); }
+
+//Returns the sum of all four lanes, broadcast to every lane. Lanes are added in x, y, z, w order like the scalar Sum, so both paths round the same way.
+HC_INLINE __m128 HC_VECTORCALL HorizontalSumF(__m128 _fVec) {
+	__m128 fSum = _mm_add_ss(_fVec, HC_SHUFFLE4F(_fVec, 1, 1, 1, 1));
+	fSum = _mm_add_ss(fSum, _mm_movehl_ps(_fVec, _fVec));
+	fSum = _mm_add_ss(fSum, HC_SHUFFLE4F(_fVec, 3, 3, 3, 3));
+	return HC_SHUFFLE4F(fSum, 0, 0, 0, 0);
+}
+
+//Vec2F is only 8 bytes wide, so it is moved in and out of registers through the low 64 bits.
+HC_INLINE __m128 HC_VECTORCALL Load2F(const float* _pData) { return _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(_pData))); }
+HC_INLINE void HC_VECTORCALL Store2F(float* _pData, __m128 _fVec) { _mm_store_sd(reinterpret_cast<double*>(_pData), _mm_castps_pd(_fVec)); }
+
+//The double precision types use AVX2/FMA. SSE is part of the x64 baseline but AVX2 is not, so unless the compiler was told
+//to target it (HC_ENABLE_AVX2) the AVX2 kernels are compiled per function and picked at runtime.
+#if defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+#define HC_AVX2_TARGET
+#define HC_AVX2_AVAILABLE() true
+#else
+#if defined(_MSC_VER)
+#define HC_AVX2_TARGET
+#else
+#define HC_AVX2_TARGET __attribute__((target("avx2,fma")))
+#endif
+#define HC_AVX2_AVAILABLE() CPUSupportsAVX2()
+#endif
+
+//Internal permute macro for the AVX2 backend. Lanes are given in x, y, z, w order to match the swizzle functions.
+#define HC_PERMUTE4D(_vec, _x, _y, _z, _w) _mm256_permute4x64_pd((_vec), _MM_SHUFFLE((_w), (_z), (_y), (_x)))
+
+/// <summary>
+/// Checks once whether the CPU and OS support AVX2 and FMA, caching the result for later calls.
+/// </summary>
+HC_INLINE bool CPUSupportsAVX2() {
+#if defined(_MSC_VER)
+	static const bool g_bSupported = [] {
+		int iInfo[4];
+		__cpuid(iInfo, 1);
+		const bool bOSXSave = (iInfo[2] & (1 << 27)) != 0;
+		const bool bFMA = (iInfo[2] & (1 << 12)) != 0;
+		__cpuidex(iInfo, 7, 0);
+		const bool bAVX2 = (iInfo[1] & (1 << 5)) != 0;
+		return bOSXSave && bFMA && bAVX2 && (_xgetbv(0) & 0x6) == 0x6;
+	}();
 #else
-//Internal macro for cleaner ternary. Not intended for use outside of math. (ONLY USED IN NON-SIMD MATH)
+	static const bool g_bSupported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+	return g_bSupported;
+}
+
+//Returns the sum of all four lanes in the low lane, added in x, y, z, w order like the scalar Sum.
+HC_AVX2_TARGET HC_INLINE __m128d HorizontalSumD(__m256d _dVec) {
+	const __m128d dLow = _mm256_castpd256_pd128(_dVec);
+	const __m128d dHigh = _mm256_extractf128_pd(_dVec, 1);
+	__m128d dSum = _mm_add_sd(dLow, _mm_unpackhi_pd(dLow, dLow));
+	dSum = _mm_add_sd(dSum, dHigh);
+	return _mm_add_sd(dSum, _mm_unpackhi_pd(dHigh, dHigh));
+}
+
+//F16C (hardware float <-> half conversion) is dispatched the same way as AVX2.
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define HC_F16C_TARGET
+#define HC_F16C_AVAILABLE() true
+#else
+#if defined(_MSC_VER)
+#define HC_F16C_TARGET
+#else
+#define HC_F16C_TARGET __attribute__((target("f16c")))
+#endif
+#define HC_F16C_AVAILABLE() CPUSupportsF16C()
+#endif
+
+/// <summary>
+/// Checks once whether the CPU and OS support F16C, caching the result for later calls.
+/// </summary>
+HC_INLINE bool CPUSupportsF16C() {
+#if defined(_MSC_VER)
+	static const bool g_bSupported = [] {
+		int iInfo[4];
+		__cpuid(iInfo, 1);
+		const bool bOSXSave = (iInfo[2] & (1 << 27)) != 0;
+		const bool bF16C = (iInfo[2] & (1 << 29)) != 0;
+		return bOSXSave && bF16C && (_xgetbv(0) & 0x6) == 0x6;
+	}();
+#else
+	static const bool g_bSupported = __builtin_cpu_supports("f16c");
+#endif
+	return g_bSupported;
+}
+
+#define HC_AVX2_DISPATCH(_call) if (HC_AVX2_AVAILABLE()) { return (_call); }
+#else
+#define HC_AVX2_DISPATCH(_call)
+#endif
+
+//Internal macro for cleaner ternary. Not intended for use outside of math.
 #define HC_TERNARY(_val1, _val2, _sign) (_val1) _sign (_val2) ? (_val1) : (_val2)
-#endif
\ No newline at end of file
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <HellfireControl/Math/Internal/Wide/Wide_Fx4.hpp>
+#include <HellfireControl/Math/Math.hpp>
+
+#include <span>
+
+/*
+* Batched rotation blending for animation. QuaternionF and RotorF are both a unit 4D vector that double covers the rotations,
+* so one set of kernels blends either kind. Every group of four rotations is transposed into Vec4Fx4 lanes and blended without
+* branches: the shorter arc flip moves the sign of the dot product onto the end lanes and the nearly parallel fallback is a
+* lane select. Endpoints must already be unit length. Every function accepts the same span for an input and the output.
+*/
+
+static_assert(sizeof(QuaternionF) == sizeof(Vec4F), "Batched blends walk QuaternionF spans as packed Vec4Fs");
+
+//Ratio correction of the approximate SLerp. A cubic in the ratio, scaled by these fits in |cos theta|, makes NLerp follow the
+//constant speed arc to within about 1e-3 radians.
+#define HC_BLEND_APPROX_A0 1.0904f
+#define HC_BLEND_APPROX_A1 -3.2452f
+#define HC_BLEND_APPROX_A2 3.55645f
+#define HC_BLEND_APPROX_A3 -1.43519f
+#define HC_BLEND_APPROX_B0 0.848013f
+#define HC_BLEND_APPROX_B1 -1.06021f
+#define HC_BLEND_APPROX_B2 0.215638f
+
+//Flips the end lanes onto the hemisphere of the start lanes so every lane takes the shorter arc. _fDot receives |cos theta|.
+[[nodiscard]] HC_INLINE Vec4Fx4 BlendShortestArcF(const Vec4Fx4& _vStart, const Vec4Fx4& _vEnd, Floatx4& _fDot) {
+	const Floatx4 fDot = Dot(_vStart, _vEnd);
+	_fDot = Abs(fDot);
+
+	return Vec4Fx4(FlipSign(_vEnd.x, fDot), FlipSign(_vEnd.y, fDot), FlipSign(_vEnd.z, fDot), FlipSign(_vEnd.w, fDot));
+}
+
+[[nodiscard]] HC_INLINE Vec4Fx4 BlendNLerpF(const Vec4Fx4& _vStart, const Vec4Fx4& _vEnd, const Floatx4& _fRatio) {
+	Floatx4 fDot;
+	const Vec4Fx4 vEnd = BlendShortestArcF(_vStart, _vEnd, fDot);
+
+	return Normalize((vEnd - _vStart) * _fRatio + _vStart);
+}
+
+[[nodiscard]] HC_INLINE Vec4Fx4 BlendSLerpF(const Vec4Fx4& _vStart, const Vec4Fx4& _vEnd, const Floatx4& _fRatio, MathPrecision _mpPrecision) {
+	Floatx4 fDot;
+	const Vec4Fx4 vEnd = BlendShortestArcF(_vStart, _vEnd, fDot);
+
+	if (_mpPrecision == PRECISION_FAST) {
+		//NLerp with a corrected ratio. No transcendentals, so the whole blend stays in the lanes.
+		const Floatx4 fCentered = _fRatio - Floatx4(0.5f);
+		const Floatx4 fA = Floatx4(HC_BLEND_APPROX_A0) + fDot * (Floatx4(HC_BLEND_APPROX_A1) + fDot * (Floatx4(HC_BLEND_APPROX_A2) + fDot * Floatx4(HC_BLEND_APPROX_A3)));
+		const Floatx4 fB = Floatx4(HC_BLEND_APPROX_B0) + fDot * (Floatx4(HC_BLEND_APPROX_B1) + fDot * Floatx4(HC_BLEND_APPROX_B2));
+		const Floatx4 fRatio = _fRatio + _fRatio * fCentered * (_fRatio - Floatx4(1.0f)) * (fA * fCentered * fCentered + fB);
+
+		return Normalize((vEnd - _vStart) * fRatio + _vStart);
+	}
+
+	//Rounding can push |cos theta| just past one, and (1 - dot) * (1 + dot) keeps the digits 1 - dot * dot loses near it
+	fDot = Min(fDot, Floatx4(1.0f));
+	const Floatx4 fInvSinTheta = Floatx4(1.0f) / Max(Sqrt((Floatx4(1.0f) - fDot) * (Floatx4(1.0f) + fDot)), Floatx4(FLT_MIN));
+	Floatx4 fFrom, fTo;
+
+	//sin((1 - t) * theta) expands to sin(theta) * cos(t * theta) - cos(theta) * sin(t * theta), so one SinCos covers both weights
+	SinCos(_fRatio * ArcCos(fDot), fTo, fFrom);
+
+	fTo *= fInvSinTheta;
+
+	//Nearly parallel lanes take the Lerp weights instead. Renormalizing only corrects rounding on the other lanes.
+	const Floatx4 fNearOne = Floatx4(HC_NEAR_ONE);
+	fFrom = SelectGreater(fDot, fNearOne, Floatx4(1.0f) - _fRatio, fFrom - fDot * fTo);
+	fTo = SelectGreater(fDot, fNearOne, _fRatio, fTo);
+
+	return Normalize(_vStart * fFrom + vEnd * fTo);
+}
+
+//Writes the rotation matrices of four unit quaternions in lanes, the same matrices ExtractMatrix(QuaternionF) builds.
+HC_INLINE void BlendMatricesF(const Vec4Fx4& _vQuat, MatrixF* _pOut, int _iCount) {
+	const Floatx4 fX2 = _vQuat.x + _vQuat.x, fY2 = _vQuat.y + _vQuat.y, fZ2 = _vQuat.z + _vQuat.z;
+	const Floatx4 fXX = _vQuat.x * fX2, fYY = _vQuat.y * fY2, fZZ = _vQuat.z * fZ2;
+	const Floatx4 fXY = _vQuat.x * fY2, fXZ = _vQuat.x * fZ2, fYZ = _vQuat.y * fZ2;
+	const Floatx4 fWX = _vQuat.w * fX2, fWY = _vQuat.w * fY2, fWZ = _vQuat.w * fZ2;
+	const Floatx4 fOne = Floatx4(1.0f);
+
+	Vec4F vRow0[Floatx4::LANES], vRow1[Floatx4::LANES], vRow2[Floatx4::LANES];
+	Store(Vec4Fx4(fOne - fYY - fZZ, fXY - fWZ, fXZ + fWY, Floatx4()), vRow0, _iCount);
+	Store(Vec4Fx4(fXY + fWZ, fOne - fXX - fZZ, fYZ - fWX, Floatx4()), vRow1, _iCount);
+	Store(Vec4Fx4(fXZ - fWY, fYZ + fWX, fOne - fXX - fYY, Floatx4()), vRow2, _iCount);
+
+	for (int iLane = 0; iLane < _iCount; ++iLane) {
+		_pOut[iLane] = MatrixF(vRow0[iLane], vRow1[iLane], vRow2[iLane], Vec4F(0.0f, 0.0f, 0.0f, 1.0f));
+	}
+}
+
+//Runs _fnBlend over every group of four pairs. Each group is fully loaded before it is stored, which keeps in place blends safe.
+template<typename Blend>
+HC_INLINE void BlendBatchF(const Vec4F* _pStart, const Vec4F* _pEnd, Vec4F* _pOut, size_t _sCount, Blend _fnBlend) {
+	for (size_t sNdx = 0; sNdx < _sCount; sNdx += Floatx4::LANES) {
+		const int iCount = static_cast<int>(HC_TERNARY(_sCount - sNdx, static_cast<size_t>(Floatx4::LANES), <));
+		Store(_fnBlend(LoadVec4Fx4(_pStart + sNdx, iCount), LoadVec4Fx4(_pEnd + sNdx, iCount)), _pOut + sNdx, iCount);
+	}
+}
+
+//_fnToQuaternion reorders the loaded lanes into quaternion X, Y, Z and W.
+template<typename Convert>
+HC_INLINE void ExtractMatricesBatchF(const Vec4F* _pIn, MatrixF* _pOut, size_t _sCount, Convert _fnToQuaternion) {
+	for (size_t sNdx = 0; sNdx < _sCount; sNdx += Floatx4::LANES) {
+		const int iCount = static_cast<int>(HC_TERNARY(_sCount - sNdx, static_cast<size_t>(Floatx4::LANES), <));
+		BlendMatricesF(_fnToQuaternion(LoadVec4Fx4(_pIn + sNdx, iCount)), _pOut + sNdx, iCount);
+	}
+}
+
+namespace Math {
+	/// <summary>
+	/// NLerps every lane along the shorter arc. The endpoints must be unit length.
+	/// </summary>
+	[[nodiscard]] HC_INLINE QuaternionFx4 NLerp(const QuaternionFx4& _qStart, const QuaternionFx4& _qEnd, float _fRatio) {
+		Vec4Fx4 vRes = BlendNLerpF(Vec4Fx4(_qStart.x, _qStart.y, _qStart.z, _qStart.w), Vec4Fx4(_qEnd.x, _qEnd.y, _qEnd.z, _qEnd.w), Floatx4(_fRatio));
+		return QuaternionFx4(vRes.x, vRes.y, vRes.z, vRes.w);
+	}
+
+	/// <summary>
+	/// Branch free SLerp of every lane. Unlike SLerp(QuaternionFx4, QuaternionFx4, float) the endpoints are not normalized first,
+	/// so they must already be unit length. PRECISION_FAST swaps the exact weights for the approximate SLerp.
+	/// </summary>
+	[[nodiscard]] HC_INLINE QuaternionFx4 SLerp(const QuaternionFx4& _qStart, const QuaternionFx4& _qEnd, float _fRatio, MathPrecision _mpPrecision) {
+		Vec4Fx4 vRes = BlendSLerpF(Vec4Fx4(_qStart.x, _qStart.y, _qStart.z, _qStart.w), Vec4Fx4(_qEnd.x, _qEnd.y, _qEnd.z, _qEnd.w), Floatx4(_fRatio), _mpPrecision);
+		return QuaternionFx4(vRes.x, vRes.y, vRes.z, vRes.w);
+	}
+
+	/// <summary>
+	/// NLerps every pair _qStart[i], _qEnd[i] along the shorter arc and writes the unit results to _qOut.
+	/// </summary>
+	/// <param name="_qStart: Unit start rotations"></param>
+	/// <param name="_qEnd: Unit end rotations. Must be as long as _qStart"></param>
+	/// <param name="_fRatio: Blend weight, shared by every pair"></param>
+	/// <param name="_qOut: Destination. Must be at least as long as _qStart and may be the same span as either input"></param>
+	HC_INLINE void NLerp(std::span<const QuaternionF> _qStart, std::span<const QuaternionF> _qEnd, float _fRatio, std::span<QuaternionF> _qOut) {
+		assert(_qEnd.size() == _qStart.size() && _qOut.size() >= _qStart.size());
+		BlendBatchF(reinterpret_cast<const Vec4F*>(_qStart.data()), reinterpret_cast<const Vec4F*>(_qEnd.data()), reinterpret_cast<Vec4F*>(_qOut.data()), _qStart.size(),
+					[_fRatio](const Vec4Fx4& _vStart, const Vec4Fx4& _vEnd) { return BlendNLerpF(_vStart, _vEnd, Floatx4(_fRatio)); });
+	}
+
+	/// <summary>
+	/// SLerps every pair _qStart[i], _qEnd[i] along the shorter arc and writes the unit results to _qOut.
+	/// </summary>
+	/// <param name="_qStart: Unit start rotations"></param>
+	/// <param name="_qEnd: Unit end rotations. Must be as long as _qStart"></param>
+	/// <param name="_fRatio: Blend weight, shared by every pair"></param>
+	/// <param name="_qOut: Destination. Must be at least as long as _qStart and may be the same span as either input"></param>
+	/// <param name="_mpPrecision: PRECISION_FULL for exact SLerp, PRECISION_FAST for the approximate SLerp"></param>
+	HC_INLINE void SLerp(std::span<const QuaternionF> _qStart, std::span<const QuaternionF> _qEnd, float _fRatio, std::span<QuaternionF> _qOut, MathPrecision _mpPrecision) {
+		assert(_qEnd.size() == _qStart.size() && _qOut.size() >= _qStart.size());
+		BlendBatchF(reinterpret_cast<const Vec4F*>(_qStart.data()), reinterpret_cast<const Vec4F*>(_qEnd.data()), reinterpret_cast<Vec4F*>(_qOut.data()), _qStart.size(),
+					[_fRatio, _mpPrecision](const Vec4Fx4& _vStart, const Vec4Fx4& _vEnd) { return BlendSLerpF(_vStart, _vEnd, Floatx4(_fRatio), _mpPrecision); });
+	}
+
+#if HC_USE_ROTOR
+	HC_INLINE void NLerp(std::span<const RotorF> _rStart, std::span<const RotorF> _rEnd, float _fRatio, std::span<RotorF> _rOut) {
+		static_assert(sizeof(RotorF) == sizeof(Vec4F), "Batched blends walk RotorF spans as packed Vec4Fs");
+		assert(_rEnd.size() == _rStart.size() && _rOut.size() >= _rStart.size());
+		BlendBatchF(reinterpret_cast<const Vec4F*>(_rStart.data()), reinterpret_cast<const Vec4F*>(_rEnd.data()), reinterpret_cast<Vec4F*>(_rOut.data()), _rStart.size(),
+					[_fRatio](const Vec4Fx4& _vStart, const Vec4Fx4& _vEnd) { return BlendNLerpF(_vStart, _vEnd, Floatx4(_fRatio)); });
+	}
+
+	HC_INLINE void SLerp(std::span<const RotorF> _rStart, std::span<const RotorF> _rEnd, float _fRatio, std::span<RotorF> _rOut, MathPrecision _mpPrecision) {
+		assert(_rEnd.size() == _rStart.size() && _rOut.size() >= _rStart.size());
+		BlendBatchF(reinterpret_cast<const Vec4F*>(_rStart.data()), reinterpret_cast<const Vec4F*>(_rEnd.data()), reinterpret_cast<Vec4F*>(_rOut.data()), _rStart.size(),
+					[_fRatio, _mpPrecision](const Vec4Fx4& _vStart, const Vec4Fx4& _vEnd) { return BlendSLerpF(_vStart, _vEnd, Floatx4(_fRatio), _mpPrecision); });
+	}
+#endif
+}
+
+/// <summary>
+/// Converts every unit quaternion in _qIn to the matrix ExtractMatrix(QuaternionF) would build and writes it to _mOut.
+/// </summary>
+/// <param name="_qIn: Unit rotations to convert"></param>
+/// <param name="_mOut: Destination. Must be at least as long as _qIn"></param>
+HC_INLINE void ExtractMatrices(std::span<const QuaternionF> _qIn, std::span<MatrixF> _mOut) {
+	assert(_mOut.size() >= _qIn.size());
+	ExtractMatricesBatchF(reinterpret_cast<const Vec4F*>(_qIn.data()), _mOut.data(), _qIn.size(), [](const Vec4Fx4& _vQuat) { return _vQuat; });
+}
+
+#if HC_USE_ROTOR
+/// <summary>
+/// Converts every unit rotor in _rIn to the matrix ExtractMatrix(RotorF) would build and writes it to _mOut.
+/// </summary>
+/// <param name="_rIn: Unit rotations to convert"></param>
+/// <param name="_mOut: Destination. Must be at least as long as _rIn"></param>
+HC_INLINE void ExtractMatrices(std::span<const RotorF> _rIn, std::span<MatrixF> _mOut) {
+	assert(_mOut.size() >= _rIn.size());
+	//The rotor (b01, b02, b12, a) rotates the same way as the quaternion (b12, b02, b01, a)
+	ExtractMatricesBatchF(reinterpret_cast<const Vec4F*>(_rIn.data()), _mOut.data(), _rIn.size(), [](const Vec4Fx4& _vRot) { return Vec4Fx4(_vRot.z, _vRot.y, _vRot.x, _vRot.w); });
+}
+#endif
@@ -0,0 +1,303 @@
+#pragma once
+
+#include <cfloat>
+#include <math.h>
+#include <vector>
+
+#include <HellfireControl/Core/Common.hpp>
+#include <HellfireControl/Math/Vector.hpp>
+#include <HellfireControl/Math/Quaternion.hpp>
+
+//Internal macro for the scalar fallback of the lane types. Evaluates _expr once per lane with iLane in scope.
+#define HC_LANEWISE(_type, _expr) _type fRes; for (int iLane = 0; iLane < _type::LANES; ++iLane) { fRes.m_fLanes[iLane] = (_expr); } return fRes
+#define HC_LANEWISE_UINT(_expr) Uintx4 uRes; for (int iLane = 0; iLane < Uintx4::LANES; ++iLane) { uRes.m_uLanes[iLane] = (_expr); } return uRes
+
+/// <summary>
+/// Four floats processed together. This is the lane type the structure-of-arrays vectors are built from.
+/// </summary>
+struct HC_ALIGNAS(16) Floatx4
+{
+	static constexpr int LANES = 4;
+
+	union
+	{
+		float m_fLanes[4];
+#if HC_USE_SIMD
+		__m128 m_fVec;
+#endif
+	};
+
+#if HC_USE_SIMD
+	HC_INLINE Floatx4() { m_fVec = _mm_setzero_ps(); }
+	HC_INLINE explicit Floatx4(float _fVal) { m_fVec = _mm_set1_ps(_fVal); }
+	HC_INLINE explicit Floatx4(float _fLane0, float _fLane1, float _fLane2, float _fLane3) { m_fVec = _mm_setr_ps(_fLane0, _fLane1, _fLane2, _fLane3); }
+	HC_INLINE explicit Floatx4(__m128 _fVec) { m_fVec = _fVec; }
+#else
+	HC_INLINE Floatx4() { m_fLanes[0] = 0.0f; m_fLanes[1] = 0.0f; m_fLanes[2] = 0.0f; m_fLanes[3] = 0.0f; }
+	HC_INLINE explicit Floatx4(float _fVal) { m_fLanes[0] = _fVal; m_fLanes[1] = _fVal; m_fLanes[2] = _fVal; m_fLanes[3] = _fVal; }
+	HC_INLINE explicit Floatx4(float _fLane0, float _fLane1, float _fLane2, float _fLane3) { m_fLanes[0] = _fLane0; m_fLanes[1] = _fLane1; m_fLanes[2] = _fLane2; m_fLanes[3] = _fLane3; }
+#endif
+
+	[[nodiscard]] HC_INLINE float operator[](int _iNdx) const { assert(_iNdx < LANES); return m_fLanes[_iNdx]; }
+	[[nodiscard]] HC_INLINE float& operator[](int _iNdx) { assert(_iNdx < LANES); return m_fLanes[_iNdx]; }
+};
+
+/// <summary>
+/// Eight floats processed together. Under HC_USE_SIMD this is a pair of SSE registers, so it works on any x64 CPU.
+/// </summary>
+struct HC_ALIGNAS(32) Floatx8
+{
+	static constexpr int LANES = 8;
+
+	union
+	{
+		float m_fLanes[8];
+#if HC_USE_SIMD
+		__m128 m_fVec[2];
+#endif
+	};
+
+#if HC_USE_SIMD
+	HC_INLINE Floatx8() { m_fVec[0] = _mm_setzero_ps(); m_fVec[1] = _mm_setzero_ps(); }
+	HC_INLINE explicit Floatx8(float _fVal) { m_fVec[0] = _mm_set1_ps(_fVal); m_fVec[1] = _mm_set1_ps(_fVal); }
+	HC_INLINE explicit Floatx8(__m128 _fLow, __m128 _fHigh) { m_fVec[0] = _fLow; m_fVec[1] = _fHigh; }
+#else
+	HC_INLINE Floatx8() { for (int iLane = 0; iLane < LANES; ++iLane) { m_fLanes[iLane] = 0.0f; } }
+	HC_INLINE explicit Floatx8(float _fVal) { for (int iLane = 0; iLane < LANES; ++iLane) { m_fLanes[iLane] = _fVal; } }
+#endif
+
+	[[nodiscard]] HC_INLINE float operator[](int _iNdx) const { assert(_iNdx < LANES); return m_fLanes[_iNdx]; }
+	[[nodiscard]] HC_INLINE float& operator[](int _iNdx) { assert(_iNdx < LANES); return m_fLanes[_iNdx]; }
+};
+
+/// <summary>
+/// Four unsigned 32-bit integers processed together, alongside Floatx4. Lattice coordinates and hashes live in these.
+/// Arithmetic wraps like uint32_t.
+/// </summary>
+struct HC_ALIGNAS(16) Uintx4
+{
+	static constexpr int LANES = 4;
+
+	union
+	{
+		uint32_t m_uLanes[4];
+#if HC_USE_SIMD
+		__m128i m_uVec;
+#endif
+	};
+
+#if HC_USE_SIMD
+	HC_INLINE Uintx4() { m_uVec = _mm_setzero_si128(); }
+	HC_INLINE explicit Uintx4(uint32_t _uVal) { m_uVec = _mm_set1_epi32(static_cast<int>(_uVal)); }
+	HC_INLINE explicit Uintx4(__m128i _uVec) { m_uVec = _uVec; }
+#else
+	HC_INLINE Uintx4() { m_uLanes[0] = 0U; m_uLanes[1] = 0U; m_uLanes[2] = 0U; m_uLanes[3] = 0U; }
+	HC_INLINE explicit Uintx4(uint32_t _uVal) { m_uLanes[0] = _uVal; m_uLanes[1] = _uVal; m_uLanes[2] = _uVal; m_uLanes[3] = _uVal; }
+#endif
+
+	[[nodiscard]] HC_INLINE uint32_t operator[](int _iNdx) const { assert(_iNdx < LANES); return m_uLanes[_iNdx]; }
+	[[nodiscard]] HC_INLINE uint32_t& operator[](int _iNdx) { assert(_iNdx < LANES); return m_uLanes[_iNdx]; }
+};
+
+#if HC_USE_SIMD
+[[nodiscard]] HC_INLINE Floatx4 operator+(const Floatx4& _fLeft, const Floatx4& _fRight) { return Floatx4(_mm_add_ps(_fLeft.m_fVec, _fRight.m_fVec)); }
+[[nodiscard]] HC_INLINE Floatx4 operator-(const Floatx4& _fLeft, const Floatx4& _fRight) { return Floatx4(_mm_sub_ps(_fLeft.m_fVec, _fRight.m_fVec)); }
+[[nodiscard]] HC_INLINE Floatx4 operator*(const Floatx4& _fLeft, const Floatx4& _fRight) { return Floatx4(_mm_mul_ps(_fLeft.m_fVec, _fRight.m_fVec)); }
+[[nodiscard]] HC_INLINE Floatx4 operator/(const Floatx4& _fLeft, const Floatx4& _fRight) { return Floatx4(_mm_div_ps(_fLeft.m_fVec, _fRight.m_fVec)); }
+[[nodiscard]] HC_INLINE Floatx4 operator-(const Floatx4& _fVal) { return Floatx4(_mm_xor_ps(_fVal.m_fVec, _mm_set1_ps(-0.0f))); }
+[[nodiscard]] HC_INLINE Floatx4 Sqrt(const Floatx4& _fVal) { return Floatx4(_mm_sqrt_ps(_fVal.m_fVec)); }
+[[nodiscard]] HC_INLINE Floatx4 Min(const Floatx4& _fLeft, const Floatx4& _fRight) { return Floatx4(_mm_min_ps(_fLeft.m_fVec, _fRight.m_fVec)); }
+[[nodiscard]] HC_INLINE Floatx4 Max(const Floatx4& _fLeft, const Floatx4& _fRight) { return Floatx4(_mm_max_ps(_fLeft.m_fVec, _fRight.m_fVec)); }
+[[nodiscard]] HC_INLINE Floatx4 Abs(const Floatx4& _fVal) { return Floatx4(AbsF(_fVal.m_fVec)); }
+
+[[nodiscard]] HC_INLINE Floatx8 operator+(const Floatx8& _fLeft, const Floatx8& _fRight) { return Floatx8(_mm_add_ps(_fLeft.m_fVec[0], _fRight.m_fVec[0]), _mm_add_ps(_fLeft.m_fVec[1], _fRight.m_fVec[1])); }
+[[nodiscard]] HC_INLINE Floatx8 operator-(const Floatx8& _fLeft, const Floatx8& _fRight) { return Floatx8(_mm_sub_ps(_fLeft.m_fVec[0], _fRight.m_fVec[0]), _mm_sub_ps(_fLeft.m_fVec[1], _fRight.m_fVec[1])); }
+[[nodiscard]] HC_INLINE Floatx8 operator*(const Floatx8& _fLeft, const Floatx8& _fRight) { return Floatx8(_mm_mul_ps(_fLeft.m_fVec[0], _fRight.m_fVec[0]), _mm_mul_ps(_fLeft.m_fVec[1], _fRight.m_fVec[1])); }
+[[nodiscard]] HC_INLINE Floatx8 operator/(const Floatx8& _fLeft, const Floatx8& _fRight) { return Floatx8(_mm_div_ps(_fLeft.m_fVec[0], _fRight.m_fVec[0]), _mm_div_ps(_fLeft.m_fVec[1], _fRight.m_fVec[1])); }
+[[nodiscard]] HC_INLINE Floatx8 operator-(const Floatx8& _fVal) { return Floatx8(_mm_xor_ps(_fVal.m_fVec[0], _mm_set1_ps(-0.0f)), _mm_xor_ps(_fVal.m_fVec[1], _mm_set1_ps(-0.0f))); }
+[[nodiscard]] HC_INLINE Floatx8 Sqrt(const Floatx8& _fVal) { return Floatx8(_mm_sqrt_ps(_fVal.m_fVec[0]), _mm_sqrt_ps(_fVal.m_fVec[1])); }
+[[nodiscard]] HC_INLINE Floatx8 Min(const Floatx8& _fLeft, const Floatx8& _fRight) { return Floatx8(_mm_min_ps(_fLeft.m_fVec[0], _fRight.m_fVec[0]), _mm_min_ps(_fLeft.m_fVec[1], _fRight.m_fVec[1])); }
+[[nodiscard]] HC_INLINE Floatx8 Max(const Floatx8& _fLeft, const Floatx8& _fRight) { return Floatx8(_mm_max_ps(_fLeft.m_fVec[0], _fRight.m_fVec[0]), _mm_max_ps(_fLeft.m_fVec[1], _fRight.m_fVec[1])); }
+[[nodiscard]] HC_INLINE Floatx8 Abs(const Floatx8& _fVal) { return Floatx8(AbsF(_fVal.m_fVec[0]), AbsF(_fVal.m_fVec[1])); }
+
+//Negates the lanes of _fVal whose matching _fSign lane is negative.
+[[nodiscard]] HC_INLINE Floatx4 FlipSign(const Floatx4& _fVal, const Floatx4& _fSign) { return Floatx4(_mm_xor_ps(_fVal.m_fVec, _mm_and_ps(_fSign.m_fVec, _mm_set1_ps(-0.0f)))); }
+[[nodiscard]] HC_INLINE Floatx8 FlipSign(const Floatx8& _fVal, const Floatx8& _fSign) { return Floatx8(FlipSign(Floatx4(_fVal.m_fVec[0]), Floatx4(_fSign.m_fVec[0])).m_fVec, FlipSign(Floatx4(_fVal.m_fVec[1]), Floatx4(_fSign.m_fVec[1])).m_fVec); }
+
+//Per lane _fLeft > _fRight ? _fTrue : _fFalse, without branching.
+[[nodiscard]] HC_INLINE Floatx4 SelectGreater(const Floatx4& _fLeft, const Floatx4& _fRight, const Floatx4& _fTrue, const Floatx4& _fFalse) {
+	const __m128 fMask = _mm_cmpgt_ps(_fLeft.m_fVec, _fRight.m_fVec);
+	return Floatx4(_mm_or_ps(_mm_and_ps(fMask, _fTrue.m_fVec), _mm_andnot_ps(fMask, _fFalse.m_fVec)));
+}
+[[nodiscard]] HC_INLINE Floatx8 SelectGreater(const Floatx8& _fLeft, const Floatx8& _fRight, const Floatx8& _fTrue, const Floatx8& _fFalse) {
+	return Floatx8(SelectGreater(Floatx4(_fLeft.m_fVec[0]), Floatx4(_fRight.m_fVec[0]), Floatx4(_fTrue.m_fVec[0]), Floatx4(_fFalse.m_fVec[0])).m_fVec,
+				   SelectGreater(Floatx4(_fLeft.m_fVec[1]), Floatx4(_fRight.m_fVec[1]), Floatx4(_fTrue.m_fVec[1]), Floatx4(_fFalse.m_fVec[1])).m_fVec);
+}
+
+//One bit per lane, set where _fLeft <= _fRight. Lane 0 is the lowest bit.
+[[nodiscard]] HC_INLINE int MaskLessEqual(const Floatx4& _fLeft, const Floatx4& _fRight) { return _mm_movemask_ps(_mm_cmple_ps(_fLeft.m_fVec, _fRight.m_fVec)); }
+#else
+[[nodiscard]] HC_INLINE Floatx4 operator+(const Floatx4& _fLeft, const Floatx4& _fRight) { HC_LANEWISE(Floatx4, _fLeft.m_fLanes[iLane] + _fRight.m_fLanes[iLane]); }
+[[nodiscard]] HC_INLINE Floatx4 operator-(const Floatx4& _fLeft, const Floatx4& _fRight) { HC_LANEWISE(Floatx4, _fLeft.m_fLanes[iLane] - _fRight.m_fLanes[iLane]); }
+[[nodiscard]] HC_INLINE Floatx4 operator*(const Floatx4& _fLeft, const Floatx4& _fRight) { HC_LANEWISE(Floatx4, _fLeft.m_fLanes[iLane] * _fRight.m_fLanes[iLane]); }
+[[nodiscard]] HC_INLINE Floatx4 operator/(const Floatx4& _fLeft, const Floatx4& _fRight) { HC_LANEWISE(Floatx4, _fLeft.m_fLanes[iLane] / _fRight.m_fLanes[iLane]); }
+[[nodiscard]] HC_INLINE Floatx4 operator-(const Floatx4& _fVal) { HC_LANEWISE(Floatx4, -_fVal.m_fLanes[iLane]); }
+[[nodiscard]] HC_INLINE Floatx4 Sqrt(const Floatx4& _fVal) { HC_LANEWISE(Floatx4, sqrtf(_fVal.m_fLanes[iLane])); }
+[[nodiscard]] HC_INLINE Floatx4 Min(const Floatx4& _fLeft, const Floatx4& _fRight) { HC_LANEWISE(Floatx4, HC_TERNARY(_fLeft.m_fLanes[iLane], _fRight.m_fLanes[iLane], <)); }
+[[nodiscard]] HC_INLINE Floatx4 Max(const Floatx4& _fLeft, const Floatx4& _fRight) { HC_LANEWISE(Floatx4, HC_TERNARY(_fLeft.m_fLanes[iLane], _fRight.m_fLanes[iLane], >)); }
+[[nodiscard]] HC_INLINE Floatx4 Abs(const Floatx4& _fVal) { HC_LANEWISE(Floatx4, fabsf(_fVal.m_fLanes[iLane])); }
+
+[[nodiscard]] HC_INLINE Floatx8 operator+(const Floatx8& _fLeft, const Floatx8& _fRight) { HC_LANEWISE(Floatx8, _fLeft.m_fLanes[iLane] + _fRight.m_fLanes[iLane]); }
+[[nodiscard]] HC_INLINE Floatx8 operator-(const Floatx8& _fLeft, const Floatx8& _fRight) { HC_LANEWISE(Floatx8, _fLeft.m_fLanes[iLane] - _fRight.m_fLanes[iLane]); }
+[[nodiscard]] HC_INLINE Floatx8 operator*(const Floatx8& _fLeft, const Floatx8& _fRight) { HC_LANEWISE(Floatx8, _fLeft.m_fLanes[iLane] * _fRight.m_fLanes[iLane]); }
+[[nodiscard]] HC_INLINE Floatx8 operator/(const Floatx8& _fLeft, const Floatx8& _fRight) { HC_LANEWISE(Floatx8, _fLeft.m_fLanes[iLane] / _fRight.m_fLanes[iLane]); }
+[[nodiscard]] HC_INLINE Floatx8 operator-(const Floatx8& _fVal) { HC_LANEWISE(Floatx8, -_fVal.m_fLanes[iLane]); }
+[[nodiscard]] HC_INLINE Floatx8 Sqrt(const Floatx8& _fVal) { HC_LANEWISE(Floatx8, sqrtf(_fVal.m_fLanes[iLane])); }
+[[nodiscard]] HC_INLINE Floatx8 Min(const Floatx8& _fLeft, const Floatx8& _fRight) { HC_LANEWISE(Floatx8, HC_TERNARY(_fLeft.m_fLanes[iLane], _fRight.m_fLanes[iLane], <)); }
+[[nodiscard]] HC_INLINE Floatx8 Max(const Floatx8& _fLeft, const Floatx8& _fRight) { HC_LANEWISE(Floatx8, HC_TERNARY(_fLeft.m_fLanes[iLane], _fRight.m_fLanes[iLane], >)); }
+[[nodiscard]] HC_INLINE Floatx8 Abs(const Floatx8& _fVal) { HC_LANEWISE(Floatx8, fabsf(_fVal.m_fLanes[iLane])); }
+
+[[nodiscard]] HC_INLINE Floatx4 FlipSign(const Floatx4& _fVal, const Floatx4& _fSign) { HC_LANEWISE(Floatx4, signbit(_fSign.m_fLanes[iLane]) ? -_fVal.m_fLanes[iLane] : _fVal.m_fLanes[iLane]); }
+[[nodiscard]] HC_INLINE Floatx8 FlipSign(const Floatx8& _fVal, const Floatx8& _fSign) { HC_LANEWISE(Floatx8, signbit(_fSign.m_fLanes[iLane]) ? -_fVal.m_fLanes[iLane] : _fVal.m_fLanes[iLane]); }
+[[nodiscard]] HC_INLINE Floatx4 SelectGreater(const Floatx4& _fLeft, const Floatx4& _fRight, const Floatx4& _fTrue, const Floatx4& _fFalse) {
+	HC_LANEWISE(Floatx4, _fLeft.m_fLanes[iLane] > _fRight.m_fLanes[iLane] ? _fTrue.m_fLanes[iLane] : _fFalse.m_fLanes[iLane]);
+}
+[[nodiscard]] HC_INLINE Floatx8 SelectGreater(const Floatx8& _fLeft, const Floatx8& _fRight, const Floatx8& _fTrue, const Floatx8& _fFalse) {
+	HC_LANEWISE(Floatx8, _fLeft.m_fLanes[iLane] > _fRight.m_fLanes[iLane] ? _fTrue.m_fLanes[iLane] : _fFalse.m_fLanes[iLane]);
+}
+[[nodiscard]] HC_INLINE int MaskLessEqual(const Floatx4& _fLeft, const Floatx4& _fRight) {
+	int iMask = 0;
+	for (int iLane = 0; iLane < Floatx4::LANES; ++iLane) { iMask |= (_fLeft.m_fLanes[iLane] <= _fRight.m_fLanes[iLane] ? 1 : 0) << iLane; }
+	return iMask;
+}
+#endif
+
+[[nodiscard]] HC_INLINE Floatx4 operator*(const Floatx4& _fLeft, float _fRight) { return _fLeft * Floatx4(_fRight); }
+[[nodiscard]] HC_INLINE Floatx4 operator*(float _fLeft, const Floatx4& _fRight) { return Floatx4(_fLeft) * _fRight; }
+[[nodiscard]] HC_INLINE Floatx4 operator/(const Floatx4& _fLeft, float _fRight) { return _fLeft * Floatx4(1.0f / _fRight); }
+HC_INLINE Floatx4& operator+=(Floatx4& _fLeft, const Floatx4& _fRight) { _fLeft = _fLeft + _fRight; return _fLeft; }
+HC_INLINE Floatx4& operator-=(Floatx4& _fLeft, const Floatx4& _fRight) { _fLeft = _fLeft - _fRight; return _fLeft; }
+HC_INLINE Floatx4& operator*=(Floatx4& _fLeft, const Floatx4& _fRight) { _fLeft = _fLeft * _fRight; return _fLeft; }
+
+[[nodiscard]] HC_INLINE Floatx8 operator*(const Floatx8& _fLeft, float _fRight) { return _fLeft * Floatx8(_fRight); }
+[[nodiscard]] HC_INLINE Floatx8 operator*(float _fLeft, const Floatx8& _fRight) { return Floatx8(_fLeft) * _fRight; }
+[[nodiscard]] HC_INLINE Floatx8 operator/(const Floatx8& _fLeft, float _fRight) { return _fLeft * Floatx8(1.0f / _fRight); }
+HC_INLINE Floatx8& operator+=(Floatx8& _fLeft, const Floatx8& _fRight) { _fLeft = _fLeft + _fRight; return _fLeft; }
+HC_INLINE Floatx8& operator-=(Floatx8& _fLeft, const Floatx8& _fRight) { _fLeft = _fLeft - _fRight; return _fLeft; }
+HC_INLINE Floatx8& operator*=(Floatx8& _fLeft, const Floatx8& _fRight) { _fLeft = _fLeft * _fRight; return _fLeft; }
+
+#if HC_USE_SIMD
+[[nodiscard]] HC_INLINE Uintx4 operator+(const Uintx4& _uLeft, const Uintx4& _uRight) { return Uintx4(_mm_add_epi32(_uLeft.m_uVec, _uRight.m_uVec)); }
+[[nodiscard]] HC_INLINE Uintx4 operator-(const Uintx4& _uLeft, const Uintx4& _uRight) { return Uintx4(_mm_sub_epi32(_uLeft.m_uVec, _uRight.m_uVec)); }
+[[nodiscard]] HC_INLINE Uintx4 operator^(const Uintx4& _uLeft, const Uintx4& _uRight) { return Uintx4(_mm_xor_si128(_uLeft.m_uVec, _uRight.m_uVec)); }
+[[nodiscard]] HC_INLINE Uintx4 operator&(const Uintx4& _uLeft, const Uintx4& _uRight) { return Uintx4(_mm_and_si128(_uLeft.m_uVec, _uRight.m_uVec)); }
+[[nodiscard]] HC_INLINE Uintx4 operator>>(const Uintx4& _uVal, int _iShift) { return Uintx4(_mm_srl_epi32(_uVal.m_uVec, _mm_cvtsi32_si128(_iShift))); }
+
+//Low 32 bits of each product. SSE2 only multiplies the even lanes, so the odd lanes go through a second shuffled multiply.
+[[nodiscard]] HC_INLINE Uintx4 operator*(const Uintx4& _uLeft, const Uintx4& _uRight) {
+	const __m128i uEven = _mm_mul_epu32(_uLeft.m_uVec, _uRight.m_uVec);
+	const __m128i uOdd = _mm_mul_epu32(_mm_shuffle_epi32(_uLeft.m_uVec, _MM_SHUFFLE(3, 3, 1, 1)), _mm_shuffle_epi32(_uRight.m_uVec, _MM_SHUFFLE(3, 3, 1, 1)));
+	return Uintx4(_mm_unpacklo_epi32(_mm_shuffle_epi32(uEven, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_epi32(uOdd, _MM_SHUFFLE(2, 0, 2, 0))));
+}
+
+//All bits set in the lanes where _uLeft > _uRight, comparing as signed integers.
+[[nodiscard]] HC_INLINE Uintx4 MaskGreater(const Uintx4& _uLeft, const Uintx4& _uRight) { return Uintx4(_mm_cmpgt_epi32(_uLeft.m_uVec, _uRight.m_uVec)); }
+[[nodiscard]] HC_INLINE Uintx4 MaskGreater(const Floatx4& _fLeft, const Floatx4& _fRight) { return Uintx4(_mm_castps_si128(_mm_cmpgt_ps(_fLeft.m_fVec, _fRight.m_fVec))); }
+
+//Per lane _uMask ? _fTrue : _fFalse, for masks built by MaskGreater.
+[[nodiscard]] HC_INLINE Floatx4 Select(const Uintx4& _uMask, const Floatx4& _fTrue, const Floatx4& _fFalse) {
+	const __m128 fMask = _mm_castsi128_ps(_uMask.m_uVec);
+	return Floatx4(_mm_or_ps(_mm_and_ps(fMask, _fTrue.m_fVec), _mm_andnot_ps(fMask, _fFalse.m_fVec)));
+}
+
+//Rounds toward negative infinity. SSE2 has no floor, so truncate and step down the lanes that truncation rounded up.
+[[nodiscard]] HC_INLINE Floatx4 Floor(const Floatx4& _fVal) {
+	const __m128 fTrunc = _mm_cvtepi32_ps(_mm_cvttps_epi32(_fVal.m_fVec));
+	return Floatx4(_mm_sub_ps(fTrunc, _mm_and_ps(_mm_cmpgt_ps(fTrunc, _fVal.m_fVec), _mm_set1_ps(1.0f))));
+}
+[[nodiscard]] HC_INLINE Floatx8 Floor(const Floatx8& _fVal) { return Floatx8(Floor(Floatx4(_fVal.m_fVec[0])).m_fVec, Floor(Floatx4(_fVal.m_fVec[1])).m_fVec); }
+
+//Truncates toward zero into signed integers and keeps their bits. Lanes must fit in an int32_t.
+[[nodiscard]] HC_INLINE Uintx4 ToUintx4(const Floatx4& _fVal) { return Uintx4(_mm_cvttps_epi32(_fVal.m_fVec)); }
+
+//Converts lanes read as signed integers.
+[[nodiscard]] HC_INLINE Floatx4 ToFloatx4(const Uintx4& _uVal) { return Floatx4(_mm_cvtepi32_ps(_uVal.m_uVec)); }
+#else
+[[nodiscard]] HC_INLINE Uintx4 operator+(const Uintx4& _uLeft, const Uintx4& _uRight) { HC_LANEWISE_UINT(_uLeft.m_uLanes[iLane] + _uRight.m_uLanes[iLane]); }
+[[nodiscard]] HC_INLINE Uintx4 operator-(const Uintx4& _uLeft, const Uintx4& _uRight) { HC_LANEWISE_UINT(_uLeft.m_uLanes[iLane] - _uRight.m_uLanes[iLane]); }
+[[nodiscard]] HC_INLINE Uintx4 operator^(const Uintx4& _uLeft, const Uintx4& _uRight) { HC_LANEWISE_UINT(_uLeft.m_uLanes[iLane] ^ _uRight.m_uLanes[iLane]); }
+[[nodiscard]] HC_INLINE Uintx4 operator&(const Uintx4& _uLeft, const Uintx4& _uRight) { HC_LANEWISE_UINT(_uLeft.m_uLanes[iLane] & _uRight.m_uLanes[iLane]); }
+[[nodiscard]] HC_INLINE Uintx4 operator>>(const Uintx4& _uVal, int _iShift) { HC_LANEWISE_UINT(_uVal.m_uLanes[iLane] >> _iShift); }
+[[nodiscard]] HC_INLINE Uintx4 operator*(const Uintx4& _uLeft, const Uintx4& _uRight) { HC_LANEWISE_UINT(_uLeft.m_uLanes[iLane] * _uRight.m_uLanes[iLane]); }
+[[nodiscard]] HC_INLINE Uintx4 MaskGreater(const Uintx4& _uLeft, const Uintx4& _uRight) { HC_LANEWISE_UINT(static_cast<int32_t>(_uLeft.m_uLanes[iLane]) > static_cast<int32_t>(_uRight.m_uLanes[iLane]) ? UINT32_MAX : 0U); }
+[[nodiscard]] HC_INLINE Uintx4 MaskGreater(const Floatx4& _fLeft, const Floatx4& _fRight) { HC_LANEWISE_UINT(_fLeft.m_fLanes[iLane] > _fRight.m_fLanes[iLane] ? UINT32_MAX : 0U); }
+[[nodiscard]] HC_INLINE Floatx4 Select(const Uintx4& _uMask, const Floatx4& _fTrue, const Floatx4& _fFalse) { HC_LANEWISE(Floatx4, _uMask.m_uLanes[iLane] != 0U ? _fTrue.m_fLanes[iLane] : _fFalse.m_fLanes[iLane]); }
+[[nodiscard]] HC_INLINE Floatx4 Floor(const Floatx4& _fVal) { HC_LANEWISE(Floatx4, floorf(_fVal.m_fLanes[iLane])); }
+[[nodiscard]] HC_INLINE Floatx8 Floor(const Floatx8& _fVal) { HC_LANEWISE(Floatx8, floorf(_fVal.m_fLanes[iLane])); }
+[[nodiscard]] HC_INLINE Uintx4 ToUintx4(const Floatx4& _fVal) { HC_LANEWISE_UINT(static_cast<uint32_t>(static_cast<int32_t>(_fVal.m_fLanes[iLane]))); }
+[[nodiscard]] HC_INLINE Floatx4 ToFloatx4(const Uintx4& _uVal) { HC_LANEWISE(Floatx4, static_cast<float>(static_cast<int32_t>(_uVal.m_uLanes[iLane]))); }
+#endif
+
+[[nodiscard]] HC_INLINE Uintx4 operator+(const Uintx4& _uLeft, uint32_t _uRight) { return _uLeft + Uintx4(_uRight); }
+[[nodiscard]] HC_INLINE Uintx4 operator*(const Uintx4& _uLeft, uint32_t _uRight) { return _uLeft * Uintx4(_uRight); }
+[[nodiscard]] HC_INLINE Uintx4 operator&(const Uintx4& _uLeft, uint32_t _uRight) { return _uLeft & Uintx4(_uRight); }
+HC_INLINE Uintx4& operator+=(Uintx4& _uLeft, const Uintx4& _uRight) { _uLeft = _uLeft + _uRight; return _uLeft; }
+
+//Polynomial fits from Cephes' asinf, sinf and cosf. Each stays within a few float ulps of the libm function on its range.
+#define HC_WIDE_ASIN_P0 4.2163199048e-2f
+#define HC_WIDE_ASIN_P1 2.4181311049e-2f
+#define HC_WIDE_ASIN_P2 4.5470025998e-2f
+#define HC_WIDE_ASIN_P3 7.4953002686e-2f
+#define HC_WIDE_ASIN_P4 1.6666752422e-1f
+#define HC_WIDE_SIN_P0 -1.9515295891e-4f
+#define HC_WIDE_SIN_P1 8.3321608736e-3f
+#define HC_WIDE_SIN_P2 -1.6666654611e-1f
+#define HC_WIDE_COS_P0 2.443315711809948e-5f
+#define HC_WIDE_COS_P1 -1.388731625493765e-3f
+#define HC_WIDE_COS_P2 4.166664568298827e-2f
+//pi / 2 split so the first two parts multiply a quadrant count exactly
+#define HC_WIDE_PIO2_1 1.5703125f
+#define HC_WIDE_PIO2_2 4.837512969970703125e-4f
+#define HC_WIDE_PIO2_3 7.54978995489188216e-8f
+
+//Lane-wise acos for lanes in [-1, 1]. asin(z) on [0, 0.5] is an odd polynomial, and larger magnitudes go through
+//acos(x) = 2 * asin(sqrt((1 - x) / 2)), which keeps full precision as x approaches one.
+template<typename Wide>
+[[nodiscard]] HC_INLINE Wide ArcCosLanes(const Wide& _fVal) {
+	const Wide fAbs = Abs(_fVal);
+	const Wide fHalf = Wide(0.5f);
+	const Wide fZ = SelectGreater(fAbs, fHalf, (Wide(1.0f) - fAbs) * fHalf, fAbs * fAbs);
+	const Wide fS = SelectGreater(fAbs, fHalf, Sqrt(fZ), fAbs);
+
+	const Wide fPoly = (((Wide(HC_WIDE_ASIN_P0) * fZ + Wide(HC_WIDE_ASIN_P1)) * fZ + Wide(HC_WIDE_ASIN_P2)) * fZ + Wide(HC_WIDE_ASIN_P3)) * fZ + Wide(HC_WIDE_ASIN_P4);
+	const Wide fASin = fS + fS * fZ * fPoly;
+	const Wide fACos = SelectGreater(fAbs, fHalf, fASin + fASin, Wide(HC_PI_HALF) - fASin);
+
+	return SelectGreater(Wide(), _fVal, Wide(HC_PI) - fACos, fACos);
+}
+
+//Lane-wise sin and cos. Each lane is reduced to [-pi / 4, pi / 4] by its nearest multiple of pi / 2, whose quadrant picks
+//which polynomial lands in which output and their signs. Meant for angles of a few turns, not thousands.
+template<typename Wide>
+HC_INLINE void SinCosLanes(const Wide& _fVal, Wide& _fSin, Wide& _fCos) {
+	const Wide fQuadrant = Floor(_fVal * Wide(2.0f / HC_PI) + Wide(0.5f));
+	const Wide fReduced = ((_fVal - fQuadrant * Wide(HC_WIDE_PIO2_1)) - fQuadrant * Wide(HC_WIDE_PIO2_2)) - fQuadrant * Wide(HC_WIDE_PIO2_3);
+	const Wide fSquared = fReduced * fReduced;
+
+	const Wide fSin = fReduced + fReduced * fSquared * ((Wide(HC_WIDE_SIN_P0) * fSquared + Wide(HC_WIDE_SIN_P1)) * fSquared + Wide(HC_WIDE_SIN_P2));
+	const Wide fCos = Wide(1.0f) - fSquared * Wide(0.5f) + fSquared * fSquared * ((Wide(HC_WIDE_COS_P0) * fSquared + Wide(HC_WIDE_COS_P1)) * fSquared + Wide(HC_WIDE_COS_P2));
+
+	//Quadrants 1 and 3 swap the polynomials, 2 and 3 negate sin, and 1 and 2 negate cos
+	const Wide fMod4 = fQuadrant - Floor(fQuadrant * Wide(0.25f)) * Wide(4.0f);
+	const Wide fOdd = fMod4 * Wide(0.5f) - Floor(fMod4 * Wide(0.5f));
+	const Wide fSinBase = SelectGreater(fOdd, Wide(0.25f), fCos, fSin);
+	const Wide fCosBase = SelectGreater(fOdd, Wide(0.25f), fSin, fCos);
+
+	_fSin = SelectGreater(fMod4, Wide(1.5f), -fSinBase, fSinBase);
+	_fCos = SelectGreater(Abs(fMod4 - Wide(1.5f)), Wide(1.0f), fCosBase, -fCosBase);
+}
+
+[[nodiscard]] HC_INLINE Floatx4 ArcCos(const Floatx4& _fVal) { return ArcCosLanes(_fVal); }
+[[nodiscard]] HC_INLINE Floatx8 ArcCos(const Floatx8& _fVal) { return ArcCosLanes(_fVal); }
+HC_INLINE void SinCos(const Floatx4& _fVal, Floatx4& _fSin, Floatx4& _fCos) { SinCosLanes(_fVal, _fSin, _fCos); }
+HC_INLINE void SinCos(const Floatx8& _fVal, Floatx8& _fSin, Floatx8& _fCos) { SinCosLanes(_fVal, _fSin, _fCos); }
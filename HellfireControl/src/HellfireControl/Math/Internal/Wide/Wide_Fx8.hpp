@@ -0,0 +1,311 @@
+#pragma once
+
+#include <HellfireControl/Math/Internal/Wide/Wide_Common.hpp>
+
+/// <summary>
+/// Eight Vec3Fs stored as structure-of-arrays. Every operation works on all eight lanes at once.
+/// </summary>
+struct Vec3Fx8
+{
+	Floatx8 x;
+	Floatx8 y;
+	Floatx8 z;
+
+	HC_INLINE Vec3Fx8() : x(), y(), z() {}
+	HC_INLINE explicit Vec3Fx8(const Vec3F& _vVal) : x(_vVal.x), y(_vVal.y), z(_vVal.z) {}
+	HC_INLINE explicit Vec3Fx8(const Floatx8& _fX, const Floatx8& _fY, const Floatx8& _fZ) : x(_fX), y(_fY), z(_fZ) {}
+
+	[[nodiscard]] HC_INLINE Vec3F GetLane(int _iLane) const { return Vec3F(x[_iLane], y[_iLane], z[_iLane]); }
+	HC_INLINE void SetLane(int _iLane, const Vec3F& _vVal) { x[_iLane] = _vVal.x; y[_iLane] = _vVal.y; z[_iLane] = _vVal.z; }
+};
+
+/// <summary>
+/// Eight Vec4Fs stored as structure-of-arrays. Every operation works on all eight lanes at once.
+/// </summary>
+struct Vec4Fx8
+{
+	Floatx8 x;
+	Floatx8 y;
+	Floatx8 z;
+	Floatx8 w;
+
+	HC_INLINE Vec4Fx8() : x(), y(), z(), w() {}
+	HC_INLINE explicit Vec4Fx8(const Vec4F& _vVal) : x(_vVal.x), y(_vVal.y), z(_vVal.z), w(_vVal.w) {}
+	HC_INLINE explicit Vec4Fx8(const Floatx8& _fX, const Floatx8& _fY, const Floatx8& _fZ, const Floatx8& _fW) : x(_fX), y(_fY), z(_fZ), w(_fW) {}
+	HC_INLINE explicit Vec4Fx8(const Vec3Fx8& _vXYZ, const Floatx8& _fW) : x(_vXYZ.x), y(_vXYZ.y), z(_vXYZ.z), w(_fW) {}
+
+	[[nodiscard]] HC_INLINE Vec4F GetLane(int _iLane) const { return Vec4F(x[_iLane], y[_iLane], z[_iLane], w[_iLane]); }
+	HC_INLINE void SetLane(int _iLane, const Vec4F& _vVal) { x[_iLane] = _vVal.x; y[_iLane] = _vVal.y; z[_iLane] = _vVal.z; w[_iLane] = _vVal.w; }
+	[[nodiscard]] HC_INLINE Vec3Fx8 XYZ() const { return Vec3Fx8(x, y, z); }
+};
+
+/// <summary>
+/// Eight QuaternionFs stored as structure-of-arrays. Every operation works on all eight lanes at once.
+/// </summary>
+struct QuaternionFx8
+{
+	Floatx8 x;
+	Floatx8 y;
+	Floatx8 z;
+	Floatx8 w;
+
+	HC_INLINE QuaternionFx8() : x(), y(), z(), w() {}
+	HC_INLINE explicit QuaternionFx8(const QuaternionF& _qVal) : x(_qVal.x), y(_qVal.y), z(_qVal.z), w(_qVal.w) {}
+	HC_INLINE explicit QuaternionFx8(const Floatx8& _fX, const Floatx8& _fY, const Floatx8& _fZ, const Floatx8& _fW) : x(_fX), y(_fY), z(_fZ), w(_fW) {}
+
+	[[nodiscard]] HC_INLINE QuaternionF GetLane(int _iLane) const { return QuaternionF(x[_iLane], y[_iLane], z[_iLane], w[_iLane]); }
+	HC_INLINE void SetLane(int _iLane, const QuaternionF& _qVal) { x[_iLane] = _qVal.x; y[_iLane] = _qVal.y; z[_iLane] = _qVal.z; w[_iLane] = _qVal.w; }
+};
+
+[[nodiscard]] HC_INLINE Vec3Fx8 operator+(const Vec3Fx8& _vLeft, const Vec3Fx8& _vRight) { return Vec3Fx8(_vLeft.x + _vRight.x, _vLeft.y + _vRight.y, _vLeft.z + _vRight.z); }
+[[nodiscard]] HC_INLINE Vec3Fx8 operator-(const Vec3Fx8& _vLeft, const Vec3Fx8& _vRight) { return Vec3Fx8(_vLeft.x - _vRight.x, _vLeft.y - _vRight.y, _vLeft.z - _vRight.z); }
+[[nodiscard]] HC_INLINE Vec3Fx8 operator*(const Vec3Fx8& _vLeft, const Vec3Fx8& _vRight) { return Vec3Fx8(_vLeft.x * _vRight.x, _vLeft.y * _vRight.y, _vLeft.z * _vRight.z); }
+[[nodiscard]] HC_INLINE Vec3Fx8 operator*(const Vec3Fx8& _vLeft, const Floatx8& _fRight) { return Vec3Fx8(_vLeft.x * _fRight, _vLeft.y * _fRight, _vLeft.z * _fRight); }
+[[nodiscard]] HC_INLINE Vec3Fx8 operator*(const Floatx8& _fLeft, const Vec3Fx8& _vRight) { return _vRight * _fLeft; }
+[[nodiscard]] HC_INLINE Vec3Fx8 operator*(const Vec3Fx8& _vLeft, float _fRight) { return _vLeft * Floatx8(_fRight); }
+[[nodiscard]] HC_INLINE Vec3Fx8 operator*(float _fLeft, const Vec3Fx8& _vRight) { return _vRight * Floatx8(_fLeft); }
+[[nodiscard]] HC_INLINE Vec3Fx8 operator/(const Vec3Fx8& _vLeft, const Floatx8& _fRight) { return Vec3Fx8(_vLeft.x / _fRight, _vLeft.y / _fRight, _vLeft.z / _fRight); }
+[[nodiscard]] HC_INLINE Vec3Fx8 operator-(const Vec3Fx8& _vVal) { return Vec3Fx8(-_vVal.x, -_vVal.y, -_vVal.z); }
+HC_INLINE Vec3Fx8& operator+=(Vec3Fx8& _vLeft, const Vec3Fx8& _vRight) { _vLeft = _vLeft + _vRight; return _vLeft; }
+HC_INLINE Vec3Fx8& operator-=(Vec3Fx8& _vLeft, const Vec3Fx8& _vRight) { _vLeft = _vLeft - _vRight; return _vLeft; }
+HC_INLINE Vec3Fx8& operator*=(Vec3Fx8& _vLeft, const Floatx8& _fRight) { _vLeft = _vLeft * _fRight; return _vLeft; }
+[[nodiscard]] HC_INLINE Floatx8 Dot(const Vec3Fx8& _vLeft, const Vec3Fx8& _vRight) { return _vLeft.x * _vRight.x + _vLeft.y * _vRight.y + _vLeft.z * _vRight.z; }
+[[nodiscard]] HC_INLINE Floatx8 LengthSquared(const Vec3Fx8& _vVal) { return Dot(_vVal, _vVal); }
+[[nodiscard]] HC_INLINE Floatx8 Length(const Vec3Fx8& _vVal) { return Sqrt(Dot(_vVal, _vVal)); }
+[[nodiscard]] HC_INLINE Vec3Fx8 Normalize(const Vec3Fx8& _vVal) { return _vVal / Length(_vVal); }
+[[nodiscard]] HC_INLINE Vec3Fx8 Cross(const Vec3Fx8& _vLeft, const Vec3Fx8& _vRight) {
+	return Vec3Fx8(_vLeft.y * _vRight.z - _vLeft.z * _vRight.y,
+				   _vLeft.z * _vRight.x - _vLeft.x * _vRight.z,
+				   _vLeft.x * _vRight.y - _vLeft.y * _vRight.x);
+}
+
+[[nodiscard]] HC_INLINE Vec4Fx8 operator+(const Vec4Fx8& _vLeft, const Vec4Fx8& _vRight) { return Vec4Fx8(_vLeft.x + _vRight.x, _vLeft.y + _vRight.y, _vLeft.z + _vRight.z, _vLeft.w + _vRight.w); }
+[[nodiscard]] HC_INLINE Vec4Fx8 operator-(const Vec4Fx8& _vLeft, const Vec4Fx8& _vRight) { return Vec4Fx8(_vLeft.x - _vRight.x, _vLeft.y - _vRight.y, _vLeft.z - _vRight.z, _vLeft.w - _vRight.w); }
+[[nodiscard]] HC_INLINE Vec4Fx8 operator*(const Vec4Fx8& _vLeft, const Vec4Fx8& _vRight) { return Vec4Fx8(_vLeft.x * _vRight.x, _vLeft.y * _vRight.y, _vLeft.z * _vRight.z, _vLeft.w * _vRight.w); }
+[[nodiscard]] HC_INLINE Vec4Fx8 operator*(const Vec4Fx8& _vLeft, const Floatx8& _fRight) { return Vec4Fx8(_vLeft.x * _fRight, _vLeft.y * _fRight, _vLeft.z * _fRight, _vLeft.w * _fRight); }
+[[nodiscard]] HC_INLINE Vec4Fx8 operator*(const Floatx8& _fLeft, const Vec4Fx8& _vRight) { return _vRight * _fLeft; }
+[[nodiscard]] HC_INLINE Vec4Fx8 operator*(const Vec4Fx8& _vLeft, float _fRight) { return _vLeft * Floatx8(_fRight); }
+[[nodiscard]] HC_INLINE Vec4Fx8 operator*(float _fLeft, const Vec4Fx8& _vRight) { return _vRight * Floatx8(_fLeft); }
+[[nodiscard]] HC_INLINE Vec4Fx8 operator/(const Vec4Fx8& _vLeft, const Floatx8& _fRight) { return Vec4Fx8(_vLeft.x / _fRight, _vLeft.y / _fRight, _vLeft.z / _fRight, _vLeft.w / _fRight); }
+[[nodiscard]] HC_INLINE Vec4Fx8 operator-(const Vec4Fx8& _vVal) { return Vec4Fx8(-_vVal.x, -_vVal.y, -_vVal.z, -_vVal.w); }
+HC_INLINE Vec4Fx8& operator+=(Vec4Fx8& _vLeft, const Vec4Fx8& _vRight) { _vLeft = _vLeft + _vRight; return _vLeft; }
+HC_INLINE Vec4Fx8& operator-=(Vec4Fx8& _vLeft, const Vec4Fx8& _vRight) { _vLeft = _vLeft - _vRight; return _vLeft; }
+HC_INLINE Vec4Fx8& operator*=(Vec4Fx8& _vLeft, const Floatx8& _fRight) { _vLeft = _vLeft * _fRight; return _vLeft; }
+[[nodiscard]] HC_INLINE Floatx8 Dot(const Vec4Fx8& _vLeft, const Vec4Fx8& _vRight) { return _vLeft.x * _vRight.x + _vLeft.y * _vRight.y + _vLeft.z * _vRight.z + _vLeft.w * _vRight.w; }
+[[nodiscard]] HC_INLINE Floatx8 LengthSquared(const Vec4Fx8& _vVal) { return Dot(_vVal, _vVal); }
+[[nodiscard]] HC_INLINE Floatx8 Length(const Vec4Fx8& _vVal) { return Sqrt(Dot(_vVal, _vVal)); }
+[[nodiscard]] HC_INLINE Vec4Fx8 Normalize(const Vec4Fx8& _vVal) { return _vVal / Length(_vVal); }
+[[nodiscard]] HC_INLINE Vec4Fx8 Cross(const Vec4Fx8& _vLeft, const Vec4Fx8& _vRight) { return Vec4Fx8(Cross(_vLeft.XYZ(), _vRight.XYZ()), _vLeft.w); }
+
+[[nodiscard]] HC_INLINE QuaternionFx8 operator+(const QuaternionFx8& _qLeft, const QuaternionFx8& _qRight) { return QuaternionFx8(_qLeft.x + _qRight.x, _qLeft.y + _qRight.y, _qLeft.z + _qRight.z, _qLeft.w + _qRight.w); }
+[[nodiscard]] HC_INLINE QuaternionFx8 operator-(const QuaternionFx8& _qLeft, const QuaternionFx8& _qRight) { return QuaternionFx8(_qLeft.x - _qRight.x, _qLeft.y - _qRight.y, _qLeft.z - _qRight.z, _qLeft.w - _qRight.w); }
+[[nodiscard]] HC_INLINE QuaternionFx8 operator*(const QuaternionFx8& _qLeft, const Floatx8& _fRight) { return QuaternionFx8(_qLeft.x * _fRight, _qLeft.y * _fRight, _qLeft.z * _fRight, _qLeft.w * _fRight); }
+[[nodiscard]] HC_INLINE QuaternionFx8 operator*(const Floatx8& _fLeft, const QuaternionFx8& _qRight) { return _qRight * _fLeft; }
+[[nodiscard]] HC_INLINE QuaternionFx8 operator*(const QuaternionFx8& _qLeft, float _fRight) { return _qLeft * Floatx8(_fRight); }
+[[nodiscard]] HC_INLINE QuaternionFx8 operator/(const QuaternionFx8& _qLeft, const Floatx8& _fRight) { return QuaternionFx8(_qLeft.x / _fRight, _qLeft.y / _fRight, _qLeft.z / _fRight, _qLeft.w / _fRight); }
+[[nodiscard]] HC_INLINE QuaternionFx8 operator-(const QuaternionFx8& _qVal) { return QuaternionFx8(-_qVal.x, -_qVal.y, -_qVal.z, -_qVal.w); }
+[[nodiscard]] HC_INLINE QuaternionFx8 operator*(const QuaternionFx8& _qLeft, const QuaternionFx8& _qRight) {
+	return QuaternionFx8(_qLeft.w * _qRight.x + _qLeft.x * _qRight.w + _qLeft.y * _qRight.z - _qLeft.z * _qRight.y,
+						 _qLeft.w * _qRight.y - _qLeft.x * _qRight.z + _qLeft.y * _qRight.w + _qLeft.z * _qRight.x,
+						 _qLeft.w * _qRight.z + _qLeft.x * _qRight.y - _qLeft.y * _qRight.x + _qLeft.z * _qRight.w,
+						 _qLeft.w * _qRight.w - _qLeft.x * _qRight.x - _qLeft.y * _qRight.y - _qLeft.z * _qRight.z);
+}
+HC_INLINE QuaternionFx8& operator*=(QuaternionFx8& _qLeft, const QuaternionFx8& _qRight) { _qLeft = _qLeft * _qRight; return _qLeft; }
+//Unlike Dot(QuaternionF, QuaternionF) this is the true four component dot product, which the interpolation below relies on.
+[[nodiscard]] HC_INLINE Floatx8 Dot(const QuaternionFx8& _qLeft, const QuaternionFx8& _qRight) { return _qLeft.x * _qRight.x + _qLeft.y * _qRight.y + _qLeft.z * _qRight.z + _qLeft.w * _qRight.w; }
+[[nodiscard]] HC_INLINE Floatx8 Length(const QuaternionFx8& _qVal) { return Sqrt(Dot(_qVal, _qVal)); }
+[[nodiscard]] HC_INLINE QuaternionFx8 Normalize(const QuaternionFx8& _qVal) { return _qVal / Length(_qVal); }
+[[nodiscard]] HC_INLINE QuaternionFx8 Conjugate(const QuaternionFx8& _qVal) { return QuaternionFx8(-_qVal.x, -_qVal.y, -_qVal.z, _qVal.w); }
+[[nodiscard]] HC_INLINE Vec3Fx8 operator*(const QuaternionFx8& _qLeft, const Vec3Fx8& _vRight) {
+	QuaternionFx8 qRes = _qLeft * QuaternionFx8(_vRight.x, _vRight.y, _vRight.z, Floatx8()) * Conjugate(_qLeft);
+	return Vec3Fx8(qRes.x, qRes.y, qRes.z);
+}
+[[nodiscard]] HC_INLINE Vec3Fx8 RotateByQuaternion(const Vec3Fx8& _vVector, const QuaternionFx8& _qRotation) { return _qRotation * _vVector; }
+
+namespace Math {
+	[[nodiscard]] HC_INLINE Vec3Fx8 Lerp(const Vec3Fx8& _vStart, const Vec3Fx8& _vEnd, float _fRatio) { return (_vEnd - _vStart) * _fRatio + _vStart; }
+	[[nodiscard]] HC_INLINE Vec4Fx8 Lerp(const Vec4Fx8& _vStart, const Vec4Fx8& _vEnd, float _fRatio) { return (_vEnd - _vStart) * _fRatio + _vStart; }
+	[[nodiscard]] HC_INLINE QuaternionFx8 Lerp(const QuaternionFx8& _qStart, const QuaternionFx8& _qEnd, float _fRatio) { return (_qEnd - _qStart) * _fRatio + _qStart; }
+
+	/// <summary>
+	/// Per lane SLerp weights for the (already normalized) endpoints with the cosine _fDot between them. The end weight
+	/// carries the sign flip that takes the shorter arc, and lanes that are nearly parallel fall back to plain Lerp weights.
+	/// </summary>
+	HC_INLINE void SLerpWeights(const Floatx8& _fDot, float _fRatio, Floatx8& _fFrom, Floatx8& _fTo) {
+		const Floatx8 fDot = Min(Abs(_fDot), Floatx8(1.0f));
+		const Floatx8 fOne = Floatx8(1.0f);
+
+		//1 - dot * dot loses most of its digits as dot nears one, and (1 - dot) * (1 + dot) does not
+		const Floatx8 fInvSinTheta = fOne / Max(Sqrt((fOne - fDot) * (fOne + fDot)), Floatx8(FLT_MIN));
+		Floatx8 fSin, fCos;
+
+		//sin((1 - t) * theta) expands to sin(theta) * cos(t * theta) - cos(theta) * sin(t * theta), so one SinCos covers both weights
+		SinCos(ArcCos(fDot) * _fRatio, fSin, fCos);
+
+		const Floatx8 fTo = fSin * fInvSinTheta;
+		const Floatx8 fNearOne = Floatx8(HC_NEAR_ONE);
+
+		_fFrom = SelectGreater(fDot, fNearOne, Floatx8(1.0f - _fRatio), fCos - fDot * fTo);
+		_fTo = FlipSign(SelectGreater(fDot, fNearOne, Floatx8(_fRatio), fTo), _fDot);
+	}
+
+	[[nodiscard]] HC_INLINE Vec3Fx8 SLerp(const Vec3Fx8& _vStart, const Vec3Fx8& _vEnd, float _fRatio) {
+		Vec3Fx8 vStart = Normalize(_vStart);
+		Vec3Fx8 vEnd = Normalize(_vEnd);
+		Floatx8 fFrom, fTo;
+
+		SLerpWeights(Dot(vStart, vEnd), _fRatio, fFrom, fTo);
+
+		return Normalize(vStart * fFrom + vEnd * fTo);
+	}
+
+	[[nodiscard]] HC_INLINE Vec4Fx8 SLerp(const Vec4Fx8& _vStart, const Vec4Fx8& _vEnd, float _fRatio) {
+		Vec4Fx8 vStart = Normalize(_vStart);
+		Vec4Fx8 vEnd = Normalize(_vEnd);
+		Floatx8 fFrom, fTo;
+
+		SLerpWeights(Dot(vStart, vEnd), _fRatio, fFrom, fTo);
+
+		return Normalize(vStart * fFrom + vEnd * fTo);
+	}
+
+	[[nodiscard]] HC_INLINE QuaternionFx8 SLerp(const QuaternionFx8& _qStart, const QuaternionFx8& _qEnd, float _fRatio) {
+		QuaternionFx8 qStart = Normalize(_qStart);
+		QuaternionFx8 qEnd = Normalize(_qEnd);
+		Floatx8 fFrom, fTo;
+
+		SLerpWeights(Dot(qStart, qEnd), _fRatio, fFrom, fTo);
+
+		return Normalize(qStart * fFrom + qEnd * fTo);
+	}
+}
+
+/// <summary>
+/// Gathers up to eight Vec3Fs into one lane group. Lanes past _iCount are left at zero.
+/// </summary>
+[[nodiscard]] HC_INLINE Vec3Fx8 LoadVec3Fx8(const Vec3F* _pSource, int _iCount = Floatx8::LANES) {
+	Vec3Fx8 vRes;
+#if HC_USE_SIMD
+	if (_iCount == Floatx8::LANES) {
+		__m128 fLow0 = _pSource[0].m_fVec, fLow1 = _pSource[1].m_fVec, fLow2 = _pSource[2].m_fVec, fLow3 = _pSource[3].m_fVec;
+		__m128 fHigh0 = _pSource[4].m_fVec, fHigh1 = _pSource[5].m_fVec, fHigh2 = _pSource[6].m_fVec, fHigh3 = _pSource[7].m_fVec;
+		_MM_TRANSPOSE4_PS(fLow0, fLow1, fLow2, fLow3);
+		_MM_TRANSPOSE4_PS(fHigh0, fHigh1, fHigh2, fHigh3);
+		return Vec3Fx8(Floatx8(fLow0, fHigh0), Floatx8(fLow1, fHigh1), Floatx8(fLow2, fHigh2));
+	}
+#endif
+	for (int iLane = 0; iLane < _iCount; ++iLane) { vRes.SetLane(iLane, _pSource[iLane]); }
+	return vRes;
+}
+
+/// <summary>
+/// Scatters the first _iCount lanes of _vWide back out to _pDest.
+/// </summary>
+HC_INLINE void Store(const Vec3Fx8& _vWide, Vec3F* _pDest, int _iCount = Floatx8::LANES) {
+#if HC_USE_SIMD
+	if (_iCount == Floatx8::LANES) {
+		for (int iHalf = 0; iHalf < 2; ++iHalf) {
+			__m128 fRow0 = _vWide.x.m_fVec[iHalf], fRow1 = _vWide.y.m_fVec[iHalf], fRow2 = _vWide.z.m_fVec[iHalf], fRow3 = _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS(fRow0, fRow1, fRow2, fRow3);
+			Vec3F* pDest = _pDest + iHalf * 4;
+			pDest[0] = Vec3F(fRow0); pDest[1] = Vec3F(fRow1); pDest[2] = Vec3F(fRow2); pDest[3] = Vec3F(fRow3);
+		}
+		return;
+	}
+#endif
+	for (int iLane = 0; iLane < _iCount; ++iLane) { _pDest[iLane] = _vWide.GetLane(iLane); }
+}
+
+[[nodiscard]] HC_INLINE Vec4Fx8 LoadVec4Fx8(const Vec4F* _pSource, int _iCount = Floatx8::LANES) {
+	Vec4Fx8 vRes;
+#if HC_USE_SIMD
+	if (_iCount == Floatx8::LANES) {
+		__m128 fLow0 = _pSource[0].m_fVec, fLow1 = _pSource[1].m_fVec, fLow2 = _pSource[2].m_fVec, fLow3 = _pSource[3].m_fVec;
+		__m128 fHigh0 = _pSource[4].m_fVec, fHigh1 = _pSource[5].m_fVec, fHigh2 = _pSource[6].m_fVec, fHigh3 = _pSource[7].m_fVec;
+		_MM_TRANSPOSE4_PS(fLow0, fLow1, fLow2, fLow3);
+		_MM_TRANSPOSE4_PS(fHigh0, fHigh1, fHigh2, fHigh3);
+		return Vec4Fx8(Floatx8(fLow0, fHigh0), Floatx8(fLow1, fHigh1), Floatx8(fLow2, fHigh2), Floatx8(fLow3, fHigh3));
+	}
+#endif
+	for (int iLane = 0; iLane < _iCount; ++iLane) { vRes.SetLane(iLane, _pSource[iLane]); }
+	return vRes;
+}
+
+HC_INLINE void Store(const Vec4Fx8& _vWide, Vec4F* _pDest, int _iCount = Floatx8::LANES) {
+#if HC_USE_SIMD
+	if (_iCount == Floatx8::LANES) {
+		for (int iHalf = 0; iHalf < 2; ++iHalf) {
+			__m128 fRow0 = _vWide.x.m_fVec[iHalf], fRow1 = _vWide.y.m_fVec[iHalf], fRow2 = _vWide.z.m_fVec[iHalf], fRow3 = _vWide.w.m_fVec[iHalf];
+			_MM_TRANSPOSE4_PS(fRow0, fRow1, fRow2, fRow3);
+			Vec4F* pDest = _pDest + iHalf * 4;
+			pDest[0] = Vec4F(fRow0); pDest[1] = Vec4F(fRow1); pDest[2] = Vec4F(fRow2); pDest[3] = Vec4F(fRow3);
+		}
+		return;
+	}
+#endif
+	for (int iLane = 0; iLane < _iCount; ++iLane) { _pDest[iLane] = _vWide.GetLane(iLane); }
+}
+
+[[nodiscard]] HC_INLINE QuaternionFx8 LoadQuaternionFx8(const QuaternionF* _pSource, int _iCount = Floatx8::LANES) {
+	QuaternionFx8 qRes;
+	for (int iLane = 0; iLane < _iCount; ++iLane) { qRes.SetLane(iLane, _pSource[iLane]); }
+	return qRes;
+}
+
+HC_INLINE void Store(const QuaternionFx8& _qWide, QuaternionF* _pDest, int _iCount = Floatx8::LANES) {
+	for (int iLane = 0; iLane < _iCount; ++iLane) { _pDest[iLane] = _qWide.GetLane(iLane); }
+}
+
+/// <summary>
+/// Converts _vSource into lane groups, zero padding the final group. Unpack with the original element count.
+/// </summary>
+HC_INLINE void Pack(const std::vector<Vec3F>& _vSource, std::vector<Vec3Fx8>& _vDest) {
+	_vDest.resize((_vSource.size() + Floatx8::LANES - 1) / Floatx8::LANES);
+	for (size_t sGroup = 0; sGroup < _vDest.size(); ++sGroup) {
+		size_t sFirst = sGroup * Floatx8::LANES;
+		_vDest[sGroup] = LoadVec3Fx8(&_vSource[sFirst], static_cast<int>(HC_TERNARY(_vSource.size() - sFirst, static_cast<size_t>(Floatx8::LANES), <)));
+	}
+}
+
+HC_INLINE void Unpack(const std::vector<Vec3Fx8>& _vSource, std::vector<Vec3F>& _vDest, size_t _sCount) {
+	assert(_sCount <= _vSource.size() * Floatx8::LANES);
+	_vDest.resize(_sCount);
+	for (size_t sGroup = 0; sGroup < _vSource.size() && sGroup * Floatx8::LANES < _sCount; ++sGroup) {
+		size_t sFirst = sGroup * Floatx8::LANES;
+		Store(_vSource[sGroup], &_vDest[sFirst], static_cast<int>(HC_TERNARY(_sCount - sFirst, static_cast<size_t>(Floatx8::LANES), <)));
+	}
+}
+
+HC_INLINE void Pack(const std::vector<Vec4F>& _vSource, std::vector<Vec4Fx8>& _vDest) {
+	_vDest.resize((_vSource.size() + Floatx8::LANES - 1) / Floatx8::LANES);
+	for (size_t sGroup = 0; sGroup < _vDest.size(); ++sGroup) {
+		size_t sFirst = sGroup * Floatx8::LANES;
+		_vDest[sGroup] = LoadVec4Fx8(&_vSource[sFirst], static_cast<int>(HC_TERNARY(_vSource.size() - sFirst, static_cast<size_t>(Floatx8::LANES), <)));
+	}
+}
+
+HC_INLINE void Unpack(const std::vector<Vec4Fx8>& _vSource, std::vector<Vec4F>& _vDest, size_t _sCount) {
+	assert(_sCount <= _vSource.size() * Floatx8::LANES);
+	_vDest.resize(_sCount);
+	for (size_t sGroup = 0; sGroup < _vSource.size() && sGroup * Floatx8::LANES < _sCount; ++sGroup) {
+		size_t sFirst = sGroup * Floatx8::LANES;
+		Store(_vSource[sGroup], &_vDest[sFirst], static_cast<int>(HC_TERNARY(_sCount - sFirst, static_cast<size_t>(Floatx8::LANES), <)));
+	}
+}
+
+HC_INLINE void Pack(const std::vector<QuaternionF>& _vSource, std::vector<QuaternionFx8>& _vDest) {
+	_vDest.resize((_vSource.size() + Floatx8::LANES - 1) / Floatx8::LANES);
+	for (size_t sGroup = 0; sGroup < _vDest.size(); ++sGroup) {
+		size_t sFirst = sGroup * Floatx8::LANES;
+		_vDest[sGroup] = LoadQuaternionFx8(&_vSource[sFirst], static_cast<int>(HC_TERNARY(_vSource.size() - sFirst, static_cast<size_t>(Floatx8::LANES), <)));
+	}
+}
+
+HC_INLINE void Unpack(const std::vector<QuaternionFx8>& _vSource, std::vector<QuaternionF>& _vDest, size_t _sCount) {
+	assert(_sCount <= _vSource.size() * Floatx8::LANES);
+	_vDest.resize(_sCount);
+	for (size_t sGroup = 0; sGroup < _vSource.size() && sGroup * Floatx8::LANES < _sCount; ++sGroup) {
+		size_t sFirst = sGroup * Floatx8::LANES;
+		Store(_vSource[sGroup], &_vDest[sFirst], static_cast<int>(HC_TERNARY(_sCount - sFirst, static_cast<size_t>(Floatx8::LANES), <)));
+	}
+}
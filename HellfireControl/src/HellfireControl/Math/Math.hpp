@@ -5,6 +5,7 @@
 #include <HellfireControl/Math/Vector.hpp>
 #include <HellfireControl/Math/Matrix.hpp>
 #include <HellfireControl/Math/Quaternion.hpp>
+#include <HellfireControl/Math/Approx.hpp>
 
 #if HC_USE_ROTOR
 #include <HellfireControl/Math/Rotor.hpp>
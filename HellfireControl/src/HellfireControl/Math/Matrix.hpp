@@ -3,6 +3,8 @@
 #include <HellfireControl/Core/Common.hpp>
 
 #include <HellfireControl/Math/Internal/Matrix/Matrix_F.hpp>
+#include <HellfireControl/Math/Internal/Matrix/Transform_F.hpp>
+#include <HellfireControl/Math/Internal/Matrix/Affine_F.hpp>
 
 #if HC_ENABLE_DOUBLE_PRECISION
 #include <HellfireControl/Math/Internal/Matrix/Matrix_D.hpp>
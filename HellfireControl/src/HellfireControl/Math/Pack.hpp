@@ -0,0 +1,5 @@
+#pragma once
+
+#include <HellfireControl/Core/Common.hpp>
+
+#include <HellfireControl/Math/Internal/Pack/Pack_F.hpp>
@@ -3,6 +3,7 @@
 #include <HellfireControl/Core/Common.hpp>
 
 #include <HellfireControl/Math/Internal/Quaternion/Quaternion_F.hpp>
+#include <HellfireControl/Math/Internal/Quaternion/DualQuaternion_F.hpp>
 
 #if HC_ENABLE_DOUBLE_PRECISION
 #include <HellfireControl/Math/Internal/Quaternion/Quaternion_D.hpp>
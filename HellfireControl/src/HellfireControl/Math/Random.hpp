@@ -2,8 +2,14 @@
 
 #include <HellfireControl/Core/Common.hpp>
 
+#include <HellfireControl/Math/Vector.hpp>
+#include <HellfireControl/Math/Internal/Random/RandomStream.hpp>
+
+#include <span>
+
 /// <summary>
-/// A random number generator that utilizes Mersenne Twister.
+/// A random number generator that utilizes Mersenne Twister. The bulk Fill functions draw from four xoshiro128+ generators
+/// instead, one per SIMD lane, seeded from the same seed.
 /// </summary>
 class Random {
 private:
@@ -27,6 +33,16 @@ private:
 	/// </summary>
 	int m_iNext = 0;
 
+	/// <summary>
+	/// The number of xoshiro128+ generators stepped together by the Fill functions
+	/// </summary>
+	const static int s_iLaneCount = 4;
+
+	/// <summary>
+	/// The state of the Fill generators. Word-major, so each row loads as one SIMD register.
+	/// </summary>
+	alignas(16) uint32_t m_uLanes[4][s_iLaneCount];
+
 public:
 	/// <summary>
 	/// Default constructor. Uses current system time at function call for seed.
@@ -40,74 +56,104 @@ public:
 	explicit Random(uint64_t _uSeed);
 
 	/// <summary>
-	/// Generates a random char between _cMin and _cMax. Defaults to the full range of char.
+	/// Generates a random char between _cMin and _cMax, both inclusive. Defaults to the full range of char.
 	/// </summary>
 	/// <param name="_cMin: Minimum possible generated value"></param>
 	/// <param name="_cMax: Maximum possible generated value"></param>
 	/// <returns>
 	/// char: Randomly generated char
 	/// </returns>
-	[[nodiscard]] char GenerateChar(char _cMin, char _cMax);
+	[[nodiscard]] char GenerateChar(char _cMin = 0, char _cMax = CHAR_MAX);
 
 	/// <summary>
-	/// Generates a random short between _sMin and _sMax. Defaults to the full range of short.
+	/// Generates a random short between _sMin and _sMax, both inclusive. Defaults to the full range of short.
 	/// </summary>
 	/// <param name="_sMin: Minimum possible generated value"></param>
 	/// <param name="_sMax: Minimum possible generated value"></param>
 	/// <returns>
 	/// short: Randomly generated short
 	/// </returns>
-	[[nodiscard]] short GenerateShort(short _sMin, short _sMax);
+	[[nodiscard]] short GenerateShort(short _sMin = 0, short _sMax = SHRT_MAX);
 
 	/// <summary>
-	/// Generates a random int between _iMin and _iMax. Defaults to the full range of int.
+	/// Generates a random int between _iMin and _iMax, both inclusive. Defaults to the full range of int.
 	/// </summary>
 	/// <param name="_iMin: Minimum possible generated value"></param>
 	/// <param name="_iMax: Maximum possible generated value"></param>
 	/// <returns>
 	/// int: Randomly generated integer
 	/// </returns>
-	[[nodiscard]] int GenerateInt(int _iMin, int _iMax);
+	[[nodiscard]] int GenerateInt(int _iMin = 0, int _iMax = INT_MAX);
 
 	/// <summary>
-	/// Generates a random unsigned 32-bit int between _uMin and _uMax. Defaults to the full range of unsigned 32-bit integers.
+	/// Generates a random unsigned 32-bit int from _uMin up to but excluding _uMax. Defaults to the full range of unsigned 32-bit integers.
 	/// </summary>
 	/// <param name="_uMin: Minimum possible generated value"></param>
 	/// <param name="_uMax: Maximum possible generated value"></param>
 	/// <returns>
 	/// uint32_t: Randomly generated 32-bit integer
 	/// </returns>
-	[[nodiscard]] uint32_t GenerateUnsignedInt(uint32_t _uMin, uint32_t _uMax);
+	[[nodiscard]] uint32_t GenerateUnsignedInt(uint32_t _uMin = 0, uint32_t _uMax = UINT_MAX);
 
 	/// <summary>
-	/// Generates a random long between _lMin and _lMax. Defaults to the full range of long.
+	/// Generates a random long between _lMin and _lMax, both inclusive. Defaults to the full range of long.
 	/// </summary>
 	/// <param name="_lMin: Minimum possible generated value"></param>
 	/// <param name="_lMax: Maximum possible generated value"></param>
 	/// <returns>
 	/// long: Randomly generated long
 	/// </returns>
-	[[nodiscard]] int64_t GenerateLong(int64_t _lMin, int64_t _lMax);
+	[[nodiscard]] int64_t GenerateLong(int64_t _lMin = 0, int64_t _lMax = LLONG_MAX);
 
 	/// <summary>
-	/// Generates a random float between _fMin and _fMax. Defaults to between 0 and 1.
+	/// Generates a random float from _fMin up to but excluding _fMax. Defaults to between 0 and 1.
 	/// </summary>
 	/// <param name="_fMin: Minimum possible generated value"></param>
 	/// <param name="_fMax: Maximum possible generated value"></param>
 	/// <returns>
 	/// float: Randomly generated float
 	/// </returns>
-	[[nodiscard]] float GenerateFloat(float _fMin, float _fMax);
+	[[nodiscard]] float GenerateFloat(float _fMin = 0.0f, float _fMax = 1.0f);
 
 	/// <summary>
-	/// Generates a random double between _dMin and _dMax. Defaults to between 0 and 1.
+	/// Generates a random double from _dMin up to but excluding _dMax. Defaults to between 0 and 1.
 	/// </summary>
 	/// <param name="_dMin: Minimum possible generated value"></param>
 	/// <param name="_dMax: Maximum possible generated value"></param>
 	/// <returns>
 	/// double: Randomly generated double
 	/// </returns>
-	[[nodiscard]] double GenerateDouble(double _dMin, double _dMax);
+	[[nodiscard]] double GenerateDouble(double _dMin = 0.0, double _dMax = 1.0);
+
+	/// <summary>
+	/// Fills _uOut with raw random 32-bit values, four at a time. The samplers in Math/Distribution.hpp draw from this.
+	/// </summary>
+	/// <param name="_uOut: Values to overwrite"></param>
+	void FillUnsignedInts(std::span<uint32_t> _uOut);
+
+	/// <summary>
+	/// Fills _fOut with random floats between _fMin and _fMax, four at a time.
+	/// </summary>
+	/// <param name="_fOut: Floats to overwrite"></param>
+	/// <param name="_fMin: Minimum possible generated value"></param>
+	/// <param name="_fMax: Maximum possible generated value"></param>
+	void FillFloats(std::span<float> _fOut, float _fMin = 0.0f, float _fMax = 1.0f);
+
+	/// <summary>
+	/// Fills _iOut with random ints between _iMin and _iMax, both inclusive. Every value in the range is equally likely.
+	/// </summary>
+	/// <param name="_iOut: Ints to overwrite"></param>
+	/// <param name="_iMin: Minimum possible generated value"></param>
+	/// <param name="_iMax: Maximum possible generated value"></param>
+	void FillInts(std::span<int> _iOut, int _iMin, int _iMax);
+
+	/// <summary>
+	/// Fills _vOut with random points in the box between _vMin and _vMax.
+	/// </summary>
+	/// <param name="_vOut: Vectors to overwrite"></param>
+	/// <param name="_vMin: Minimum possible generated value on each axis"></param>
+	/// <param name="_vMax: Maximum possible generated value on each axis"></param>
+	void FillVec3(std::span<Vec3F> _vOut, const Vec3F& _vMin, const Vec3F& _vMax);
 
 	/// <summary>
 	/// Returns the seed utilized in generated the current state.
@@ -132,8 +178,23 @@ private:
 	/// </returns>
 	[[nodiscard]] uint64_t GetNextVal();
 
+	/// <summary>
+	/// Fuses two generated values into 64 random bits.
+	/// </summary>
+	[[nodiscard]] uint64_t GetNext64();
+
+	/// <summary>
+	/// Returns an unbiased value in [0, _uRange). _uRange must not be 0.
+	/// </summary>
+	[[nodiscard]] uint32_t GenerateBounded(uint32_t _uRange);
+
 	/// <summary>
 	/// Resets the machine and regenerates the state register.
 	/// </summary>
 	void Regenerate();
+
+	/// <summary>
+	/// Derives the state of the Fill generators from m_uSeed.
+	/// </summary>
+	void SeedLanes();
 };
\ No newline at end of file
@@ -0,0 +1,7 @@
+#pragma once
+
+#include <HellfireControl/Core/Common.hpp>
+
+#include <HellfireControl/Math/Internal/Wide/Wide_Fx4.hpp>
+#include <HellfireControl/Math/Internal/Wide/Wide_Fx8.hpp>
+#include <HellfireControl/Math/Internal/Wide/Blend_Fx4.hpp>
\ No newline at end of file
@@ -0,0 +1,78 @@
+#include <HellfireControl/Render/Culling.hpp>
+#include <HellfireControl/Util/Parallel.hpp>
+
+#include <bit>
+
+void CullingSubsystem::SetBounds(uint32_t _u32ContextID, uint32_t _u32DrawIndex, const AABBF& _bBounds) {
+	CullContextData& ccdData = m_mContextMap[_u32ContextID];
+
+	if (_u32DrawIndex >= ccdData.m_vBounds.size()) {
+		ccdData.m_vBounds.resize(static_cast<size_t>(_u32DrawIndex) + 1, AABBF(Vec3F(-HC_CULL_UNBOUNDED), Vec3F(HC_CULL_UNBOUNDED)));
+	}
+
+	ccdData.m_vBounds[_u32DrawIndex] = _bBounds;
+}
+
+void CullingSubsystem::SetDrawCount(uint32_t _u32ContextID, uint32_t _u32DrawCount) {
+	auto aContext = m_mContextMap.find(_u32ContextID);
+
+	if (aContext == m_mContextMap.end()) return;
+
+	if (_u32DrawCount > aContext->second.m_vBounds.size()) {
+		aContext->second.m_vBounds.resize(_u32DrawCount, AABBF(Vec3F(-HC_CULL_UNBOUNDED), Vec3F(HC_CULL_UNBOUNDED)));
+	}
+
+	aContext->second.m_u32DrawCount = _u32DrawCount;
+}
+
+void CullingSubsystem::ClearContext(uint32_t _u32ContextID) {
+	m_mContextMap.erase(_u32ContextID);
+}
+
+void CullingSubsystem::SetThreadCount(uint32_t _u32ThreadCount) {
+	m_u32ThreadCount = _u32ThreadCount;
+}
+
+void CullingSubsystem::Cull(const MatrixF& _mViewProjection) {
+	const FrustumF fFrustum(_mViewProjection);
+
+	m_csStats = {};
+
+	for (auto& aContext : m_mContextMap) {
+		CullContextData& ccdData = aContext.second;
+		//Draws removed since their bounds were set must not reach GetVisibleDraws
+		const size_t sCount = std::min<size_t>(ccdData.m_vBounds.size(), ccdData.m_u32DrawCount);
+
+		ccdData.m_vVisibleMask.resize(GetMaskWordCount(sCount));
+		ccdData.m_vVisibleDraws.clear();
+
+		TestBounds(fFrustum, std::span<const AABBF>(ccdData.m_vBounds).first(sCount), ccdData.m_vVisibleMask, m_u32ThreadCount);
+
+		//Walk only the set bits, so a mostly hidden context costs one step per 32 draws
+		for (size_t sWord = 0; sWord < ccdData.m_vVisibleMask.size(); ++sWord) {
+			for (uint32_t u32Bits = ccdData.m_vVisibleMask[sWord]; u32Bits != 0U; u32Bits &= u32Bits - 1U) {
+				ccdData.m_vVisibleDraws.push_back(static_cast<uint32_t>(sWord * 32 + std::countr_zero(u32Bits)));
+			}
+		}
+
+		m_csStats.m_u32Tested += static_cast<uint32_t>(sCount);
+		m_csStats.m_u32Visible += static_cast<uint32_t>(ccdData.m_vVisibleDraws.size());
+	}
+}
+
+bool CullingSubsystem::IsContextCulled(uint32_t _u32ContextID) const {
+	return m_mContextMap.contains(_u32ContextID);
+}
+
+std::span<const uint32_t> CullingSubsystem::GetVisibleDraws(uint32_t _u32ContextID) const {
+	auto aContext = m_mContextMap.find(_u32ContextID);
+
+	return aContext != m_mContextMap.end() ? std::span<const uint32_t>(aContext->second.m_vVisibleDraws) : std::span<const uint32_t>();
+}
+
+void CullingSubsystem::TestBounds(const FrustumF& _fFrustum, std::span<const AABBF> _vBounds, std::span<uint32_t> _vMask, uint32_t _u32ThreadCount) {
+	//Bands start on whole mask words so no two threads ever write the same word
+	Util::ParallelFor(_vBounds.size(), _u32ThreadCount, HC_CULL_PARALLEL_MIN / 2, 32, [&](size_t _sFirst, size_t _sLast) {
+		Math::Intersects(_fFrustum, _vBounds.subspan(_sFirst, _sLast - _sFirst), _vMask.subspan(_sFirst / 32, GetMaskWordCount(_sLast - _sFirst)));
+	});
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <HellfireControl/Core/Common.hpp>
+#include <HellfireControl/Math/Geometry.hpp>
+
+#include <span>
+
+#define HC_CULL_PARALLEL_MIN 8192	//Below this many bounds in one context the frustum test stays on the calling thread
+#define HC_CULL_UNBOUNDED 1.0e18f	//Half size of the box given to draws without bounds. Large enough to pass any frustum, small enough to stay finite
+
+struct CullStats {
+	uint32_t m_u32Tested = 0;
+	uint32_t m_u32Visible = 0;
+};
+
+class CullingSubsystem {
+private:
+	struct CullContextData {
+		std::vector<AABBF> m_vBounds; //World space bounds, indexed by draw
+
+		uint32_t m_u32DrawCount = UINT32_MAX; //Draws the context has. Bounds at or past it are kept but not tested
+
+		std::vector<uint32_t> m_vVisibleMask;
+
+		std::vector<uint32_t> m_vVisibleDraws;
+	};
+
+	std::map<uint32_t, CullContextData> m_mContextMap;
+
+	CullStats m_csStats;
+
+	uint32_t m_u32ThreadCount = 0;
+
+	static void TestBounds(const FrustumF& _fFrustum, std::span<const AABBF> _vBounds, std::span<uint32_t> _vMask, uint32_t _u32ThreadCount);
+public:
+	/// <summary>
+	/// Sets the world space bounds of one draw in a render context. Draws are numbered in the order their buffers were created.
+	/// Any draw in the context without bounds of its own is always kept.
+	/// </summary>
+	/// <param name="_u32ContextID: The render context the draw belongs to"></param>
+	/// <param name="_u32DrawIndex: Index of the vertex/index buffer pair within the context"></param>
+	/// <param name="_bBounds: World space box containing everything the draw renders"></param>
+	void SetBounds(uint32_t _u32ContextID, uint32_t _u32DrawIndex, const AABBF& _bBounds);
+
+	/// <summary>
+	/// Sets how many draws the context has. New draws have no bounds and are always kept, and bounds past the count are ignored
+	/// until it grows again. Does nothing for contexts that have never been given bounds.
+	/// </summary>
+	void SetDrawCount(uint32_t _u32ContextID, uint32_t _u32DrawCount);
+
+	/// <summary>
+	/// Stops culling a render context. Every draw in it is recorded again.
+	/// </summary>
+	void ClearContext(uint32_t _u32ContextID);
+
+	/// <summary>
+	/// Sets how many threads a large context is split across. 0 uses every hardware thread.
+	/// </summary>
+	void SetThreadCount(uint32_t _u32ThreadCount);
+
+	/// <summary>
+	/// Tests every draw with bounds against the view volume of _mViewProjection and rebuilds the visible draw lists and stats.
+	/// </summary>
+	/// <param name="_mViewProjection: View * Projection of the camera in this library's row vector convention"></param>
+	void Cull(const MatrixF& _mViewProjection);
+
+	/// <summary>
+	/// Whether the render context has bounds, and so whether GetVisibleDraws should replace drawing everything in it.
+	/// </summary>
+	[[nodiscard]] bool IsContextCulled(uint32_t _u32ContextID) const;
+
+	/// <summary>
+	/// Draw indices of the context that passed the last Cull, in ascending order.
+	/// </summary>
+	[[nodiscard]] std::span<const uint32_t> GetVisibleDraws(uint32_t _u32ContextID) const;
+
+	/// <summary>
+	/// Counts from the last Cull, summed over every culled context.
+	/// </summary>
+	[[nodiscard]] HC_INLINE const CullStats& GetStats() const { return m_csStats; }
+};
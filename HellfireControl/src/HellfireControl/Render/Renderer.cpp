@@ -55,10 +55,25 @@ void RenderingSubsystem::Init(const std::string& _strAppName, uint64_t _u64Windo
 }
 
 void RenderingSubsystem::RenderFrame() {
+	if (m_bCullingEnabled) {
+		for (const auto& aContext : m_vRenderContexts) {
+			m_csCulling.SetDrawCount(aContext.m_u32ContextID, PlatformRenderer::GetDrawCount(aContext.m_u32ContextID)); //Draws added since their bounds were set are kept and removed ones are dropped
+		}
+
+		m_csCulling.Cull(m_mViewProjection);
+	}
+
 	PlatformRenderer::BeginRenderPass();
 
 	for (int ndx = 0; ndx < m_vRenderContexts.size(); ++ndx) {
-		PlatformRenderer::Draw(m_vRenderContexts[ndx].m_u32ContextID);
+		const uint32_t u32ContextID = m_vRenderContexts[ndx].m_u32ContextID;
+
+		if (m_bCullingEnabled && m_csCulling.IsContextCulled(u32ContextID)) {
+			PlatformRenderer::Draw(u32ContextID, m_csCulling.GetVisibleDraws(u32ContextID));
+		}
+		else {
+			PlatformRenderer::Draw(u32ContextID);
+		}
 	}
 
 	PlatformRenderer::Present();
@@ -86,6 +101,28 @@ const Vec2F RenderingSubsystem::GetRenderableExtents() {
 	return PlatformRenderer::GetRenderableExtent();
 }
 
+void RenderingSubsystem::SetViewProjection(const MatrixF& _mViewProjection) {
+	m_mViewProjection = _mViewProjection;
+
+	m_bCullingEnabled = true; //Nothing can be culled until there is a camera to cull against.
+}
+
+void RenderingSubsystem::SetDrawBounds(uint32_t _u32ContextID, uint32_t _u32DrawIndex, const AABBF& _bBounds) {
+	m_csCulling.SetBounds(_u32ContextID, _u32DrawIndex, _bBounds);
+}
+
+void RenderingSubsystem::ClearDrawBounds(uint32_t _u32ContextID) {
+	m_csCulling.ClearContext(_u32ContextID);
+}
+
+void RenderingSubsystem::SetCullingThreadCount(uint32_t _u32ThreadCount) {
+	m_csCulling.SetThreadCount(_u32ThreadCount);
+}
+
+const CullStats& RenderingSubsystem::GetCullStats() const {
+	return m_csCulling.GetStats();
+}
+
 const uint32_t RenderingSubsystem::GetRenderContextID(uint8_t _rctType) {
 	for (const auto& aContext : m_vRenderContexts) {
 		if (aContext.m_rctContextType == _rctType) {
@@ -5,6 +5,7 @@
 
 #include <HellfireControl/Render/Buffer.hpp>
 #include <HellfireControl/Render/RenderContext.hpp>
+#include <HellfireControl/Render/Culling.hpp>
 
 struct UniformBufferData {
 	MatrixF m_mModel;
@@ -18,6 +19,12 @@ private:
 
 	uint32_t m_u32NewRenderContextID = 0;
 
+	CullingSubsystem m_csCulling;
+
+	MatrixF m_mViewProjection;
+
+	bool m_bCullingEnabled = false;
+
 	static RenderingSubsystem* m_prsInstancePtr;
 
 	std::vector<std::string> GetShaderFileNames(uint8_t _rctType); //TEMPORARY ! ! ! WILL BE REPLACED WITH READING FROM AN INI FILE
@@ -36,5 +43,15 @@ public:
 
 	[[nodiscard]] const Vec2F GetRenderableExtents();
 
+	void SetViewProjection(const MatrixF& _mViewProjection);
+
+	void SetDrawBounds(uint32_t _u32ContextID, uint32_t _u32DrawIndex, const AABBF& _bBounds);
+
+	void ClearDrawBounds(uint32_t _u32ContextID);
+
+	void SetCullingThreadCount(uint32_t _u32ThreadCount);
+
+	[[nodiscard]] const CullStats& GetCullStats() const;
+
 	[[nodiscard]] const uint32_t GetRenderContextID(uint8_t _rctType);
 };
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <HellfireControl/Core/Common.hpp>
+
+#include <algorithm>
+
+namespace Util {
+	/// <summary>
+	/// Splits [0, _sCount) into one contiguous band per thread and runs _fnBand on each, the calling thread taking the first.
+	/// Threads are capped so each gets at least _sMinPerThread items, so anything under twice that runs on the calling thread alone.
+	/// </summary>
+	/// <param name="_sCount: Number of items to split"></param>
+	/// <param name="_uThreads: Number of threads to use. 0 uses one per hardware thread"></param>
+	/// <param name="_sMinPerThread: Fewest items worth starting a thread for"></param>
+	/// <param name="_sGranularity: Every band starts on a multiple of this many items, so no two threads share a block"></param>
+	/// <param name="_fnBand: Called with the first index and one past the last index of each band"></param>
+	template<typename Func>
+	HC_INLINE void ParallelFor(size_t _sCount, uint32_t _uThreads, size_t _sMinPerThread, size_t _sGranularity, Func _fnBand) {
+		const size_t sBlocks = (_sCount + _sGranularity - 1) / _sGranularity;
+
+		size_t sThreads = _uThreads != 0U ? _uThreads : std::max(1U, std::thread::hardware_concurrency());
+		sThreads = std::min({ sThreads, std::max<size_t>(_sCount / std::max<size_t>(_sMinPerThread, 1), 1), std::max<size_t>(sBlocks, 1) });
+
+		if (sThreads < 2) {
+			if (_sCount != 0) { _fnBand(static_cast<size_t>(0), _sCount); }
+			return;
+		}
+
+		const auto fnRun = [&](size_t _sBand) {
+			const size_t sFirst = std::min(sBlocks * _sBand / sThreads * _sGranularity, _sCount);
+			const size_t sLast = std::min(sBlocks * (_sBand + 1) / sThreads * _sGranularity, _sCount);
+
+			if (sFirst < sLast) { _fnBand(sFirst, sLast); }
+		};
+
+		std::vector<std::thread> vWorkers;
+		vWorkers.reserve(sThreads - 1);
+
+		for (size_t sBand = 1; sBand < sThreads; ++sBand) { vWorkers.emplace_back(fnRun, sBand); }
+
+		fnRun(0);
+
+		for (std::thread& tWorker : vWorkers) { tWorker.join(); }
+	}
+}
@@ -2,6 +2,7 @@
 #include <Platform/Vulkan/VkBuffer.hpp>
 #include <Platform/Vulkan/VkRenderer.hpp>
 #include <Platform/Vulkan/VkRenderContext.hpp>
+#include <Platform/Vulkan/VkStaging.hpp>
 
 #include <HellfireControl/Render/Buffer.hpp>
 
@@ -22,12 +23,12 @@ void PlatformBuffer::InitBuffer(BufferHandleGeneric& _bhgOutHandle, uint8_t _u8T
 		for (int ndx = 0; ndx < HC_MAX_FRAMES_IN_FLIGHT; ++ndx) {
 			PlatformBuffer::CreateBuffer(dsSize, _u8Type, HC_MEMORY_FLAGS, vsbBufferData.m_vBuffers[ndx], vsbBufferData.m_vMemory[ndx]);
 
-			vkMapMemory(PlatformRenderer::m_dDeviceHandle, vsbBufferData.m_vMemory[ndx], 0, dsSize, 0, &vsbBufferData.m_vMappedPtrs[ndx]);
+			vsbBufferData.m_vMappedPtrs[ndx] = PlatformMemory::GetAllocation(vsbBufferData.m_vMemory[ndx]).m_pMapped;
 		}
 
 		_bhgOutHandle = {
 			.upper = reinterpret_cast<uint64_t>(vsbBufferData.m_vBuffers[0]),
-			.lower = reinterpret_cast<uint64_t>(vsbBufferData.m_vMemory[0])
+			.lower = vsbBufferData.m_vMemory[0]
 		};
 
 		g_blData.g_mBufferDataTable[vsbBufferData.m_vBuffers[0]] = {
@@ -43,28 +44,24 @@ void PlatformBuffer::InitBuffer(BufferHandleGeneric& _bhgOutHandle, uint8_t _u8T
 		PlatformRenderContext::TempInitDescriptors(PlatformRenderContext::m_mContextMap[_u32RenderContext].m_vContextBuffers.size() - 1, PlatformRenderContext::m_mContextMap[_u32RenderContext]);
 	}
 	else {
-		VkBuffer bStagingBuffer;
-		VkDeviceMemory dmStagingMemory;
-		CreateBuffer(dsSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, HC_MEMORY_FLAGS, bStagingBuffer, dmStagingMemory);
-
-		void* pvData;
-		vkMapMemory(PlatformRenderer::m_dDeviceHandle, dmStagingMemory, 0, dsSize, 0, &pvData);
-		memcpy(pvData, _pDataBlob, dsSize);
-		vkUnmapMemory(PlatformRenderer::m_dDeviceHandle, dmStagingMemory);
-
 		VkBuffer bNewBufferHandle;
-		VkDeviceMemory dmNewBufferMemory;
+		VkMemoryHandle mhNewBufferMemory;
 
-		CreateBuffer(dsSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | _u8Type, HC_MEMORY_FLAGS, bNewBufferHandle, dmNewBufferMemory);
+		if (PlatformMemory::HasMappableDeviceMemory()) {
+			//Resizable BAR or unified memory. The data is written straight into device local memory, with no copy to wait on
+			CreateBuffer(dsSize, _u8Type, HC_MAPPED_DEVICE_MEMORY_FLAGS, bNewBufferHandle, mhNewBufferMemory);
 
-		CopyBuffer(bStagingBuffer, bNewBufferHandle, dsSize);
+			memcpy(PlatformMemory::GetAllocation(mhNewBufferMemory).m_pMapped, _pDataBlob, dsSize);
+		}
+		else {
+			CreateBuffer(dsSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | _u8Type, HC_DEVICE_MEMORY_FLAGS, bNewBufferHandle, mhNewBufferMemory);
 
-		vkDestroyBuffer(PlatformRenderer::m_dDeviceHandle, bStagingBuffer, nullptr); //Free the staging buffer
-		vkFreeMemory(PlatformRenderer::m_dDeviceHandle, dmStagingMemory, nullptr);
+			PlatformStaging::Upload(bNewBufferHandle, 0, _pDataBlob, dsSize, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, _u8Type == INDEX_BUFFER ? VK_ACCESS_INDEX_READ_BIT : VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT);
+		}
 
 		_bhgOutHandle = {
 			.upper = reinterpret_cast<uint64_t>(bNewBufferHandle),
-			.lower = reinterpret_cast<uint64_t>(dmNewBufferMemory)
+			.lower = mhNewBufferMemory
 		};
 
 		g_blData.g_mBufferDataTable[bNewBufferHandle] = {
@@ -102,12 +99,18 @@ void PlatformBuffer::Update(const BufferHandleGeneric& _bhgHandle, const void* _
 }
 
 void PlatformBuffer::CleanupBuffer(const BufferHandleGeneric& _bhgHandle, uint32_t _u32RenderContext) {
-	vkDeviceWaitIdle(PlatformRenderer::m_dDeviceHandle);
+	const VkBuffer bBuffer = reinterpret_cast<VkBuffer>(_bhgHandle.upper);
+	const VkMemoryHandle mhMemory = _bhgHandle.lower;
 
-	vkDestroyBuffer(PlatformRenderer::m_dDeviceHandle, reinterpret_cast<VkBuffer>(_bhgHandle.upper), nullptr);
-	vkFreeMemory(PlatformRenderer::m_dDeviceHandle, reinterpret_cast<VkDeviceMemory>(_bhgHandle.lower), nullptr);
+	//Frames and uploads already submitted may still read or write the buffer
+	PlatformRenderer::DeferDestroy([bBuffer, mhMemory]() {
+		vkDestroyBuffer(PlatformRenderer::m_dDeviceHandle, bBuffer, nullptr);
+		PlatformMemory::Free(mhMemory);
+	});
 
 	g_blData.g_mBufferDataTable.erase(reinterpret_cast<VkBuffer>(_bhgHandle.upper));
+
+	PlatformStaging::ForgetBuffer(bBuffer);
 }
 
 uint8_t PlatformBuffer::GetBufferType(const BufferHandleGeneric& _bhgHandle) {
@@ -118,7 +121,7 @@ uint32_t PlatformBuffer::GetBufferRenderContext(const BufferHandleGeneric& _bhgH
 	return g_blData.g_mBufferDataTable[reinterpret_cast<VkBuffer>(_bhgHandle.upper)].m_u32RenderContextID;
 }
 
-void PlatformBuffer::CreateBuffer(VkDeviceSize _dsSize, VkBufferUsageFlags _bufFlags, VkMemoryPropertyFlags _mpfFlags, VkBuffer& _bBuffer, VkDeviceMemory& _dmMemory) {
+void PlatformBuffer::CreateBuffer(VkDeviceSize _dsSize, VkBufferUsageFlags _bufFlags, VkMemoryPropertyFlags _mpfFlags, VkBuffer& _bBuffer, VkMemoryHandle& _mhMemory) {
 	VkBufferCreateInfo bciBufferInfo = {
 		.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
 			.pNext = nullptr,
@@ -134,48 +137,8 @@ void PlatformBuffer::CreateBuffer(VkDeviceSize _dsSize, VkBufferUsageFlags _bufF
 		throw std::runtime_error("ERROR: Failed to create buffer!");
 	}
 
-	VkMemoryRequirements mrRequirements;
-	vkGetBufferMemoryRequirements(PlatformRenderer::m_dDeviceHandle, _bBuffer, &mrRequirements);
-
-	VkMemoryAllocateInfo maiAllocInfo = {
-		.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
-		.pNext = nullptr,
-		.allocationSize = mrRequirements.size,
-		.memoryTypeIndex = FindMemoryType(mrRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
-	};
-
-	if (vkAllocateMemory(PlatformRenderer::m_dDeviceHandle, &maiAllocInfo, nullptr, &_dmMemory) != VK_SUCCESS) {
-		throw std::runtime_error("ERROR: Failed to allocate buffer memory!");
-	}
-
-	vkBindBufferMemory(PlatformRenderer::m_dDeviceHandle, _bBuffer, _dmMemory, 0);
-}
-
-void PlatformBuffer::CopyBuffer(VkBuffer _bSource, VkBuffer _bDestination, VkDeviceSize _dsSize) {
-	VkCommandBuffer cbBuffer = VkUtil::BeginSingleTimeCommands();
-
-	VkBufferCopy bcCopyRegion = {
-		.srcOffset = 0,
-		.dstOffset = 0,
-		.size = _dsSize
-	};
-
-	vkCmdCopyBuffer(cbBuffer, _bSource, _bDestination, 1, &bcCopyRegion);
-
-	VkUtil::EndSingleTimeCommands(cbBuffer);
-}
-
-uint32_t PlatformBuffer::FindMemoryType(uint32_t _u32TypeFilter, VkMemoryPropertyFlags _mpfFlags) {
-	VkPhysicalDeviceMemoryProperties pdmpMemProperties;
-	vkGetPhysicalDeviceMemoryProperties(PlatformRenderer::m_pdPhysicalDevice, &pdmpMemProperties);
-
-	for (uint32_t ndx = 0; ndx < pdmpMemProperties.memoryTypeCount; ++ndx) {
-		if (_u32TypeFilter & (1 << ndx) && (pdmpMemProperties.memoryTypes[ndx].propertyFlags & _mpfFlags) == _mpfFlags) {
-			return ndx;
-		}
-	}
-
-	throw std::runtime_error("ERROR: Failed to find suitable memory type!");
+	//Memory comes out of a shared block, or a dedicated allocation for large buffers, and is bound before returning
+	_mhMemory = PlatformMemory::AllocateForBuffer(_bBuffer, _mpfFlags);
 }
 
 const std::map<VkBuffer, BufferData>* PlatformBuffer::GetActiveBufferData() {
@@ -2,6 +2,8 @@
 
 #include <Platform/GLCommon.hpp>
 
+#include <Platform/Vulkan/VkMemory.hpp>
+
 struct BufferHandleGeneric;
 
 struct BufferData {
@@ -16,18 +18,17 @@ struct BufferLocals {
 	std::map<VkBuffer, BufferData> g_mBufferDataTable;
 };
 
-constexpr VkMemoryPropertyFlags HC_MEMORY_FLAGS = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+constexpr VkMemoryPropertyFlags HC_MEMORY_FLAGS = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT; //Written by the CPU every frame, or staging
+constexpr VkMemoryPropertyFlags HC_DEVICE_MEMORY_FLAGS = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT; //Written once through the staging ring
+constexpr VkMemoryPropertyFlags HC_MAPPED_DEVICE_MEMORY_FLAGS = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT; //Resizable BAR or unified memory
 
 class PlatformBuffer {
 	friend class PlatformRenderer;
 	friend class PlatformRenderContext;
 	friend class VkUtil;
+	friend class PlatformStaging;
 private:
-	static void CreateBuffer(VkDeviceSize _dsSize, VkBufferUsageFlags _bufFlags, VkMemoryPropertyFlags _mpfFlags, VkBuffer& _bBuffer, VkDeviceMemory& _dmMemory);
-
-	static void CopyBuffer(VkBuffer _bSource, VkBuffer _bDestination, VkDeviceSize _dsSize);
-
-	static uint32_t FindMemoryType(uint32_t _u32TypeFilter, VkMemoryPropertyFlags _mpfFlags);
+	static void CreateBuffer(VkDeviceSize _dsSize, VkBufferUsageFlags _bufFlags, VkMemoryPropertyFlags _mpfFlags, VkBuffer& _bBuffer, VkMemoryHandle& _mhMemory);
 
 	static const std::map<VkBuffer, BufferData>* GetActiveBufferData();
 
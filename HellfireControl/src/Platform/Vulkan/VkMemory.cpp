@@ -0,0 +1,488 @@
+#include <Platform/Vulkan/VkMemory.hpp>
+#include <Platform/Vulkan/VkRenderer.hpp>
+
+#pragma region Static Member Declarations
+
+VkPhysicalDeviceMemoryProperties PlatformMemory::m_pdmpProperties = {};
+std::vector<PlatformMemory::VkMemoryPool> PlatformMemory::m_vPools = {};
+std::vector<PlatformMemory::VkMemoryRecord> PlatformMemory::m_vRecords = {};
+std::vector<VkMemoryHandle> PlatformMemory::m_vSpareHandles = {};
+uint32_t PlatformMemory::m_u32DeviceAllocationCount = 0;
+bool PlatformMemory::m_bMappableDeviceMemory = false;
+#pragma endregion
+
+void PlatformMemory::InitMemory() {
+	vkGetPhysicalDeviceMemoryProperties(PlatformRenderer::m_pdPhysicalDevice, &m_pdmpProperties);
+
+	m_vPools.resize(static_cast<size_t>(m_pdmpProperties.memoryTypeCount) * 2);
+
+	for (uint32_t ndx = 0; ndx < m_vPools.size(); ++ndx) {
+		const uint32_t u32MemoryType = ndx / 2;
+		const VkDeviceSize dsHeapSize = m_pdmpProperties.memoryHeaps[m_pdmpProperties.memoryTypes[u32MemoryType].heapIndex].size;
+
+		//Small heaps, such as the 256MB device local and host visible window, get smaller blocks so one block can't claim most of the heap
+		m_vPools[ndx].m_u32MemoryType = u32MemoryType;
+		m_vPools[ndx].m_dsBlockSize = std::min<VkDeviceSize>(HC_VK_BLOCK_SIZE, dsHeapSize / 8) & ~(HC_TLSF_MIN_ALIGNMENT - 1);
+	}
+
+	//With the whole of device memory visible to the CPU, writing resources in place beats staging them through a copy
+	const VkMemoryPropertyFlags mpfMappableDevice = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+	m_bMappableDeviceMemory = false;
+
+	for (uint32_t ndx = 0; ndx < m_pdmpProperties.memoryTypeCount; ++ndx) {
+		if ((m_pdmpProperties.memoryTypes[ndx].propertyFlags & mpfMappableDevice) == mpfMappableDevice &&
+			m_pdmpProperties.memoryHeaps[m_pdmpProperties.memoryTypes[ndx].heapIndex].size > HC_VK_REBAR_MIN_HEAP) {
+			m_bMappableDeviceMemory = true;
+		}
+	}
+}
+
+void PlatformMemory::CleanupMemory() {
+	uint32_t u32Leaked = 0;
+
+	for (auto& aRecord : m_vRecords) {
+		if (!aRecord.m_bLive) {
+			continue;
+		}
+
+		++u32Leaked;
+
+		if (aRecord.m_u32Block == UINT32_MAX) {
+			vkFreeMemory(PlatformRenderer::m_dDeviceHandle, aRecord.m_maAllocation.m_dmMemory, nullptr);
+		}
+	}
+
+	if (u32Leaked != 0) {
+		std::cerr << "WARNING: " << u32Leaked << " device memory allocation(s) were never freed before the renderer shut down!\n";
+	}
+
+	for (auto& aPool : m_vPools) {
+		for (auto& aBlock : aPool.m_vBlocks) {
+			if (aBlock.m_dmMemory != VK_NULL_HANDLE) {
+				vkFreeMemory(PlatformRenderer::m_dDeviceHandle, aBlock.m_dmMemory, nullptr);
+			}
+		}
+	}
+
+	m_vPools.clear();
+	m_vRecords.clear();
+	m_vSpareHandles.clear();
+	m_u32DeviceAllocationCount = 0;
+}
+
+uint32_t PlatformMemory::FindMemoryType(uint32_t _u32TypeFilter, VkMemoryPropertyFlags _mpfFlags) {
+	//Memory that only needs to be device local stays out of the host visible types, which can be a small BAR window
+	if (!(_mpfFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)) {
+		for (uint32_t ndx = 0; ndx < m_pdmpProperties.memoryTypeCount; ++ndx) {
+			if (_u32TypeFilter & (1 << ndx) && (m_pdmpProperties.memoryTypes[ndx].propertyFlags & _mpfFlags) == _mpfFlags &&
+				!(m_pdmpProperties.memoryTypes[ndx].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)) {
+				return ndx;
+			}
+		}
+	}
+
+	for (uint32_t ndx = 0; ndx < m_pdmpProperties.memoryTypeCount; ++ndx) {
+		if (_u32TypeFilter & (1 << ndx) && (m_pdmpProperties.memoryTypes[ndx].propertyFlags & _mpfFlags) == _mpfFlags) {
+			return ndx;
+		}
+	}
+
+	throw std::runtime_error("ERROR: Failed to find suitable memory type!");
+}
+
+VkMemoryHandle PlatformMemory::AllocateForBuffer(VkBuffer _bBuffer, VkMemoryPropertyFlags _mpfFlags) {
+	VkBufferMemoryRequirementsInfo2 bmriInfo = {
+		.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2,
+		.pNext = nullptr,
+		.buffer = _bBuffer
+	};
+
+	VkMemoryDedicatedRequirements mdrDedicated = {
+		.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS,
+		.pNext = nullptr
+	};
+
+	VkMemoryRequirements2 mrRequirements = {
+		.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2,
+		.pNext = &mdrDedicated
+	};
+
+	vkGetBufferMemoryRequirements2(PlatformRenderer::m_dDeviceHandle, &bmriInfo, &mrRequirements);
+
+	VkMemoryDedicatedAllocateInfo mdaiDedicatedInfo = {
+		.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO,
+		.pNext = nullptr,
+		.image = VK_NULL_HANDLE,
+		.buffer = _bBuffer
+	};
+
+	VkMemoryHandle mhHandle = Allocate(mrRequirements.memoryRequirements, _mpfFlags, false,
+		mdrDedicated.prefersDedicatedAllocation || mdrDedicated.requiresDedicatedAllocation, &mdaiDedicatedInfo);
+
+	const VkMemoryAllocation& maAllocation = GetAllocation(mhHandle);
+
+	if (vkBindBufferMemory(PlatformRenderer::m_dDeviceHandle, _bBuffer, maAllocation.m_dmMemory, maAllocation.m_dsOffset) != VK_SUCCESS) {
+		Free(mhHandle);
+
+		throw std::runtime_error("ERROR: Failed to bind buffer memory!");
+	}
+
+	return mhHandle;
+}
+
+VkMemoryHandle PlatformMemory::AllocateForImage(VkImage _iImage, VkMemoryPropertyFlags _mpfFlags) {
+	VkImageMemoryRequirementsInfo2 imriInfo = {
+		.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2,
+		.pNext = nullptr,
+		.image = _iImage
+	};
+
+	VkMemoryDedicatedRequirements mdrDedicated = {
+		.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS,
+		.pNext = nullptr
+	};
+
+	VkMemoryRequirements2 mrRequirements = {
+		.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2,
+		.pNext = &mdrDedicated
+	};
+
+	vkGetImageMemoryRequirements2(PlatformRenderer::m_dDeviceHandle, &imriInfo, &mrRequirements);
+
+	VkMemoryDedicatedAllocateInfo mdaiDedicatedInfo = {
+		.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO,
+		.pNext = nullptr,
+		.image = _iImage,
+		.buffer = VK_NULL_HANDLE
+	};
+
+	VkMemoryHandle mhHandle = Allocate(mrRequirements.memoryRequirements, _mpfFlags, true,
+		mdrDedicated.prefersDedicatedAllocation || mdrDedicated.requiresDedicatedAllocation, &mdaiDedicatedInfo);
+
+	const VkMemoryAllocation& maAllocation = GetAllocation(mhHandle);
+
+	if (vkBindImageMemory(PlatformRenderer::m_dDeviceHandle, _iImage, maAllocation.m_dmMemory, maAllocation.m_dsOffset) != VK_SUCCESS) {
+		Free(mhHandle);
+
+		throw std::runtime_error("ERROR: Failed to bind image memory!");
+	}
+
+	return mhHandle;
+}
+
+VkMemoryHandle PlatformMemory::Allocate(const VkMemoryRequirements& _mrRequirements, VkMemoryPropertyFlags _mpfFlags, bool _bOptimalImage, bool _bDedicated, const VkMemoryDedicatedAllocateInfo* _pmdaiDedicatedInfo) {
+	const uint32_t u32MemoryType = FindMemoryType(_mrRequirements.memoryTypeBits, _mpfFlags);
+
+	//Linear and optimal resources never share a block, so bufferImageGranularity never has to be padded for
+	VkMemoryRecord mrRecord = {
+		.m_u32Pool = u32MemoryType * 2 + (_bOptimalImage ? 1 : 0),
+		.m_bLive = true,
+		.m_dsAlignment = _mrRequirements.alignment
+	};
+
+	const bool bDedicated = _bDedicated || _mrRequirements.size >= std::min<VkDeviceSize>(HC_VK_DEDICATED_THRESHOLD, m_vPools[mrRecord.m_u32Pool].m_dsBlockSize / 2);
+
+	if (!bDedicated && AllocateFromPool(mrRecord.m_u32Pool, _mrRequirements, UINT32_MAX, true, mrRecord)) {
+		return StoreRecord(mrRecord);
+	}
+
+	//Large resources, and anything a new block couldn't be made for, get memory of their own
+	void* pMapped = nullptr;
+	VkDeviceMemory dmMemory = AllocateDeviceMemory(_mrRequirements.size, u32MemoryType, bDedicated ? _pmdaiDedicatedInfo : nullptr, pMapped);
+
+	if (dmMemory == VK_NULL_HANDLE) {
+		throw std::runtime_error("ERROR: Failed to allocate device memory!");
+	}
+
+	mrRecord.m_u32Block = UINT32_MAX;
+	mrRecord.m_maAllocation = {
+		.m_dmMemory = dmMemory,
+		.m_dsOffset = 0,
+		.m_dsSize = _mrRequirements.size,
+		.m_pMapped = pMapped
+	};
+
+	return StoreRecord(mrRecord);
+}
+
+bool PlatformMemory::AllocateFromPool(uint32_t _u32Pool, const VkMemoryRequirements& _mrRequirements, uint32_t _u32SkipBlock, bool _bCreateBlocks, VkMemoryRecord& _mrRecord) {
+	VkMemoryPool& mpPool = m_vPools[_u32Pool];
+	uint64_t u64Offset = 0;
+
+	const auto fnTryBlock = [&](uint32_t _u32Block) -> bool {
+		VkMemoryBlock& mbBlock = mpPool.m_vBlocks[_u32Block];
+		const uint32_t u32Node = mbBlock.m_taRanges.Allocate(_mrRequirements.size, _mrRequirements.alignment, u64Offset);
+
+		if (u32Node == HC_TLSF_INVALID_NODE) {
+			return false;
+		}
+
+		_mrRecord.m_u32Block = _u32Block;
+		_mrRecord.m_u32Node = u32Node;
+		_mrRecord.m_maAllocation = {
+			.m_dmMemory = mbBlock.m_dmMemory,
+			.m_dsOffset = u64Offset,
+			.m_dsSize = _mrRequirements.size,
+			.m_pMapped = mbBlock.m_pMapped != nullptr ? static_cast<uint8_t*>(mbBlock.m_pMapped) + u64Offset : nullptr
+		};
+
+		return true;
+	};
+
+	for (uint32_t ndx = 0; ndx < mpPool.m_vBlocks.size(); ++ndx) {
+		if (ndx != _u32SkipBlock && mpPool.m_vBlocks[ndx].m_dmMemory != VK_NULL_HANDLE && fnTryBlock(ndx)) {
+			return true;
+		}
+	}
+
+	if (!_bCreateBlocks) {
+		return false;
+	}
+
+	void* pMapped = nullptr;
+	VkDeviceMemory dmMemory = AllocateDeviceMemory(mpPool.m_dsBlockSize, mpPool.m_u32MemoryType, nullptr, pMapped);
+
+	if (dmMemory == VK_NULL_HANDLE) {
+		return false;
+	}
+
+	//Reuse a released slot before growing the list
+	uint32_t u32Block = 0;
+	while (u32Block < mpPool.m_vBlocks.size() && mpPool.m_vBlocks[u32Block].m_dmMemory != VK_NULL_HANDLE) { ++u32Block; }
+
+	if (u32Block == mpPool.m_vBlocks.size()) {
+		mpPool.m_vBlocks.emplace_back();
+	}
+
+	mpPool.m_vBlocks[u32Block] = {
+		.m_dmMemory = dmMemory,
+		.m_pMapped = pMapped,
+		.m_taRanges = TLSFAllocator(mpPool.m_dsBlockSize)
+	};
+
+	return fnTryBlock(u32Block);
+}
+
+VkDeviceMemory PlatformMemory::AllocateDeviceMemory(VkDeviceSize _dsSize, uint32_t _u32MemoryType, const void* _pNext, void*& _pMapped) {
+	VkMemoryAllocateInfo maiAllocInfo = {
+		.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+		.pNext = _pNext,
+		.allocationSize = _dsSize,
+		.memoryTypeIndex = _u32MemoryType
+	};
+
+	VkDeviceMemory dmMemory = VK_NULL_HANDLE;
+
+	if (vkAllocateMemory(PlatformRenderer::m_dDeviceHandle, &maiAllocInfo, nullptr, &dmMemory) != VK_SUCCESS) {
+		return VK_NULL_HANDLE;
+	}
+
+	//Host visible memory stays mapped for its whole life. Memory can only be mapped once, and every allocation in the block shares the mapping
+	_pMapped = nullptr;
+
+	if ((m_pdmpProperties.memoryTypes[_u32MemoryType].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) &&
+		vkMapMemory(PlatformRenderer::m_dDeviceHandle, dmMemory, 0, VK_WHOLE_SIZE, 0, &_pMapped) != VK_SUCCESS) {
+		vkFreeMemory(PlatformRenderer::m_dDeviceHandle, dmMemory, nullptr);
+
+		throw std::runtime_error("ERROR: Failed to map device memory!");
+	}
+
+	++m_u32DeviceAllocationCount;
+
+	return dmMemory;
+}
+
+VkMemoryHandle PlatformMemory::StoreRecord(const VkMemoryRecord& _mrRecord) {
+	if (!m_vSpareHandles.empty()) {
+		const VkMemoryHandle mhHandle = m_vSpareHandles.back();
+		m_vSpareHandles.pop_back();
+
+		m_vRecords[mhHandle - 1] = _mrRecord;
+
+		return mhHandle;
+	}
+
+	m_vRecords.push_back(_mrRecord);
+
+	return static_cast<VkMemoryHandle>(m_vRecords.size());
+}
+
+void PlatformMemory::ReleaseRange(const VkMemoryRecord& _mrRecord) {
+	if (_mrRecord.m_u32Block == UINT32_MAX) {
+		vkFreeMemory(PlatformRenderer::m_dDeviceHandle, _mrRecord.m_maAllocation.m_dmMemory, nullptr);
+		--m_u32DeviceAllocationCount;
+
+		return;
+	}
+
+	VkMemoryPool& mpPool = m_vPools[_mrRecord.m_u32Pool];
+	VkMemoryBlock& mbBlock = mpPool.m_vBlocks[_mrRecord.m_u32Block];
+
+	mbBlock.m_taRanges.Free(_mrRecord.m_u32Node);
+
+	if (!mbBlock.m_taRanges.IsEmpty()) {
+		return;
+	}
+
+	//Keep one empty block per pool, so a single resource being created and destroyed every frame doesn't reach the driver each time
+	for (uint32_t ndx = 0; ndx < mpPool.m_vBlocks.size(); ++ndx) {
+		if (ndx != _mrRecord.m_u32Block && mpPool.m_vBlocks[ndx].m_dmMemory != VK_NULL_HANDLE && mpPool.m_vBlocks[ndx].m_taRanges.IsEmpty()) {
+			vkFreeMemory(PlatformRenderer::m_dDeviceHandle, mbBlock.m_dmMemory, nullptr);
+			--m_u32DeviceAllocationCount;
+
+			mbBlock = {};
+
+			return;
+		}
+	}
+}
+
+void PlatformMemory::Free(VkMemoryHandle _mhHandle) {
+	if (_mhHandle == HC_VK_NULL_MEMORY) {
+		return;
+	}
+
+	assert(_mhHandle <= m_vRecords.size() && m_vRecords[_mhHandle - 1].m_bLive);
+
+	ReleaseRange(m_vRecords[_mhHandle - 1]);
+
+	m_vRecords[_mhHandle - 1] = {};
+	m_vSpareHandles.push_back(_mhHandle);
+}
+
+const VkMemoryAllocation& PlatformMemory::GetAllocation(VkMemoryHandle _mhHandle) {
+	assert(_mhHandle != HC_VK_NULL_MEMORY && _mhHandle <= m_vRecords.size() && m_vRecords[_mhHandle - 1].m_bLive);
+
+	return m_vRecords[_mhHandle - 1].m_maAllocation;
+}
+
+VkMemoryStats PlatformMemory::GetStats() {
+	VkMemoryStats msStats = {
+		.m_u32DeviceAllocationCount = m_u32DeviceAllocationCount
+	};
+
+	for (const auto& aPool : m_vPools) {
+		for (const auto& aBlock : aPool.m_vBlocks) {
+			if (aBlock.m_dmMemory == VK_NULL_HANDLE) {
+				continue;
+			}
+
+			++msStats.m_u32BlockCount;
+			msStats.m_u32AllocationCount += aBlock.m_taRanges.GetAllocationCount();
+			msStats.m_dsBytesReserved += aBlock.m_taRanges.GetSize();
+			msStats.m_dsBytesUsed += aBlock.m_taRanges.GetUsed();
+			msStats.m_dsBytesFree += aBlock.m_taRanges.GetSize() - aBlock.m_taRanges.GetUsed();
+			msStats.m_dsLargestFreeRange = std::max(msStats.m_dsLargestFreeRange, aBlock.m_taRanges.GetLargestFree());
+		}
+	}
+
+	for (const auto& aRecord : m_vRecords) {
+		if (aRecord.m_bLive && aRecord.m_u32Block == UINT32_MAX) {
+			++msStats.m_u32DedicatedCount;
+			++msStats.m_u32AllocationCount;
+			msStats.m_dsBytesReserved += aRecord.m_maAllocation.m_dsSize;
+			msStats.m_dsBytesUsed += aRecord.m_maAllocation.m_dsSize;
+		}
+	}
+
+	if (msStats.m_dsBytesFree != 0) {
+		msStats.m_fFragmentation = 1.0f - static_cast<float>(msStats.m_dsLargestFreeRange) / static_cast<float>(msStats.m_dsBytesFree);
+	}
+
+	return msStats;
+}
+
+std::vector<VkDefragMove> PlatformMemory::BeginDefragmentation(uint32_t _u32MaxMoves) {
+	std::vector<VkDefragMove> vMoves;
+	std::vector<uint32_t> vNodes;
+	std::map<uint32_t, VkMemoryHandle> mNodeHandles;
+
+	for (uint32_t u32Pool = 0; u32Pool < m_vPools.size() && vMoves.size() < _u32MaxMoves; ++u32Pool) {
+		VkMemoryPool& mpPool = m_vPools[u32Pool];
+		uint32_t u32Source = UINT32_MAX, u32LiveBlocks = 0;
+
+		for (uint32_t ndx = 0; ndx < mpPool.m_vBlocks.size(); ++ndx) {
+			const VkMemoryBlock& mbBlock = mpPool.m_vBlocks[ndx];
+
+			if (mbBlock.m_dmMemory == VK_NULL_HANDLE) {
+				continue;
+			}
+
+			++u32LiveBlocks;
+
+			if (!mbBlock.m_taRanges.IsEmpty() && (u32Source == UINT32_MAX || mbBlock.m_taRanges.GetUsed() < mpPool.m_vBlocks[u32Source].m_taRanges.GetUsed())) {
+				u32Source = ndx;
+			}
+		}
+
+		//Nowhere to move to
+		if (u32Source == UINT32_MAX || u32LiveBlocks < 2) {
+			continue;
+		}
+
+		mNodeHandles.clear();
+
+		for (uint32_t ndx = 0; ndx < m_vRecords.size(); ++ndx) {
+			if (m_vRecords[ndx].m_bLive && m_vRecords[ndx].m_u32Pool == u32Pool && m_vRecords[ndx].m_u32Block == u32Source) {
+				mNodeHandles[m_vRecords[ndx].m_u32Node] = ndx + 1;
+			}
+		}
+
+		mpPool.m_vBlocks[u32Source].m_taRanges.GetAllocatedNodes(vNodes);
+
+		for (const uint32_t u32Node : vNodes) {
+			if (vMoves.size() >= _u32MaxMoves) {
+				break;
+			}
+
+			const VkMemoryHandle mhHandle = mNodeHandles[u32Node];
+			const VkMemoryRecord& mrSource = m_vRecords[mhHandle - 1];
+
+			const VkMemoryRequirements mrRequirements = {
+				.size = mrSource.m_maAllocation.m_dsSize,
+				.alignment = mrSource.m_dsAlignment,
+				.memoryTypeBits = 1U << mpPool.m_u32MemoryType
+			};
+
+			VkMemoryRecord mrDestination = {
+				.m_u32Pool = u32Pool,
+				.m_bLive = true,
+				.m_dsAlignment = mrSource.m_dsAlignment
+			};
+
+			//Only existing free space is used. Growing the pool to empty a block would gain nothing
+			if (!AllocateFromPool(u32Pool, mrRequirements, u32Source, false, mrDestination)) {
+				break;
+			}
+
+			const VkMemoryAllocation maSource = mrSource.m_maAllocation;
+			const VkMemoryHandle mhDestination = StoreRecord(mrDestination);
+
+			vMoves.push_back({
+				.m_mhAllocation = mhHandle,
+				.m_mhDestination = mhDestination,
+				.m_maSource = maSource,
+				.m_maDestination = mrDestination.m_maAllocation
+			});
+		}
+	}
+
+	return vMoves;
+}
+
+void PlatformMemory::EndDefragmentation(const std::vector<VkDefragMove>& _vMoves, bool _bApplied) {
+	for (const auto& aMove : _vMoves) {
+		if (!_bApplied) {
+			Free(aMove.m_mhDestination);
+
+			continue;
+		}
+
+		//The allocation keeps its handle and takes over the destination's range
+		ReleaseRange(m_vRecords[aMove.m_mhAllocation - 1]);
+
+		m_vRecords[aMove.m_mhAllocation - 1] = m_vRecords[aMove.m_mhDestination - 1];
+		m_vRecords[aMove.m_mhDestination - 1] = {};
+		m_vSpareHandles.push_back(aMove.m_mhDestination);
+	}
+}
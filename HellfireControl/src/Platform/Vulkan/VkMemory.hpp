@@ -0,0 +1,128 @@
+#pragma once
+
+#include <Platform/GLCommon.hpp>
+
+#include <Platform/Vulkan/VkTLSF.hpp>
+
+#define HC_VK_BLOCK_SIZE (64ULL * 1024ULL * 1024ULL)	//Size of each device memory block that small resources are packed into
+#define HC_VK_DEDICATED_THRESHOLD (HC_VK_BLOCK_SIZE / 2)	//Resources at least this large get a vkAllocateMemory of their own
+#define HC_VK_REBAR_MIN_HEAP (256ULL * 1024ULL * 1024ULL)	//A device local, host visible heap larger than the classic 256MB BAR window means resizable BAR or unified memory
+#define HC_VK_NULL_MEMORY 0ULL
+
+typedef uint64_t VkMemoryHandle;
+
+struct VkMemoryAllocation {
+	VkDeviceMemory m_dmMemory = VK_NULL_HANDLE;
+	VkDeviceSize m_dsOffset = 0;
+	VkDeviceSize m_dsSize = 0;
+	void* m_pMapped = nullptr; //Already offset to this allocation. Null unless the memory type is host visible
+};
+
+struct VkMemoryStats {
+	uint32_t m_u32BlockCount = 0;
+	uint32_t m_u32DedicatedCount = 0;
+	uint32_t m_u32AllocationCount = 0;
+	uint32_t m_u32DeviceAllocationCount = 0; //Live vkAllocateMemory calls, to compare against maxMemoryAllocationCount
+
+	VkDeviceSize m_dsBytesReserved = 0; //Everything obtained from the driver, blocks and dedicated allocations together
+	VkDeviceSize m_dsBytesUsed = 0;
+	VkDeviceSize m_dsBytesFree = 0; //Unused space inside blocks
+	VkDeviceSize m_dsLargestFreeRange = 0;
+
+	float m_fFragmentation = 0.0f; //1 - largest free range / free bytes. 0 while the free space in blocks is all in one piece
+};
+
+struct VkDefragMove {
+	VkMemoryHandle m_mhAllocation = HC_VK_NULL_MEMORY;
+	VkMemoryHandle m_mhDestination = HC_VK_NULL_MEMORY;
+
+	VkMemoryAllocation m_maSource;
+	VkMemoryAllocation m_maDestination;
+};
+
+class PlatformMemory {
+	friend class PlatformRenderer;
+	friend class PlatformBuffer;
+	friend class PlatformRenderContext;
+	friend class PlatformStaging;
+	friend class VkUtil;
+private:
+	struct VkMemoryBlock {
+		VkDeviceMemory m_dmMemory = VK_NULL_HANDLE; //VK_NULL_HANDLE marks a released slot, so block indices held by allocations stay valid
+		void* m_pMapped = nullptr;
+
+		TLSFAllocator m_taRanges;
+	};
+
+	struct VkMemoryPool {
+		uint32_t m_u32MemoryType = 0;
+		VkDeviceSize m_dsBlockSize = 0;
+
+		std::vector<VkMemoryBlock> m_vBlocks;
+	};
+
+	struct VkMemoryRecord {
+		uint32_t m_u32Pool = 0;
+		uint32_t m_u32Block = UINT32_MAX; //UINT32_MAX for dedicated allocations
+		uint32_t m_u32Node = HC_TLSF_INVALID_NODE;
+		bool m_bLive = false;
+
+		VkDeviceSize m_dsAlignment = 0; //Kept so defragmentation can find an equally aligned destination
+
+		VkMemoryAllocation m_maAllocation;
+	};
+
+	static VkPhysicalDeviceMemoryProperties m_pdmpProperties;
+	static std::vector<VkMemoryPool>		m_vPools; //Two per memory type: linear resources first, then optimally tiled images
+	static std::vector<VkMemoryRecord>		m_vRecords; //Indexed by handle - 1
+	static std::vector<VkMemoryHandle>		m_vSpareHandles;
+	static uint32_t							m_u32DeviceAllocationCount;
+	static bool								m_bMappableDeviceMemory;
+
+	static void InitMemory();
+
+	static void CleanupMemory();
+
+	static uint32_t FindMemoryType(uint32_t _u32TypeFilter, VkMemoryPropertyFlags _mpfFlags);
+
+	[[nodiscard]] HC_INLINE static bool HasMappableDeviceMemory() { return m_bMappableDeviceMemory; }
+
+	static VkMemoryHandle AllocateForBuffer(VkBuffer _bBuffer, VkMemoryPropertyFlags _mpfFlags);
+
+	static VkMemoryHandle AllocateForImage(VkImage _iImage, VkMemoryPropertyFlags _mpfFlags);
+
+	static VkMemoryHandle Allocate(const VkMemoryRequirements& _mrRequirements, VkMemoryPropertyFlags _mpfFlags, bool _bOptimalImage, bool _bDedicated, const VkMemoryDedicatedAllocateInfo* _pmdaiDedicatedInfo);
+
+	static bool AllocateFromPool(uint32_t _u32Pool, const VkMemoryRequirements& _mrRequirements, uint32_t _u32SkipBlock, bool _bCreateBlocks, VkMemoryRecord& _mrRecord);
+
+	static VkDeviceMemory AllocateDeviceMemory(VkDeviceSize _dsSize, uint32_t _u32MemoryType, const void* _pNext, void*& _pMapped);
+
+	static VkMemoryHandle StoreRecord(const VkMemoryRecord& _mrRecord);
+
+	static void ReleaseRange(const VkMemoryRecord& _mrRecord);
+
+	static void Free(VkMemoryHandle _mhHandle);
+
+	static const VkMemoryAllocation& GetAllocation(VkMemoryHandle _mhHandle);
+public:
+	/// <summary>
+	/// Totals across every pool, including how scattered the free space inside blocks has become
+	/// </summary>
+	[[nodiscard]] static VkMemoryStats GetStats();
+
+	/// <summary>
+	/// Plans moves that empty the least used block of each memory type into the free space of its other blocks, and reserves the destinations.
+	/// The caller copies each source range to its destination, recreates and binds the resource over the new memory, and then passes the
+	/// same moves to EndDefragmentation. Nothing changes until then.
+	/// </summary>
+	/// <param name="_u32MaxMoves: The most allocations to move in this pass"></param>
+	[[nodiscard]] static std::vector<VkDefragMove> BeginDefragmentation(uint32_t _u32MaxMoves);
+
+	/// <summary>
+	/// Finishes a defragmentation pass. Applied moves point their allocation handle at the destination and release the source range.
+	/// Otherwise every reserved destination is released and the allocations are left where they were.
+	/// </summary>
+	/// <param name="_vMoves: The moves returned by BeginDefragmentation"></param>
+	/// <param name="_bApplied: Whether the caller actually performed the copies and rebinds"></param>
+	static void EndDefragmentation(const std::vector<VkDefragMove>& _vMoves, bool _bApplied);
+};
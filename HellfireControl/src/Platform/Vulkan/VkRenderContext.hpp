@@ -2,6 +2,7 @@
 
 #include <Platform/GLCommon.hpp>
 
+#include <Platform/Vulkan/VkMemory.hpp>
 #include <Platform/Vulkan/VkUtil.hpp>
 #include <Platform/Vulkan/VkRenderer.hpp>
 
@@ -15,14 +16,14 @@ private:
 		VkBufferUsageFlags m_bufFlags = 0;
 
 		std::vector<VkBuffer> m_vBuffers;
-		std::vector<VkDeviceMemory> m_vMemory;
+		std::vector<VkMemoryHandle> m_vMemory;
 		std::vector<void*> m_vMappedPtrs;
 
 		void Destroy() {
 			for (int ndx = 0; ndx < HC_MAX_FRAMES_IN_FLIGHT; ++ndx) {
 				vkDestroyBuffer(PlatformRenderer::m_dDeviceHandle, m_vBuffers[ndx], nullptr);
 
-				vkFreeMemory(PlatformRenderer::m_dDeviceHandle, m_vMemory[ndx], nullptr);
+				PlatformMemory::Free(m_vMemory[ndx]);
 			}
 
 			m_vBuffers.clear(); //Clear lists to prevent UAF error
@@ -50,36 +51,39 @@ private:
 		std::vector<BufferHandleGeneric> m_vIndexBuffers;
 
 		void Destroy() {
-			vkDeviceWaitIdle(PlatformRenderer::m_dDeviceHandle);
+			//Frames already submitted may still be drawing with the context, so everything is handed off until they finish
+			PlatformRenderer::DeferDestroy([vContextBuffers = std::move(m_vContextBuffers), vVertexBuffers = std::move(m_vVertexBuffers),
+				vIndexBuffers = std::move(m_vIndexBuffers), ddDescriptorData = m_ddDescriptorData, plPipelineLayout = m_plPipelineLayout,
+				pPipeline = m_pPipeline]() mutable {
+				for (auto& aSyncedBuffer : vContextBuffers) {
+					aSyncedBuffer.Destroy();
+				}
 
-			for (auto& aSyncedBuffer : m_vContextBuffers) {
-				aSyncedBuffer.Destroy();
-			}
-
-			for (auto& aBufferHandle : m_vVertexBuffers) {
-				DestroyBuffer(aBufferHandle);
-			}
+				for (auto& aBufferHandle : vVertexBuffers) {
+					DestroyBuffer(aBufferHandle);
+				}
 
-			for (auto& aBufferHandle : m_vIndexBuffers) {
-				DestroyBuffer(aBufferHandle);
-			}
+				for (auto& aBufferHandle : vIndexBuffers) {
+					DestroyBuffer(aBufferHandle);
+				}
 
-			vkDestroyDescriptorPool(PlatformRenderer::m_dDeviceHandle, m_ddDescriptorData.m_dpDescriptorPool, nullptr);
+				vkDestroyDescriptorPool(PlatformRenderer::m_dDeviceHandle, ddDescriptorData.m_dpDescriptorPool, nullptr);
 
-			vkDestroyDescriptorSetLayout(PlatformRenderer::m_dDeviceHandle, m_ddDescriptorData.m_dslDescriptorSetLayout, nullptr);
+				vkDestroyDescriptorSetLayout(PlatformRenderer::m_dDeviceHandle, ddDescriptorData.m_dslDescriptorSetLayout, nullptr);
 
-			vkDestroyPipelineLayout(PlatformRenderer::m_dDeviceHandle, m_plPipelineLayout, nullptr);
+				vkDestroyPipelineLayout(PlatformRenderer::m_dDeviceHandle, plPipelineLayout, nullptr);
 
-			vkDestroyPipeline(PlatformRenderer::m_dDeviceHandle, m_pPipeline, nullptr);
+				vkDestroyPipeline(PlatformRenderer::m_dDeviceHandle, pPipeline, nullptr);
+			});
 
-			m_vContextBuffers.clear(); //Clear list to prevent UAF error
+			m_vContextBuffers.clear(); //Clear lists to prevent UAF error
 			m_vVertexBuffers.clear();
 			m_vIndexBuffers.clear();
 		}
 
-		void DestroyBuffer(BufferHandleGeneric& _bhgBuffer) {
+		static void DestroyBuffer(BufferHandleGeneric& _bhgBuffer) {
 			vkDestroyBuffer(PlatformRenderer::m_dDeviceHandle, reinterpret_cast<VkBuffer>(_bhgBuffer.upper), nullptr);
-			vkFreeMemory(PlatformRenderer::m_dDeviceHandle, reinterpret_cast<VkDeviceMemory>(_bhgBuffer.lower), nullptr);
+			PlatformMemory::Free(_bhgBuffer.lower);
 		}
 	};
 
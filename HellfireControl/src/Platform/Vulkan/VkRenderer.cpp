@@ -2,6 +2,7 @@
 #include <Platform/Vulkan/VkRenderer.hpp>
 #include <Platform/Vulkan/VkBuffer.hpp>
 #include <Platform/Vulkan/VkRenderContext.hpp>
+#include <Platform/Vulkan/VkStaging.hpp>
 #include <Platform/Vulkan/VkUtil.hpp>
 
 #define HC_INCLUDE_SURFACE_VK
@@ -18,6 +19,8 @@
 
 uint64_t PlatformRenderer::m_u64WindowHandle = 0;
 uint32_t PlatformRenderer::m_u32CurrentFrame = 0;
+uint32_t PlatformRenderer::m_u32ImageIndex = 0;
+bool PlatformRenderer::m_bRecordingFrame = false;
 bool PlatformRenderer::m_bFramebufferResized = false;
 
 VkInstance PlatformRenderer::m_iInstance = VK_NULL_HANDLE;
@@ -25,16 +28,22 @@ VkPhysicalDevice PlatformRenderer::m_pdPhysicalDevice = VK_NULL_HANDLE;
 VkDevice PlatformRenderer::m_dDeviceHandle = VK_NULL_HANDLE;
 VkQueue PlatformRenderer::m_qGraphicsQueue = VK_NULL_HANDLE;
 VkQueue PlatformRenderer::m_qPresentQueue = VK_NULL_HANDLE;
+VkQueue PlatformRenderer::m_qTransferQueue = VK_NULL_HANDLE;
+VkQueue PlatformRenderer::m_qComputeQueue = VK_NULL_HANDLE;
+uint32_t PlatformRenderer::m_u32GraphicsFamily = 0;
+uint32_t PlatformRenderer::m_u32TransferFamily = 0;
+uint32_t PlatformRenderer::m_u32ComputeFamily = 0;
 VkSurfaceKHR PlatformRenderer::m_sSurface = VK_NULL_HANDLE;
 VkSwapchainKHR PlatformRenderer::m_scSwapChain = VK_NULL_HANDLE;
 VkRenderPass PlatformRenderer::m_rpRenderPass = VK_NULL_HANDLE;
 VkDescriptorSetLayout PlatformRenderer::m_dslDescriptorSetLayout = VK_NULL_HANDLE;
 VkCommandPool PlatformRenderer::m_cpCommandPool = VK_NULL_HANDLE;
+VkCommandPool PlatformRenderer::m_cpTransferCommandPool = VK_NULL_HANDLE;
 VkDescriptorPool PlatformRenderer::m_dpDescriptorPool = VK_NULL_HANDLE;
 VkSampler PlatformRenderer::m_sSampler = VK_NULL_HANDLE;
 
 VkImage PlatformRenderer::m_iDepth = VK_NULL_HANDLE;
-VkDeviceMemory PlatformRenderer::m_dmDepthMem = VK_NULL_HANDLE;
+VkMemoryHandle PlatformRenderer::m_mhDepthMem = HC_VK_NULL_MEMORY;
 VkImageView PlatformRenderer::m_ivDepthView = VK_NULL_HANDLE;
 
 VkFormat PlatformRenderer::m_fFormat = {};
@@ -45,13 +54,18 @@ std::vector<VkCommandBuffer> PlatformRenderer::m_vCommandBuffers = {};
 std::vector<VkDescriptorSet> PlatformRenderer::m_vDescriptorSets = {};
 std::vector<VkSemaphore> PlatformRenderer::m_vImageAvailableSemaphores = {};
 std::vector<VkSemaphore> PlatformRenderer::m_vRenderFinishedSemaphores = {};
-std::vector<VkFence> PlatformRenderer::m_vInFlightFences = {};
+VkSemaphore PlatformRenderer::m_sGraphicsTimeline = VK_NULL_HANDLE;
+VkSemaphore PlatformRenderer::m_sTransferTimeline = VK_NULL_HANDLE;
+uint64_t PlatformRenderer::m_u64GraphicsValue = 0;
+uint64_t PlatformRenderer::m_u64TransferValue = 0;
+std::array<uint64_t, HC_MAX_FRAMES_IN_FLIGHT> PlatformRenderer::m_arrFrameValues = {};
+std::vector<VkDeferredDestroy> PlatformRenderer::m_vDeferredDestroys = {};
 std::vector<VkImage> PlatformRenderer::m_vSwapchainImages = {};
 std::vector<VkImageView> PlatformRenderer::m_vSwapchainImageViews = {};
 std::vector<VkFramebuffer> PlatformRenderer::m_vFramebuffers = {};
 
 VkImage PlatformRenderer::imgTexture = VK_NULL_HANDLE; //SUPER TEMPORARY ! ! !
-VkDeviceMemory PlatformRenderer::dmTextureMemory = VK_NULL_HANDLE;
+VkMemoryHandle PlatformRenderer::mhTextureMemory = HC_VK_NULL_MEMORY;
 VkImageView PlatformRenderer::ivTextureView = VK_NULL_HANDLE;
 #pragma endregion
 
@@ -75,6 +89,10 @@ void PlatformRenderer::InitRenderer(const std::string& _strAppName, uint32_t _u3
 
 	CreateLogicalDevice();
 
+	CreateTimelineSemaphores();
+
+	PlatformMemory::InitMemory();
+
 	CreateSwapChain();
 
 	CreateSwapchainImageViews();
@@ -83,6 +101,8 @@ void PlatformRenderer::InitRenderer(const std::string& _strAppName, uint32_t _u3
 
 	CreateCommandPool();
 
+	PlatformStaging::InitStaging();
+
 	CreateDepthResources();
 
 	CreateFramebuffers();
@@ -102,12 +122,13 @@ void PlatformRenderer::MarkFramebufferUpdated() {
 }
 
 void PlatformRenderer::BeginRenderPass() {
-	vkWaitForFences(m_dDeviceHandle, 1, &m_vInFlightFences[m_u32CurrentFrame], VK_TRUE, UINT64_MAX);
+	//The last submission made from this frame's command buffer and uniform buffers
+	WaitForValue(m_arrFrameValues[m_u32CurrentFrame]);
 
-	vkResetFences(m_dDeviceHandle, 1, &m_vInFlightFences[m_u32CurrentFrame]);
+	ProcessDeferredDestroys(false);
 
 	VkResult rRes = vkAcquireNextImageKHR(m_dDeviceHandle, m_scSwapChain, UINT64_MAX,
-		m_vImageAvailableSemaphores[m_u32CurrentFrame], VK_NULL_HANDLE, &m_u32CurrentFrame);
+		m_vImageAvailableSemaphores[m_u32CurrentFrame], VK_NULL_HANDLE, &m_u32ImageIndex);
 
 	if (rRes == VK_ERROR_OUT_OF_DATE_KHR || rRes == VK_SUBOPTIMAL_KHR) {
 		RecreateSwapchain();
@@ -117,7 +138,7 @@ void PlatformRenderer::BeginRenderPass() {
 		throw std::runtime_error("ERROR: Failed to acquire swapchain image!");
 	}
 
-	vkResetFences(m_dDeviceHandle, 1, &m_vInFlightFences[m_u32CurrentFrame]);
+	m_bRecordingFrame = true;
 
 	VkCommandBuffer cbBuffer = m_vCommandBuffers[m_u32CurrentFrame];
 
@@ -138,7 +159,7 @@ void PlatformRenderer::BeginRenderPass() {
 		.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
 		.pNext = nullptr,
 		.renderPass = m_rpRenderPass,
-		.framebuffer = m_vFramebuffers[m_u32CurrentFrame],
+		.framebuffer = m_vFramebuffers[m_u32ImageIndex],
 		.renderArea = { { 0, 0 }, m_eExtent},
 		.clearValueCount = static_cast<uint32_t>(m_arrClearValues.size()),
 		.pClearValues = m_arrClearValues.data()
@@ -149,10 +170,32 @@ void PlatformRenderer::BeginRenderPass() {
 }
 
 void PlatformRenderer::Draw(uint32_t _u32ContextID) {
+	RecordDraws(_u32ContextID, nullptr);
+}
+
+void PlatformRenderer::Draw(uint32_t _u32ContextID, std::span<const uint32_t> _vDrawIndices) {
+	RecordDraws(_u32ContextID, &_vDrawIndices);
+}
+
+uint32_t PlatformRenderer::GetDrawCount(uint32_t _u32ContextID) {
+	auto aContext = PlatformRenderContext::m_mContextMap.find(_u32ContextID);
+
+	return aContext != PlatformRenderContext::m_mContextMap.end() ? static_cast<uint32_t>(aContext->second.m_vIndexBuffers.size()) : 0;
+}
+
+void PlatformRenderer::RecordDraws(uint32_t _u32ContextID, const std::span<const uint32_t>* _pDrawIndices) {
 	VkCommandBuffer cbBuffer = m_vCommandBuffers[m_u32CurrentFrame]; //Grab command buffer for current frame.
 
 	PlatformRenderContext::VkRenderContextData& rcdCurrentContext = PlatformRenderContext::m_mContextMap[_u32ContextID]; //Grab render context data.
 
+	if (rcdCurrentContext.m_vVertexBuffers.size() == 0 || rcdCurrentContext.m_vIndexBuffers.size() != rcdCurrentContext.m_vVertexBuffers.size()) {
+		throw std::runtime_error("ERROR: Attempted to draw an object with no index buffer! Models MUST include an index buffer!");
+	}
+
+	if (_pDrawIndices && _pDrawIndices->empty()) {
+		return; //Everything in the context was culled, so there is nothing worth binding the pipeline for.
+	}
+
 	vkCmdBindPipeline(cbBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, rcdCurrentContext.m_pPipeline); //Set pipeline, viewport, and scissor from context.
 
 	VkViewport vViewport = {
@@ -175,26 +218,29 @@ void PlatformRenderer::Draw(uint32_t _u32ContextID) {
 	//Bind descriptor data from context.
 	vkCmdBindDescriptorSets(cbBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, rcdCurrentContext.m_plPipelineLayout, 0, 1, &rcdCurrentContext.m_ddDescriptorData.m_vDescriptorSets[m_u32CurrentFrame], 0, nullptr);
 
-	if (rcdCurrentContext.m_vVertexBuffers.size() > 0 && rcdCurrentContext.m_vIndexBuffers.size() == rcdCurrentContext.m_vVertexBuffers.size()) {
-		VkDeviceSize dsOffsets[] = { 0 }; //Vulkan forcing my hand. Possibly use offsets for bindless vertices?
+	VkDeviceSize dsOffsets[] = { 0 }; //Vulkan forcing my hand. Possibly use offsets for bindless vertices?
 
-		for (int ndx = 0; ndx < rcdCurrentContext.m_vVertexBuffers.size(); ++ndx) {
-			//Extract matching buffer handles. This assumes buffers are loaded simultaneously and thus match in bindings.
-			//This will be guaranteed by the asset load code for models.
-			//Possible future implementation -- Combine with bindless design to eliminate multiple vertex buffers and use
-			//instancer to greatly reduce number of draw calls. Current design requires separate buffer per object per RenderContext
-			VkBuffer bVertexBuffer = reinterpret_cast<VkBuffer>(rcdCurrentContext.m_vVertexBuffers[ndx].upper);
-			VkBuffer bIndexBuffer = reinterpret_cast<VkBuffer>(rcdCurrentContext.m_vIndexBuffers[ndx].upper);
+	const uint32_t u32DrawCount = _pDrawIndices ? static_cast<uint32_t>(_pDrawIndices->size()) : static_cast<uint32_t>(rcdCurrentContext.m_vVertexBuffers.size());
 
-			vkCmdBindVertexBuffers(cbBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, 1, &bVertexBuffer, dsOffsets);
+	for (uint32_t ndx = 0; ndx < u32DrawCount; ++ndx) {
+		const uint32_t u32Draw = _pDrawIndices ? (*_pDrawIndices)[ndx] : ndx;
 
-			vkCmdBindIndexBuffer(cbBuffer, bIndexBuffer, 0, VK_INDEX_TYPE_UINT16); //Temporary -- store index type.
-
-			vkCmdDrawIndexed(cbBuffer, PlatformBuffer::g_blData.g_mBufferDataTable[bIndexBuffer].m_u32ItemCount, 1, 0, 0, 0); //Temporary -- support instancing.
+		if (u32Draw >= rcdCurrentContext.m_vVertexBuffers.size()) {
+			continue; //A draw index from a cull that ran before the context lost buffers
 		}
-	}
-	else {
-		throw std::runtime_error("ERROR: Attempted to draw an object with no index buffer! Models MUST include an index buffer!");
+
+		//Extract matching buffer handles. This assumes buffers are loaded simultaneously and thus match in bindings.
+		//This will be guaranteed by the asset load code for models.
+		//Possible future implementation -- Combine with bindless design to eliminate multiple vertex buffers and use
+		//instancer to greatly reduce number of draw calls. Current design requires separate buffer per object per RenderContext
+		VkBuffer bVertexBuffer = reinterpret_cast<VkBuffer>(rcdCurrentContext.m_vVertexBuffers[u32Draw].upper);
+		VkBuffer bIndexBuffer = reinterpret_cast<VkBuffer>(rcdCurrentContext.m_vIndexBuffers[u32Draw].upper);
+
+		vkCmdBindVertexBuffers(cbBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, 1, &bVertexBuffer, dsOffsets);
+
+		vkCmdBindIndexBuffer(cbBuffer, bIndexBuffer, 0, VK_INDEX_TYPE_UINT16); //Temporary -- store index type.
+
+		vkCmdDrawIndexed(cbBuffer, PlatformBuffer::g_blData.g_mBufferDataTable[bIndexBuffer].m_u32ItemCount, 1, 0, 0, 0); //Temporary -- support instancing.
 	}
 }
 
@@ -205,26 +251,61 @@ void PlatformRenderer::Present() {
 		throw std::runtime_error("ERROR: Failed to record command buffer!");
 	}
 
+	//Copies into buffers drawn this frame have to be on the queue ahead of it
+	PlatformStaging::Flush();
+
 	VkPipelineStageFlags psfStageFlags[] = {
 		VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT
 	};
 
+	//The swapchain only works with binary semaphores, so the timeline is signaled alongside the one presentation waits on
+	const uint64_t u64FrameValue = ++m_u64GraphicsValue;
+
+	std::array<VkSemaphore, 2> arrSignalSemaphores = {
+		m_vRenderFinishedSemaphores[m_u32CurrentFrame],
+		m_sGraphicsTimeline
+	};
+
+	std::array<uint64_t, 2> arrSignalValues = {
+		0, //Ignored for binary semaphores
+		u64FrameValue
+	};
+
+	VkTimelineSemaphoreSubmitInfo tssiTimelineInfo = {
+		.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+		.pNext = nullptr,
+		.waitSemaphoreValueCount = 0,
+		.pWaitSemaphoreValues = nullptr,
+		.signalSemaphoreValueCount = static_cast<uint32_t>(arrSignalValues.size()),
+		.pSignalSemaphoreValues = arrSignalValues.data()
+	};
+
 	VkSubmitInfo siSubmitInfo = {
 		.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-		.pNext = nullptr,
+		.pNext = &tssiTimelineInfo,
 		.waitSemaphoreCount = 1,
 		.pWaitSemaphores = &m_vImageAvailableSemaphores[m_u32CurrentFrame],
 		.pWaitDstStageMask = psfStageFlags,
 		.commandBufferCount = 1,
 		.pCommandBuffers = &m_vCommandBuffers[m_u32CurrentFrame],
-		.signalSemaphoreCount = 1,
-		.pSignalSemaphores = &m_vRenderFinishedSemaphores[m_u32CurrentFrame]
+		.signalSemaphoreCount = static_cast<uint32_t>(arrSignalSemaphores.size()),
+		.pSignalSemaphores = arrSignalSemaphores.data()
 	};
 
-	if (vkQueueSubmit(m_qGraphicsQueue, 1, &siSubmitInfo, m_vInFlightFences[m_u32CurrentFrame]) != VK_SUCCESS) {
+	if (vkQueueSubmit(m_qGraphicsQueue, 1, &siSubmitInfo, VK_NULL_HANDLE) != VK_SUCCESS) {
 		throw std::runtime_error("ERROR: Failed to submit draw command buffer!");
 	}
 
+	m_arrFrameValues[m_u32CurrentFrame] = u64FrameValue;
+	m_bRecordingFrame = false;
+
+	//Resources released while this frame was being recorded can go once it finishes
+	for (auto& aDestroy : m_vDeferredDestroys) {
+		if (aDestroy.m_u64Value == UINT64_MAX) {
+			aDestroy.m_u64Value = u64FrameValue;
+		}
+	}
+
 	VkPresentInfoKHR piPresentInfo = {
 		.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
 		.pNext = nullptr,
@@ -232,7 +313,7 @@ void PlatformRenderer::Present() {
 		.pWaitSemaphores = &m_vRenderFinishedSemaphores[m_u32CurrentFrame],
 		.swapchainCount = 1,
 		.pSwapchains = &m_scSwapChain,
-		.pImageIndices = &m_u32CurrentFrame,
+		.pImageIndices = &m_u32ImageIndex,
 		.pResults = nullptr
 	};
 
@@ -251,6 +332,8 @@ void PlatformRenderer::Present() {
 }
 
 void PlatformRenderer::CleanupRenderer() {
+	PlatformStaging::Flush(); //Recorded uploads may still reference resources destroyed below
+
 	vkDeviceWaitIdle(m_dDeviceHandle);
 
 	CleanupSwapchain();
@@ -261,7 +344,7 @@ void PlatformRenderer::CleanupRenderer() {
 
 	vkDestroyImage(m_dDeviceHandle, imgTexture, nullptr);
 
-	vkFreeMemory(m_dDeviceHandle, dmTextureMemory, nullptr);
+	PlatformMemory::Free(mhTextureMemory);
 
 	vkDestroyDescriptorPool(m_dDeviceHandle, m_dpDescriptorPool, nullptr);
 
@@ -270,15 +353,27 @@ void PlatformRenderer::CleanupRenderer() {
 	for (int ndx = 0; ndx < HC_MAX_FRAMES_IN_FLIGHT; ++ndx) {
 		vkDestroySemaphore(m_dDeviceHandle, m_vImageAvailableSemaphores[ndx], nullptr);
 		vkDestroySemaphore(m_dDeviceHandle, m_vRenderFinishedSemaphores[ndx], nullptr);
-		vkDestroyFence(m_dDeviceHandle, m_vInFlightFences[ndx], nullptr);
 	}
 
-	vkDestroyCommandPool(m_dDeviceHandle, m_cpCommandPool, nullptr);
-
 	PlatformRenderContext::CleanupAllContextData();
 
+	ProcessDeferredDestroys(true);
+
+	PlatformStaging::CleanupStaging(); //Waits on the timelines, so they go after it
+
+	vkDestroySemaphore(m_dDeviceHandle, m_sGraphicsTimeline, nullptr);
+	vkDestroySemaphore(m_dDeviceHandle, m_sTransferTimeline, nullptr);
+
+	if (m_cpTransferCommandPool != m_cpCommandPool) {
+		vkDestroyCommandPool(m_dDeviceHandle, m_cpTransferCommandPool, nullptr);
+	}
+
+	vkDestroyCommandPool(m_dDeviceHandle, m_cpCommandPool, nullptr);
+
 	vkDestroyRenderPass(m_dDeviceHandle, m_rpRenderPass, nullptr);
 
+	PlatformMemory::CleanupMemory();
+
 	vkDestroyDevice(m_dDeviceHandle, nullptr);
 
 	vkDestroySurfaceKHR(m_iInstance, m_sSurface, nullptr);
@@ -350,9 +445,17 @@ void PlatformRenderer::CreateLogicalDevice() {
 	VkQueueFamilyIndices qfiIndices = VkUtil::GetQueueFamilies(m_pdPhysicalDevice);
 
 	std::vector<VkDeviceQueueCreateInfo> vQueueCreateInfos;
+
+	//Without a dedicated family, transfers and compute share the graphics queue
+	m_u32GraphicsFamily = qfiIndices.m_u32GraphicsFamily.value();
+	m_u32TransferFamily = qfiIndices.m_u32TransferFamily.value_or(m_u32GraphicsFamily);
+	m_u32ComputeFamily = qfiIndices.m_u32ComputeFamily.value_or(m_u32GraphicsFamily);
+
 	std::set<uint32_t> sUniqueQueueFamilies = {
-		qfiIndices.m_u32GraphicsFamily.value(),
-		qfiIndices.m_u32PresentFamily.value()
+		m_u32GraphicsFamily,
+		qfiIndices.m_u32PresentFamily.value(),
+		m_u32TransferFamily,
+		m_u32ComputeFamily
 	};
 
 	float fQueuePriority = 1.0f; //BLECK, REQUIRED FOR FUNCTION.
@@ -362,7 +465,7 @@ void PlatformRenderer::CreateLogicalDevice() {
 			.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
 			.pNext = nullptr,
 			.flags = 0,
-			.queueFamilyIndex = qfiIndices.m_u32GraphicsFamily.value(),
+			.queueFamilyIndex = u32QueueFamily,
 			.queueCount = 1,
 			.pQueuePriorities = &fQueuePriority
 		};
@@ -373,12 +476,16 @@ void PlatformRenderer::CreateLogicalDevice() {
 	VkPhysicalDeviceFeatures pdfFeatures = {};
 	pdfFeatures.samplerAnisotropy = VK_TRUE;
 
+	VkPhysicalDeviceVulkan12Features pdv12Features = {};
+	pdv12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+	pdv12Features.timelineSemaphore = VK_TRUE;
+
 	std::vector<const char*> vDeviceExtensions = VkUtil::GetDeviceExtensions();
 	std::vector<const char*> vValidationLayers = VkUtil::GetValidationLayers();
 
 	VkDeviceCreateInfo dciDeviceInfo = {
 		.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
-		.pNext = nullptr,
+		.pNext = &pdv12Features,
 		.flags = 0,
 		.queueCreateInfoCount = static_cast<uint32_t>(vQueueCreateInfos.size()),
 		.pQueueCreateInfos = vQueueCreateInfos.data(),
@@ -398,8 +505,10 @@ void PlatformRenderer::CreateLogicalDevice() {
 		throw std::runtime_error("ERROR: Failed to create logical device!");
 	}
 
-	vkGetDeviceQueue(m_dDeviceHandle, qfiIndices.m_u32GraphicsFamily.value(), 0, &m_qGraphicsQueue);
+	vkGetDeviceQueue(m_dDeviceHandle, m_u32GraphicsFamily, 0, &m_qGraphicsQueue);
 	vkGetDeviceQueue(m_dDeviceHandle, qfiIndices.m_u32PresentFamily.value(), 0, &m_qPresentQueue);
+	vkGetDeviceQueue(m_dDeviceHandle, m_u32TransferFamily, 0, &m_qTransferQueue);
+	vkGetDeviceQueue(m_dDeviceHandle, m_u32ComputeFamily, 0, &m_qComputeQueue);
 }
 
 void PlatformRenderer::CreateSwapChain() {
@@ -547,29 +656,37 @@ void PlatformRenderer::CreateRenderPass() {
 }
 
 void PlatformRenderer::CreateCommandPool() {
-	VkQueueFamilyIndices qfiIndices = VkUtil::GetQueueFamilies(m_pdPhysicalDevice);
-
 	VkCommandPoolCreateInfo cpciPoolCreateInfo = {
 		.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
 		.pNext = nullptr,
 		.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
-		.queueFamilyIndex = qfiIndices.m_u32GraphicsFamily.value()
+		.queueFamilyIndex = m_u32GraphicsFamily
 	};
 
 	if (vkCreateCommandPool(m_dDeviceHandle, &cpciPoolCreateInfo, nullptr, &m_cpCommandPool) != VK_SUCCESS) {
 		throw std::runtime_error("ERROR: Failed to create command pool!");
 	}
+
+	m_cpTransferCommandPool = m_cpCommandPool;
+
+	if (m_u32TransferFamily != m_u32GraphicsFamily) {
+		cpciPoolCreateInfo.queueFamilyIndex = m_u32TransferFamily;
+
+		if (vkCreateCommandPool(m_dDeviceHandle, &cpciPoolCreateInfo, nullptr, &m_cpTransferCommandPool) != VK_SUCCESS) {
+			throw std::runtime_error("ERROR: Failed to create transfer command pool!");
+		}
+	}
 }
 
 void PlatformRenderer::CreateDepthResources() {
 	VkFormat fDepthFormat = VkUtil::FindDepthFormat();
 
 	VkUtil::CreateImage(m_eExtent.width, m_eExtent.height, fDepthFormat, VK_IMAGE_TILING_OPTIMAL,
-		VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_iDepth, m_dmDepthMem);
+		VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_iDepth, m_mhDepthMem);
 
 	m_ivDepthView = VkUtil::CreateImageView(m_iDepth, fDepthFormat, VK_IMAGE_ASPECT_DEPTH_BIT);
 
-	VkUtil::TransitionImageLayout(m_iDepth, fDepthFormat, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
+	PlatformStaging::TransitionImage(m_iDepth, fDepthFormat, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
 }
 
 void PlatformRenderer::CreateFramebuffers() {
@@ -603,35 +720,17 @@ void PlatformRenderer::CreateTextureImage() {
 	int iWidth, iHeight, iChannels;
 	stbi_uc* pPixels = stbi_load("../../Assets/Textures/debug_fallback.png", &iWidth, &iHeight, &iChannels, STBI_rgb_alpha);
 
-	VkDeviceSize dsSize = static_cast<uint64_t>(iWidth) * static_cast<uint64_t>(iHeight) * 4U;
-
 	if (!pPixels) {
 		throw std::runtime_error("ERROR: Failed to load texture!");
 	}
 
-	VkBuffer bStagingBuffer;
-	VkDeviceMemory dmStagingMem;
-
-	PlatformBuffer::CreateBuffer(dsSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, HC_MEMORY_FLAGS, bStagingBuffer, dmStagingMem);
-
-	void* pvData;
-	vkMapMemory(m_dDeviceHandle, dmStagingMem, 0, dsSize, 0, &pvData);
-	memcpy(pvData, pPixels, static_cast<size_t>(dsSize));
-	vkUnmapMemory(m_dDeviceHandle, dmStagingMem);
-
-	stbi_image_free(pPixels);
-
 	VkUtil::CreateImage(iWidth, iHeight, VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
-		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, imgTexture, dmTextureMemory);
+		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, imgTexture, mhTextureMemory);
 
-	VkUtil::TransitionImageLayout(imgTexture, VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-	
-	VkUtil::CopyBufferToImage(bStagingBuffer, imgTexture, static_cast<uint32_t>(iWidth), static_cast<uint32_t>(iHeight));
+	//The pixels are copied into the staging ring before this returns, and reach the image with the next batch flushed
+	PlatformStaging::UploadImage(imgTexture, VK_FORMAT_R8G8B8A8_SRGB, static_cast<uint32_t>(iWidth), static_cast<uint32_t>(iHeight), 4U, pPixels);
 
-	VkUtil::TransitionImageLayout(imgTexture, VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-
-	vkDestroyBuffer(m_dDeviceHandle, bStagingBuffer, nullptr);
-	vkFreeMemory(m_dDeviceHandle, dmStagingMem, nullptr);
+	stbi_image_free(pPixels);
 }
 
 void PlatformRenderer::CreateTextureImageView() {
@@ -687,7 +786,6 @@ void PlatformRenderer::CreateCommandBuffer() {
 void PlatformRenderer::CreateSyncObjects() {
 	m_vImageAvailableSemaphores.resize(HC_MAX_FRAMES_IN_FLIGHT);
 	m_vRenderFinishedSemaphores.resize(HC_MAX_FRAMES_IN_FLIGHT);
-	m_vInFlightFences.resize(HC_MAX_FRAMES_IN_FLIGHT);
 
 	VkSemaphoreCreateInfo sciSemaphoreInfo = {
 		.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
@@ -695,27 +793,44 @@ void PlatformRenderer::CreateSyncObjects() {
 		.flags = 0
 	};
 
-	VkFenceCreateInfo fciFenceInfo = {
-		.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
-		.pNext = nullptr,
-		.flags = VK_FENCE_CREATE_SIGNALED_BIT
-	};
-
 	for (int ndx = 0; ndx < HC_MAX_FRAMES_IN_FLIGHT; ++ndx) {
 		if (vkCreateSemaphore(m_dDeviceHandle, &sciSemaphoreInfo, nullptr, &m_vImageAvailableSemaphores[ndx]) != VK_SUCCESS ||
-			vkCreateSemaphore(m_dDeviceHandle, &sciSemaphoreInfo, nullptr, &m_vRenderFinishedSemaphores[ndx]) != VK_SUCCESS ||
-			vkCreateFence(m_dDeviceHandle, &fciFenceInfo, nullptr, &m_vInFlightFences[ndx]) != VK_SUCCESS) {
+			vkCreateSemaphore(m_dDeviceHandle, &sciSemaphoreInfo, nullptr, &m_vRenderFinishedSemaphores[ndx]) != VK_SUCCESS) {
 			throw std::runtime_error("ERROR: Failed to create sync objects!");
 		}
 	}
 }
 
+void PlatformRenderer::CreateTimelineSemaphores() {
+	VkSemaphoreTypeCreateInfo stciTypeInfo = {
+		.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+		.pNext = nullptr,
+		.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE,
+		.initialValue = 0
+	};
+
+	VkSemaphoreCreateInfo sciSemaphoreInfo = {
+		.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+		.pNext = &stciTypeInfo,
+		.flags = 0
+	};
+
+	if (vkCreateSemaphore(m_dDeviceHandle, &sciSemaphoreInfo, nullptr, &m_sGraphicsTimeline) != VK_SUCCESS ||
+		vkCreateSemaphore(m_dDeviceHandle, &sciSemaphoreInfo, nullptr, &m_sTransferTimeline) != VK_SUCCESS) {
+		throw std::runtime_error("ERROR: Failed to create timeline semaphores!");
+	}
+
+	m_u64GraphicsValue = 0;
+	m_u64TransferValue = 0;
+	m_arrFrameValues.fill(0);
+}
+
 void PlatformRenderer::CleanupSwapchain() {
 	vkDestroyImageView(m_dDeviceHandle, m_ivDepthView, nullptr);
 
 	vkDestroyImage(m_dDeviceHandle, m_iDepth, nullptr);
 
-	vkFreeMemory(m_dDeviceHandle, m_dmDepthMem, nullptr);
+	PlatformMemory::Free(m_mhDepthMem);
 
 	for (auto aFramebuffer : m_vFramebuffers) {
 		vkDestroyFramebuffer(m_dDeviceHandle, aFramebuffer, nullptr);
@@ -731,7 +846,11 @@ void PlatformRenderer::CleanupSwapchain() {
 void PlatformRenderer::RecreateSwapchain() {
 	VkUtil::CheckWindowMinimized();
 
-	vkDeviceWaitIdle(m_dDeviceHandle);
+	PlatformStaging::Flush(); //The depth image about to be replaced may still have its transition recorded
+
+	//Only frames and presentation use the swapchain resources, so uploads on the transfer queue carry on meanwhile
+	WaitForValue(m_u64GraphicsValue);
+	vkQueueWaitIdle(m_qPresentQueue);
 
 	CleanupSwapchain();
 
@@ -744,4 +863,61 @@ void PlatformRenderer::RecreateSwapchain() {
 	CreateFramebuffers();
 
 	m_u32CurrentFrame = 0;
-}
\ No newline at end of file
+}
+
+uint64_t PlatformRenderer::GetCompletedValue() {
+	uint64_t u64Value = 0;
+
+	if (vkGetSemaphoreCounterValue(m_dDeviceHandle, m_sGraphicsTimeline, &u64Value) != VK_SUCCESS) {
+		throw std::runtime_error("ERROR: Failed to read the graphics timeline!");
+	}
+
+	return u64Value;
+}
+
+void PlatformRenderer::WaitForValue(uint64_t _u64Value) {
+	VkSemaphoreWaitInfo swiWaitInfo = {
+		.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+		.pNext = nullptr,
+		.flags = 0,
+		.semaphoreCount = 1,
+		.pSemaphores = &m_sGraphicsTimeline,
+		.pValues = &_u64Value
+	};
+
+	if (vkWaitSemaphores(m_dDeviceHandle, &swiWaitInfo, UINT64_MAX) != VK_SUCCESS) {
+		throw std::runtime_error("ERROR: Failed to wait on the graphics timeline!");
+	}
+}
+
+void PlatformRenderer::DeferDestroy(std::function<void()> _fnDestroy) {
+	//Outside a frame everything that could use the resource is already submitted once pending uploads are. Inside one, the frame itself may
+	//still use it, so it waits for the frame's value
+	if (!m_bRecordingFrame) {
+		PlatformStaging::Flush();
+	}
+
+	m_vDeferredDestroys.push_back({
+		.m_u64Value = m_bRecordingFrame ? UINT64_MAX : m_u64GraphicsValue,
+		.m_fnDestroy = std::move(_fnDestroy)
+	});
+}
+
+void PlatformRenderer::ProcessDeferredDestroys(bool _bAll) {
+	if (m_vDeferredDestroys.empty()) {
+		return;
+	}
+
+	const uint64_t u64Completed = _bAll ? 0 : GetCompletedValue();
+
+	//Destroy callbacks never queue more destroys, so the list can be walked in place
+	std::erase_if(m_vDeferredDestroys, [_bAll, u64Completed](VkDeferredDestroy& _ddDestroy) {
+		if (!_bAll && _ddDestroy.m_u64Value > u64Completed) {
+			return false;
+		}
+
+		_ddDestroy.m_fnDestroy();
+
+		return true;
+	});
+}
@@ -1,31 +1,49 @@
 #pragma once
 
 #include <Platform/GLCommon.hpp>
+#include <Platform/Vulkan/VkMemory.hpp>
 
 #include <HellfireControl/Math/Vector.hpp>
 
+#include <span>
+
+struct VkDeferredDestroy {
+	uint64_t m_u64Value; //Graphics timeline value that has to be reached first. UINT64_MAX until the frame being recorded is submitted
+	std::function<void()> m_fnDestroy;
+};
+
 class PlatformRenderer {
 	friend class PlatformBuffer;
+	friend class PlatformMemory;
 	friend class PlatformRenderContext;
+	friend class PlatformStaging;
 	friend class VkUtil;
 private:
 	static uint64_t						m_u64WindowHandle;
 	static uint32_t						m_u32CurrentFrame;
+	static uint32_t						m_u32ImageIndex;
+	static bool							m_bRecordingFrame;
 	static bool							m_bFramebufferResized;
 	static VkInstance					m_iInstance;
 	static VkPhysicalDevice				m_pdPhysicalDevice;
 	static VkDevice						m_dDeviceHandle;
 	static VkQueue						m_qGraphicsQueue;
 	static VkQueue						m_qPresentQueue;
+	static VkQueue						m_qTransferQueue;	//The graphics queue when the device has no dedicated transfer family
+	static VkQueue						m_qComputeQueue;	//The graphics queue when the device has no dedicated compute family
+	static uint32_t						m_u32GraphicsFamily;
+	static uint32_t						m_u32TransferFamily;
+	static uint32_t						m_u32ComputeFamily;
 	static VkSurfaceKHR					m_sSurface;
 	static VkSwapchainKHR				m_scSwapChain;
 	static VkRenderPass					m_rpRenderPass;
 	static VkDescriptorSetLayout		m_dslDescriptorSetLayout;
 	static VkCommandPool				m_cpCommandPool;
+	static VkCommandPool				m_cpTransferCommandPool; //Same as m_cpCommandPool without a dedicated transfer family
 	static VkDescriptorPool				m_dpDescriptorPool;
 	static VkSampler					m_sSampler;
 	static VkImage						m_iDepth;
-	static VkDeviceMemory				m_dmDepthMem;
+	static VkMemoryHandle				m_mhDepthMem;
 	static VkImageView					m_ivDepthView;
 	static VkFormat						m_fFormat;
 	static VkExtent2D					m_eExtent;
@@ -34,13 +52,18 @@ private:
 	static std::vector<VkDescriptorSet>	m_vDescriptorSets;
 	static std::vector<VkSemaphore>		m_vImageAvailableSemaphores;
 	static std::vector<VkSemaphore>		m_vRenderFinishedSemaphores;
-	static std::vector<VkFence>			m_vInFlightFences;
+	static VkSemaphore					m_sGraphicsTimeline;	//Signaled by every graphics queue submission with the next value
+	static VkSemaphore					m_sTransferTimeline;	//Signaled by every transfer queue submission with the next value
+	static uint64_t						m_u64GraphicsValue;		//Last value handed to a graphics queue submission
+	static uint64_t						m_u64TransferValue;
+	static std::array<uint64_t, HC_MAX_FRAMES_IN_FLIGHT> m_arrFrameValues;
+	static std::vector<VkDeferredDestroy> m_vDeferredDestroys;
 	static std::vector<VkImage>			m_vSwapchainImages;
 	static std::vector<VkImageView>		m_vSwapchainImageViews;
 	static std::vector<VkFramebuffer>	m_vFramebuffers;
 
 	static VkImage imgTexture; //SUPER TEMPORARY ! ! !
-	static VkDeviceMemory dmTextureMemory;
+	static VkMemoryHandle mhTextureMemory;
 	static VkImageView ivTextureView;
 
 	static void CreateInstance(const std::string& _strAppName, uint32_t _u32Version);
@@ -55,11 +78,19 @@ private:
 	static void CreateTextureSampler();
 	static void CreateCommandBuffer();
 	static void CreateSyncObjects();
+	static void CreateTimelineSemaphores();
 	static void CleanupSwapchain();
 	static void RecreateSwapchain();
 
 	static void CreateTextureImage();
 	static void CreateTextureImageView();
+
+	static void RecordDraws(uint32_t _u32ContextID, const std::span<const uint32_t>* _pDrawIndices); //nullptr records every draw
+
+	[[nodiscard]] static uint64_t GetCompletedValue();
+	static void WaitForValue(uint64_t _u64Value);
+	static void DeferDestroy(std::function<void()> _fnDestroy);
+	static void ProcessDeferredDestroys(bool _bAll);
 public:
 	/// <summary>
 	/// Initializes the renderer using the given parameters
@@ -86,6 +117,19 @@ public:
 	/// <param name="_u32ContextID: The render context to draw from"></param>
 	static void Draw(uint32_t _u32ContextID);
 
+	/// <summary>
+	/// Submits only the listed draws of the given render context, such as the survivors of frustum culling
+	/// </summary>
+	/// <param name="_u32ContextID: The render context to draw from"></param>
+	/// <param name="_vDrawIndices: Indices of the vertex/index buffer pairs to draw, in the order they were created within the context"></param>
+	static void Draw(uint32_t _u32ContextID, std::span<const uint32_t> _vDrawIndices);
+
+	/// <summary>
+	/// Returns the number of vertex/index buffer pairs in the given render context
+	/// </summary>
+	/// <param name="_u32ContextID: The render context to count"></param>
+	[[nodiscard]] static uint32_t GetDrawCount(uint32_t _u32ContextID);
+
 	/// <summary>
 	/// Closes out the current render pass and posts the image to the screen
 	/// </summary>
@@ -0,0 +1,444 @@
+#include <Platform/Vulkan/VkStaging.hpp>
+#include <Platform/Vulkan/VkBuffer.hpp>
+#include <Platform/Vulkan/VkRenderer.hpp>
+#include <Platform/Vulkan/VkUtil.hpp>
+
+#include <cstring>
+
+#pragma region Static Member Declarations
+
+VkBuffer PlatformStaging::m_bRing = VK_NULL_HANDLE;
+VkMemoryHandle PlatformStaging::m_mhRing = HC_VK_NULL_MEMORY;
+uint8_t* PlatformStaging::m_pRing = nullptr;
+VkDeviceSize PlatformStaging::m_dsHead = 0;
+uint32_t PlatformStaging::m_u32Recording = 0;
+bool PlatformStaging::m_bRecording = false;
+VkUploadTicket PlatformStaging::m_utLastTicket = 0;
+bool PlatformStaging::m_bOwnershipTransfer = false;
+std::array<PlatformStaging::VkStagingSubmission, HC_VK_STAGING_SUBMISSIONS> PlatformStaging::m_arrSubmissions = {};
+std::map<VkBuffer, VkPipelineStageFlags> PlatformStaging::m_mUploaded = {};
+#pragma endregion
+
+void PlatformStaging::InitStaging() {
+	PlatformBuffer::CreateBuffer(HC_VK_STAGING_RING_SIZE, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, HC_MEMORY_FLAGS, m_bRing, m_mhRing);
+
+	m_pRing = static_cast<uint8_t*>(PlatformMemory::GetAllocation(m_mhRing).m_pMapped);
+
+	m_bOwnershipTransfer = PlatformRenderer::m_u32TransferFamily != PlatformRenderer::m_u32GraphicsFamily;
+
+	std::array<VkCommandBuffer, HC_VK_STAGING_SUBMISSIONS> arrCommandBuffers = {};
+	std::array<VkCommandBuffer, HC_VK_STAGING_SUBMISSIONS> arrAcquireBuffers = {};
+
+	VkCommandBufferAllocateInfo cbaiBufferInfo = {
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+		.pNext = nullptr,
+		.commandPool = PlatformRenderer::m_cpTransferCommandPool,
+		.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+		.commandBufferCount = HC_VK_STAGING_SUBMISSIONS
+	};
+
+	if (vkAllocateCommandBuffers(PlatformRenderer::m_dDeviceHandle, &cbaiBufferInfo, arrCommandBuffers.data()) != VK_SUCCESS) {
+		throw std::runtime_error("ERROR: Failed to allocate staging command buffers!");
+	}
+
+	if (m_bOwnershipTransfer) {
+		cbaiBufferInfo.commandPool = PlatformRenderer::m_cpCommandPool;
+
+		if (vkAllocateCommandBuffers(PlatformRenderer::m_dDeviceHandle, &cbaiBufferInfo, arrAcquireBuffers.data()) != VK_SUCCESS) {
+			throw std::runtime_error("ERROR: Failed to allocate staging command buffers!");
+		}
+	}
+	else {
+		arrAcquireBuffers = arrCommandBuffers;
+	}
+
+	for (int ndx = 0; ndx < HC_VK_STAGING_SUBMISSIONS; ++ndx) {
+		m_arrSubmissions[ndx] = {
+			.m_cbCommands = arrCommandBuffers[ndx],
+			.m_cbAcquire = arrAcquireBuffers[ndx]
+		};
+	}
+
+	m_dsHead = 0;
+	m_u32Recording = 0;
+	m_bRecording = false;
+}
+
+void PlatformStaging::CleanupStaging() {
+	Flush();
+
+	Wait(m_utLastTicket);
+
+	for (auto& aSubmission : m_arrSubmissions) {
+		vkFreeCommandBuffers(PlatformRenderer::m_dDeviceHandle, PlatformRenderer::m_cpTransferCommandPool, 1, &aSubmission.m_cbCommands);
+
+		if (m_bOwnershipTransfer) {
+			vkFreeCommandBuffers(PlatformRenderer::m_dDeviceHandle, PlatformRenderer::m_cpCommandPool, 1, &aSubmission.m_cbAcquire);
+		}
+
+		aSubmission = {};
+	}
+
+	vkDestroyBuffer(PlatformRenderer::m_dDeviceHandle, m_bRing, nullptr);
+	PlatformMemory::Free(m_mhRing);
+
+	m_bRing = VK_NULL_HANDLE;
+	m_mhRing = HC_VK_NULL_MEMORY;
+	m_pRing = nullptr;
+
+	m_mUploaded.clear();
+}
+
+VkUploadTicket PlatformStaging::Upload(VkBuffer _bDestination, VkDeviceSize _dsOffset, const void* _pData, VkDeviceSize _dsSize, VkPipelineStageFlags _psfDstStage, VkAccessFlags _afDstAccess) {
+	const uint8_t* pSource = static_cast<const uint8_t*>(_pData);
+	const auto aPrevious = m_mUploaded.find(_bDestination);
+
+	//The graphics family owns the buffer after its first upload, and would have to release it to the transfer family before another copy
+	assert(!m_bOwnershipTransfer || aPrevious == m_mUploaded.end());
+
+	if (aPrevious != m_mUploaded.end()) {
+		//Reads of the old contents by work already on the queue have to finish before the copy overwrites them
+		vkCmdPipelineBarrier(BeginBatch(), aPrevious->second, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 0, nullptr);
+	}
+
+	m_mUploaded[_bDestination] = _psfDstStage;
+
+	while (_dsSize != 0) {
+		//Chunks of half the ring let one chunk be copied on the GPU while the next is written
+		const VkDeviceSize dsChunk = std::min<VkDeviceSize>(_dsSize, HC_VK_STAGING_RING_SIZE / 2);
+		const VkDeviceSize dsRingOffset = Reserve(dsChunk);
+
+		memcpy(m_pRing + dsRingOffset, pSource, static_cast<size_t>(dsChunk));
+
+		VkBufferCopy bcCopyRegion = {
+			.srcOffset = dsRingOffset,
+			.dstOffset = _dsOffset,
+			.size = dsChunk
+		};
+
+		VkStagingSubmission& ssBatch = m_arrSubmissions[m_u32Recording];
+
+		vkCmdCopyBuffer(ssBatch.m_cbCommands, m_bRing, _bDestination, 1, &bcCopyRegion);
+
+		if (m_bOwnershipTransfer) {
+			VkUtil::ReleaseBuffer(ssBatch.m_cbCommands, _bDestination, _dsOffset, dsChunk, PlatformRenderer::m_u32TransferFamily, PlatformRenderer::m_u32GraphicsFamily,
+				VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT);
+			VkUtil::AcquireBuffer(ssBatch.m_cbAcquire, _bDestination, _dsOffset, dsChunk, PlatformRenderer::m_u32TransferFamily, PlatformRenderer::m_u32GraphicsFamily,
+				_psfDstStage, _afDstAccess);
+		}
+
+		ssBatch.m_psfDstStages |= _psfDstStage;
+		ssBatch.m_afDstAccess |= _afDstAccess;
+
+		pSource += dsChunk;
+		_dsOffset += dsChunk;
+		_dsSize -= dsChunk;
+	}
+
+	return m_utLastTicket;
+}
+
+VkUploadTicket PlatformStaging::UploadImage(VkImage _iImage, VkFormat _fFormat, uint32_t _u32Width, uint32_t _u32Height, uint32_t _u32TexelSize, const void* _pData) {
+	const uint8_t* pSource = static_cast<const uint8_t*>(_pData);
+	const VkDeviceSize dsRowSize = static_cast<VkDeviceSize>(_u32Width) * _u32TexelSize;
+
+	assert(dsRowSize <= HC_VK_STAGING_RING_SIZE / 2);
+
+	//Recorded alongside the copies, on whichever queue runs them
+	VkUtil::TransitionImageLayout(BeginBatch(), _iImage, _fFormat, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+	//Whole rows are copied at a time, so each chunk is a band of the image
+	const uint32_t u32ChunkRows = static_cast<uint32_t>((HC_VK_STAGING_RING_SIZE / 2) / dsRowSize);
+
+	for (uint32_t u32Row = 0; u32Row < _u32Height; u32Row += u32ChunkRows) {
+		const uint32_t u32Rows = std::min(u32ChunkRows, _u32Height - u32Row);
+		const VkDeviceSize dsChunk = dsRowSize * u32Rows;
+		const VkDeviceSize dsRingOffset = Reserve(dsChunk);
+
+		memcpy(m_pRing + dsRingOffset, pSource, static_cast<size_t>(dsChunk));
+
+		VkUtil::CopyBufferToImage(m_arrSubmissions[m_u32Recording].m_cbCommands, m_bRing, dsRingOffset, _iImage, _u32Width, u32Row, u32Rows);
+
+		pSource += dsChunk;
+	}
+
+	if (!m_bOwnershipTransfer) {
+		return TransitionImage(_iImage, _fFormat, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+	}
+
+	//The move to the shader read layout happens as part of the ownership transfer
+	VkStagingSubmission& ssBatch = m_arrSubmissions[m_u32Recording];
+
+	VkUtil::ReleaseImage(ssBatch.m_cbCommands, _iImage, _fFormat, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+		PlatformRenderer::m_u32TransferFamily, PlatformRenderer::m_u32GraphicsFamily, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT);
+	VkUtil::AcquireImage(ssBatch.m_cbAcquire, _iImage, _fFormat, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+		PlatformRenderer::m_u32TransferFamily, PlatformRenderer::m_u32GraphicsFamily, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT);
+
+	return m_utLastTicket;
+}
+
+VkUploadTicket PlatformStaging::TransitionImage(VkImage _iImage, VkFormat _fFormat, VkImageLayout _ilLayoutOld, VkImageLayout _ilLayoutNew) {
+	BeginBatch();
+
+	VkUtil::TransitionImageLayout(m_arrSubmissions[m_u32Recording].m_cbAcquire, _iImage, _fFormat, _ilLayoutOld, _ilLayoutNew);
+
+	return m_utLastTicket;
+}
+
+void PlatformStaging::Flush() {
+	if (!m_bRecording) {
+		return;
+	}
+
+	VkStagingSubmission& ssBatch = m_arrSubmissions[m_u32Recording];
+
+	if (m_bOwnershipTransfer) {
+		if (vkEndCommandBuffer(ssBatch.m_cbCommands) != VK_SUCCESS) {
+			throw std::runtime_error("ERROR: Failed to record staging command buffer!");
+		}
+
+		const uint64_t u64TransferValue = ++PlatformRenderer::m_u64TransferValue;
+
+		VkTimelineSemaphoreSubmitInfo tssiTransferTimeline = {
+			.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+			.pNext = nullptr,
+			.waitSemaphoreValueCount = 0,
+			.pWaitSemaphoreValues = nullptr,
+			.signalSemaphoreValueCount = 1,
+			.pSignalSemaphoreValues = &u64TransferValue
+		};
+
+		VkSubmitInfo siTransferInfo = {
+			.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+			.pNext = &tssiTransferTimeline,
+			.waitSemaphoreCount = 0,
+			.pWaitSemaphores = nullptr,
+			.pWaitDstStageMask = nullptr,
+			.commandBufferCount = 1,
+			.pCommandBuffers = &ssBatch.m_cbCommands,
+			.signalSemaphoreCount = 1,
+			.pSignalSemaphores = &PlatformRenderer::m_sTransferTimeline
+		};
+
+		if (vkQueueSubmit(PlatformRenderer::m_qTransferQueue, 1, &siTransferInfo, VK_NULL_HANDLE) != VK_SUCCESS) {
+			throw std::runtime_error("ERROR: Failed to submit staging command buffer!");
+		}
+	}
+	else if (ssBatch.m_psfDstStages != 0) {
+		//Later submissions on the queue read the copied data in the stages the uploads asked for. With a transfer queue, the acquires cover this
+		VkMemoryBarrier mbBarrier = {
+			.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+			.pNext = nullptr,
+			.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+			.dstAccessMask = ssBatch.m_afDstAccess
+		};
+
+		vkCmdPipelineBarrier(ssBatch.m_cbCommands, VK_PIPELINE_STAGE_TRANSFER_BIT, ssBatch.m_psfDstStages, 0, 1, &mbBarrier, 0, nullptr, 0, nullptr);
+	}
+
+	if (vkEndCommandBuffer(ssBatch.m_cbAcquire) != VK_SUCCESS) {
+		throw std::runtime_error("ERROR: Failed to record staging command buffer!");
+	}
+
+	//Completion is tracked on the graphics timeline, which can't pass this batch before the transfer submission it waits on
+	VkPipelineStageFlags psfWaitStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+	const uint64_t u64WaitValue = PlatformRenderer::m_u64TransferValue;
+
+	ssBatch.m_u64Value = ++PlatformRenderer::m_u64GraphicsValue;
+
+	VkTimelineSemaphoreSubmitInfo tssiGraphicsTimeline = {
+		.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+		.pNext = nullptr,
+		.waitSemaphoreValueCount = m_bOwnershipTransfer ? 1U : 0U,
+		.pWaitSemaphoreValues = &u64WaitValue,
+		.signalSemaphoreValueCount = 1,
+		.pSignalSemaphoreValues = &ssBatch.m_u64Value
+	};
+
+	VkSubmitInfo siSubmitInfo = {
+		.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		.pNext = &tssiGraphicsTimeline,
+		.waitSemaphoreCount = m_bOwnershipTransfer ? 1U : 0U,
+		.pWaitSemaphores = &PlatformRenderer::m_sTransferTimeline,
+		.pWaitDstStageMask = &psfWaitStage,
+		.commandBufferCount = 1,
+		.pCommandBuffers = &ssBatch.m_cbAcquire,
+		.signalSemaphoreCount = 1,
+		.pSignalSemaphores = &PlatformRenderer::m_sGraphicsTimeline
+	};
+
+	if (vkQueueSubmit(PlatformRenderer::m_qGraphicsQueue, 1, &siSubmitInfo, VK_NULL_HANDLE) != VK_SUCCESS) {
+		throw std::runtime_error("ERROR: Failed to submit staging command buffer!");
+	}
+
+	ssBatch.m_bPending = true;
+
+	m_bRecording = false;
+	m_u32Recording = (m_u32Recording + 1) % HC_VK_STAGING_SUBMISSIONS;
+}
+
+VkCommandBuffer PlatformStaging::BeginBatch() {
+	VkStagingSubmission& ssBatch = m_arrSubmissions[m_u32Recording];
+
+	if (m_bRecording) {
+		return ssBatch.m_cbCommands;
+	}
+
+	//Every batch is in flight. The one being reused is the oldest of them
+	if (ssBatch.m_bPending) {
+		PlatformRenderer::WaitForValue(ssBatch.m_u64Value);
+
+		ssBatch.m_bPending = false;
+	}
+
+	VkCommandBufferBeginInfo cbbiBeginInfo = {
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+		.pNext = nullptr,
+		.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+		.pInheritanceInfo = nullptr
+	};
+
+	vkResetCommandBuffer(ssBatch.m_cbCommands, 0);
+
+	if (vkBeginCommandBuffer(ssBatch.m_cbCommands, &cbbiBeginInfo) != VK_SUCCESS) {
+		throw std::runtime_error("ERROR: Failed to begin recording a staging command buffer!");
+	}
+
+	if (m_bOwnershipTransfer) {
+		vkResetCommandBuffer(ssBatch.m_cbAcquire, 0);
+
+		if (vkBeginCommandBuffer(ssBatch.m_cbAcquire, &cbbiBeginInfo) != VK_SUCCESS) {
+			throw std::runtime_error("ERROR: Failed to begin recording a staging command buffer!");
+		}
+	}
+
+	ssBatch.m_dsBegin = m_dsHead;
+	ssBatch.m_dsEnd = m_dsHead;
+	ssBatch.m_utTicket = ++m_utLastTicket;
+	ssBatch.m_psfDstStages = 0;
+	ssBatch.m_afDstAccess = 0;
+
+	m_bRecording = true;
+
+	return ssBatch.m_cbCommands;
+}
+
+VkDeviceSize PlatformStaging::Reserve(VkDeviceSize _dsSize) {
+	const VkDeviceSize dsSize = (_dsSize + HC_VK_STAGING_ALIGNMENT - 1) & ~(HC_VK_STAGING_ALIGNMENT - 1);
+
+	assert(dsSize <= HC_VK_STAGING_RING_SIZE);
+
+	while (true) {
+		Retire(false);
+
+		VkDeviceSize dsOffset = m_dsHead;
+
+		//Each batch reads one unbroken range, so a batch that would wrap is sent off first
+		if (dsOffset + dsSize > HC_VK_STAGING_RING_SIZE) {
+			Flush();
+
+			dsOffset = 0;
+		}
+
+		if (!Overlaps(dsOffset, dsOffset + dsSize)) {
+			m_dsHead = dsOffset;
+
+			break;
+		}
+
+		//The ring is full of copies the GPU hasn't made yet
+		Flush();
+		Retire(true);
+	}
+
+	BeginBatch();
+
+	m_dsHead += dsSize;
+	m_arrSubmissions[m_u32Recording].m_dsEnd = m_dsHead;
+
+	return m_dsHead - dsSize;
+}
+
+bool PlatformStaging::Overlaps(VkDeviceSize _dsBegin, VkDeviceSize _dsEnd) {
+	for (uint32_t ndx = 0; ndx < HC_VK_STAGING_SUBMISSIONS; ++ndx) {
+		const VkStagingSubmission& ssBatch = m_arrSubmissions[ndx];
+
+		if (IsLive(ndx) && _dsBegin < ssBatch.m_dsEnd && ssBatch.m_dsBegin < _dsEnd) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void PlatformStaging::Retire(bool _bWaitForOldest) {
+	uint64_t u64Completed = PlatformRenderer::GetCompletedValue();
+
+	//Batches are submitted in order, so the oldest one still in flight has the lowest value
+	if (_bWaitForOldest) {
+		uint64_t u64Oldest = UINT64_MAX;
+
+		for (const auto& aSubmission : m_arrSubmissions) {
+			if (aSubmission.m_bPending) {
+				u64Oldest = std::min(u64Oldest, aSubmission.m_u64Value);
+			}
+		}
+
+		if (u64Oldest != UINT64_MAX && u64Oldest > u64Completed) {
+			PlatformRenderer::WaitForValue(u64Oldest);
+
+			u64Completed = u64Oldest;
+		}
+	}
+
+	for (auto& aSubmission : m_arrSubmissions) {
+		if (aSubmission.m_bPending && aSubmission.m_u64Value <= u64Completed) {
+			aSubmission.m_bPending = false;
+		}
+	}
+}
+
+bool PlatformStaging::IsLive(uint32_t _u32Batch) {
+	return m_arrSubmissions[_u32Batch].m_bPending || (m_bRecording && _u32Batch == m_u32Recording);
+}
+
+void PlatformStaging::ForgetBuffer(VkBuffer _bBuffer) {
+	m_mUploaded.erase(_bBuffer);
+}
+
+bool PlatformStaging::IsComplete(VkUploadTicket _utTicket) {
+	Retire(false);
+
+	for (uint32_t ndx = 0; ndx < HC_VK_STAGING_SUBMISSIONS; ++ndx) {
+		if (IsLive(ndx) && m_arrSubmissions[ndx].m_utTicket <= _utTicket) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void PlatformStaging::Wait(VkUploadTicket _utTicket) {
+	if (m_bRecording && m_arrSubmissions[m_u32Recording].m_utTicket <= _utTicket) {
+		Flush();
+	}
+
+	//Waiting on the newest matching batch covers every one before it
+	uint64_t u64Value = 0;
+
+	for (const auto& aSubmission : m_arrSubmissions) {
+		if (aSubmission.m_bPending && aSubmission.m_utTicket <= _utTicket) {
+			u64Value = std::max(u64Value, aSubmission.m_u64Value);
+		}
+	}
+
+	if (u64Value != 0) {
+		PlatformRenderer::WaitForValue(u64Value);
+	}
+
+	for (auto& aSubmission : m_arrSubmissions) {
+		if (aSubmission.m_bPending && aSubmission.m_u64Value <= u64Value) {
+			aSubmission.m_bPending = false;
+		}
+	}
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <Platform/GLCommon.hpp>
+
+#include <Platform/Vulkan/VkMemory.hpp>
+
+#define HC_VK_STAGING_RING_SIZE (32ULL * 1024ULL * 1024ULL)	//Persistently mapped upload space shared by every staged copy
+#define HC_VK_STAGING_SUBMISSIONS 8							//Batches of copies that can be in flight at once before the oldest is waited on
+#define HC_VK_STAGING_ALIGNMENT 16ULL
+
+typedef uint64_t VkUploadTicket; //Identifies the batch an upload was recorded into. Batches finish in the order they're recorded
+
+class PlatformStaging {
+	friend class PlatformRenderer;
+	friend class PlatformBuffer;
+	friend class PlatformRenderContext;
+private:
+	struct VkStagingSubmission {
+		VkCommandBuffer m_cbCommands = VK_NULL_HANDLE;	//Copies, on the transfer family
+		VkCommandBuffer m_cbAcquire = VK_NULL_HANDLE;	//Acquires and graphics only transitions, on the graphics family. Same as m_cbCommands without a transfer queue
+		uint64_t m_u64Value = 0; //Graphics timeline value the batch signals once its copies and acquires are done
+
+		VkPipelineStageFlags m_psfDstStages = 0; //Every stage and access the batch's buffer uploads are read with
+		VkAccessFlags m_afDstAccess = 0;
+
+		VkDeviceSize m_dsBegin = 0; //Range of the ring this batch copies out of
+		VkDeviceSize m_dsEnd = 0;
+
+		VkUploadTicket m_utTicket = 0;
+
+		bool m_bPending = false; //Submitted and not yet known to be finished
+	};
+
+	static VkBuffer									m_bRing;
+	static VkMemoryHandle							m_mhRing;
+	static uint8_t*									m_pRing;
+	static VkDeviceSize								m_dsHead;
+	static uint32_t									m_u32Recording; //Batch taking new copies
+	static bool										m_bRecording;
+	static VkUploadTicket							m_utLastTicket; //Ticket of the newest batch, recording or not
+	static bool										m_bOwnershipTransfer; //Copies run on a dedicated transfer queue, and are handed to the graphics family
+	static std::array<VkStagingSubmission, HC_VK_STAGING_SUBMISSIONS> m_arrSubmissions;
+	static std::map<VkBuffer, VkPipelineStageFlags>	m_mUploaded; //Buffers that have been uploaded to, and the stages their previous contents are read in
+
+	static void InitStaging();
+
+	static void CleanupStaging();
+
+	static VkCommandBuffer BeginBatch();
+
+	static VkDeviceSize Reserve(VkDeviceSize _dsSize);
+
+	static bool Overlaps(VkDeviceSize _dsBegin, VkDeviceSize _dsEnd);
+
+	static void Retire(bool _bWaitForOldest);
+
+	static bool IsLive(uint32_t _u32Batch);
+
+	static void ForgetBuffer(VkBuffer _bBuffer);
+public:
+	/// <summary>
+	/// Copies _dsSize bytes into _bDestination at _dsOffset through the staging ring. The copy is recorded into the current batch and
+	/// happens on the GPU once the batch is flushed, which the renderer does before every frame it submits.
+	/// Uploads larger than the ring are split into several batches.
+	/// With a dedicated transfer queue, ownership of the copied range is handed to the graphics family by the batch, and only a buffer's first
+	/// upload may go through it. Without one, a buffer may be uploaded to again, and the copy waits for earlier reads of it to finish.
+	/// </summary>
+	/// <param name="_bDestination: Buffer created with VK_BUFFER_USAGE_TRANSFER_DST_BIT"></param>
+	/// <param name="_dsOffset: Byte offset into the destination"></param>
+	/// <param name="_pData: Source data, which may be released as soon as this returns"></param>
+	/// <param name="_dsSize: Number of bytes to copy"></param>
+	/// <param name="_psfDstStage: Pipeline stages the graphics queue reads the uploaded data in"></param>
+	/// <param name="_afDstAccess: Accesses the graphics queue reads the uploaded data with"></param>
+	/// <returns>
+	/// VkUploadTicket: Can be polled with IsComplete or waited on with Wait
+	/// </returns>
+	static VkUploadTicket Upload(VkBuffer _bDestination, VkDeviceSize _dsOffset, const void* _pData, VkDeviceSize _dsSize, VkPipelineStageFlags _psfDstStage, VkAccessFlags _afDstAccess);
+
+	/// <summary>
+	/// Fills every texel of a freshly created image through the staging ring, leaving it in VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL.
+	/// Images larger than the ring are copied a band of rows at a time.
+	/// </summary>
+	/// <param name="_iImage: Image created with VK_IMAGE_USAGE_TRANSFER_DST_BIT, in VK_IMAGE_LAYOUT_UNDEFINED"></param>
+	/// <param name="_fFormat: Format the image was created with"></param>
+	/// <param name="_u32Width: Width of the image in texels"></param>
+	/// <param name="_u32Height: Height of the image in texels"></param>
+	/// <param name="_u32TexelSize: Size of one texel in bytes"></param>
+	/// <param name="_pData: Tightly packed rows of texels, which may be released as soon as this returns"></param>
+	/// <returns>
+	/// VkUploadTicket: Can be polled with IsComplete or waited on with Wait
+	/// </returns>
+	static VkUploadTicket UploadImage(VkImage _iImage, VkFormat _fFormat, uint32_t _u32Width, uint32_t _u32Height, uint32_t _u32TexelSize, const void* _pData);
+
+	/// <summary>
+	/// Records an image layout transition into the current batch, so it's ordered with the uploads around it. Transitions always run on the
+	/// graphics queue, after the batch's copies.
+	/// </summary>
+	/// <param name="_iImage: The image to transition"></param>
+	/// <param name="_fFormat: Format the image was created with"></param>
+	/// <param name="_ilLayoutOld: Current layout of the image"></param>
+	/// <param name="_ilLayoutNew: Layout to move the image to"></param>
+	/// <returns>
+	/// VkUploadTicket: Can be polled with IsComplete or waited on with Wait
+	/// </returns>
+	static VkUploadTicket TransitionImage(VkImage _iImage, VkFormat _fFormat, VkImageLayout _ilLayoutOld, VkImageLayout _ilLayoutNew);
+
+	/// <summary>
+	/// Submits every copy and transition recorded since the last flush. With a dedicated transfer queue the copies are submitted there, and the
+	/// graphics queue waits on them before acquiring ownership. Anything submitted to the graphics queue afterwards sees uploaded buffers
+	/// in the stages given to Upload, and uploaded images in its fragment shaders.
+	/// </summary>
+	static void Flush();
+
+	/// <summary>
+	/// Checks whether the GPU has finished the batch holding the given ticket without blocking. A ticket still being recorded is never complete.
+	/// </summary>
+	/// <param name="_utTicket: Ticket returned by an upload"></param>
+	[[nodiscard]] static bool IsComplete(VkUploadTicket _utTicket);
+
+	/// <summary>
+	/// Blocks until the GPU has finished the batch holding the given ticket, and every batch before it. Flushes the batch first if it's still recording.
+	/// </summary>
+	/// <param name="_utTicket: Ticket returned by an upload"></param>
+	static void Wait(VkUploadTicket _utTicket);
+};
@@ -0,0 +1,233 @@
+#include <Platform/Vulkan/VkTLSF.hpp>
+
+#include <bit>
+
+TLSFAllocator::TLSFAllocator(uint64_t _u64Size) {
+	m_u64Size = _u64Size & ~(HC_TLSF_MIN_ALIGNMENT - 1);
+	m_arrFreeHeads.fill(HC_TLSF_INVALID_NODE);
+
+	if (m_u64Size != 0) {
+		InsertFree(CreateNode(0, m_u64Size));
+	}
+}
+
+uint32_t TLSFAllocator::Allocate(uint64_t _u64Size, uint64_t _u64Alignment, uint64_t& _u64Offset) {
+	const uint64_t u64Alignment = std::max<uint64_t>(_u64Alignment, HC_TLSF_MIN_ALIGNMENT);
+	const uint64_t u64Size = (std::max<uint64_t>(_u64Size, HC_TLSF_MIN_ALIGNMENT) + HC_TLSF_MIN_ALIGNMENT - 1) & ~(HC_TLSF_MIN_ALIGNMENT - 1);
+
+	if (u64Size > m_u64Size) {
+		return HC_TLSF_INVALID_NODE;
+	}
+
+	//Ranges always start on the minimum alignment, so only a larger alignment can cost padding
+	const uint32_t u32Node = FindFree(u64Size + (u64Alignment - HC_TLSF_MIN_ALIGNMENT));
+
+	if (u32Node == HC_TLSF_INVALID_NODE) {
+		return HC_TLSF_INVALID_NODE;
+	}
+
+	RemoveFree(u32Node);
+
+	const uint64_t u64Padding = ((m_vNodes[u32Node].m_u64Offset + u64Alignment - 1) & ~(u64Alignment - 1)) - m_vNodes[u32Node].m_u64Offset;
+
+	//The range before a free node is never free, so padding becomes a free node of its own
+	if (u64Padding != 0) {
+		const uint32_t u32Padding = CreateNode(m_vNodes[u32Node].m_u64Offset, u64Padding);
+
+		m_vNodes[u32Padding].m_u32PrevPhysical = m_vNodes[u32Node].m_u32PrevPhysical;
+		m_vNodes[u32Padding].m_u32NextPhysical = u32Node;
+
+		if (m_vNodes[u32Node].m_u32PrevPhysical != HC_TLSF_INVALID_NODE) { m_vNodes[m_vNodes[u32Node].m_u32PrevPhysical].m_u32NextPhysical = u32Padding; }
+
+		m_vNodes[u32Node].m_u32PrevPhysical = u32Padding;
+		m_vNodes[u32Node].m_u64Offset += u64Padding;
+		m_vNodes[u32Node].m_u64Size -= u64Padding;
+
+		InsertFree(u32Padding);
+	}
+
+	//Hand back whatever is left past the end
+	if (m_vNodes[u32Node].m_u64Size - u64Size >= HC_TLSF_MIN_ALIGNMENT) {
+		const uint32_t u32Remainder = CreateNode(m_vNodes[u32Node].m_u64Offset + u64Size, m_vNodes[u32Node].m_u64Size - u64Size);
+
+		m_vNodes[u32Remainder].m_u32PrevPhysical = u32Node;
+		m_vNodes[u32Remainder].m_u32NextPhysical = m_vNodes[u32Node].m_u32NextPhysical;
+
+		if (m_vNodes[u32Node].m_u32NextPhysical != HC_TLSF_INVALID_NODE) { m_vNodes[m_vNodes[u32Node].m_u32NextPhysical].m_u32PrevPhysical = u32Remainder; }
+
+		m_vNodes[u32Node].m_u32NextPhysical = u32Remainder;
+		m_vNodes[u32Node].m_u64Size = u64Size;
+
+		InsertFree(u32Remainder);
+	}
+
+	m_vNodes[u32Node].m_bFree = false;
+	m_u64Used += m_vNodes[u32Node].m_u64Size;
+	++m_u32AllocationCount;
+
+	_u64Offset = m_vNodes[u32Node].m_u64Offset;
+
+	return u32Node;
+}
+
+void TLSFAllocator::Free(uint32_t _u32Node) {
+	assert(_u32Node < m_vNodes.size() && !m_vNodes[_u32Node].m_bFree);
+
+	m_u64Used -= m_vNodes[_u32Node].m_u64Size;
+	--m_u32AllocationCount;
+
+	uint32_t u32Node = _u32Node;
+
+	//Absorb a free range before this one
+	const uint32_t u32Prev = m_vNodes[u32Node].m_u32PrevPhysical;
+
+	if (u32Prev != HC_TLSF_INVALID_NODE && m_vNodes[u32Prev].m_bFree) {
+		RemoveFree(u32Prev);
+
+		m_vNodes[u32Prev].m_u64Size += m_vNodes[u32Node].m_u64Size;
+		m_vNodes[u32Prev].m_u32NextPhysical = m_vNodes[u32Node].m_u32NextPhysical;
+
+		if (m_vNodes[u32Node].m_u32NextPhysical != HC_TLSF_INVALID_NODE) { m_vNodes[m_vNodes[u32Node].m_u32NextPhysical].m_u32PrevPhysical = u32Prev; }
+
+		ReleaseNode(u32Node);
+		u32Node = u32Prev;
+	}
+
+	//And one after it
+	const uint32_t u32Next = m_vNodes[u32Node].m_u32NextPhysical;
+
+	if (u32Next != HC_TLSF_INVALID_NODE && m_vNodes[u32Next].m_bFree) {
+		RemoveFree(u32Next);
+
+		m_vNodes[u32Node].m_u64Size += m_vNodes[u32Next].m_u64Size;
+		m_vNodes[u32Node].m_u32NextPhysical = m_vNodes[u32Next].m_u32NextPhysical;
+
+		if (m_vNodes[u32Next].m_u32NextPhysical != HC_TLSF_INVALID_NODE) { m_vNodes[m_vNodes[u32Next].m_u32NextPhysical].m_u32PrevPhysical = u32Node; }
+
+		ReleaseNode(u32Next);
+	}
+
+	InsertFree(u32Node);
+}
+
+uint64_t TLSFAllocator::GetLargestFree() const {
+	if (m_u64FLBitmap == 0) {
+		return 0;
+	}
+
+	const uint32_t u32FL = 63U - std::countl_zero(m_u64FLBitmap);
+	const uint32_t u32SL = 31U - std::countl_zero(m_arrSLBitmaps[u32FL]);
+	uint64_t u64Largest = 0;
+
+	//Only the top size class can hold the largest range, but its members still differ in size
+	for (uint32_t u32Node = m_arrFreeHeads[u32FL * HC_TLSF_SL_COUNT + u32SL]; u32Node != HC_TLSF_INVALID_NODE; u32Node = m_vNodes[u32Node].m_u32NextFree) {
+		u64Largest = std::max(u64Largest, m_vNodes[u32Node].m_u64Size);
+	}
+
+	return u64Largest;
+}
+
+void TLSFAllocator::GetAllocatedNodes(std::vector<uint32_t>& _vNodes) const {
+	_vNodes.clear();
+
+	if (m_vNodes.empty()) {
+		return;
+	}
+
+	//Node 0 is created for the whole block at offset 0 and can only ever be merged into, never released
+	for (uint32_t u32Node = 0; u32Node != HC_TLSF_INVALID_NODE; u32Node = m_vNodes[u32Node].m_u32NextPhysical) {
+		if (!m_vNodes[u32Node].m_bFree) { _vNodes.push_back(u32Node); }
+	}
+}
+
+void TLSFAllocator::MapSize(uint64_t _u64Size, uint32_t& _u32FL, uint32_t& _u32SL) {
+	_u32FL = 63U - std::countl_zero(_u64Size);
+	_u32SL = static_cast<uint32_t>(_u64Size >> (_u32FL - HC_TLSF_SL_BITS)) ^ HC_TLSF_SL_COUNT;
+}
+
+uint32_t TLSFAllocator::CreateNode(uint64_t _u64Offset, uint64_t _u64Size) {
+	uint32_t u32Node;
+
+	if (!m_vSpareNodes.empty()) {
+		u32Node = m_vSpareNodes.back();
+		m_vSpareNodes.pop_back();
+	}
+	else {
+		u32Node = static_cast<uint32_t>(m_vNodes.size());
+		m_vNodes.emplace_back();
+	}
+
+	m_vNodes[u32Node] = {
+		.m_u64Offset = _u64Offset,
+		.m_u64Size = _u64Size
+	};
+
+	return u32Node;
+}
+
+void TLSFAllocator::ReleaseNode(uint32_t _u32Node) {
+	m_vNodes[_u32Node] = {};
+	m_vSpareNodes.push_back(_u32Node);
+}
+
+void TLSFAllocator::InsertFree(uint32_t _u32Node) {
+	uint32_t u32FL, u32SL;
+	MapSize(m_vNodes[_u32Node].m_u64Size, u32FL, u32SL);
+
+	uint32_t& u32Head = m_arrFreeHeads[u32FL * HC_TLSF_SL_COUNT + u32SL];
+
+	m_vNodes[_u32Node].m_bFree = true;
+	m_vNodes[_u32Node].m_u32PrevFree = HC_TLSF_INVALID_NODE;
+	m_vNodes[_u32Node].m_u32NextFree = u32Head;
+
+	if (u32Head != HC_TLSF_INVALID_NODE) { m_vNodes[u32Head].m_u32PrevFree = _u32Node; }
+
+	u32Head = _u32Node;
+
+	m_u64FLBitmap |= 1ULL << u32FL;
+	m_arrSLBitmaps[u32FL] |= 1U << u32SL;
+}
+
+void TLSFAllocator::RemoveFree(uint32_t _u32Node) {
+	uint32_t u32FL, u32SL;
+	MapSize(m_vNodes[_u32Node].m_u64Size, u32FL, u32SL);
+
+	TLSFNode& nNode = m_vNodes[_u32Node];
+
+	if (nNode.m_u32PrevFree != HC_TLSF_INVALID_NODE) { m_vNodes[nNode.m_u32PrevFree].m_u32NextFree = nNode.m_u32NextFree; }
+	else { m_arrFreeHeads[u32FL * HC_TLSF_SL_COUNT + u32SL] = nNode.m_u32NextFree; }
+
+	if (nNode.m_u32NextFree != HC_TLSF_INVALID_NODE) { m_vNodes[nNode.m_u32NextFree].m_u32PrevFree = nNode.m_u32PrevFree; }
+
+	nNode.m_bFree = false;
+	nNode.m_u32PrevFree = HC_TLSF_INVALID_NODE;
+	nNode.m_u32NextFree = HC_TLSF_INVALID_NODE;
+
+	if (m_arrFreeHeads[u32FL * HC_TLSF_SL_COUNT + u32SL] == HC_TLSF_INVALID_NODE) {
+		m_arrSLBitmaps[u32FL] &= ~(1U << u32SL);
+
+		if (m_arrSLBitmaps[u32FL] == 0) { m_u64FLBitmap &= ~(1ULL << u32FL); }
+	}
+}
+
+uint32_t TLSFAllocator::FindFree(uint64_t _u64Size) const {
+	//Round the request up to the next size class, so any node found in that class or above is guaranteed to fit
+	const uint64_t u64Rounded = _u64Size + (1ULL << ((63U - std::countl_zero(_u64Size)) - HC_TLSF_SL_BITS)) - 1;
+	uint32_t u32FL, u32SL;
+	MapSize(u64Rounded, u32FL, u32SL);
+
+	uint32_t u32SLMap = m_arrSLBitmaps[u32FL] & (~0U << u32SL);
+
+	if (u32SLMap == 0) {
+		const uint64_t u64FLMap = u32FL + 1 < HC_TLSF_FL_COUNT ? m_u64FLBitmap & (~0ULL << (u32FL + 1)) : 0;
+
+		if (u64FLMap == 0) {
+			return HC_TLSF_INVALID_NODE;
+		}
+
+		u32FL = std::countr_zero(u64FLMap);
+		u32SLMap = m_arrSLBitmaps[u32FL];
+	}
+
+	return m_arrFreeHeads[u32FL * HC_TLSF_SL_COUNT + std::countr_zero(u32SLMap)];
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <HellfireControl/Core/Common.hpp>
+
+#define HC_TLSF_MIN_ALIGNMENT 64ULL	//Every range starts and ends on this boundary, so no two allocations ever share a cache line
+#define HC_TLSF_SL_BITS 4			//Each power of two size class is split into 1 << HC_TLSF_SL_BITS linear sub classes
+#define HC_TLSF_FL_COUNT 64
+#define HC_TLSF_SL_COUNT (1U << HC_TLSF_SL_BITS)
+#define HC_TLSF_INVALID_NODE UINT32_MAX
+
+/// <summary>
+/// Two level segregated fit allocator for ranges of a single block of memory. It only manages offsets and never touches the memory itself.
+/// Allocation and free are O(1): a free range is found through two bitmap scans, and freed ranges merge with their free neighbours immediately.
+/// </summary>
+class TLSFAllocator {
+private:
+	struct TLSFNode {
+		uint64_t m_u64Offset = 0;
+		uint64_t m_u64Size = 0;
+
+		uint32_t m_u32PrevPhysical = HC_TLSF_INVALID_NODE; //Neighbouring ranges in address order
+		uint32_t m_u32NextPhysical = HC_TLSF_INVALID_NODE;
+
+		uint32_t m_u32PrevFree = HC_TLSF_INVALID_NODE; //Neighbours in the free list of this node's size class
+		uint32_t m_u32NextFree = HC_TLSF_INVALID_NODE;
+
+		bool m_bFree = false;
+	};
+
+	std::vector<TLSFNode> m_vNodes;
+	std::vector<uint32_t> m_vSpareNodes;
+
+	uint64_t m_u64FLBitmap = 0;
+	std::array<uint32_t, HC_TLSF_FL_COUNT> m_arrSLBitmaps = {};
+	std::array<uint32_t, HC_TLSF_FL_COUNT * HC_TLSF_SL_COUNT> m_arrFreeHeads = {};
+
+	uint64_t m_u64Size = 0;
+	uint64_t m_u64Used = 0;
+	uint32_t m_u32AllocationCount = 0;
+
+	static void MapSize(uint64_t _u64Size, uint32_t& _u32FL, uint32_t& _u32SL);
+
+	uint32_t CreateNode(uint64_t _u64Offset, uint64_t _u64Size);
+
+	void ReleaseNode(uint32_t _u32Node);
+
+	void InsertFree(uint32_t _u32Node);
+
+	void RemoveFree(uint32_t _u32Node);
+
+	uint32_t FindFree(uint64_t _u64Size) const;
+public:
+	TLSFAllocator() = default;
+
+	/// <summary>
+	/// Creates an allocator managing the range [0, _u64Size). The size is rounded down to HC_TLSF_MIN_ALIGNMENT.
+	/// </summary>
+	/// <param name="_u64Size: Size in bytes of the block being managed"></param>
+	explicit TLSFAllocator(uint64_t _u64Size);
+
+	/// <summary>
+	/// Reserves a range of at least _u64Size bytes whose offset is a multiple of _u64Alignment.
+	/// </summary>
+	/// <param name="_u64Size: Size in bytes of the range"></param>
+	/// <param name="_u64Alignment: Required alignment of the offset. Must be a power of two"></param>
+	/// <param name="_u64Offset: Receives the offset of the range on success"></param>
+	/// <returns>
+	/// uint32_t: The node owning the range, to be passed to Free, or HC_TLSF_INVALID_NODE if no free range is large enough.
+	/// </returns>
+	[[nodiscard]] uint32_t Allocate(uint64_t _u64Size, uint64_t _u64Alignment, uint64_t& _u64Offset);
+
+	/// <summary>
+	/// Returns a range from Allocate and merges it with any free ranges on either side.
+	/// </summary>
+	void Free(uint32_t _u32Node);
+
+	/// <summary>
+	/// Size in bytes of the largest range that Allocate could currently return with the minimum alignment.
+	/// </summary>
+	[[nodiscard]] uint64_t GetLargestFree() const;
+
+	/// <summary>
+	/// Fills _vNodes with every allocated node, in address order.
+	/// </summary>
+	void GetAllocatedNodes(std::vector<uint32_t>& _vNodes) const;
+
+	[[nodiscard]] HC_INLINE uint64_t GetOffset(uint32_t _u32Node) const { return m_vNodes[_u32Node].m_u64Offset; }
+
+	[[nodiscard]] HC_INLINE uint64_t GetNodeSize(uint32_t _u32Node) const { return m_vNodes[_u32Node].m_u64Size; }
+
+	[[nodiscard]] HC_INLINE uint64_t GetSize() const { return m_u64Size; }
+
+	[[nodiscard]] HC_INLINE uint64_t GetUsed() const { return m_u64Used; }
+
+	[[nodiscard]] HC_INLINE uint32_t GetAllocationCount() const { return m_u32AllocationCount; }
+
+	[[nodiscard]] HC_INLINE bool IsEmpty() const { return m_u32AllocationCount == 0; }
+};
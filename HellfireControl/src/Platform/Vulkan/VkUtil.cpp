@@ -34,52 +34,6 @@ namespace LayersAndExtensions {
 
 using namespace LayersAndExtensions;
 
-VkCommandBuffer VkUtil::BeginSingleTimeCommands() {
-	VkCommandBufferAllocateInfo cbaiBufferInfo = {
-		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
-		.pNext = nullptr,
-		.commandPool = PlatformRenderer::m_cpCommandPool,
-		.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
-		.commandBufferCount = 1
-	};
-
-	VkCommandBuffer cbBuffer;
-
-	vkAllocateCommandBuffers(PlatformRenderer::m_dDeviceHandle, &cbaiBufferInfo, &cbBuffer);
-
-	VkCommandBufferBeginInfo cbbiBeginInfo = {
-		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
-		.pNext = nullptr,
-		.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
-		.pInheritanceInfo = nullptr
-	};
-
-	vkBeginCommandBuffer(cbBuffer, &cbbiBeginInfo);
-
-	return cbBuffer;
-}
-
-void VkUtil::EndSingleTimeCommands(VkCommandBuffer _cbBuffer) {
-	vkEndCommandBuffer(_cbBuffer);
-
-	VkSubmitInfo siSubmitInfo = {
-		.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-		.pNext = nullptr,
-		.waitSemaphoreCount = 0,
-		.pWaitSemaphores = nullptr,
-		.pWaitDstStageMask = nullptr,
-		.commandBufferCount = 1,
-		.pCommandBuffers = &_cbBuffer,
-		.signalSemaphoreCount = 0,
-		.pSignalSemaphores = nullptr
-	};
-
-	vkQueueSubmit(PlatformRenderer::m_qGraphicsQueue, 1, &siSubmitInfo, VK_NULL_HANDLE);
-	vkQueueWaitIdle(PlatformRenderer::m_qGraphicsQueue);
-
-	vkFreeCommandBuffers(PlatformRenderer::m_dDeviceHandle, PlatformRenderer::m_cpCommandPool, 1, &_cbBuffer);
-}
-
 VkImageView VkUtil::CreateImageView(VkImage _iImage, VkFormat _fFormat, VkImageAspectFlags _iafFlags) {
 	VkImageViewCreateInfo ivciViewInfo = {
 		.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
@@ -112,7 +66,7 @@ VkImageView VkUtil::CreateImageView(VkImage _iImage, VkFormat _fFormat, VkImageA
 	return ivView;
 }
 
-void VkUtil::CreateImage(uint32_t _iWidth, uint32_t _iHeight, VkFormat _fFormat, VkImageTiling _itTiling, VkImageUsageFlags _iufFlags, VkMemoryPropertyFlags _mpfProperties, VkImage& _iImage, VkDeviceMemory& _dmImageMem) {
+void VkUtil::CreateImage(uint32_t _iWidth, uint32_t _iHeight, VkFormat _fFormat, VkImageTiling _itTiling, VkImageUsageFlags _iufFlags, VkMemoryPropertyFlags _mpfProperties, VkImage& _iImage, VkMemoryHandle& _mhImageMem) {
 	VkImageCreateInfo iciImageInfo = {
 		.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
 		.pNext = nullptr,
@@ -135,26 +89,10 @@ void VkUtil::CreateImage(uint32_t _iWidth, uint32_t _iHeight, VkFormat _fFormat,
 		throw std::runtime_error("ERROR: Failed to create image!");
 	}
 
-	VkMemoryRequirements mrRequirements;
-	vkGetImageMemoryRequirements(PlatformRenderer::m_dDeviceHandle, _iImage, &mrRequirements);
-
-	VkMemoryAllocateInfo maiAllocInfo = {
-		.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
-		.pNext = nullptr,
-		.allocationSize = mrRequirements.size,
-		.memoryTypeIndex = PlatformBuffer::FindMemoryType(mrRequirements.memoryTypeBits, _mpfProperties)
-	};
-
-	if (vkAllocateMemory(PlatformRenderer::m_dDeviceHandle, &maiAllocInfo, nullptr, &_dmImageMem) != VK_SUCCESS) {
-		throw std::runtime_error("ERROR: Failed to allocate iamge memory!");
-	}
-
-	vkBindImageMemory(PlatformRenderer::m_dDeviceHandle, _iImage, _dmImageMem, 0);
+	_mhImageMem = PlatformMemory::AllocateForImage(_iImage, _mpfProperties);
 }
 
-void VkUtil::TransitionImageLayout(VkImage _iImage, VkFormat _fFormat, VkImageLayout _ilLayoutOld, VkImageLayout _ilLayoutNew) {
-	VkCommandBuffer cbBuffer = BeginSingleTimeCommands();
-
+void VkUtil::TransitionImageLayout(VkCommandBuffer _cbBuffer, VkImage _iImage, VkFormat _fFormat, VkImageLayout _ilLayoutOld, VkImageLayout _ilLayoutNew) {
 	VkImageMemoryBarrier imbBarrier = {
 		.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
 		.pNext = nullptr,
@@ -210,16 +148,12 @@ void VkUtil::TransitionImageLayout(VkImage _iImage, VkFormat _fFormat, VkImageLa
 		throw std::runtime_error("ERROR: Unsupported layout transition attempted!");
 	}
 
-	vkCmdPipelineBarrier(cbBuffer, psfSrcFlags, psfDestFlags, 0, 0, nullptr, 0, nullptr, 1, &imbBarrier);
-
-	EndSingleTimeCommands(cbBuffer);
+	vkCmdPipelineBarrier(_cbBuffer, psfSrcFlags, psfDestFlags, 0, 0, nullptr, 0, nullptr, 1, &imbBarrier);
 }
 
-void VkUtil::CopyBufferToImage(VkBuffer _bBuffer, VkImage _iImage, uint32_t _u32Width, uint32_t _u32Height) {
-	VkCommandBuffer cbBuffer = BeginSingleTimeCommands();
-
+void VkUtil::CopyBufferToImage(VkCommandBuffer _cbBuffer, VkBuffer _bBuffer, VkDeviceSize _dsBufferOffset, VkImage _iImage, uint32_t _u32Width, uint32_t _u32FirstRow, uint32_t _u32RowCount) {
 	VkBufferImageCopy bicImageCopy = {
-		.bufferOffset = 0,
+		.bufferOffset = _dsBufferOffset,
 		.bufferRowLength = 0,
 		.bufferImageHeight = 0,
 		.imageSubresource = {
@@ -230,19 +164,98 @@ void VkUtil::CopyBufferToImage(VkBuffer _bBuffer, VkImage _iImage, uint32_t _u32
 		},
 		.imageOffset = {
 			.x = 0,
-			.y = 0,
+			.y = static_cast<int32_t>(_u32FirstRow),
 			.z = 0
 		},
 		.imageExtent = {
 			.width = _u32Width,
-			.height = _u32Height,
+			.height = _u32RowCount,
 			.depth = 1
 		}
 	};
 
-	vkCmdCopyBufferToImage(cbBuffer, _bBuffer, _iImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &bicImageCopy);
+	vkCmdCopyBufferToImage(_cbBuffer, _bBuffer, _iImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &bicImageCopy);
+}
 
-	EndSingleTimeCommands(cbBuffer);
+void VkUtil::ReleaseBuffer(VkCommandBuffer _cbBuffer, VkBuffer _bBuffer, VkDeviceSize _dsOffset, VkDeviceSize _dsSize, uint32_t _u32SrcFamily, uint32_t _u32DstFamily, VkPipelineStageFlags _psfSrcStage, VkAccessFlags _afSrcAccess) {
+	//The release half of an ownership transfer. Its destination scope is ignored, the matching acquire on the other family provides it
+	VkBufferMemoryBarrier bmbBarrier = {
+		.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+		.pNext = nullptr,
+		.srcAccessMask = _afSrcAccess,
+		.dstAccessMask = 0,
+		.srcQueueFamilyIndex = _u32SrcFamily,
+		.dstQueueFamilyIndex = _u32DstFamily,
+		.buffer = _bBuffer,
+		.offset = _dsOffset,
+		.size = _dsSize
+	};
+
+	vkCmdPipelineBarrier(_cbBuffer, _psfSrcStage, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 1, &bmbBarrier, 0, nullptr);
+}
+
+void VkUtil::AcquireBuffer(VkCommandBuffer _cbBuffer, VkBuffer _bBuffer, VkDeviceSize _dsOffset, VkDeviceSize _dsSize, uint32_t _u32SrcFamily, uint32_t _u32DstFamily, VkPipelineStageFlags _psfDstStage, VkAccessFlags _afDstAccess) {
+	//Has to match the release exactly. The semaphore the submission waits on orders it after the release
+	VkBufferMemoryBarrier bmbBarrier = {
+		.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+		.pNext = nullptr,
+		.srcAccessMask = 0,
+		.dstAccessMask = _afDstAccess,
+		.srcQueueFamilyIndex = _u32SrcFamily,
+		.dstQueueFamilyIndex = _u32DstFamily,
+		.buffer = _bBuffer,
+		.offset = _dsOffset,
+		.size = _dsSize
+	};
+
+	vkCmdPipelineBarrier(_cbBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, _psfDstStage, 0, 0, nullptr, 1, &bmbBarrier, 0, nullptr);
+}
+
+void VkUtil::ReleaseImage(VkCommandBuffer _cbBuffer, VkImage _iImage, VkFormat _fFormat, VkImageLayout _ilLayoutOld, VkImageLayout _ilLayoutNew, uint32_t _u32SrcFamily, uint32_t _u32DstFamily, VkPipelineStageFlags _psfSrcStage, VkAccessFlags _afSrcAccess) {
+	//A layout change given here is performed once, between the release and the acquire. Ownership moves for every mip level and layer
+	VkImageMemoryBarrier imbBarrier = {
+		.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+		.pNext = nullptr,
+		.srcAccessMask = _afSrcAccess,
+		.dstAccessMask = 0,
+		.oldLayout = _ilLayoutOld,
+		.newLayout = _ilLayoutNew,
+		.srcQueueFamilyIndex = _u32SrcFamily,
+		.dstQueueFamilyIndex = _u32DstFamily,
+		.image = _iImage,
+		.subresourceRange = {
+			.aspectMask = VkUtil::GetImageAspect(_fFormat),
+			.baseMipLevel = 0,
+			.levelCount = VK_REMAINING_MIP_LEVELS,
+			.baseArrayLayer = 0,
+			.layerCount = VK_REMAINING_ARRAY_LAYERS
+		}
+	};
+
+	vkCmdPipelineBarrier(_cbBuffer, _psfSrcStage, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &imbBarrier);
+}
+
+void VkUtil::AcquireImage(VkCommandBuffer _cbBuffer, VkImage _iImage, VkFormat _fFormat, VkImageLayout _ilLayoutOld, VkImageLayout _ilLayoutNew, uint32_t _u32SrcFamily, uint32_t _u32DstFamily, VkPipelineStageFlags _psfDstStage, VkAccessFlags _afDstAccess) {
+	VkImageMemoryBarrier imbBarrier = {
+		.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+		.pNext = nullptr,
+		.srcAccessMask = 0,
+		.dstAccessMask = _afDstAccess,
+		.oldLayout = _ilLayoutOld,
+		.newLayout = _ilLayoutNew,
+		.srcQueueFamilyIndex = _u32SrcFamily,
+		.dstQueueFamilyIndex = _u32DstFamily,
+		.image = _iImage,
+		.subresourceRange = {
+			.aspectMask = VkUtil::GetImageAspect(_fFormat),
+			.baseMipLevel = 0,
+			.levelCount = VK_REMAINING_MIP_LEVELS,
+			.baseArrayLayer = 0,
+			.layerCount = VK_REMAINING_ARRAY_LAYERS
+		}
+	};
+
+	vkCmdPipelineBarrier(_cbBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, _psfDstStage, 0, 0, nullptr, 0, nullptr, 1, &imbBarrier);
 }
 
 VkFormat VkUtil::FindSupportedFormat(const std::vector<VkFormat>& _vCandidates, VkImageTiling _itTiling, VkFormatFeatureFlags _fffFeatures) {
@@ -268,6 +281,23 @@ bool VkUtil::HasStencilComponent(VkFormat _fFormat) {
 	return _fFormat == VK_FORMAT_D32_SFLOAT_S8_UINT || _fFormat == VK_FORMAT_D24_UNORM_S8_UINT;
 }
 
+VkImageAspectFlags VkUtil::GetImageAspect(VkFormat _fFormat) {
+	switch (_fFormat) {
+	case VK_FORMAT_D16_UNORM:
+	case VK_FORMAT_X8_D24_UNORM_PACK32:
+	case VK_FORMAT_D32_SFLOAT:
+		return VK_IMAGE_ASPECT_DEPTH_BIT;
+	case VK_FORMAT_D16_UNORM_S8_UINT:
+	case VK_FORMAT_D24_UNORM_S8_UINT:
+	case VK_FORMAT_D32_SFLOAT_S8_UINT:
+		return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+	case VK_FORMAT_S8_UINT:
+		return VK_IMAGE_ASPECT_STENCIL_BIT;
+	default:
+		return VK_IMAGE_ASPECT_COLOR_BIT;
+	}
+}
+
 void VkUtil::ValidateSupportedLayers() {
 	uint32_t u32LayerCount = 0;
 	vkEnumerateInstanceLayerProperties(&u32LayerCount, nullptr);
@@ -314,6 +344,16 @@ bool VkUtil::CheckDeviceSuitability(VkPhysicalDevice _pdDevice) {
 	VkPhysicalDeviceFeatures pdfFeatures = {};
 	vkGetPhysicalDeviceFeatures(_pdDevice, &pdfFeatures);
 
+	//Every submission is tracked on a timeline semaphore
+	VkPhysicalDeviceVulkan12Features pdv12Features = {};
+	pdv12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+
+	VkPhysicalDeviceFeatures2 pdf2Features = {};
+	pdf2Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+	pdf2Features.pNext = &pdv12Features;
+
+	vkGetPhysicalDeviceFeatures2(_pdDevice, &pdf2Features);
+
 	VkQueueFamilyIndices qfiIndices = GetQueueFamilies(_pdDevice);
 
 	bool bExtensionsSupported = ValidateSupportedDeviceExtensions(_pdDevice);
@@ -326,7 +366,7 @@ bool VkUtil::CheckDeviceSuitability(VkPhysicalDevice _pdDevice) {
 	}
 
 	return pdpProperties.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU && qfiIndices.IsComplete()
-		&& bExtensionsSupported && bSwapChainAdequate && pdfFeatures.samplerAnisotropy;
+		&& bExtensionsSupported && bSwapChainAdequate && pdfFeatures.samplerAnisotropy && pdv12Features.timelineSemaphore;
 }
 
 VkQueueFamilyIndices VkUtil::GetQueueFamilies(VkPhysicalDevice _pdDevice) {
@@ -338,23 +378,28 @@ VkQueueFamilyIndices VkUtil::GetQueueFamilies(VkPhysicalDevice _pdDevice) {
 	std::vector<VkQueueFamilyProperties> vFamilies(u32FamilyCount);
 	vkGetPhysicalDeviceQueueFamilyProperties(_pdDevice, &u32FamilyCount, vFamilies.data());
 
-	int iFamilyNumber = 0;
-	VkBool32 bPresentSupport = false;
-	for (const auto& aFamily : vFamilies) {
-		if (aFamily.queueFlags & VK_QUEUE_GRAPHICS_BIT) {
-			qfiIndices.m_u32GraphicsFamily = iFamilyNumber;
+	for (uint32_t ndx = 0; ndx < u32FamilyCount; ++ndx) {
+		const VkQueueFlags qfFlags = vFamilies[ndx].queueFlags;
+
+		VkBool32 bPresentSupport = false;
+		vkGetPhysicalDeviceSurfaceSupportKHR(_pdDevice, ndx, PlatformRenderer::m_sSurface, &bPresentSupport);
+
+		if ((qfFlags & VK_QUEUE_GRAPHICS_BIT) && !qfiIndices.m_u32GraphicsFamily.has_value()) {
+			qfiIndices.m_u32GraphicsFamily = ndx;
 		}
 
-		vkGetPhysicalDeviceSurfaceSupportKHR(_pdDevice, iFamilyNumber, PlatformRenderer::m_sSurface, &bPresentSupport);
-		if (bPresentSupport) {
-			qfiIndices.m_u32PresentFamily = iFamilyNumber;
+		//Presenting from the graphics family saves an ownership transfer of every swapchain image
+		if (bPresentSupport && (!qfiIndices.m_u32PresentFamily.has_value() || ndx == qfiIndices.m_u32GraphicsFamily)) {
+			qfiIndices.m_u32PresentFamily = ndx;
 		}
 
-		if (qfiIndices.IsComplete()) {
-			break;
+		if ((qfFlags & VK_QUEUE_TRANSFER_BIT) && !(qfFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) && !qfiIndices.m_u32TransferFamily.has_value()) {
+			qfiIndices.m_u32TransferFamily = ndx;
 		}
 
-		++iFamilyNumber;
+		if ((qfFlags & VK_QUEUE_COMPUTE_BIT) && !(qfFlags & VK_QUEUE_GRAPHICS_BIT) && !qfiIndices.m_u32ComputeFamily.has_value()) {
+			qfiIndices.m_u32ComputeFamily = ndx;
+		}
 	}
 
 	return qfiIndices;
@@ -2,6 +2,8 @@
 
 #include <Platform/GLCommon.hpp>
 
+#include <Platform/Vulkan/VkMemory.hpp>
+
 struct VertexSimple {
 	Vec3F m_v2Position;
 	Vec3F m_v3Color;
@@ -51,6 +53,8 @@ struct VkVertexData {
 struct VkQueueFamilyIndices {
 	std::optional<uint32_t> m_u32GraphicsFamily;
 	std::optional<uint32_t> m_u32PresentFamily;
+	std::optional<uint32_t> m_u32TransferFamily;	//Only set for a family without graphics or compute, which usually maps to the DMA engines
+	std::optional<uint32_t> m_u32ComputeFamily;	//Only set for a family without graphics, so compute can overlap the graphics queue
 
 	HC_INLINE bool IsComplete() const {
 		return m_u32GraphicsFamily.has_value() && m_u32PresentFamily.has_value();
@@ -65,15 +69,18 @@ struct VkSwapChainSupportDetails {
 
 class VkUtil {
 public:
-	static VkCommandBuffer BeginSingleTimeCommands();
-	static void EndSingleTimeCommands(VkCommandBuffer _cbBuffer);
 	static VkImageView CreateImageView(VkImage _iImage, VkFormat _fFormat, VkImageAspectFlags _iafFlags);
-	static void CreateImage(uint32_t _u32Width, uint32_t _u32Height, VkFormat _fFormat, VkImageTiling _itTiling, VkImageUsageFlags _iufUsage, VkMemoryPropertyFlags _mpfProperties, VkImage& _iImage, VkDeviceMemory& _dmMem);
-	static void TransitionImageLayout(VkImage _iImage, VkFormat _fFormat, VkImageLayout _ilLayoutOld, VkImageLayout _ilLayoutNew);
-	static void CopyBufferToImage(VkBuffer _bBuffer, VkImage _iImage, uint32_t _u32Width, uint32_t _u32Height);
+	static void CreateImage(uint32_t _u32Width, uint32_t _u32Height, VkFormat _fFormat, VkImageTiling _itTiling, VkImageUsageFlags _iufUsage, VkMemoryPropertyFlags _mpfProperties, VkImage& _iImage, VkMemoryHandle& _mhMem);
+	static void TransitionImageLayout(VkCommandBuffer _cbBuffer, VkImage _iImage, VkFormat _fFormat, VkImageLayout _ilLayoutOld, VkImageLayout _ilLayoutNew);
+	static void CopyBufferToImage(VkCommandBuffer _cbBuffer, VkBuffer _bBuffer, VkDeviceSize _dsBufferOffset, VkImage _iImage, uint32_t _u32Width, uint32_t _u32FirstRow, uint32_t _u32RowCount);
+	static void ReleaseBuffer(VkCommandBuffer _cbBuffer, VkBuffer _bBuffer, VkDeviceSize _dsOffset, VkDeviceSize _dsSize, uint32_t _u32SrcFamily, uint32_t _u32DstFamily, VkPipelineStageFlags _psfSrcStage, VkAccessFlags _afSrcAccess);
+	static void AcquireBuffer(VkCommandBuffer _cbBuffer, VkBuffer _bBuffer, VkDeviceSize _dsOffset, VkDeviceSize _dsSize, uint32_t _u32SrcFamily, uint32_t _u32DstFamily, VkPipelineStageFlags _psfDstStage, VkAccessFlags _afDstAccess);
+	static void ReleaseImage(VkCommandBuffer _cbBuffer, VkImage _iImage, VkFormat _fFormat, VkImageLayout _ilLayoutOld, VkImageLayout _ilLayoutNew, uint32_t _u32SrcFamily, uint32_t _u32DstFamily, VkPipelineStageFlags _psfSrcStage, VkAccessFlags _afSrcAccess);
+	static void AcquireImage(VkCommandBuffer _cbBuffer, VkImage _iImage, VkFormat _fFormat, VkImageLayout _ilLayoutOld, VkImageLayout _ilLayoutNew, uint32_t _u32SrcFamily, uint32_t _u32DstFamily, VkPipelineStageFlags _psfDstStage, VkAccessFlags _afDstAccess);
 	static VkFormat FindSupportedFormat(const std::vector<VkFormat>& _vCandidates, VkImageTiling _itTiling, VkFormatFeatureFlags _fffFeatures);
 	static VkFormat FindDepthFormat();
 	static bool HasStencilComponent(VkFormat _fFormat);
+	static VkImageAspectFlags GetImageAspect(VkFormat _fFormat);
 	static void ValidateSupportedLayers();
 	static bool ValidateSupportedDeviceExtensions(VkPhysicalDevice _pdDevice);
 	static bool CheckDeviceSuitability(VkPhysicalDevice _pdDevice);
@@ -31,6 +31,9 @@ void UICreationToolApplication::Start() {
 
 	Buffer vertexBuffer(BufferType::VERTEX_BUFFER, vVertices.data(), sizeof(VertexSimple), vVertices.size(), m_prsRenderer->GetRenderContextID(CONTEXT_TYPE_3D));
 	Buffer indexBuffer(BufferType::INDEX_BUFFER, vIndices.data(), sizeof(uint16_t), vIndices.size(), m_prsRenderer->GetRenderContextID(CONTEXT_TYPE_3D));
+
+	//The quads spin about z, so the box covers every angle they can reach rather than following them frame to frame.
+	m_prsRenderer->SetDrawBounds(m_prsRenderer->GetRenderContextID(CONTEXT_TYPE_3D), 0, AABBF(Vec3F(-0.71f, -0.71f, -0.25f), Vec3F(0.71f, 0.71f, 0.25f)));
 }
 
 void UICreationToolApplication::Run() {
@@ -66,9 +69,11 @@ void UICreationToolApplication::UpdateUniformBuffer(const BufferHandleGeneric& _
 
 	UniformBufferData ubdData = {
 		.m_mModel = RotateZGlobalDeg(fTime * HC_DEG2RAD(90.0f) * 15.0f, IdentityF()),
-		.m_mView = Inverse(LookAtLH(Vec3F(1.0f, 1.0f, 1.0f), Vec3F(0.0f, 0.0f, 0.0f), Vec3F(0.0f, 0.0f, 1.0f))),
+		.m_mView = InverseRigid(LookAtLH(Vec3F(1.0f, 1.0f, 1.0f), Vec3F(0.0f, 0.0f, 0.0f), Vec3F(0.0f, 0.0f, 1.0f))),
 		.m_mProj = ProjectionF(v2RenderableArea.x / v2RenderableArea.y, HC_DEG2RAD(45.0f), 0.1f, 10.0f)
 	};
 
 	Buffer(_bhgHandle).Update(&ubdData, sizeof(UniformBufferData), 1);
+
+	m_prsRenderer->SetViewProjection(ubdData.m_mView * ubdData.m_mProj);
 }
\ No newline at end of file